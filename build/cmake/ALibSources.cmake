@@ -74,6 +74,7 @@ list( APPEND ALIB_INL   lang/tmp.inl                   )
 # alib::time
 list( APPEND ALIB_H     ALib.Time.H                    )
 list( APPEND ALIB_MPP   time/time.mpp                  )
+list( APPEND ALIB_HPP   time/time.prepro.hpp           )
 list( APPEND ALIB_INL   time/datetime.inl              )
 list( APPEND ALIB_CPP   time/datetime.cpp              )
 list( APPEND ALIB_INL   time/stopwatch.inl             )
@@ -81,6 +82,8 @@ list( APPEND ALIB_INL   time/tickconverter.inl         )
 list( APPEND ALIB_CPP   time/tickconverter.cpp         )
 list( APPEND ALIB_INL   time/ticks.inl                 )
 list( APPEND ALIB_INL   time/timepointbase.inl         )
+list( APPEND ALIB_INL   time/tscclock.inl              )
+list( APPEND ALIB_CPP   time/tscclock.cpp              )
 list( APPEND ALIB_CPP   time/time.cpp                  )
 
 # alib::threads
@@ -112,6 +115,10 @@ list( APPEND ALIB_H     ALib.Characters.Functions.H    )
 list( APPEND ALIB_MPP   characters/functions.mpp       )
 list( APPEND ALIB_INL   characters/functions.inl       )
 list( APPEND ALIB_CPP   characters/functions.cpp       )
+list( APPEND ALIB_INL   characters/utf.inl             )
+list( APPEND ALIB_CPP   characters/utf.cpp             )
+list( APPEND ALIB_INL   characters/hash.inl            )
+list( APPEND ALIB_CPP   characters/hash.cpp            )
 list( APPEND ALIB_H     ALib.Compatibility.QTCharacters.H        )
 
 list( APPEND ALIB_H     ALib.EnumOps.H                            )
@@ -188,11 +195,20 @@ if( "BITBUFFER" IN_LIST ALibBuild )
     list( APPEND ALIB_INL   bitbuffer/bitbuffer.inl                  )
     list( APPEND ALIB_INL   bitbuffer/ac_v1/acalgos.inl.inl          )
     list( APPEND ALIB_INL   bitbuffer/ac_v1/ac.inl                   )
+    list( APPEND ALIB_INL   bitbuffer/ac_v1/chunked.inl              )
     list( APPEND ALIB_INL   bitbuffer/ac_v1/huffman.inl              )
 
     list( APPEND ALIB_CPP   bitbuffer/bitbuffer.cpp                  )
     list( APPEND ALIB_CPP   bitbuffer/ac_v1/ac.cpp                   )
+    list( APPEND ALIB_CPP   bitbuffer/ac_v1/chunked.cpp              )
     list( APPEND ALIB_CPP   bitbuffer/ac_v1/huffman.cpp              )
+
+    if( "THREADMODEL" IN_LIST ALibBuild )
+      list( APPEND ALIB_H   ALib.BitBuffer.Parallel.H                )
+      list( APPEND ALIB_MPP bitbuffer/parallel/parallel.mpp          )
+      list( APPEND ALIB_INL bitbuffer/parallel/chunkedparallel.inl   )
+      list( APPEND ALIB_INL bitbuffer/parallel/compressparallel.inl  )
+    endif()
 endif()
 
 if( "BOXING" IN_LIST ALibBuild )
@@ -269,6 +285,7 @@ if( "VARIABLES" IN_LIST ALibBuild )
     list( APPEND ALIB_INL  variables/vmeta.inl                 )
     list( APPEND ALIB_INL  variables/declaration.inl           )
     list( APPEND ALIB_INL  variables/configuration.inl         )
+    list( APPEND ALIB_INL  variables/variablehandle.inl        )
     list( APPEND ALIB_CPP  variables/configuration.cpp         )
     list( APPEND ALIB_CPP  variables/vmeta.cpp                 )
     list( APPEND ALIB_CPP  variables/variable.cpp              )
@@ -342,6 +359,8 @@ if( "ENUMRECORDS" IN_LIST ALibBuild )
     list( APPEND ALIB_HPP   enumrecords/enumrecords.prepro.hpp            )
     list( APPEND ALIB_INL   enumrecords/detail/enumrecordmap.inl          )
     list( APPEND ALIB_INL   enumrecords/records.inl                       )
+    list( APPEND ALIB_INL   enumrecords/detail/recordtable.inl            )
+    list( APPEND ALIB_INL   enumrecords/detail/parseindex.inl             )
     list( APPEND ALIB_INL   enumrecords/serialization.inl                 )
     list( APPEND ALIB_INL   enumrecords/builtin.inl                       )
 
@@ -378,6 +397,7 @@ if( "EXPRESSIONS" IN_LIST ALibBuild )
     list( APPEND ALIB_INL  expressions/compilerplugin.inl          )
     list( APPEND ALIB_INL  expressions/expression.inl              )
     list( APPEND ALIB_INL  expressions/scope.inl                   )
+    list( APPEND ALIB_INL  expressions/scopepool.inl               )
     list( APPEND ALIB_INL  expressions/standardrepository.inl      )
 
     list( APPEND ALIB_INL  expressions/detail/ast_impl.inl         )
@@ -396,6 +416,7 @@ if( "EXPRESSIONS" IN_LIST ALibBuild )
     list( APPEND ALIB_CPP  expressions/expressionscamp.cpp         )
     list( APPEND ALIB_CPP  expressions/compiler.cpp                )
     list( APPEND ALIB_CPP  expressions/expression.cpp              )
+    list( APPEND ALIB_CPP  expressions/scopepool.cpp               )
     list( APPEND ALIB_CPP  expressions/standardrepository.cpp      )
 
     list( APPEND ALIB_CPP  expressions/parser.cpp           )
@@ -416,6 +437,12 @@ if( "EXPRESSIONS" IN_LIST ALibBuild )
     list( APPEND ALIB_INL  expressions/util/expressionformatter.inl )
     list( APPEND ALIB_CPP  expressions/util/expressionformatter.cpp )
 
+    if( "THREADMODEL" IN_LIST ALibBuild )
+      list( APPEND ALIB_H   ALib.Expressions.Parallel.H              )
+      list( APPEND ALIB_MPP expressions/parallel/parallel.mpp        )
+      list( APPEND ALIB_INL expressions/parallel/evaluateall.inl     )
+    endif()
+
  endif()
 
 if( "FORMAT" IN_LIST ALibBuild )
@@ -578,6 +605,7 @@ if( "RESOURCES" IN_LIST ALibBuild )
     list( APPEND ALIB_MPP  resources/resources.mpp                      )
     list( APPEND ALIB_HPP  resources/resources.prepro.hpp               )
     list( APPEND ALIB_INL  resources/resources.inl                      )
+    list( APPEND ALIB_INL  resources/statictable.inl                    )
     list( APPEND ALIB_INL  resources/detail/resourcemap.inl             )
     list( APPEND ALIB_INL  resources/localresourcepool.inl              )
 
@@ -615,12 +643,18 @@ endif()
 if( "THREADMODEL" IN_LIST ALibBuild )
     list( APPEND ALIB_H    ALib.ThreadModel.H                  )
     list( APPEND ALIB_MPP  threadmodel/threadmodel.mpp         )
+    list( APPEND ALIB_INL  threadmodel/coroutines.inl          )
     list( APPEND ALIB_INL  threadmodel/dedicatedworker.inl     )
+    list( APPEND ALIB_INL  threadmodel/future.inl              )
     list( APPEND ALIB_INL  threadmodel/jobs.inl                )
+    list( APPEND ALIB_INL  threadmodel/parallel.inl            )
     list( APPEND ALIB_INL  threadmodel/threadpool.inl          )
     list( APPEND ALIB_INL  threadmodel/trigger.inl             )
 
+    list( APPEND ALIB_CPP  threadmodel/coroutines.cpp          )
     list( APPEND ALIB_CPP  threadmodel/dedicatedworker.cpp     )
+    list( APPEND ALIB_CPP  threadmodel/future.cpp              )
+    list( APPEND ALIB_CPP  threadmodel/parallel.cpp            )
     list( APPEND ALIB_CPP  threadmodel/threadpool.cpp          )
     list( APPEND ALIB_CPP  threadmodel/trigger.cpp             )
 endif()
@@ -1354,6 +1354,42 @@ DOX_MARKER( [DOX_MONOMEM_RECYCLER] )
 }
 
 
+//--------------------------------------------------------------------------------------------------
+//--- HashTable with pre-calculated hash codes
+//--------------------------------------------------------------------------------------------------
+UT_METHOD(HashTableHashedKeys)
+{
+    UT_INIT()
+
+    static_assert(  containers::IsHashedKey<HashedString, String, std::hash<String>> );
+    static_assert( !containers::IsHashedKey<String      , String, std::hash<String>> );
+    static_assert( !containers::IsHashedKey<HashedString, String, alib::hash_string_ignore_case<character>> );
+
+    MonoAllocator ma(ALIB_DBG("UTHashedKeys",) 1);
+    HashMap<MonoAllocator, String, int> map(ma);
+    map.EmplaceUnique( A_CHAR("one"  ), 1 );
+    map.EmplaceUnique( A_CHAR("two"  ), 2 );
+    map.EmplaceUnique( A_CHAR("three"), 3 );
+
+    HashedString two  ( A_CHAR("two")  );
+    HashedString four ( A_CHAR("four") );
+    UT_EQ( String(A_CHAR("two")).Hashcode(), two.Hashcode() )
+    UT_TRUE(  map.Contains( two  ) )
+    UT_FALSE( map.Contains( four ) )
+    UT_EQ( 2, map.Find( two  ).Mapped() )
+    UT_TRUE(  map.Find( four ) == map.end() )
+    const auto& constMap= map;
+    UT_EQ( 2, constMap.Find( two ).Mapped() )
+
+    // case-insensitive table
+    HashMap<MonoAllocator, String, int, alib::hash_string_ignore_case<character>,
+                                        alib::equal_to_string_ignore_case<character>> mapIC(ma);
+    mapIC.EmplaceUnique( A_CHAR("Hello"), 1 );
+    strings::THashedString<character, alib::hash_string_ignore_case<character>> hello( A_CHAR("HELLO") );
+    UT_TRUE( mapIC.Contains( hello ) )
+    UT_EQ( 1, mapIC.Find( hello ).Mapped() )
+}
+
 //--------------------------------------------------------------------------------------------------
 //--- HashTable
 //--------------------------------------------------------------------------------------------------
@@ -23,6 +23,8 @@
 
 #include <iostream>
 #include <fstream>
+#include <vector>
+#include <algorithm>
 
 using namespace std;
 using namespace alib;
@@ -47,6 +49,24 @@ struct ValueSorter : StringTreeIterator<AStringST>::Sorter
     }
 };
 
+// forwards to another sorter but does not provide sort keys
+struct KeylessSorter : StringTreeIterator<AStringST>::Sorter
+{
+    StringTreeIterator<AStringST>::Sorter* inner;
+
+    bool Compare (const AStringST::ConstCursor& lhs,
+                  const AStringST::ConstCursor& rhs) override {
+        return inner->Compare( lhs, rhs );
+    }
+};
+
+std::vector<uinteger> collectNodes( StringTreeIterator<AStringST>& stit, AStringST& tree ) {
+    std::vector<uinteger> result;
+    for( stit.Initialize( tree.Root(), lang::Inclusion::Exclude ) ; stit.IsValid() ; stit.Next() )
+        result.push_back( stit.Node().Export().value );
+    return result;
+}
+
 
 using MyTree= StringTree<MonoAllocator, const char*>;
 StringTreeIterator<MyTree> testIt;
@@ -728,6 +748,83 @@ UT_METHOD(StringTree_RecIter_Const)
     stit.NextParentSibling();                                   UT_FALSE(   stit.IsValid())
 }
 
+UT_METHOD(StringTreeIterator_SortCache)
+{
+    UT_INIT()
+
+    MonoAllocator ma(ALIB_DBG("UTSortCache",)8);
+    AStringST tree(ma, '/');
+
+    // names with mixed letter case, underscores, equal prefixes and non-ASCII characters
+    String64 name;
+    uint32_t random= 1;
+    for( int i= 0 ; i < 300 ; ++i ) {
+        random= random * 1664525u + 1013904223u;
+        name.Reset( (random & 1) ? A_CHAR("EqualPrefix16Chr") : A_CHAR("") );
+        name << ( (random & 2) ? 'x' : 'X' ) << ( (random & 4) ? '_' : 'y' );
+        if( (random & 0x18) == 0 )
+            name << character(0xC4);
+        // wide characters that towupper and towlower map to ASCII letters
+        if constexpr ( sizeof(character) > 1 )
+            if( (random & 0x18) == 8 )
+                name << character( (random & 0x20) ? 0x17F : 0x131 );
+        name << (random >> 16) << '-' << i;
+        auto child= tree.Root().CreateChild( name );
+        if( i % 10 == 0 ) {
+            child.CreateChild( A_CHAR("b") );
+            child.CreateChild( A_CHAR("A") );
+            child.CreateChild( A_CHAR("_") );
+    }   }
+
+    StringTreeIterator<AStringST>::NameSorter sorter;
+    KeylessSorter                             keyless;
+    keyless.inner= &sorter;
+    StringTreeIterator<AStringST>             refIt;
+    refIt.SetSorting( &keyless );
+
+    StringTreeIterator<AStringST>             stit;
+    StringTreeIterator<AStringST>::SortCache  cache;
+    stit.SetSorting  ( &sorter );
+    stit.SetSortCache( &cache  );
+
+    for( int mode= 0 ; mode < 4 ; ++mode ) {
+        sorter.Descending   = (mode & 1) != 0;
+        sorter.CaseSensitive= (mode & 2) != 0;
+        cache.Clear();
+
+        auto expected= collectNodes( refIt, tree );
+        UT_EQ( tree.Size(), integer( expected.size() ) )
+        UT_TRUE( collectNodes( stit, tree ) == expected )
+        UT_EQ( 31, cache.Size() )
+        UT_TRUE( collectNodes( stit, tree ) == expected )
+        stit.SetSortCache( nullptr );
+        UT_TRUE( collectNodes( stit, tree ) == expected )
+        stit.SetSortCache( &cache  );
+    }
+
+    // insertions and deletions invalidate the cache
+    uinteger stamp= tree.StructureStamp();
+    auto newNode= tree.Root().CreateChild( A_CHAR("a_new") );
+    newNode.CreateChild( A_CHAR("child") );
+    UT_TRUE( stamp != tree.StructureStamp() )
+    auto sorted= collectNodes( stit, tree );
+    UT_TRUE( sorted == collectNodes( refIt, tree ) )
+    UT_TRUE( std::find( sorted.begin(), sorted.end(), newNode.Export().value ) != sorted.end() )
+    UT_EQ( 32, cache.Size() )
+
+    stamp= tree.StructureStamp();
+    UT_TRUE( tree.Root().DeleteChild( A_CHAR("a_new") ) )
+    UT_TRUE( stamp != tree.StructureStamp() )
+    sorted= collectNodes( stit, tree );
+    UT_TRUE( sorted == collectNodes( refIt, tree ) )
+    UT_EQ( tree.Size(), integer( sorted.size() ) )
+    UT_EQ( 31, cache.Size() )
+
+    // iterations without sorting are not affected
+    stit.SetSorting( nullptr );
+    UT_EQ( tree.Size(), integer( collectNodes( stit, tree ).size() ) )
+}
+
 
 #include "aworx_unittests_end.hpp"
 
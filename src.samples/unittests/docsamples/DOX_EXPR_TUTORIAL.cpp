@@ -1712,14 +1712,14 @@ DOX_MARKER([DOX_EXPR_TUT_FF_Name3])
     for( auto& directoryEntry : fs::directory_iterator( sourceDir ) )
         if( filter62.Includes( directoryEntry ) )
             ++cnt;
-    UT_EQ(5, cnt)
+    UT_EQ(6, cnt)
 
     cnt= 0;
     step6::FileFilter filter63(A_CHAR("name * \"*.inl\""));
     for( auto& directoryEntry : fs::directory_iterator( sourceDir ) )
         if( filter63.Includes( directoryEntry ) )
             ++cnt;
-    UT_EQ(7, cnt)
+    UT_EQ(8, cnt)
 
     //---------------- samples after more  functionality was added ------------------
     cout << "--- Filter Expression {IsDirectory}: ---" << endl;
@@ -15,10 +15,12 @@
 #include "ALib.Exceptions.H"
 #include "ALib.Expressions.H"
 #include "ALib.Expressions.Impl.H"
+#include "ALib.Expressions.Parallel.H"
 #include "ALib.Format.H"
 #include "ALib.Camp.Base.H"
 
 #include <math.h>
+#include <algorithm>
 
 #define TESTCLASSNAME       UT_Expr
 #include "aworx_unittests.hpp"
@@ -81,6 +83,10 @@ class MyScope : public expressions::Scope
     : Scope(compiler.CfgFormatter)
     {}
 
+    MyScope(SPFormatter& formatter)
+    : Scope(formatter)
+    {}
+
     MyType   MyObject; // should be a pointer or reference in real life :-)
 };
 
@@ -165,6 +171,24 @@ class ETExceptionThrowers : public plugins::Calculus
     }
 };
 
+// compiles an identifier which is not listed in the tables of class Calculus
+class CustomIdentifier : public plugins::Calculus
+{
+    public:
+    CustomIdentifier( Compiler& compiler )
+    : Calculus( "CustomIdentifier", compiler, CompilePriorities::Custom )                         {}
+
+    using Calculus::TryCompilation;
+
+    bool TryCompilation( CIFunction& ciFunction )                                          override
+    {
+        if( !ciFunction.Name.Equals<NC, lang::Case::Ignore>( A_CHAR("TheAnswer") ) )
+            return Calculus::TryCompilation( ciFunction );
+        ciFunction.TypeOrValue= integer(42);
+        return true;
+    }
+};
+
 
 // #################################################################################################
 // ### MultiThreaded test
@@ -195,6 +219,44 @@ struct EvaluationThread : public threads::Thread
 ALIB_WARNINGS_RESTORE
 #endif
 
+#if ALIB_THREADMODEL
+class MyScopePool : public expressions::ScopePool
+{
+    public:
+    MyScopePool(Compiler& compiler)
+    : ScopePool(compiler.CfgFormatter)
+    {}
+
+    protected:
+    Scope* createScope()                                                                override
+    {
+        SPFormatter scopeFormatter= cloneFormatter();
+        return new MyScope(scopeFormatter);
+    }
+};
+
+// evaluates "age * 3 + <nested: age * 2>" for each input age with the given number of workers
+Ticks::Duration evaluateAll( Compiler& compiler, Expression& expr, int workers,
+                             std::vector<integer>& inputs, std::vector<integer>& results )
+{
+    MyScopePool scopes(compiler);
+    ThreadPool  pool;
+    pool.Strategy.Mode      = ThreadPool::ResizeStrategy::Modes::Fixed;
+    pool.Strategy.WorkersMax= workers;
+
+    Ticks start;
+    EvaluateAll( pool, scopes, expr, inputs.begin(), inputs.end(),
+                 [](Scope& scope, std::vector<integer>::iterator it)
+                 { dynamic_cast<MyScope&>(scope).MyObject.Age= *it; },
+                 [&](std::vector<integer>::iterator it, Box& result)
+                 { results[size_t(it - inputs.begin())]= result.Unbox<integer>(); }  );
+    auto duration= start.Age();
+    pool.WaitForAllIdle( 1min  ALIB_DBG(, 1s) );
+    pool.Shutdown();
+    return duration;
+}
+#endif
+
 } // anonymous namespace
 
 
@@ -258,6 +320,259 @@ UT_METHOD(ParseSpeed)
 
 }
 
+// #################################################################################################
+// ### PluginDispatchIndex
+// #################################################################################################
+UT_METHOD(PluginDispatchIndex)
+{
+    UT_INIT()
+
+    Compiler indexed;
+    indexed.SetupDefaults();
+    MyScope  scopeIndexed(indexed);
+
+    Compiler unindexed;
+    unindexed.CfgCompilation|= Compilation::NoPluginDispatchIndex;
+    unindexed.SetupDefaults();
+    MyScope  scopeUnindexed(unindexed);
+
+    const String expressions[]=
+    {
+        A_CHAR("1 + 2 * 3 - 4 / 2"),
+        A_CHAR("2.5 * 4 > 9 && !(1 = 2)"),
+        A_CHAR("not true or 5 >= 3 and 7 % 2 == 1"),
+        A_CHAR("~5 | 3 ^ 12 & 7"),
+        A_CHAR("\"Hello\" + 42 + true + -\"WORLD\""),
+        A_CHAR("toupper(\"Hello\") * \"HEL*\""),
+        A_CHAR("Int(3.7) + Float(2) + Bool(1)"),
+        A_CHAR("abs(-PI) + Min(1, 7) + Max(2.0, 4.0)"),
+        A_CHAR("Format(\"{}-{}\", 1, 2.5)"),
+        A_CHAR("(5 > 3 ? \"yes\" : \"no\") + (\"\" ?: \"elvis\")"),
+        A_CHAR("Length(\"abc\") + true + 1.5"),
+    };
+
+    // the index must not change compilation results
+    for( auto& expressionString : expressions ) {
+        Expression exprIndexed  =   indexed.Compile( expressionString );
+        Expression exprUnindexed= unindexed.Compile( expressionString );
+        UT_EQ( exprUnindexed->GetNormalizedString(), exprIndexed->GetNormalizedString() )
+        UT_EQ( exprUnindexed->GetOptimizedString() , exprIndexed->GetOptimizedString()  )
+        String256 resultIndexed;    resultIndexed   << exprIndexed  ->Evaluate( scopeIndexed   );
+        String256 resultUnindexed;  resultUnindexed << exprUnindexed->Evaluate( scopeUnindexed );
+        UT_EQ( resultUnindexed, resultIndexed )
+    }
+
+    // plug-ins derived from Calculus are offered all syntax elements, unless they opt in
+    {
+        Compiler compiler;
+        compiler.SetupDefaults();
+        CustomIdentifier customIdentifier( compiler );
+        compiler.InsertPlugin( &customIdentifier );
+        MyScope scope( compiler );
+        UT_EQ( 43, compiler.Compile( A_CHAR("theAnswer + 1") )->Evaluate( scope ).Unbox<integer>() )
+        compiler.RemovePlugin( &customIdentifier );
+    }
+
+    // unknown identifiers, functions and operators are reported just the same
+    for( auto* compiler : { &indexed, &unindexed } ) {
+        try { compiler->Compile( A_CHAR("5 + unknownIdentifier") ); UT_TRUE(false) }
+        catch( Exception& e ) { UT_TRUE( e.Type() == expressions::Exceptions::UnknownIdentifier ) }
+        try { compiler->Compile( A_CHAR("\"abc\" - 5") ); UT_TRUE(false) }
+        catch( Exception& e ) { UT_TRUE( e.Type() == expressions::Exceptions::BinaryOperatorNotDefined ) }
+    }
+
+    // speed comparison
+    int qtyCompilations= 50;
+    Ticks start= Ticks::Now();
+    for( int i= 0 ; i < qtyCompilations ; ++i )
+        for( auto& expressionString : expressions )
+            indexed.Compile( expressionString );
+    auto durationIndexed= start.Age();
+
+    start= Ticks::Now();
+    for( int i= 0 ; i < qtyCompilations ; ++i )
+        for( auto& expressionString : expressions )
+            unindexed.Compile( expressionString );
+    auto durationUnindexed= start.Age();
+
+    UT_PRINT( "Compiling {} expressions {} times: with dispatch index: {}, without: {}",
+              sizeof(expressions) / sizeof(String), qtyCompilations,
+              durationIndexed, durationUnindexed )
+}
+
+// #################################################################################################
+// ### NativeOperations
+// #################################################################################################
+UT_METHOD(NativeOperations)
+{
+    UT_INIT()
+
+    // optimizations are switched off, to keep the operators in the program
+    Compiler native;
+    native.CfgCompilation|= Compilation::NoOptimization;
+    native.SetupDefaults();
+    MyScope  scopeNative(native);
+
+    Compiler callbacks;
+    callbacks.CfgCompilation|= Compilation::NoOptimization | Compilation::NoNativeOperations;
+    callbacks.SetupDefaults();
+    MyScope  scopeCallbacks(callbacks);
+
+    const String expressions[]=
+    {
+        A_CHAR("1 + 2 * 3 - 4 / 2 + 17 % 5"),
+        A_CHAR("(6 & 3) + (6 | 3) + (6 ^ 3) + (1 << 4) + (256 >> 2) + ~7 + -(3)"),
+        A_CHAR("1.5 + 2.5 * 3.0 - 4.0 / 8.0 + -(0.5)"),
+        A_CHAR("1 < 2 && 2 <= 2 && 3 > 2 && 3 >= 3 && 4 == 4 && 4 != 5"),
+        A_CHAR("1.0 < 2.0 && 2.0 <= 2.0 && 3.0 > 2.0 && 3.0 >= 3.0 && 4.0 == 4.0 && 4.0 != 5.0"),
+        A_CHAR("(true || false) == !false && (true != false)"),
+        A_CHAR("5 > 3 ? 10 * 2 : 10 / 2"),
+        A_CHAR("5 < 3 ? 10 * 2 : 10 / 2"),
+        A_CHAR("2.0 * 3.0 > 5.0 ? \"big\" : \"small\""),
+        A_CHAR("3 + (1 < 2 ? 10 : 20)"),
+        A_CHAR("(1 > 2 ? 1 < 2 : 2 < 1) ? 100 : 200"),
+        A_CHAR("(1 + 2 > 2) == (5 * 2 < 11) ? (7 - 8 < 0 ? 1 : 2) : 3"),
+    };
+
+    for( auto& expressionString : expressions ) {
+        Expression exprNative   =    native.Compile( expressionString );
+        Expression exprCallbacks= callbacks.Compile( expressionString );
+        String256 resultNative;     resultNative    << exprNative   ->Evaluate( scopeNative    );
+        String256 resultCallbacks;  resultCallbacks << exprCallbacks->Evaluate( scopeCallbacks );
+        UT_PRINT( "{} = {}", expressionString, resultNative )
+        UT_EQ( resultCallbacks, resultNative )
+    }
+
+    // speed comparison
+    const String speedTestString= A_CHAR("(1 + 2 * 3 - 4 > 2 ? 1.5 * 2.0 + 3.0 : 2.5 / 2.0) < 6.0 && 17 % 5 == 2");
+    Expression exprNative   =    native.Compile( speedTestString );
+    Expression exprCallbacks= callbacks.Compile( speedTestString );
+    int qtyEvaluations= 100000;
+    Ticks start= Ticks::Now();
+    for( int i= 0 ; i < qtyEvaluations ; ++i )
+        exprNative->Evaluate( scopeNative );
+    auto durationNative= start.Age();
+
+    start= Ticks::Now();
+    for( int i= 0 ; i < qtyEvaluations ; ++i )
+        exprCallbacks->Evaluate( scopeCallbacks );
+    auto durationCallbacks= start.Age();
+
+    UT_PRINT( "Evaluating {} times: with native operations: {}, with callbacks: {}",
+              qtyEvaluations, durationNative, durationCallbacks )
+}
+
+// #################################################################################################
+// ### SerializePrograms
+// #################################################################################################
+UT_METHOD(SerializePrograms)
+{
+    UT_INIT()
+
+    Compiler compiler;
+    compiler.SetupDefaults();
+    MyFunctions myIdentifierPlugin(compiler);
+    compiler.InsertPlugin( &myIdentifierPlugin );
+    compiler.AddNamed( A_CHAR("nested"), A_CHAR("age * 2") );
+    MyScope  scope(compiler);
+
+    const String expressions[]=
+    {
+        A_CHAR("1 + 2 * age - 4 / 2 + 17 % 5"),
+        A_CHAR("age > 40 ? name + \"/\" + age : \"young\""),
+        A_CHAR("abs(-PI) + Min(age, 7) + Max(2.0, 4.0) * age"),
+        A_CHAR("toupper(name) * \"J*\" && WildcardMatch(name, \"*o*\")"),
+        A_CHAR("age ?: 5"),
+        A_CHAR("rawobject"),
+        A_CHAR("*nested + Expression(\"nested\" + (age < 0 ? \"x\" : \"\"), 0) + Length(name)"),
+    IF_ALIB_CAMP(
+        A_CHAR("GetYear(DateTime(2019,1,31,14,5) + Hours(age)) + InDays(Hours(48))"),  )
+    };
+
+    std::vector<uint8_t> blob;
+    Expression           compiled;
+    for( auto& expressionString : expressions ) {
+        compiled= compiler.Compile( expressionString );
+        String256  resultCompiled; resultCompiled  << compiled->Evaluate( scope );
+
+        blob.clear();
+        UT_TRUE( compiler.Serialize( compiled, blob ) )
+        bool       restored= false;
+        Expression loaded  = compiler.Deserialize( blob, &restored );
+        UT_TRUE( restored )
+        String256  resultLoaded;   resultLoaded    << loaded->Evaluate( scope );
+        UT_PRINT( "{} = {}  ({} bytes)", expressionString, resultLoaded, blob.size() )
+        UT_EQ( resultCompiled                  , resultLoaded                    )
+        UT_EQ( compiled->GetOriginalString()   , loaded->GetOriginalString()     )
+        UT_EQ( compiled->GetNormalizedString() , loaded->GetNormalizedString()   )
+        UT_EQ( compiled->GetOptimizedString()  , loaded->GetOptimizedString()    )
+        UT_EQ( compiled->GetProgramLength()    , loaded->GetProgramLength()      )
+        UT_TRUE( compiled->ResultType().IsSameType( loaded->ResultType() ) )
+    }
+
+    // constants of custom types are not serializable
+    {
+        Compiler customCompiler;
+        customCompiler.SetupDefaults();
+        MyFunctions customPlugin(customCompiler);
+        customPlugin.ConstantIdentifiers= { { {A_CHAR("joe"), lang::Case::Ignore, 3}, MyType() } };
+        customCompiler.InsertPlugin( &customPlugin );
+        compiled= customCompiler.Compile( A_CHAR("joe") );
+        blob.clear();
+        UT_FALSE( customCompiler.Serialize( compiled, blob ) )
+        UT_TRUE ( blob.empty() )
+        compiled= nullptr;
+    }
+
+    // a changed configuration leads to recompilation
+    compiled= compiler.Compile( expressions[1] );
+    blob.clear();
+    UT_TRUE( compiler.Serialize( compiled, blob ) )
+    compiler.CfgCompilation|= Compilation::NoNativeOperations;
+    bool       restored= true;
+    Expression loaded  = compiler.Deserialize( blob, &restored );
+    UT_FALSE( restored )
+    UT_EQ( compiled->GetNormalizedString(), loaded->GetNormalizedString() )
+    compiler.CfgCompilation-= Compilation::NoNativeOperations;
+
+    // a changed set of plug-ins leads to recompilation
+    compiler.RemovePlugin( &myIdentifierPlugin );
+    compiled= compiler.Compile( A_CHAR("3 * 4 + Length(\"abc\")") );
+    blob.clear();
+    UT_TRUE( compiler.Serialize( compiled, blob ) )
+    compiler.InsertPlugin( &myIdentifierPlugin );
+    loaded= compiler.Deserialize( blob, &restored );
+    UT_FALSE( restored )
+    UT_EQ( 15, loaded->Evaluate( scope ).Unbox<integer>() )
+
+    // corrupt blobs
+    blob.resize( blob.size() / 2 );
+    loaded= compiler.Deserialize( blob, &restored );
+    UT_FALSE( restored )
+    UT_EQ( 15, loaded->Evaluate( scope ).Unbox<integer>() )
+    blob.clear();
+    UT_TRUE( compiler.Deserialize( blob, &restored ) == nullptr )
+
+    // speed comparison
+    const String speedTestString= expressions[2];
+    compiled= compiler.Compile( speedTestString );
+    blob.clear();
+    compiler.Serialize( compiled, blob );
+    int qtyRepetitions= 2000;
+    Ticks start= Ticks::Now();
+    for( int i= 0 ; i < qtyRepetitions ; ++i )
+        compiler.Compile( speedTestString );
+    auto durationCompile= start.Age();
+
+    start= Ticks::Now();
+    for( int i= 0 ; i < qtyRepetitions ; ++i )
+        compiler.Deserialize( blob );
+    auto durationLoad= start.Age();
+
+    UT_PRINT( "Creating expression {} times: compiling: {}, loading: {}",
+              qtyRepetitions, durationCompile, durationLoad )
+}
+
 // #################################################################################################
 // ### ProgramListing
 // #################################################################################################
@@ -1889,6 +2204,119 @@ UT_METHOD(MultiThreaded)
 }
 #endif // !ALIB_SINGLE_THREADED
 
+// #################################################################################################
+// ### EvaluateAll
+// #################################################################################################
+#if ALIB_THREADMODEL
+UT_METHOD(EvaluateAll)
+{
+    UT_INIT()
+
+    Compiler compiler;
+    compiler.SetupDefaults();
+    MyFunctions myIdentifierPlugin(compiler);
+    compiler.InsertPlugin( &myIdentifierPlugin );
+    compiler.AddNamed( A_CHAR("twice"), A_CHAR("age * 2") );
+
+    // the nested expression is resolved at evaluation-time
+    Expression expr= compiler.Compile(
+            A_CHAR(R"(age * 3 + Expression("twice" + (random < 0 ? "Never" : ""), 0))") );
+
+    std::vector<integer> inputs;
+    for( integer i= 0 ; i < 10000 ; ++i )
+        inputs.push_back( i );
+    std::vector<integer> results( inputs.size(), -1 );
+
+    evaluateAll( compiler, expr, 4, inputs, results );
+    bool allCorrect= true;
+    for( size_t i= 0 ; i < inputs.size() ; ++i )
+        allCorrect&= ( results[i] == inputs[i] * 5 );
+    UT_TRUE( allCorrect )
+
+    // a scope pool is reusable and creates scopes only on demand
+    {
+        MyScopePool scopes(compiler);
+        {
+            ScopePool::Lease lease1(scopes);
+            ScopePool::Lease lease2(scopes);
+            UT_EQ( 2, scopes.Size() )
+
+            // each scope uses its own formatter
+            UT_TRUE( lease1->Formatter.Get() != lease2->Formatter.Get()     )
+            UT_TRUE( lease1->Formatter.Get() != compiler.CfgFormatter.Get() )
+        }
+        {
+            ScopePool::Lease lease(scopes);
+            dynamic_cast<MyScope&>(lease.Get()).MyObject.Age= 7;
+            UT_EQ( 35, expr->Evaluate( lease.Get() ).Unbox<integer>() )
+            UT_EQ( 2, scopes.Size() )
+        }
+        scopes.Clear();
+        UT_EQ( 0, scopes.Size() )
+    }
+
+    // formatting in parallel
+    {
+        Expression formatting= compiler.Compile( A_CHAR(R"(Format("{}-{}", age, age * 2))") );
+        MyScopePool scopes(compiler);
+        ThreadPool  pool;
+        pool.Strategy.Mode      = ThreadPool::ResizeStrategy::Modes::Fixed;
+        pool.Strategy.WorkersMax= 4;
+        std::vector<int> correct( inputs.size(), 0 );
+        EvaluateAll( pool, scopes, formatting, inputs.begin(), inputs.end(),
+                     [](Scope& scope, std::vector<integer>::iterator it)
+                     { dynamic_cast<MyScope&>(scope).MyObject.Age= *it; },
+                     [&](std::vector<integer>::iterator it, Box& result) {
+                         String64 expected;
+                         expected << *it << '-' << *it * 2;
+                         correct[size_t(it - inputs.begin())]= result.Unbox<String>()
+                                                                     .Equals( expected );
+                     }  );
+        pool.WaitForAllIdle( 1min  ALIB_DBG(, 1s) );
+        pool.Shutdown();
+        UT_TRUE( std::find( correct.begin(), correct.end(), 0 ) == correct.end() )
+    }
+
+    // exceptions are forwarded to the caller
+    Expression throwing= compiler.Compile(
+            A_CHAR(R"(Expression("undefined" + (random < 0 ? "Never" : ""), 0, throw))") );
+    MyScopePool scopes(compiler);
+    ThreadPool  pool;
+    bool caught= false;
+    try
+    {
+        EvaluateAll( pool, scopes, throwing, inputs.begin(), inputs.end(),
+                     [](Scope&, std::vector<integer>::iterator) {},
+                     [](std::vector<integer>::iterator, Box&)   {}   );
+    }
+    catch( Exception& e )
+    {
+        caught= true;
+        UT_TRUE( e.Type() == expressions::Exceptions::NestedExpressionNotFoundET )
+    }
+    UT_TRUE( caught )
+    pool.WaitForAllIdle( 1min  ALIB_DBG(, 1s) );
+    pool.Shutdown();
+
+    // scaling benchmark
+    inputs.clear();
+    for( integer i= 0 ; i < 200000 ; ++i )
+        inputs.push_back( i );
+    results.resize( inputs.size() );
+    Ticks::Duration single;
+    UT_PRINT( "EvaluateAll scaling ({} evaluations, {} hardware threads):",
+              inputs.size(), ThreadPool::HardwareConcurrency() )
+    for( int workers : { 1, 2, 4, 8 } ) {
+        auto duration= evaluateAll( compiler, expr, workers, inputs, results );
+        if( workers == 1 )
+            single= duration;
+        UT_PRINT( "  Workers: {}  Time: {:>7} us  Speed-up: {:.2}", workers,
+                  duration.InAbsoluteMicroseconds(),
+                  double(single.InNanoseconds()) / double(duration.InNanoseconds()) )
+    }
+}
+#endif // ALIB_THREADMODEL
+
 
 
 #include "aworx_unittests_end.hpp"
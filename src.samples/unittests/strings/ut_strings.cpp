@@ -18,6 +18,7 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <unordered_set>
 
 #include "aworx_unittests.hpp"
 #define TESTCLASSNAME       UT_Strings
@@ -1514,6 +1515,66 @@ UT_METHOD( CompareOperators )
 } //UT_METHOD( CompareOperators )
 #endif // !defined(ALIB_UT_REDUCED_COMPILE_TIME)
 
+//--------------------------------------------------------------------------------------------------
+//--- Hashcode
+//--------------------------------------------------------------------------------------------------
+#include "ALib.Lang.CIFunctions.H"
+template<typename TChar>
+void testHashcode( AWorxUnitTesting& ut ) {
+    // all lengths of the different code paths, including chunks of HashIgnoreCase
+    std::basic_string<TChar> mixed, upper;
+    for( int len= 0 ; len < 600 ; ++len ) {
+        TChar c= TChar( "aBcDeFgHiJkLmNoPqRsTuVwXyZ[0]-_+!"[len % 33] );
+        if( len % 41 == 40 )
+            c= TChar( sizeof(TChar) == 1 ? 0xE4 : 0x00E4 );
+        mixed.push_back( c );
+        upper.push_back( characters::ToUpper<TChar>( c ) );
+
+        strings::TString<TChar> m( mixed.data(), integer(mixed.size()) );
+        strings::TString<TChar> u( upper.data(), integer(upper.size()) );
+        std::basic_string<TChar> copy= mixed;
+        strings::TString<TChar> mc( copy.data(), integer(copy.size()) );
+
+        UT_EQ( m.Hashcode()          , mc.Hashcode()           )
+        UT_EQ( m.Hashcode(42)        , mc.Hashcode(42)         )
+        UT_EQ( m.HashcodeIgnoreCase(), u .HashcodeIgnoreCase() )
+        UT_EQ( m.HashcodeIgnoreCase(7), u.HashcodeIgnoreCase(7))
+        if( len > 0 ) {
+            UT_TRUE( m.Hashcode() != u .Hashcode()   )
+            UT_TRUE( m.Hashcode() != m .Hashcode(42) )
+        }
+    }
+}
+#include "ALib.Lang.CIMethods.H"
+
+UT_METHOD( Hashcode )
+{
+    UT_INIT()
+
+    testHashcode<nchar>( ut );
+    testHashcode<wchar>( ut );
+    testHashcode<xchar>( ut );
+
+    // empty and nulled strings
+    UT_EQ( NString().Hashcode()   , NString(A_NCHAR("")).Hashcode()    )
+    UT_EQ( String ().Hashcode(123), String (A_CHAR ("")).Hashcode(123) )
+
+    // seeds are used for combining hash codes
+    String a= A_CHAR("Category"), b= A_CHAR("Name");
+    UT_TRUE( b.Hashcode( a.Hashcode() ) != a.Hashcode( b.Hashcode() ) )
+    UT_TRUE( a.Hashcode( a.Hashcode() ) != b.Hashcode( b.Hashcode() ) )
+
+    // no collisions with similar keys
+    std::unordered_set<size_t> hashes;
+    String128 key;
+    for( int i= 0 ; i < 20000 ; ++i ) {
+        key.Reset( A_CHAR("key_") ) << i;
+        hashes.insert( key.Hashcode() );
+        hashes.insert( key.HashcodeIgnoreCase( 1 ) );
+    }
+    UT_EQ( size_t(40000), hashes.size() )
+}
+
 #include "aworx_unittests_end.hpp"
 
 } //namespace
@@ -821,6 +821,102 @@ UT_METHOD( CapacityLength )
     #endif
 }
 
+//--------------------------------------------------------------------------------------------------
+//--- Test growth with different allocators
+//--------------------------------------------------------------------------------------------------
+#include "ALib.Lang.CIFunctions.H"
+// Appends to interleaved strings round robin and returns the nanoseconds per append.
+template<typename TAString>
+integer appendInterleaved( std::vector<TAString>& strings, int qtyRounds, integer& checksum ) {
+    Ticks start;
+    for( int round= 0 ; round < qtyRounds ; ++round )
+        for( auto& str : strings ) {
+            str << A_CHAR("0123456789") << round;
+            checksum+= str.Length();
+        }
+    return start.Age().InNanoseconds() / ( qtyRounds * integer(strings.size()) );
+}
+
+// Returns the number of bytes allocated but not used by the given strings.
+template<typename TAString>
+size_t unusedCapacity( std::vector<TAString>& strings ) {
+    size_t result= 0;
+    for( auto& str : strings )
+        result+= size_t( str.Capacity() - str.Length() ) * sizeof(character);
+    return result;
+}
+#include "ALib.Lang.CIMethods.H"
+
+UT_METHOD( GrowthTraits )
+{
+    UT_INIT()
+
+    // growth factors and rounding
+    UT_EQ( size_t(150), lang::GrowthTraits<lang::HeapAllocator>::Grow( 100, 101 ) )
+    UT_EQ( size_t(300), lang::GrowthTraits<lang::HeapAllocator>::Grow( 100, 300 ) )
+    UT_EQ( size_t(200), lang::GrowthTraits<MonoAllocator      >::Grow( 100, 101 ) )
+    UT_EQ( size_t(256), lang::GrowthTraits<PoolAllocator      >::Grow( 100, 101 ) )
+    UT_EQ( size_t(512), lang::GrowthTraits<PoolAllocator      >::Grow( 128, 300 ) )
+    UT_EQ( size_t(64 ), lang::GrowthTraits<PoolAllocator      >::RoundUp( 33 ) )
+
+    // pool-allocated strings use the full block size
+    {
+        MonoAllocator ma(ALIB_DBG("UTGrowth",) 16);
+        PoolAllocator pa(ma);
+        AStringPA pooled(pa);
+        for( int i= 0 ; i < 1000 ; ++i ) {
+            pooled << 'x';
+            #if !ALIB_DEBUG_STRINGS
+            UT_EQ( 0, ( pooled.Capacity() + 1 ) * integer(sizeof(character))
+                      & ( ( pooled.Capacity() + 1 ) * integer(sizeof(character)) - 1 ) )
+            #endif
+        }
+        UT_EQ( 1000, pooled.Length() )
+    }
+
+    // build interleaved strings with each allocator
+    const int qtyStrings= 32;
+    const int qtyRounds = 200;
+    integer   nonOptimizableUsedResultValue= 0;
+    {
+        std::vector<AString>   strings( qtyStrings );
+        integer nanos= appendInterleaved( strings, qtyRounds, nonOptimizableUsedResultValue );
+        if ( nonOptimizableUsedResultValue > -1 )
+            UT_PRINT( "Heap: unused capacity {:7} bytes, {:3} ns per append",
+                      unusedCapacity( strings ), nanos )
+    }
+    {
+        MonoAllocator ma(ALIB_DBG("UTGrowth",) 16);
+        std::vector<AStringMA> strings;
+        strings.reserve( qtyStrings );
+        for( int i= 0 ; i < qtyStrings ; ++i )
+            strings.emplace_back( ma );
+        integer nanos= appendInterleaved( strings, qtyRounds, nonOptimizableUsedResultValue );
+        size_t used= 0;
+        for( auto& str : strings )
+            used+= size_t( str.Length() ) * sizeof(character);
+        monomem::Statistics stats;
+        ma.GetStatistics( stats );
+        UT_TRUE( stats.AllocSize >= used )
+        if ( nonOptimizableUsedResultValue > -1 )
+            UT_PRINT( "Mono: unused capacity {:7} bytes, abandoned and unused {:7} bytes, "
+                      "{:3} ns per append",
+                      unusedCapacity( strings ), stats.AllocSize - used, nanos )
+    }
+    {
+        MonoAllocator ma(ALIB_DBG("UTGrowth",) 16);
+        PoolAllocator pa(ma);
+        std::vector<AStringPA> strings;
+        strings.reserve( qtyStrings );
+        for( int i= 0 ; i < qtyStrings ; ++i )
+            strings.emplace_back( pa );
+        integer nanos= appendInterleaved( strings, qtyRounds, nonOptimizableUsedResultValue );
+        if ( nonOptimizableUsedResultValue > -1 )
+            UT_PRINT( "Pool: unused capacity {:7} bytes, {:3} ns per append",
+                      unusedCapacity( strings ), nanos )
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 //--- Test TTab
 //--------------------------------------------------------------------------------------------------
@@ -1837,6 +1933,115 @@ UT_METHOD( Test_XAString )
     UT_TRUE(  xcstr.IndexOfAny<lang::Inclusion::Include>( A_XCHAR("XY3") )  ==  2)
 }
 
+//--------------------------------------------------------------------------------------------------
+//--- Test Transcode
+//--------------------------------------------------------------------------------------------------
+UT_METHOD( Transcode )
+{
+    UT_INIT()
+
+    // round trips with strings long enough to use the block-wise ASCII paths
+    NAString utf8;
+    for( int i= 0 ; i < 10 ; ++i )
+        utf8 << "Some ASCII text of more than thirty-two characters "
+             << "\xC3\xA4\xC3\xB6\xC3\xBC"              // 2-byte sequences
+             << "\xE2\x82\xAC"                          // 3-byte sequence (Euro)
+             << "\xF0\x9F\x98\x80"                      // 4-byte sequence (emoji)
+             << "x";
+    {
+        std::vector<char16_t> u16( size_t(utf8.Length()) );
+        std::vector<char32_t> u32( size_t(utf8.Length()) );
+        integer len16= characters::Transcode( utf8.Buffer(), utf8.Length(), u16.data() );
+        integer len32= characters::Transcode( utf8.Buffer(), utf8.Length(), u32.data() );
+        UT_EQ( len16, characters::TranscodedLength<char16_t>( utf8.Buffer(), utf8.Length() ) )
+        UT_EQ( len32, characters::TranscodedLength<char32_t>( utf8.Buffer(), utf8.Length() ) )
+        UT_EQ( 10 * (51 + 3 + 1 + 2 + 1), len16 )
+        UT_EQ( 10 * (51 + 3 + 1 + 1 + 1), len32 )
+        UT_EQ( char16_t(0x20AC), u16[54] )
+        UT_EQ( char16_t(0xD83D), u16[55] )
+        UT_EQ( char16_t(0xDE00), u16[56] )
+        UT_EQ( char32_t(0x1F600), u32[55] )
+
+        std::vector<nchar> back( size_t(characters::TranscodedLengthMax<nchar, char16_t>( len16 )) );
+        integer lenBack= characters::Transcode( u16.data(), len16, back.data() );
+        UT_EQ( lenBack, characters::TranscodedLength<nchar>( u16.data(), len16 ) )
+        UT_EQ( utf8, NString( back.data(), lenBack ) )
+
+        lenBack= characters::Transcode( u32.data(), len32, back.data() );
+        UT_EQ( lenBack, characters::TranscodedLength<nchar>( u32.data(), len32 ) )
+        UT_EQ( utf8, NString( back.data(), lenBack ) )
+
+        std::vector<char32_t> u32b( static_cast<size_t>(len16) );
+        UT_EQ( len32, characters::Transcode( u16.data(), len16, u32b.data() ) )
+        UT_TRUE( std::equal( u32.begin(), u32.begin() + len32, u32b.begin() ) )
+        std::vector<char16_t> u16b( size_t(2 * len32) );
+        UT_EQ( len16, characters::Transcode( u32.data(), len32, u16b.data() ) )
+        UT_TRUE( std::equal( u16.begin(), u16.begin() + len16, u16b.begin() ) )
+
+        // the string types use the same functions
+        WAString wstr( utf8 );
+        XAString xstr( utf8 );
+        NAString nstr( wstr );
+        UT_EQ( utf8, nstr )
+        nstr.Reset( xstr );
+        UT_EQ( utf8, nstr )
+        UT_EQ( wstr.Length(), utf8.WStringLength() )
+        UT_EQ( wstr.Length(), xstr.WStringLength() )
+        nstr.Reset() << wchar(0x20AC) << xchar('-') << wchar(0xE4);
+        UT_EQ( NString("\xE2\x82\xAC-\xC3\xA4"), nstr )
+    }
+
+    // invalid input is replaced by U+FFFD, a maximal subpart at a time
+    auto toU32= [](const NString& src) {
+        std::u32string result( size_t(src.Length()), U'\0' );
+        result.resize( size_t(characters::Transcode( src.Buffer(), src.Length(), result.data() )) );
+        return result;
+    };
+    UT_TRUE( toU32( NString("a\xC3"            ) ) == U"a\uFFFD"                 )  // truncated
+    UT_TRUE( toU32( NString("\xE2\x82" "A"     ) ) == U"\uFFFDA"                 )  // truncated
+    UT_TRUE( toU32( NString("\xC0\x80"         ) ) == U"\uFFFD\uFFFD"            )  // overlong
+    UT_TRUE( toU32( NString("\xED\xA0\x80"     ) ) == U"\uFFFD\uFFFD\uFFFD"      )  // surrogate
+    UT_TRUE( toU32( NString("\xF4\x90\x80\x80" ) ) == U"\uFFFD\uFFFD\uFFFD\uFFFD" )  // > U+10FFFF
+    UT_TRUE( toU32( NString("\x80" "b\xFF"     ) ) == U"\uFFFDb\uFFFD"           )
+    UT_EQ  ( 3, NString("\xED\xA0\x80").WStringLength() )
+    {
+        char16_t lone[]= { u'a', char16_t(0xD800), u'b', char16_t(0xDC00) };
+        nchar    buf[16];
+        integer  len= characters::Transcode( lone, 4, buf );
+        UT_EQ( NString("a\xEF\xBF\xBD" "b\xEF\xBF\xBD"), NString( buf, len ) )
+        UT_EQ( len, characters::TranscodedLength<nchar>( lone, 4 ) )
+
+        char32_t bad[]= { char32_t(0xD800), char32_t(0x110000), U'c' };
+        char16_t buf16[8];
+        UT_EQ( 3, characters::Transcode( bad, 3, buf16 ) )
+        UT_EQ( char16_t(0xFFFD), buf16[0] )
+        UT_EQ( char16_t(0xFFFD), buf16[1] )
+    }
+
+    // speed
+    {
+        NAString text;
+        while( text.Length() < 1024 * 1024 )
+            text << utf8;
+        std::vector<char16_t> u16( size_t(text.Length()) );
+        std::vector<nchar>    back( size_t(3 * text.Length()) );
+        integer len16= 0, lenBack= 0;
+
+        Ticks start= Ticks::Now();
+        for( int i= 0 ; i < 10 ; ++i )
+            len16= characters::Transcode( text.Buffer(), text.Length(), u16.data() );
+        auto decodeTime= start.Age();
+        start= Ticks::Now();
+        for( int i= 0 ; i < 10 ; ++i )
+            lenBack= characters::Transcode( u16.data(), len16, back.data() );
+        auto encodeTime= start.Age();
+        UT_EQ( text.Length(), lenBack )
+        UT_PRINT( "Transcoding 10 x {:,} bytes: UTF-8 to UTF-16: {:,} ms, UTF-16 to UTF-8: {:,} ms",
+                  text.Length(), decodeTime.InAbsoluteMilliseconds(),
+                                 encodeTime.InAbsoluteMilliseconds() )
+    }
+}
+
 #include "aworx_unittests_end.hpp"
 
 } //namespace
@@ -9,6 +9,7 @@
 #if ALIB_UT_BITBUFFER
 
 #include "ALib.BitBuffer.H"
+#include "ALib.BitBuffer.Parallel.H"
 #include "ALib.Monomem.H"
 #if !ALIB_SINGLE_THREADED && ALIB_CAMP
 #   include "ALib.Camp.Base.H"
@@ -19,6 +20,8 @@
 
 
 #include <algorithm>
+#include <sstream>
+#include <vector>
 #include <assert.h>
 
 #define TESTCLASSNAME       UT_BitBuffer
@@ -417,9 +420,78 @@ TestAlgo( BitBuffer& bb, TValue* data, size_t length, ArrayCompressor::Algorithm
     auto result= ArrayCompressor::Compress( bw, array, algo );
     return result;
 }
+
+// compresses and decompresses an array and returns the number of values not read back correctly
+template< typename TValue >
+int ACRoundTrip( BitBuffer& bb, TValue* data, size_t length, ArrayCompressor::Algorithm algos,
+                 ArrayCompressor::Statistics* stats )
+{
+    BitWriter  bw( bb );
+    ArrayCompressor::Array<TValue> array( data, length );
+    ArrayCompressor::Compress( bw, array, algos, stats );
+
+    std::vector<TValue> readBack( length, TValue(1) );
+    BitReader  br( bb );
+    ArrayCompressor::Array<TValue> arrayBack( readBack.data(), length );
+    ArrayCompressor::Decompress( br, arrayBack, algos, stats );
+    int errors= 0;
+    for (size_t i = 0; i < length; ++i)
+        if( data[i] != readBack[i] )
+            ++errors;
+    return errors;
+}
+
+// compares the sizes calculated with ArrayCompressor::Estimate with the sizes written by the
+// single algorithms and the results of both selection modes. Returns the number of differences.
+template< typename TValue >
+int ACEstimation( BitBuffer& bb, TValue* data, size_t length )
+{
+    using Algorithm= ArrayCompressor::Algorithm;
+    int    errors= 0;
+    size_t sizes[ArrayCompressor::NumberOfAlgorithms];
+    {
+        ArrayCompressor::Array<TValue> array( data, length );
+        ArrayCompressor::Estimate( array, Algorithm::ALL, sizes );
+    }
+    int algoNo= -1;
+    for( Algorithm algo : enumops::EnumIterator<Algorithm>() )
+    {
+        ++algoNo;
+        BitWriter  bw( bb );
+        ArrayCompressor::Array<TValue> array( data, length );
+        if( ArrayCompressor::Compress( bw, array, algo ).first != sizes[algoNo] )
+            ++errors;
+    }
+
+    BitWriter  bw( bb );
+    ArrayCompressor::Array<TValue> arrayTrial( data, length );
+    auto trial= ArrayCompressor::Compress( bw, arrayTrial, Algorithm::ALL );
+    bw.Reset();
+    ArrayCompressor::Array<TValue> arrayEstimation( data, length );
+    auto estimation= ArrayCompressor::Compress( bw, arrayEstimation, Algorithm::ALL, nullptr,
+                                                ArrayCompressor::Selection::Estimation );
+    if( trial != estimation )
+        ++errors;
+
+    std::vector<TValue> readBack( length, TValue(1) );
+    BitReader  br( bb );
+    ArrayCompressor::Array<TValue> arrayBack( readBack.data(), length );
+    ArrayCompressor::Decompress( br, arrayBack, Algorithm::ALL );
+    for (size_t i = 0; i < length; ++i)
+        if( data[i] != readBack[i] )
+            ++errors;
+    return errors;
+}
 ALIB_WARNINGS_RESTORE
 
 
+// a simple pseudo random generator to create reproducible test data
+uint32_t ACRandom( uint32_t& seed )
+{
+    seed= seed * 1664525u + 1013904223u;
+    return seed >> 8;
+}
+
 } // anonymous namespace
 
 UT_CLASS
@@ -780,6 +852,380 @@ UT_INIT()
 }
 
 
+UT_METHOD(AC_Telemetry)
+{
+    UT_INIT()
+    Log_SetDomain( "UT/AC/TELEMETRY", Scope::Method )
+    UT_PRINT( "" )
+    UT_PRINT( "--------------------------- AC_Telemetry() ---------------------------" )
+    using Algorithm= ArrayCompressor::Algorithm;
+
+    constexpr size_t len = 1000;
+    constexpr int    sets= 20;
+    BitBuffer bb( 4 * len * 64 );
+
+    std::vector<uint64_t> timestamps(len);
+    std::vector<uint32_t> counters  (len);
+    std::vector<int16_t>  gauges    (len);
+    std::vector<uint32_t> outliers  (len);
+    std::vector<uint8_t>  states    (len);
+
+    ArrayCompressor::Statistics stats[5];
+    Algorithm newAlgos[4]= { Algorithm::PFOR, Algorithm::DeltaOfDelta,
+                             Algorithm::ZigZagDelta, Algorithm::RLEBitPacked };
+    uint32_t seed  = 4711;
+    int      errors= 0;
+    for(int set= 0; set < sets ; ++set )
+    {
+        uint64_t timestamp= 1700000000000ull + uint64_t(set) * 3600000ull;
+        uint32_t counter  = 0;
+        int16_t  gauge    = 0;
+        uint8_t  state    = 0;
+        size_t   stateLeft= 0;
+        for (size_t i = 0; i < len; ++i)
+        {
+            // timestamps with a nearly constant rate
+            timestamp+= 1000 + ( ACRandom(seed) % 5 == 0 ? ACRandom(seed) % 7 : 0 );
+            timestamps[i]= timestamp;
+
+            // monotone counters
+            counter+= ACRandom(seed) % 20;
+            counters[i]= counter;
+
+            // noisy signed gauges
+            gauge= int16_t( gauge + int(ACRandom(seed) % 33) - 16 );
+            gauges[i]= gauge;
+
+            // small values with rare outliers
+            outliers[i]= 5000 + ( ACRandom(seed) % 50 == 0 ? ACRandom(seed) % 1000000
+                                                           : ACRandom(seed) % 64 );
+
+            // states with longer runs
+            if( stateLeft == 0 )
+            {
+                stateLeft= 1 + ACRandom(seed) % 40;
+                state    = uint8_t( ACRandom(seed) % 6 );
+            }
+            --stateLeft;
+            states[i]= state;
+        }
+
+        errors+= ACRoundTrip( bb, timestamps.data(), len, Algorithm::ALL, &stats[0] );
+        errors+= ACRoundTrip( bb, counters  .data(), len, Algorithm::ALL, &stats[1] );
+        errors+= ACRoundTrip( bb, gauges    .data(), len, Algorithm::ALL, &stats[2] );
+        errors+= ACRoundTrip( bb, outliers  .data(), len, Algorithm::ALL, &stats[3] );
+        errors+= ACRoundTrip( bb, states    .data(), len, Algorithm::ALL, &stats[4] );
+
+        // the new algorithms, selected exclusively
+        for( Algorithm algo : newAlgos )
+        {
+            errors+= ACRoundTrip( bb, timestamps.data(), len, algo, nullptr );
+            errors+= ACRoundTrip( bb, counters  .data(), len, algo, nullptr );
+            errors+= ACRoundTrip( bb, gauges    .data(), len, algo, nullptr );
+            errors+= ACRoundTrip( bb, outliers  .data(), len, algo, nullptr );
+            errors+= ACRoundTrip( bb, states    .data(), len, algo, nullptr );
+        }
+    }
+    UT_EQ( 0, errors )
+
+    const character* headlines[5]= { A_CHAR("Timestamps (uint64_t)"),
+                                     A_CHAR("Counters (uint32_t)"),
+                                     A_CHAR("Gauges (int16_t)"),
+                                     A_CHAR("Outliers (uint32_t)"),
+                                     A_CHAR("States (uint8_t)") };
+    ArrayCompressor::Statistics statsAll;
+    for( int type= 0 ; type < 5 ; ++type )
+    {
+        String1K result;
+        stats[type].Print( result, headlines[type], false );
+        UT_PRINT( result )
+        statsAll+= stats[type];
+    }
+    String1K result;
+    statsAll.Print(result, A_CHAR("Sums of the 5 telemetry types"), true );
+    UT_PRINT( result )
+
+    // short arrays with extreme values, which let the differences wrap around
+    int8_t   extreme8 [10]= { -128, 127, -128, 127, 0, -1, 1, -128, -128, 127 };
+    uint16_t extreme16[10]= { 0, 65535, 0, 65535, 65535, 1, 0, 32768, 32767, 0 };
+    int64_t  extreme64[10]= { (std::numeric_limits<int64_t>::min)(),
+                              (std::numeric_limits<int64_t>::max)(),
+                              (std::numeric_limits<int64_t>::min)(), -1, 0, 1,
+                              (std::numeric_limits<int64_t>::max)(),
+                              (std::numeric_limits<int64_t>::max)(),
+                              (std::numeric_limits<int64_t>::min)(), 42 };
+    for (size_t length = 0; length <= 10; ++length)
+    {
+        errors+= ACRoundTrip( bb, extreme8 , length, Algorithm::ALL, nullptr );
+        errors+= ACRoundTrip( bb, extreme16, length, Algorithm::ALL, nullptr );
+        errors+= ACRoundTrip( bb, extreme64, length, Algorithm::ALL, nullptr );
+        if( length == 0 )
+            continue;
+        for( Algorithm algo : newAlgos )
+        {
+            errors+= ACRoundTrip( bb, extreme8 , length, algo, nullptr );
+            errors+= ACRoundTrip( bb, extreme16, length, algo, nullptr );
+            errors+= ACRoundTrip( bb, extreme64, length, algo, nullptr );
+        }
+    }
+    UT_EQ( 0, errors )
+}
+
+UT_METHOD(AC_Estimation)
+{
+    UT_INIT()
+    Log_SetDomain( "UT/AC/ESTIMATION", Scope::Method )
+    UT_PRINT( "" )
+    UT_PRINT( "--------------------------- AC_Estimation() ---------------------------" )
+    using Algorithm= ArrayCompressor::Algorithm;
+    using Selection= ArrayCompressor::Selection;
+
+    // the estimated sizes have to match the written sizes exactly
+    BitBuffer bb( 96 * 64 * 4 );
+    int errors= 0;
+    for(int type= 0; type < 7 ; ++type )
+        for(int set= 0; set < 50 ; ++set )
+        {
+            uint16_t* data16= DATA[type][set];
+            int16_t   dataS16[96];
+            uint8_t   data8  [96];
+            uint32_t  data32 [96];
+            int64_t   dataS64[96];
+            for (int i = 0; i < 96; ++i)
+            {
+                dataS16[i]= int16_t ( data16[i] );
+                data8  [i]= uint8_t ( data16[i] );
+                data32 [i]= uint32_t( data16[i] ) * 65599u;
+                dataS64[i]= int64_t ( data16[i] ) - 30000;
+            }
+            for( size_t length : { size_t(1), size_t(37), size_t(96) } )
+            {
+                errors+= ACEstimation( bb, data16 , length );
+                errors+= ACEstimation( bb, dataS16, length );
+                errors+= ACEstimation( bb, data8  , length );
+                errors+= ACEstimation( bb, data32 , length );
+                errors+= ACEstimation( bb, dataS64, length );
+            }
+        }
+    UT_EQ( 0, errors )
+
+    // large telemetry arrays
+    constexpr size_t len= 1 << 16;
+    BitBuffer bbLarge( len * 64 * 3 );
+    std::vector<uint64_t> timestamps(len);
+    std::vector<int16_t>  gauges    (len);
+    uint32_t seed     = 4711;
+    uint64_t timestamp= 1700000000000ull;
+    int16_t  gauge    = 0;
+    for (size_t i = 0; i < len; ++i)
+    {
+        timestamp+= 1000 + ( ACRandom(seed) % 5 == 0 ? ACRandom(seed) % 7 : 0 );
+        timestamps[i]= timestamp;
+        gauge= int16_t( gauge + int(ACRandom(seed) % 33) - 16 );
+        gauges[i]= gauge;
+    }
+    errors+= ACEstimation( bbLarge, timestamps.data(), len );
+    errors+= ACEstimation( bbLarge, gauges    .data(), len );
+    UT_EQ( 0, errors )
+
+    // speed of trial compression and estimation
+    ArrayCompressor::Statistics stats[2];
+    Ticks::Duration             durations[2];
+    for( int mode= 0; mode < 2; ++mode )
+    {
+        Selection selection= mode == 0 ? Selection::Trial : Selection::Estimation;
+        Ticks     start;
+        BitWriter bw( bbLarge );
+        ArrayCompressor::Array<uint64_t> arrayTimestamps( timestamps.data(), len );
+        ArrayCompressor::Compress( bw, arrayTimestamps, Algorithm::ALL, &stats[mode], selection );
+        bw.Reset();
+        ArrayCompressor::Array<int16_t>  arrayGauges( gauges.data(), len );
+        ArrayCompressor::Compress( bw, arrayGauges    , Algorithm::ALL, &stats[mode], selection );
+        durations[mode]= start.Age();
+    }
+    String1K result;
+    stats[0].Print( result, A_CHAR("Trial compression of 2 arrays"), false );
+    UT_PRINT( result )
+    result.Reset();
+    stats[1].Print( result, A_CHAR("Compression using estimation of 2 arrays"), false );
+    UT_PRINT( result )
+    UT_PRINT( "Trial: {} us, estimation: {} us",
+              durations[0].InAbsoluteMicroseconds(), durations[1].InAbsoluteMicroseconds() )
+
+    // parallel estimation has to give the same result
+    #if ALIB_THREADMODEL
+    {
+        ThreadPool pool;
+        BitWriter  bw( bbLarge );
+        ArrayCompressor::Array<uint64_t> arraySerial( timestamps.data(), len );
+        Ticks start;
+        auto serial= ArrayCompressor::Compress( bw, arraySerial, Algorithm::ALL, nullptr,
+                                                Selection::Estimation );
+        auto durationSerial= start.Age();
+
+        bw.Reset();
+        ArrayCompressor::Array<uint64_t> arrayParallel( timestamps.data(), len );
+        Ticks startParallel;
+        auto parallel= bitbuffer::ac_v1::CompressParallel( pool, bw, arrayParallel );
+        auto durationParallel= startParallel.Age();
+        UT_TRUE( serial == parallel )
+        UT_PRINT( "Compression of {} timestamps: serial estimation {} us, "
+                  "parallel estimation {} us ({} hardware threads)", len,
+                  durationSerial  .InAbsoluteMicroseconds(),
+                  durationParallel.InAbsoluteMicroseconds(), ThreadPool::HardwareConcurrency() )
+        pool.WaitForAllIdle( std::chrono::minutes(1)  ALIB_DBG(, std::chrono::seconds(1)) );
+        pool.Shutdown();
+    }
+    #endif
+}
+
+UT_METHOD(AC_Chunked)
+{
+    UT_INIT()
+    using Algorithm= ArrayCompressor::Algorithm;
+
+    // counters with a few larger steps and noisy gauges
+    const size_t len        = 200003;
+    const size_t chunkLength= 4096;
+    std::vector<uint32_t> counters( len );
+    std::vector<int16_t>  gauges  ( len );
+    uint32_t seed   = 4711;
+    uint32_t counter= 0;
+    int16_t  gauge  = 0;
+    for (size_t i = 0; i < len; ++i) {
+        counter+= ACRandom(seed) % ( i % 10000 < 100 ? 100000 : 20 );
+        counters[i]= counter;
+        gauge= int16_t( gauge + int(ACRandom(seed) % 33) - 16 );
+        gauges[i]= gauge;
+    }
+
+    // write in portions of varying sizes
+    std::stringstream stream( std::ios::in | std::ios::out | std::ios::binary );
+    {
+        ChunkedArrayWriter<uint32_t> writer( stream, chunkLength );
+        size_t pos= 0;
+        while( pos < len ) {
+            size_t qty= (std::min)( len - pos, size_t( ACRandom(seed) % 20000 ) );
+            UT_TRUE( writer.Write( counters.data() + pos, qty ) )
+            pos+= qty;
+        }
+        UT_TRUE( writer.Finish() )
+        UT_EQ( uint64_t(len), writer.Length() )
+        UT_TRUE( writer.BytesWritten() < stream.str().size() )
+        UT_PRINT( "{} values of 32 bits written in {} chunks: {} bytes ({:.1}%)", len,
+                  ( len + chunkLength - 1 ) / chunkLength, stream.str().size(),
+                  100.0 * double(stream.str().size()) / double(len * sizeof(uint32_t)) )
+    }
+
+    // read all, ranges and single values
+    {
+        stream.seekg( 0 );
+        ChunkedArrayReader<uint32_t> reader( stream );
+        UT_TRUE( reader.IsOK() )
+        UT_EQ( uint64_t(len)                          , reader.Length() )
+        UT_EQ( chunkLength                            , reader.ChunkLength() )
+        UT_EQ( ( len + chunkLength - 1 ) / chunkLength, reader.CountChunks() )
+
+        std::vector<uint32_t> readBack( len, 1 );
+        UT_TRUE( reader.Read( 0, len, readBack.data() ) )
+        UT_TRUE( readBack == counters )
+
+        int errors= 0;
+        for( int i= 0; i < 200 ; ++i ) {
+            uint64_t first= ACRandom(seed) % len;
+            size_t   qty  = (std::min)( size_t( ACRandom(seed) % ( i % 2 ? 20 : 10000 ) ),
+                                        size_t( len - first ) );
+            std::fill( readBack.begin(), readBack.end(), 1 );
+            if( !reader.Read( first, qty, readBack.data() ) )
+                ++errors;
+            for( size_t j= 0; j < qty; ++j )
+                if( readBack[j] != counters[size_t(first) + j] )
+                    ++errors;
+        }
+        UT_EQ( 0, errors )
+    }
+
+    // reading with the wrong type fails, as does reading garbage
+    {
+        stream.clear();
+        stream.seekg( 0 );
+        ChunkedArrayReader<int32_t> reader( stream );
+        UT_FALSE( reader.IsOK() )
+
+        std::stringstream garbage( "This is no chunked array container, which is detected." );
+        ChunkedArrayReader<uint32_t> readerGarbage( garbage );
+        UT_FALSE( readerGarbage.IsOK() )
+    }
+
+    // empty arrays and a single algorithm
+    {
+        std::stringstream streamEmpty( std::ios::in | std::ios::out | std::ios::binary );
+        ChunkedArrayWriter<int16_t> writer( streamEmpty, chunkLength, Algorithm::MinMax );
+        UT_TRUE( writer.Finish() )
+        ChunkedArrayReader<int16_t> reader( streamEmpty );
+        UT_TRUE( reader.IsOK() )
+        UT_EQ( uint64_t(0), reader.Length() )
+        UT_EQ( size_t(0)  , reader.CountChunks() )
+
+        std::stringstream streamGauges( std::ios::in | std::ios::out | std::ios::binary );
+        ChunkedArrayWriter<int16_t> writerGauges( streamGauges, chunkLength, Algorithm::MinMax,
+                                                  ArrayCompressor::Selection::Trial );
+        UT_TRUE( writerGauges.Write( gauges.data(), len ) )
+        UT_TRUE( writerGauges.Finish() )
+        ChunkedArrayReader<int16_t> readerGauges( streamGauges );
+        UT_TRUE( readerGauges.IsOK() )
+        std::vector<int16_t> readBack( 5000 );
+        UT_TRUE( readerGauges.Read( len - 5000, 5000, readBack.data() ) )
+        UT_TRUE( std::equal( readBack.begin(), readBack.end(), gauges.end() - 5000 ) )
+    }
+
+    // short chunks of many distinct bytes, where the Huffman table exceeds the data, tried with
+    // each algorithm
+    {
+        std::vector<uint8_t> bytes( 1050 );
+        for( size_t i= 0; i < bytes.size(); ++i )
+            bytes[i]= uint8_t( i * 37 + i / 256 );
+        std::stringstream streamBytes( std::ios::in | std::ios::out | std::ios::binary );
+        ChunkedArrayWriter<uint8_t> writer( streamBytes, 100, Algorithm::ALL,
+                                            ArrayCompressor::Selection::Trial );
+        UT_TRUE( writer.Write( bytes.data(), bytes.size() ) )
+        UT_TRUE( writer.Finish() )
+        ChunkedArrayReader<uint8_t> reader( streamBytes );
+        UT_TRUE( reader.IsOK() )
+        UT_EQ( size_t(11), reader.CountChunks() )
+        std::vector<uint8_t> readBack( bytes.size() );
+        UT_TRUE( reader.Read( 0, bytes.size(), readBack.data() ) )
+        UT_TRUE( readBack == bytes )
+    }
+
+    // parallel compression has to produce the same container
+    #if ALIB_THREADMODEL
+    {
+        ThreadPool pool;
+        std::stringstream streamParallel( std::ios::in | std::ios::out | std::ios::binary );
+        ChunkedArrayWriter<uint32_t> writer( streamParallel, chunkLength );
+        UT_TRUE( writer.Write( counters.data(), 1000 ) )
+        UT_TRUE( bitbuffer::ac_v1::WriteParallel( pool, writer, counters.data() + 1000,
+                                                  len - 1000 ) )
+        UT_TRUE( writer.Finish() )
+        UT_TRUE( streamParallel.str() == stream.str() )
+
+        ChunkedArrayReader<uint32_t> reader( streamParallel );
+        UT_TRUE( reader.IsOK() )
+        std::vector<uint32_t> readBack( len, 1 );
+        UT_TRUE( bitbuffer::ac_v1::ReadParallel( pool, reader, 0, len, readBack.data() ) )
+        UT_TRUE( readBack == counters )
+
+        std::fill( readBack.begin(), readBack.end(), 1 );
+        UT_TRUE( bitbuffer::ac_v1::ReadParallel( pool, reader, 1234, 150000, readBack.data() ) )
+        UT_TRUE( std::equal( readBack.begin(), readBack.begin() + 150000,
+                             counters.begin() + 1234 ) )
+        pool.WaitForAllIdle( std::chrono::minutes(1)  ALIB_DBG(, std::chrono::seconds(1)) );
+        pool.Shutdown();
+    }
+    #endif
+}
+
 UT_METHOD(AC_Huffman)
 {
 UT_INIT()
@@ -9,6 +9,7 @@
 #if ALIB_UT_BITBUFFER
 
 #include "ALib.BitBuffer.H"
+#include "ALib.Time.H"
 
 #define TESTCLASSNAME       UT_BitBuffer
 #include "aworx_unittests.hpp"
@@ -18,6 +19,63 @@ using namespace alib::lang;
 
 
 namespace ut_aworx {
+
+namespace {
+
+// Writes an array of pseudo-random values in bulk and reads them back one by one, and vice versa.
+// Some bits are written before the array to test different start positions, and a trailer is
+// written behind it. Returns the number of errors.
+template<typename T>
+int utBulkRoundTrip( bitbuffer::BitBufferBase& bb, ShiftOpRHS width, ShiftOpRHS offset, size_t qty ) {
+    std::vector<T> values(qty), read(qty);
+    uint64_t seed= uint64_t( width ) * 7919 + uint64_t( offset ) * 31 + qty;
+    for( auto& value : values ) {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        value= T( seed >> 11 ); // upper bits are dirty and have to be masked
+    }
+    T   mask  = width == bitsof(T) ? T( ~T(0) ) : T( ( T(1) << width ) - 1 );
+    int errors= 0;
+
+    // bulk write, single read
+    {
+        BitWriter bw( bb );
+        if( offset )  bw.Write<uint32_t, true>( offset, 0x2AAAAAAAu );
+        bw.Write( width, values.data(), qty );
+        bw.Write<7>( 0x55u );
+    }
+    {
+        BitReader br( bb );
+        if( offset )  br.Read<uint32_t>( offset );
+        for( size_t i= 0 ; i < qty ; ++i )
+            if( br.Read<T>( width ) != T( values[i] & mask ) )
+                ++errors;
+        if( br.Read<7>() != 0x55 )
+            ++errors;
+    }
+
+    // single write, bulk read
+    {
+        BitWriter bw( bb );
+        if( offset )  bw.Write<uint32_t, true>( offset, 0x2AAAAAAAu );
+        for( size_t i= 0 ; i < qty ; ++i )
+            bw.Write<T, true>( width, values[i] );
+        bw.Write<7>( 0x55u );
+    }
+    {
+        BitReader br( bb );
+        if( offset )  br.Read<uint32_t>( offset );
+        br.Read( width, read.data(), qty );
+        for( size_t i= 0 ; i < qty ; ++i )
+            if( read[i] != T( values[i] & mask ) )
+                ++errors;
+        if( br.Read<7>() != 0x55 )
+            ++errors;
+    }
+    return errors;
+}
+
+} // anonymous namespace
+
 UT_CLASS
 
 UT_METHOD(BitBuffer)
@@ -612,6 +670,90 @@ UT_METHOD(BitBuffer)
     }
 }
 
+UT_METHOD(BitBufferBulk)
+{
+    UT_INIT()
+    UT_PRINT( "" )
+    UT_PRINT( "--------------------------- UT_BitBufferBulk() ---------------------------" )
+
+    UT_PRINT( "Round trips of all widths with different start bits and array lengths:" )
+    {
+        BitBufferLocal<64 * 1024> bb;
+        int errors= 0;
+        for( ShiftOpRHS offset : { 0, 3, 8, 16, 29 } )
+            for( size_t qty : { size_t(1), size_t(31), size_t(300) } ) {
+                for( ShiftOpRHS width= 1 ; width <=  8 ; ++width )
+                    errors+= utBulkRoundTrip<uint8_t >( bb, width, offset, qty );
+                for( ShiftOpRHS width= 1 ; width <= 16 ; ++width )
+                    errors+= utBulkRoundTrip<uint16_t>( bb, width, offset, qty );
+                for( ShiftOpRHS width= 1 ; width <= 32 ; ++width )
+                    errors+= utBulkRoundTrip<uint32_t>( bb, width, offset, qty );
+                for( ShiftOpRHS width= 1 ; width <= 64 ; ++width )
+                    errors+= utBulkRoundTrip<uint64_t>( bb, width, offset, qty );
+            }
+        UT_EQ( 0, errors )
+
+        // width 0 writes nothing and reads zeros
+        uint16_t values[3]= { 1, 2, 3 };
+        {
+            BitWriter bw( bb );
+            bw.Write( 0, values, 3 );
+            UT_EQ( 0u, bw.Usage() )
+        }
+        BitReader br( bb );
+        br.Read( 0, values, 3 );
+        UT_EQ( 0u, br.Usage() )
+        UT_EQ( 0, values[0] + values[1] + values[2] )
+    }
+
+    #if !defined(ALIB_UT_ROUGH_EXECUTION_SPEED_TEST)
+    UT_PRINT( "Speed of single vs. bulk writing and reading:" )
+    {
+        constexpr size_t qty= 1000000;
+        std::vector<uint32_t> values(qty), read(qty);
+        for( size_t i= 0 ; i < qty ; ++i )
+            values[i]= uint32_t( i * 2654435761u );
+
+        BitBuffer bb( qty * 32 + 64 );
+        for( ShiftOpRHS width : { 13, 16 } ) {
+            Ticks start;
+            {
+                BitWriter bw( bb );
+                for( size_t i= 0 ; i < qty ; ++i )
+                    bw.Write<uint32_t, true>( width, values[i] );
+            }
+            auto singleWrite= start.Age();
+            start.Reset();
+            {
+                BitReader br( bb );
+                for( size_t i= 0 ; i < qty ; ++i )
+                    read[i]= br.Read<uint32_t>( width );
+            }
+            auto singleRead= start.Age();
+            start.Reset();
+            {
+                BitWriter bw( bb );
+                bw.Write( width, values.data(), qty );
+            }
+            auto bulkWrite= start.Age();
+            start.Reset();
+            {
+                BitReader br( bb );
+                br.Read( width, read.data(), qty );
+            }
+            auto bulkRead= start.Age();
+            UT_EQ( values[qty - 1] & lang::LowerMask<uint32_t>( width ), read[qty - 1] )
+
+            UT_PRINT( "  Width {:2}: write single/bulk: {:5}/{:5} ps per value, "
+                      "read single/bulk: {:5}/{:5} ps per value", width,
+                      singleWrite.InNanoseconds() * 1000 / integer(qty),
+                      bulkWrite  .InNanoseconds() * 1000 / integer(qty),
+                      singleRead .InNanoseconds() * 1000 / integer(qty),
+                      bulkRead   .InNanoseconds() * 1000 / integer(qty) )
+    }   }
+    #endif
+}
+
 #include "aworx_unittests_end.hpp"
 } // namespace ut_aworx
 
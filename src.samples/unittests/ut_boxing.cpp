@@ -21,6 +21,8 @@
 #include "ALib.Boxing.H"
 #include "ALib.Monomem.H"
 #include "ALib.Format.H"
+#include "ALib.Format.Paragraphs.H"
+#include <cstdlib>
 
 #define TESTCLASSNAME       UT_Boxing
 #include "aworx_unittests.hpp"
@@ -259,6 +261,39 @@ extern float externF;
 constexpr Box constexpr2PBox(ClassConstexpr2P(&externF, &externI));
 #endif
 
+// Replacements of the C heap functions. While flag 'utCountAllocs' is set, the heap allocations
+// performed by the current thread are counted. This covers the global operator new, as well as
+// type lang::HeapAllocator, which uses std::malloc directly. (Replacing the functions is
+// possible only with the GNU C library.)
+#if defined(__GLIBC__)
+namespace ut_aworx {
+    thread_local bool   utCountAllocs= false;
+    thread_local int    utQtyAllocs  = 0;
+}
+
+extern "C" {
+void* __libc_malloc ( std::size_t size );
+void* __libc_calloc ( std::size_t qty, std::size_t size );
+void* __libc_realloc( void* mem, std::size_t size );
+
+void* malloc( std::size_t size )                            noexcept {
+    if ( ut_aworx::utCountAllocs )
+        ++ut_aworx::utQtyAllocs;
+    return __libc_malloc( size );
+}
+void* calloc( std::size_t qty, std::size_t size )           noexcept {
+    if ( ut_aworx::utCountAllocs )
+        ++ut_aworx::utQtyAllocs;
+    return __libc_calloc( qty, size );
+}
+void* realloc( void* mem, std::size_t size )                noexcept {
+    if ( ut_aworx::utCountAllocs )
+        ++ut_aworx::utQtyAllocs;
+    return __libc_realloc( mem, size );
+}
+} // extern "C"
+#endif
+
 namespace ut_aworx {
 
 #include "ALib.Lang.CIFunctions.H"
@@ -336,6 +371,24 @@ inline void testBoxing(AWorxUnitTesting& ut,  float val, const Box& box1 , const
     UT_TRUE( ( box1.Call<FEquals>(box2) ) )
     UT_TRUE( ( box2.Call<FEquals>(box1) ) )
 }
+
+// An allocator that counts allocations. Used to measure the allocations of containers of boxes.
+struct UTCountingAllocator : lang::HeapAllocator {
+    static inline int QtyAllocations= 0;
+
+    void* allocate( size_t size, size_t alignment )                                          const {
+        ++QtyAllocations;
+        return HeapAllocator::allocate( size, alignment );
+    }
+
+    void* reallocate( void* mem, size_t oldSize, size_t newSize, size_t alignment ) {
+        ++QtyAllocations;
+        return HeapAllocator::reallocate( mem, oldSize, newSize, alignment );
+    }
+
+    lang::AllocatorInterface<UTCountingAllocator> operator()()                        const noexcept
+    { return lang::AllocatorInterface<UTCountingAllocator>(*const_cast<UTCountingAllocator*>(this)); }
+};
 #include "ALib.Lang.CIMethods.H"
 
 UT_METHOD(Boxing_FundamentalTypes)
@@ -764,6 +817,138 @@ UT_METHOD(Boxing_Boxes)
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+//--- LocalBoxes and BoxesSpan
+//--------------------------------------------------------------------------------------------------
+UT_METHOD(Boxing_LocalBoxes)
+{
+    UT_INIT()
+
+    UT_PRINT("") UT_PRINT( "### Boxing: class LocalBoxes ###" )
+
+    UTCountingAllocator countingAllocator;
+    {
+        boxing::TLocalBoxes<4, UTCountingAllocator> boxes( countingAllocator );
+        UTCountingAllocator::QtyAllocations= 0;
+        boxes.Add( A_CHAR("Hello "), A_CHAR("World") );   UT_EQ( 2,  boxes.Size() )  UT_TRUE( boxes.IsLocal() )
+        Boxes boxes2;
+        boxes2.Add(A_CHAR("List1"), A_CHAR("List2") );
+        boxes.Add( boxes2 );                               UT_EQ( 4,  boxes.Size() )  UT_TRUE( boxes.IsLocal() )
+        UT_EQ( 0, UTCountingAllocator::QtyAllocations )
+        boxes.Add( Box(boxes2) );                          UT_EQ( 6,  boxes.Size() )  UT_FALSE( boxes.IsLocal() )
+        UT_EQ( 1, UTCountingAllocator::QtyAllocations )
+        UT_EQ( A_CHAR("Hello "), boxes[0].Unbox<String>())
+        UT_EQ( A_CHAR("World" ), boxes[1].Unbox<String>())
+        UT_EQ( A_CHAR("List1" ), boxes[2].Unbox<String>())
+        UT_EQ( A_CHAR("List2" ), boxes[3].Unbox<String>())
+        UT_EQ( A_CHAR("List1" ), boxes[4].Unbox<String>())
+        UT_EQ( A_CHAR("List2" ), boxes[5].Unbox<String>())
+        boxes.clear();                                     UT_EQ( 0,  boxes.Size() )  UT_TRUE( boxes.IsLocal() )
+        boxes.Add( 5, A_CHAR("xyz") );                     UT_EQ( 2,  boxes.Size() )  UT_TRUE( boxes.IsLocal() )
+        UT_EQ( A_CHAR("xyz"), boxes[1].Unbox<String>() )
+
+        // local boxes and spans are flattened when added to other containers
+        BoxesSpan span( boxes );                           UT_EQ( 2,  span.Size() )
+        boxes2.clear();
+        boxes2.Add( boxes, span );                         UT_EQ( 4,  boxes2.Size() )
+        UT_EQ( A_CHAR("xyz"), boxes2[3].Unbox<String>() )
+    }
+
+    // formatting and paragraphs accept spans of any container
+    {
+        Formatter& formatter= *Formatter::Default;
+        ALIB_LOCK_RECURSIVE_WITH(Formatter::DefaultLock)
+        AString target;
+        LocalBoxes<8> local;
+        local.Add( "{}-{}", 1, 2 );
+        formatter.FormatArgs( target, local );             UT_EQ( A_CHAR("1-2"), target )
+        formatter.Format( target.Reset(), local );         UT_EQ( A_CHAR("1-2"), target )
+        Boxes heap;
+        heap.Add( "{}+{}", 3, 4 );
+        formatter.FormatArgs( target.Reset(), heap );      UT_EQ( A_CHAR("3+4"), target )
+
+        Paragraphs paragraphs;
+        paragraphs.Add( local );
+        paragraphs.Add( heap  );
+        AString expected;
+        expected << A_CHAR("1-2") << NEW_LINE << A_CHAR("3+4") << NEW_LINE;
+        UT_EQ( expected, paragraphs.Buffer )
+    }
+
+    {
+        Lox lox( "UT_LOCALBOXES", false );
+        MemoryLogger memLogger;
+        LocalBoxes<4> logables;
+        logables.Add( "Local {}", 42 );
+        lox.Acquire( ALIB_CALLER );
+            lox.SetVerbosity( &memLogger, Verbosity::Verbose );
+            lox.Entry( "LB", Verbosity::Info, logables );
+            UT_TRUE( memLogger.MemoryLog.EndsWith( A_CHAR("Local 42") ) )
+            lox.RemoveLogger( &memLogger );
+        lox.Release();
+    }
+
+    // count the heap allocations and measure the time of a typical format and log call
+    #if defined(__GLIBC__) && !defined(ALIB_UT_ROUGH_EXECUTION_SPEED_TEST)
+    {
+        const int   qtyLoops= 10000;
+        integer     nonOptimizableUsedResultValue= 0;
+        auto measure= [&]( auto&& call ) {
+            for( int i= 0; i < 10; ++i )  // warm-up
+                call( qtyLoops );
+            utQtyAllocs  = 0;
+            utCountAllocs= true;
+            Ticks start;
+            for( int i= 0; i < qtyLoops; ++i )
+                call( i );
+            auto nanos= start.Age().InNanoseconds() / qtyLoops;
+            utCountAllocs= false;
+            return std::make_pair( double(utQtyAllocs) / qtyLoops, nanos );
+        };
+
+        String128   target;
+        Formatter&  formatter= *Formatter::Default;
+        auto formatCall= [&]( auto& args, int i ) {
+            args.Add( "{}: {}", i, "value" );
+            formatter.FormatArgs( target.Reset(), args );
+            nonOptimizableUsedResultValue+= target.Length();
+        };
+        std::pair<double, int64_t> vectorResult, localResult;
+        {ALIB_LOCK_RECURSIVE_WITH(Formatter::DefaultLock)
+            vectorResult= measure( [&]( int i ) { Boxes         args; formatCall( args, i ); } );
+            localResult = measure( [&]( int i ) { LocalBoxes<8> args; formatCall( args, i ); } );
+        }
+        UT_TRUE( vectorResult.first >= 1.0 )
+        UT_EQ(   0.0, localResult.first )
+
+        Lox lox( "UT_ALLOCATIONS", false );
+        MemoryLogger memLogger;
+        lox.Acquire( ALIB_CALLER );
+            lox.SetVerbosity( &memLogger, Verbosity::Verbose );
+        lox.Release();
+        auto logResult= measure( [&]( int i ) {
+            lox.Acquire( ALIB_CALLER );
+                lox.Info( "UT", "{}: {}", i, "value" );
+            lox.Release();
+            nonOptimizableUsedResultValue+= memLogger.MemoryLog.Length();
+            memLogger.MemoryLog.Reset();
+        } );
+        UT_EQ( 0.0, logResult.first )
+        lox.Acquire( ALIB_CALLER );
+            lox.RemoveLogger( &memLogger );
+        lox.Release();
+
+        if ( nonOptimizableUsedResultValue > -1 ) {
+            UT_PRINT( "Format 3 arguments with Boxes:       {:.1} allocations, {:4} ns per call",
+                      vectorResult.first, vectorResult.second )
+            UT_PRINT( "Format 3 arguments with LocalBoxes:  {:.1} allocations, {:4} ns per call",
+                      localResult .first, localResult .second )
+            UT_PRINT( "Log 3 arguments to a MemoryLogger:   {:.1} allocations, {:4} ns per call",
+                      logResult   .first, logResult   .second )
+    }   }
+    #endif
+}
+
 #if ALIB_DEBUG_BOXING
 
 UT_METHOD(Boxing_CustomClasses)
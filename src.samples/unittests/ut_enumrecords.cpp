@@ -0,0 +1,296 @@
+// #################################################################################################
+//  AWorx ALib Unit Tests
+//
+//  Copyright 2013-2025 A-Worx GmbH, Germany
+//  Published under 'Boost Software License' (a free software license, see LICENSE.txt)
+// #################################################################################################
+#include "alib_precompile.hpp"
+#include "alib_test_selection.hpp"
+#if ALIB_UT_ENUMRECORDS
+
+#include "ALib.ALox.H"
+#include "ALib.Monomem.H"
+#include "ALib.EnumOps.H"
+#include "ALib.EnumRecords.H"
+#include "ALib.EnumRecords.Bootstrap.H"
+#include "ALib.Strings.Tokenizer.H"
+#include "ALib.Time.H"
+
+using namespace std;
+using namespace alib;
+
+// Enumerations with many records, used to test and measure function enumrecords::Parse.
+enum class ParseIndexed10   : int {};
+enum class ParseIndexed100  : int {};
+enum class ParseIndexed1000 : int {};
+ALIB_ENUMS_ASSIGN_RECORD( ParseIndexed10  , ERSerializable )
+ALIB_ENUMS_ASSIGN_RECORD( ParseIndexed100 , ERSerializable )
+ALIB_ENUMS_ASSIGN_RECORD( ParseIndexed1000, ERSerializable )
+
+// Enumerations used to test writing enum elements.
+enum class SparseRecords : int     { Negative= -5, One= 1, Thousand= 1000, Big= 100000 };
+enum class BitsUnordered : uint8_t { None= 0, One= 1, Two= 2, Four= 4 };
+enum class Bits32        : uint32_t {};
+ALIB_ENUMS_ASSIGN_RECORD( SparseRecords, ERSerializable )
+ALIB_ENUMS_ASSIGN_RECORD( BitsUnordered, ERSerializable )
+ALIB_ENUMS_ASSIGN_RECORD( Bits32       , ERSerializable )
+ALIB_ENUMS_MAKE_BITWISE( BitsUnordered )
+ALIB_ENUMS_MAKE_BITWISE( Bits32 )
+
+#define TESTCLASSNAME       UT_EnumRecords
+#include "aworx_unittests.hpp"
+
+namespace ut_aworx {
+#include "ALib.Lang.CIFunctions.H"
+
+//--------------------------------------------------------------------------------------------------
+//--- Parsing enum elements with many records
+//--------------------------------------------------------------------------------------------------
+// Creates the records "ItemAAA", "ItemAAB", ... using different minimum recognition lengths.
+// Every seventh name is one character shorter and thus a prefix of names that follow.
+template<typename TEnum>
+void bootstrapParseIndexed( AString& definitions, int qty ) {
+    for( int i= 0 ; i < qty ; ++i ) {
+        definitions << (i == 0 ? "" : ",") << i << ",Item"
+                    << character('A' + i / 676 % 26) << character('A' + i / 26 % 26);
+        if( i % 7 != 6 )
+            definitions << character('A' + i % 26);
+        definitions << ',' << ( i % 3 == 0 ? 0 : i % 3 == 1 ? 5 : 6 );
+    }
+    ALIB_LOCK_RECURSIVE_WITH(monomem::GLOBAL_ALLOCATOR_LOCK)
+    alib::enumrecords::bootstrap::Bootstrap<TEnum>( definitions );
+}
+
+void bootstrapParseIndexed() {
+    static AString definitions10, definitions100, definitions1000;
+    if( definitions10.IsEmpty() ) {
+        bootstrapParseIndexed<ParseIndexed10  >( definitions10  ,   10 );
+        bootstrapParseIndexed<ParseIndexed100 >( definitions100 ,  100 );
+        bootstrapParseIndexed<ParseIndexed1000>( definitions1000, 1000 );
+}   }
+
+// Searches the records linearly, as function Parse did before the records got indexed.
+template<typename TEnum>
+bool parseLinear( Substring& input, TEnum& result ) {
+    input.TrimStart();
+    for( auto it= EnumRecords<TEnum>().begin() ; it != EnumRecords<TEnum>().end() ; ++it )
+        if( input.ConsumePartOf<lang::Case::Ignore>( it->EnumElementName,
+                                                     it->MinimumRecognitionLength ) > 0 ) {
+            result= it.Enum();
+            return true;
+        }
+    return false;
+}
+
+template<typename TEnum>
+void testParseIndexed( AWorxUnitTesting& ut ) {
+    AString buffer;
+    for( auto it= EnumRecords<TEnum>().begin() ; it != EnumRecords<TEnum>().end() ; ++it ) {
+        const String& name= it->EnumElementName;
+        for( integer len= 0 ; len <= name.Length() ; ++len )
+            buffer << name.Substring( 0, len ) << '|'
+                   << " "  << name.Substring( 0, len ) << "x|";
+        buffer << "  item" << name.Substring( 4 ) << "A|" << name << name << '|';
+    }
+    buffer << "|Itex|xItemAAA|ItemZZZ|I";
+    Tokenizer tknzr( buffer, '|' );
+    while( tknzr.HasNext() ) {
+        Substring input1= tknzr.Next( lang::Whitespaces::Keep );
+        Substring input2= input1;
+        TEnum result1= TEnum(-1), result2= TEnum(-1);
+        bool ok1= enumrecords::Parse( input1, result1 );
+        bool ok2= parseLinear       ( input2, result2 );
+        UT_EQ  ( ok2, ok1 )
+        UT_TRUE( result2 == result1 )
+        UT_EQ  ( input2, input1 )
+}   }
+#if !defined(ALIB_UT_ROUGH_EXECUTION_SPEED_TEST)
+// Measures parsing the last element, compared to a linear search.
+template<typename TEnum>
+void measureParseIndexed( AWorxUnitTesting& ut, int qty ) {
+    String lastName;
+    for( auto it= EnumRecords<TEnum>().begin() ; it != EnumRecords<TEnum>().end() ; ++it )
+        lastName= it->EnumElementName;
+    const int   qtyLoops= 20000;
+    integer     nonOptimizableUsedResultValue= 0;
+    TEnum       result;
+    StopWatch   sw;
+    for( int i= 0; i < qtyLoops; ++i ) {
+        Substring input= lastName;
+        nonOptimizableUsedResultValue+= parseLinear( input, result ) + integer(result);
+    }
+    Ticks::Duration linear= sw.Sample();
+    for( int i= 0; i < qtyLoops; ++i ) {
+        Substring input= lastName;
+        nonOptimizableUsedResultValue+= enumrecords::Parse( input, result ) + integer(result);
+    }
+    Ticks::Duration indexed= sw.Sample();
+
+    // this is always true, just for the sake that the compiler does not optimize the whole code!
+    if ( nonOptimizableUsedResultValue > -1 ) {
+        UT_PRINT( "Parse last of {:4} records: linear {:6} ns, indexed {:4} ns, ratio: {:.1}",
+                  qty, linear .InNanoseconds() / qtyLoops,
+                       indexed.InNanoseconds() / qtyLoops,
+                  double(linear .InNanoseconds()) / double(indexed.InNanoseconds())  )
+}   }
+#endif
+
+//--------------------------------------------------------------------------------------------------
+//--- Writing enum elements
+//--------------------------------------------------------------------------------------------------
+// Writes the names of the bits set, testing each record, as the appendable of bitwise
+// enums did before the records got indexed.
+template<typename TEnum>
+void appendBitwiseLinear( AString& target, TEnum elements ) {
+    TEnum   covered= TEnum(0);
+    integer len    = target.Length();
+    for( auto it= EnumRecords<TEnum>().begin() ; it != EnumRecords<TEnum>().end() ; ++it ) {
+        if( it.Integral() == 0 ) {
+            if( elements == TEnum(0) ) {
+                target << it->EnumElementName;
+                return;
+        }   }
+        else if( HasBits( elements, it.Enum() ) && !HasBits( covered, it.Enum() ) ) {
+            covered|= it.Enum();
+            target << it->EnumElementName << ',';
+    }   }
+    if( target.Length() != len )
+        target.DeleteEnd( 1 );
+}
+#include "ALib.Lang.CIMethods.H"
+
+UT_CLASS
+
+UT_METHOD( ParseIndexed )
+{
+    UT_INIT()
+
+    bootstrapParseIndexed();
+
+    testParseIndexed<ParseIndexed10  >( ut );
+    testParseIndexed<ParseIndexed100 >( ut );
+    testParseIndexed<ParseIndexed1000>( ut );
+
+    // records of built-in enums
+    lang::ContainerOp copRead;
+    Substring s;
+    copRead= lang::ContainerOp(-1); s= A_CHAR("getcreatex") ; UT_TRUE ( enumrecords::Parse(s, copRead  ) )    UT_TRUE( copRead == lang::ContainerOp::GetCreate )  UT_EQ( A_CHAR("x")       , s)
+    copRead= lang::ContainerOp(-1); s= A_CHAR("  insert")   ; UT_TRUE ( enumrecords::Parse(s, copRead  ) )    UT_TRUE( copRead == lang::ContainerOp::Insert    )  UT_EQ( A_CHAR("")        , s)
+    copRead= lang::ContainerOp(-1); s= A_CHAR("")           ; UT_FALSE( enumrecords::Parse(s, copRead  ) )    UT_TRUE( copRead == lang::ContainerOp(-1)        )
+
+    #if !defined(ALIB_UT_ROUGH_EXECUTION_SPEED_TEST)
+    measureParseIndexed<ParseIndexed10  >( ut,   10 );
+    measureParseIndexed<ParseIndexed100 >( ut,  100 );
+    measureParseIndexed<ParseIndexed1000>( ut, 1000 );
+    #endif
+}
+
+UT_METHOD( AppendTable )
+{
+    UT_INIT()
+
+    bootstrapParseIndexed();
+    static AString definitionsBits32;
+    if( definitionsBits32.IsEmpty() ) {
+        // an aggregation first, then single bits "B0" to "B31"
+        definitionsBits32 << 0xF0 << ",HighNibble,0";
+        for( int i= 0 ; i < 32 ; ++i )
+            definitionsBits32 << ',' << (uint32_t(1) << i) << ",B" << i << ",0";
+
+        ALIB_LOCK_RECURSIVE_WITH(monomem::GLOBAL_ALLOCATOR_LOCK)
+        alib::enumrecords::bootstrap::Bootstrap<Bits32>( definitionsBits32 );
+        alib::enumrecords::bootstrap::Bootstrap<SparseRecords>(
+        {
+            { SparseRecords::Thousand, A_CHAR("Thousand")  },
+            { SparseRecords::Negative, A_CHAR("Negative")  },
+            { SparseRecords::Big     , A_CHAR("Big")       },
+            { SparseRecords::One     , A_CHAR("One")       },
+            { SparseRecords::Thousand, A_CHAR("Duplicate") },
+        } );
+
+        // single bits not in order and an aggregation that follows single bits
+        alib::enumrecords::bootstrap::Bootstrap<BitsUnordered>(
+        {
+            { BitsUnordered::Two     , A_CHAR("Two")       },
+            { BitsUnordered::One     , A_CHAR("One")       },
+            { BitsUnordered(3)       , A_CHAR("OneTwo")    },
+            { BitsUnordered::Four    , A_CHAR("Four")      },
+            { BitsUnordered::None    , A_CHAR("None")      },
+        } );
+    }
+
+    AString buf;
+    // dense table
+    UT_EQ( A_CHAR("ItemAAA"), buf.Reset() << ParseIndexed1000(0)    )
+    UT_EQ( A_CHAR("ItemBML"), buf.Reset() << ParseIndexed1000(999)  )
+    UT_EQ( A_CHAR("1000")   , buf.Reset() << ParseIndexed1000(1000) )
+    UT_EQ( A_CHAR("-1")     , buf.Reset() << ParseIndexed1000(-1)   )
+
+    // sorted table
+    UT_EQ( A_CHAR("Negative"), buf.Reset() << SparseRecords::Negative )
+    UT_EQ( A_CHAR("One")     , buf.Reset() << SparseRecords::One      )
+    UT_EQ( A_CHAR("Thousand"), buf.Reset() << SparseRecords::Thousand )
+    UT_EQ( A_CHAR("Big")     , buf.Reset() << SparseRecords::Big      )
+    UT_EQ( A_CHAR("2")       , buf.Reset() << SparseRecords(2)        )
+    UT_EQ( A_CHAR("-6")      , buf.Reset() << SparseRecords(-6)       )
+    UT_EQ( A_CHAR("100001")  , buf.Reset() << SparseRecords(100001)   )
+
+    // bitwise, records tested in the order of their definition
+    UT_EQ( A_CHAR("None")        , buf.Reset() << BitsUnordered::None  )
+    UT_EQ( A_CHAR("Two,One")     , buf.Reset() << BitsUnordered(3)     )
+    UT_EQ( A_CHAR("Two,One,Four"), buf.Reset() << BitsUnordered(7)     )
+    UT_EQ( A_CHAR("Four")        , buf.Reset() << BitsUnordered::Four  )
+
+    // bitwise, using the table of single bits
+    UT_EQ( A_CHAR("")                  , buf.Reset() << Bits32(0)          )
+    UT_EQ( A_CHAR("B0,B31")            , buf.Reset() << Bits32(0x80000001) )
+    UT_EQ( A_CHAR("HighNibble,B3,B8")  , buf.Reset() << Bits32(0x1F8)      )
+    AString expected;
+    uint32_t value= 12345;
+    for( int i= 0 ; i < 1000 ; ++i ) {
+        value= value * 1664525u + 1013904223u;
+        expected.Reset(); appendBitwiseLinear( expected, Bits32(value) );
+        UT_EQ( expected, buf.Reset() << Bits32(value) )
+    }
+
+    #if !defined(ALIB_UT_ROUGH_EXECUTION_SPEED_TEST)
+    const int       qtyLoops= 100000;
+    integer         nonOptimizableUsedResultValue= 0;
+    StopWatch       sw;
+    for( int i= 0; i < qtyLoops; ++i )
+        nonOptimizableUsedResultValue+= enumrecords::TryRecord( ParseIndexed1000(i % 1000) )
+                                        ->EnumElementName.Length();
+    Ticks::Duration hashed= sw.Sample();
+    for( int i= 0; i < qtyLoops; ++i )
+        nonOptimizableUsedResultValue+= enumrecords::detail::EnumRecordTable<ParseIndexed1000>
+                                        ::Get().Find( ParseIndexed1000(i % 1000) )
+                                        ->EnumElementName.Length();
+    Ticks::Duration table= sw.Sample();
+    for( int i= 0; i < qtyLoops; ++i ) {
+        buf.Reset(); appendBitwiseLinear( buf, Bits32( 0x40000008 ^ uint32_t(i & 1) ) );
+        nonOptimizableUsedResultValue+= buf.Length();
+    }
+    Ticks::Duration bitsLinear= sw.Sample();
+    for( int i= 0; i < qtyLoops; ++i ) {
+        buf.Reset() << Bits32( 0x40000008 ^ uint32_t(i & 1) );
+        nonOptimizableUsedResultValue+= buf.Length();
+    }
+    Ticks::Duration bitsTable= sw.Sample();
+
+    // this is always true, just for the sake that the compiler does not optimize the whole code!
+    if ( nonOptimizableUsedResultValue > -1 ) {
+        UT_PRINT( "Record lookup: hash table {:4} ns, dense table {:4} ns, ratio: {:.1}",
+                  hashed.InNanoseconds() / qtyLoops, table.InNanoseconds() / qtyLoops,
+                  double(hashed.InNanoseconds()) / double(table.InNanoseconds())  )
+        UT_PRINT( "Bitwise write: linear     {:4} ns, bit table   {:4} ns, ratio: {:.1}",
+                  bitsLinear.InNanoseconds() / qtyLoops, bitsTable.InNanoseconds() / qtyLoops,
+                  double(bitsLinear.InNanoseconds()) / double(bitsTable.InNanoseconds())  )
+    }
+    #endif
+}
+
+#include "aworx_unittests_end.hpp"
+
+} //namespace [ut_aworx]
+
+#endif // ALIB_UT_ENUMRECORDS
@@ -252,7 +252,7 @@ UT_METHOD(FileAndFTree)
 		                              << DIRECTORY_SEPARATOR << "alib"
 									  << DIRECTORY_SEPARATOR << "expressions";
 
-    testFScan(ut, nullptr                 , nullptr                             , 3 , 40 );
+    testFScan(ut, nullptr                 , nullptr                             , 4 , 44 );
 
     UT_EQ(1u, resultPaths.size())
 
@@ -304,14 +304,14 @@ UT_METHOD(FileAndFTree)
     ftree->GetNumberFormat().Flags|= NumberFormatFlags::WriteGroupChars;
 
     auto cdc= lang::CurrentData::Clear;
-    file.Format(A_CHAR("'Size: 's"                             ),fmt,cdc);   UT_EQ(A_CHAR("Size:        13.678KiB"       ), fmt )
-    file.Format(A_CHAR("'Size: 's(KiB)"                        ),fmt,cdc);   UT_EQ(A_CHAR("Size:        13.678"          ), fmt )
-    file.Format(A_CHAR("'Size: 's(B)"                          ),fmt,cdc);   UT_EQ(A_CHAR("Size:   14,006"               ), fmt )
-    file.Format(A_CHAR("'Size: 's(B){15,c}"                    ),fmt,cdc);   UT_EQ(A_CHAR("Size:      14,006    "        ), fmt )
-    file.Format(A_CHAR("'Size: 's(iec)"                        ),fmt,cdc);   UT_EQ(A_CHAR("Size:        13.678KiB"       ), fmt)
-    file.Format(A_CHAR("'Size: 's(SI)"                         ),fmt,cdc);   UT_EQ(A_CHAR("Size:        14.006kB"        ), fmt)
+    file.Format(A_CHAR("'Size: 's"                             ),fmt,cdc);   UT_EQ(A_CHAR("Size:        14.040KiB"       ), fmt )
+    file.Format(A_CHAR("'Size: 's(KiB)"                        ),fmt,cdc);   UT_EQ(A_CHAR("Size:        14.040"          ), fmt )
+    file.Format(A_CHAR("'Size: 's(B)"                          ),fmt,cdc);   UT_EQ(A_CHAR("Size:   14,377"               ), fmt )
+    file.Format(A_CHAR("'Size: 's(B){15,c}"                    ),fmt,cdc);   UT_EQ(A_CHAR("Size:      14,377    "        ), fmt )
+    file.Format(A_CHAR("'Size: 's(iec)"                        ),fmt,cdc);   UT_EQ(A_CHAR("Size:        14.040KiB"       ), fmt)
+    file.Format(A_CHAR("'Size: 's(SI)"                         ),fmt,cdc);   UT_EQ(A_CHAR("Size:        14.377kB"        ), fmt)
     file.Format(A_CHAR("'Size: 's(mb)"                         ),fmt,cdc);   UT_EQ(A_CHAR("Size:         0.014"          ), fmt)
-    file.Format(A_CHAR("'Size: 's(mib)"                        ),fmt,cdc);   UT_EQ(A_CHAR("Size:         0.013"          ), fmt)
+    file.Format(A_CHAR("'Size: 's(mib)"                        ),fmt,cdc);   UT_EQ(A_CHAR("Size:         0.014"          ), fmt)
 
     file.Format(A_CHAR("'Stem: 'ns"                            ),fmt,cdc);   UT_EQ(A_CHAR("Stem: expression"             ), fmt )
     file.Format(A_CHAR("'Name: 'na"                            ),fmt,cdc);   UT_EQ(A_CHAR("Name: expression.inl"         ), fmt )
@@ -377,6 +377,32 @@ UT_METHOD(FileAndFTree)
     file.Format(A_CHAR("'Quality: 'qqq"                        ),fmt,cdc);   UT_EQ(A_CHAR("Quality: STA"  ),fmt )
     file.Format(A_CHAR("'ls -l format: 'ta h on gn s dm nal"  ),fmt,cdc);   UT_PRINT( fmt )
 
+    // sort the siblings of the file by size
+    {
+        FTreeSorter sorter;
+        sorter.Field= FTreeSorter::Fields::Size;
+        StringTreeIterator<FTree> stit;
+        stit.SetSorting ( &sorter );
+        stit.SetMaxDepth( 0 );
+        int      qty     = 0;
+        bool     ordered = true;
+        uinteger prevSize= 0;
+        Path     prevName;
+        stit.Initialize( file.AsCursor().Parent(), lang::Inclusion::Exclude );
+        for( ; stit.IsValid() ; stit.Next() ) {
+            auto node= stit.Node();
+            if(     qty++ > 0
+                &&  (    prevSize > node->Size()
+                      || (    prevSize == node->Size()
+                           && prevName.CompareTo<CHK, lang::Case::Ignore>( node.Name() ) >= 0 ) ) )
+                ordered= false;
+            prevSize= node->Size();
+            prevName.Reset( node.Name() );
+        }
+        UT_TRUE( qty > 1 )
+        UT_TRUE( ordered )
+    }
+
     // Create some special file entries in the tree (not existing on disk) to test basic functions.
     auto file2= file;
     file2.AsCursor().GoToRoot().CreateChild(A_PATH("test"));
@@ -557,29 +583,29 @@ UT_METHOD(Scanning)
    
    { ALIB_LOCK_WITH(ftree) ftree.Reset(); ftree->MonitorFilesByName( lang::ContainerOp::Insert,
        &secondListener, files::FTreeListener::Event::CreateNode, A_PATH("expression.inl")); }
-   testFScanListener(ut, 3, 40, 0, 1 );
+   testFScanListener(ut, 4, 44, 0, 1 );
 
    { ALIB_LOCK_WITH(ftree) ftree.Reset(); ftree->MonitorPathPrefix( lang::ContainerOp::Insert,
        &secondListener, files::FTreeListener::Event::CreateNode, baseDir ) ; }
-   testFScanListener(ut, 3, 40, 4, 40 );
+   testFScanListener(ut, 4, 44, 5, 44 );
 
    { ALIB_LOCK_WITH(ftree) ftree.Reset(); ftree->MonitorPathSubstring( lang::ContainerOp::Insert,
        &secondListener, files::FTreeListener::Event::CreateNode, A_PATH("xpressio")); }
-   testFScanListener(ut, 3, 40, 3, 40 );
+   testFScanListener(ut, 4, 44, 4, 44 );
 
    { ALIB_LOCK_WITH(ftree) ftree.Reset(); ftree->MonitorPathSubstring( lang::ContainerOp::Insert,
        &secondListener, files::FTreeListener::Event::CreateNode, A_PATH("detail")); }
-   testFScanListener(ut, 3, 40, 0, 9 );
+   testFScanListener(ut, 4, 44, 0, 9 );
 #endif
 
    //==================================== filter tests ===============================
 //tstDoDump= true;
-   testFScan(ut, nullptr                 , nullptr                             , 3 , 40 );
-   testFScan(ut, nullptr                 , A_CHAR("IsDirectory")               , 3 ,  0 );
-   testFScan(ut, nullptr                 , A_CHAR("name = \"expression.inl\"") , 3 ,  1 );
-   testFScan(ut, nullptr                 , A_CHAR("name * \"*.inl\"")          , 3 , 20 );
-   testFScan(ut, nullptr                 , A_CHAR("name * \"e*.inl\"")         , 3 ,  4 );
-   testFScan(ut, nullptr                 , A_CHAR("name == \"notexisting\"")   , 3 ,  0 );
+   testFScan(ut, nullptr                 , nullptr                             , 4 , 44 );
+   testFScan(ut, nullptr                 , A_CHAR("IsDirectory")               , 4 ,  0 );
+   testFScan(ut, nullptr                 , A_CHAR("name = \"expression.inl\"") , 4 ,  1 );
+   testFScan(ut, nullptr                 , A_CHAR("name * \"*.inl\"")          , 4 , 22 );
+   testFScan(ut, nullptr                 , A_CHAR("name * \"e*.inl\"")         , 4 ,  5 );
+   testFScan(ut, nullptr                 , A_CHAR("name == \"notexisting\"")   , 4 ,  0 );
 
    sp.RemoveEmptyDirectories= true;
    testFScan(ut, nullptr                 , A_CHAR("name == \"notexisting\"")   , 0 ,  0 );
@@ -589,60 +615,60 @@ UT_METHOD(Scanning)
    sp.RemoveEmptyDirectories= false;
 
 
-   testFScan(ut, A_CHAR("name!=\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 3 , 15 );
+   testFScan(ut, A_CHAR("name!=\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 4 , 17 );
 //   ftree.Reset(); { ALIB_LOCK_WITH(ftree) ftree->MonitorPathSubstring(lang::ContainerOp::Insert, &secondListener, files::FTreeListener::Event::CreateNode, "detail"); }
-   testFScan(ut, A_CHAR("name==\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 3 , 12 );//, false, 0,5);
-   testFScan(ut, A_CHAR("name==\"notexisting\"") , A_CHAR("name * \"*.inl\"")          , 3 ,  7 );
-   testFScan(ut, A_CHAR("name!=\"detail\"")      , A_CHAR("name == \"notexisting\"")   , 3 ,  0 );
+   testFScan(ut, A_CHAR("name==\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 4 , 13 );//, false, 0,5);
+   testFScan(ut, A_CHAR("name==\"notexisting\"") , A_CHAR("name * \"*.inl\"")          , 4 ,  8 );
+   testFScan(ut, A_CHAR("name!=\"detail\"")      , A_CHAR("name == \"notexisting\"")   , 4 ,  0 );
    sp.RemoveEmptyDirectories= true;
-   testFScan(ut, A_CHAR("name!=\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 2 , 15 );
-   testFScan(ut, A_CHAR("name==\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 1 , 12 );
-   testFScan(ut, A_CHAR("name==\"notexisting\"") , A_CHAR("name * \"*.inl\"")          , 0 ,  7 );
+   testFScan(ut, A_CHAR("name!=\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 3 , 17 );
+   testFScan(ut, A_CHAR("name==\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 1 , 13 );
+   testFScan(ut, A_CHAR("name==\"notexisting\"") , A_CHAR("name * \"*.inl\"")          , 0 ,  8 );
    testFScan(ut, A_CHAR("name!=\"detail\"")      , A_CHAR("name == \"notexisting\"")   , 0 ,  0 );
    testFScan(ut, nullptr                         , A_CHAR("name == \"notexisting\"")   , 0 ,  0 );
 
    // use post recursion dir filter
    usePostRecursionDirFilter= true;
    sp.RemoveEmptyDirectories= false;
-   testFScan(ut, A_CHAR("name!=\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 3 , 15 );
-   testFScan(ut, A_CHAR("name==\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 3 , 12 );
-   testFScan(ut, A_CHAR("name==\"notexisting\"") , A_CHAR("name * \"*.inl\"")          , 3 ,  7 );
-   testFScan(ut, A_CHAR("name!=\"detail\"")      , A_CHAR("name == \"notexisting\"")   , 3 ,  0 );
+   testFScan(ut, A_CHAR("name!=\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 4 , 17 );
+   testFScan(ut, A_CHAR("name==\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 4 , 13 );
+   testFScan(ut, A_CHAR("name==\"notexisting\"") , A_CHAR("name * \"*.inl\"")          , 4 ,  8 );
+   testFScan(ut, A_CHAR("name!=\"detail\"")      , A_CHAR("name == \"notexisting\"")   , 4 ,  0 );
    sp.RemoveEmptyDirectories= true;
-   testFScan(ut, A_CHAR("name!=\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 2 , 15 );
-   testFScan(ut, A_CHAR("name==\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 1 , 12 );
-   testFScan(ut, A_CHAR("name==\"notexisting\"") , A_CHAR("name * \"*.inl\"")          , 0 ,  7 );
+   testFScan(ut, A_CHAR("name!=\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 3 , 17 );
+   testFScan(ut, A_CHAR("name==\"detail\"")      , A_CHAR("name * \"*.inl\"")          , 1 , 13 );
+   testFScan(ut, A_CHAR("name==\"notexisting\"") , A_CHAR("name * \"*.inl\"")          , 0 ,  8 );
    testFScan(ut, A_CHAR("name!=\"detail\"")      , A_CHAR("name == \"notexisting\"")   , 0 ,  0 );
    testFScan(ut, nullptr                         , A_CHAR("name == \"notexisting\"")   , 0 ,  0 );
 
     //------------- Test all basic expression functions ----------------
    usePostRecursionDirFilter= false;
    sp.RemoveEmptyDirectories= true;
-   testFScan(ut, nullptr, A_CHAR("size > 40 * 1024")                             , 2,   3 );
-   testFScan(ut, nullptr, A_CHAR("date > DateTime(2020 , 1, 1) &&  date < today + days(1)"), 3,  40 );
+   testFScan(ut, nullptr, A_CHAR("size > 40 * 1024")                             , 2,   5 );
+   testFScan(ut, nullptr, A_CHAR("date > DateTime(2020 , 1, 1) &&  date < today + days(1)"), 4,  44 );
    testFScan(ut, nullptr, A_CHAR("date > today + days(1)")                                 , 0,   0 );
-   testFScan(ut, nullptr, A_CHAR("mdate > DateTime(2020, 1, 1) && mdate < today+ days(1)") , 3,  40 );
+   testFScan(ut, nullptr, A_CHAR("mdate > DateTime(2020, 1, 1) && mdate < today+ days(1)") , 4,  44 );
    testFScan(ut, nullptr, A_CHAR("mdate > today + days(1)")                                , 0,   0 );
    testFScan(ut, nullptr, A_CHAR("md    > today + days(1)")                                , 0,   0 );
-   testFScan(ut, nullptr, A_CHAR("mdate > DateTime(2020, 1, 1) && mdate < today+ days(1)") , 3,  40 );
+   testFScan(ut, nullptr, A_CHAR("mdate > DateTime(2020, 1, 1) && mdate < today+ days(1)") , 4,  44 );
    testFScan(ut, nullptr, A_CHAR("mdate > today + days(1)")                                , 0,   0 );
    testFScan(ut, nullptr, A_CHAR("md    > today + days(1)")                                , 0,   0 );
  //tstDoDump= true;
-   testFScan(ut, nullptr, A_CHAR("adate > DateTime(2020, 1, 1) && adate < today+ days(1)") , 3,  40 );
+   testFScan(ut, nullptr, A_CHAR("adate > DateTime(2020, 1, 1) && adate < today+ days(1)") , 4,  44 );
    testFScan(ut, nullptr, A_CHAR("adate > today + days(1)")                                , 0,   0 );
    testFScan(ut, nullptr, A_CHAR("ad    > today + days(1)")                                , 0,   0 );
    testFScan(ut, nullptr, A_CHAR("type == Directory")                                      , 0,   0 );
-   testFScan(ut, A_CHAR("type == Directory")                                      ,nullptr , 3,  40 );
-   testFScan(ut, A_CHAR("type != Directory")                                      ,nullptr , 0,  15 );
-   testFScan(ut, nullptr, A_CHAR("type == Regular")                                        , 3,  40 );
+   testFScan(ut, A_CHAR("type == Directory")                                      ,nullptr , 4,  44 );
+   testFScan(ut, A_CHAR("type != Directory")                                      ,nullptr , 0,  17 );
+   testFScan(ut, nullptr, A_CHAR("type == Regular")                                        , 4,  44 );
    testFScan(ut, nullptr, A_CHAR("type == Socket")                                         , 0,   0 );
-   testFScan(ut, A_CHAR("type != Directory"), A_CHAR("type == Regular")                    , 0,  15 );
-   testFScan(ut, A_CHAR("type == Directory"), A_CHAR("type == Regular")                    , 3,  40 );
+   testFScan(ut, A_CHAR("type != Directory"), A_CHAR("type == Regular")                    , 0,  17 );
+   testFScan(ut, A_CHAR("type == Directory"), A_CHAR("type == Regular")                    , 4,  44 );
 
    #if ALIB_FILES_SCANNER_IMPL == ALIB_FILES_SCANNER_POSIX
-     testFScan(ut, nullptr, A_CHAR("owner == userID ")                                     , 3,  40 );
+     testFScan(ut, nullptr, A_CHAR("owner == userID ")                                     , 4,  44 );
      testFScan(ut, nullptr, A_CHAR("owner != userID ")                                     , 0,   0 );
-     testFScan(ut, nullptr, A_CHAR("group == groupID")                                     , 3,  40 );
+     testFScan(ut, nullptr, A_CHAR("group == groupID")                                     , 4,  44 );
      testFScan(ut, nullptr, A_CHAR("group != groupID")                                     , 0,   0 );
    #endif
 
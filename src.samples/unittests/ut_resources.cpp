@@ -10,6 +10,11 @@
 
 #include "ALib.Camp.Base.H"
 #include "ALib.Resources.H"
+#include "ALib.Bootstrap.H"
+#include "ALib.Time.H"
+#include <thread>
+#include <atomic>
+#include <vector>
 
 
 using namespace alib;
@@ -19,6 +24,9 @@ using namespace alib;
 #define TESTCLASSNAME       UT_Resources
 #include "aworx_unittests.hpp"
 
+namespace ut_aworx { enum class UTLazyRecords { Zero, One, Two, Three }; }
+ALIB_ENUMS_ASSIGN_RECORD( ut_aworx::UTLazyRecords, alib::enumrecords::ERSerializable )
+
 using namespace std;
 using namespace alib;
 
@@ -50,6 +58,255 @@ UT_METHOD( ResourceStats )
 
 
 
+//--------------------------------------------------------------------------------------------------
+//--- Static resource tables
+//--------------------------------------------------------------------------------------------------
+constexpr resources::StaticResourceTable utStaticResources( {
+    { "A"          , A_CHAR("Value A")              },
+    { "AB"         , A_CHAR("Value AB")             },
+    { "ABC"        , A_CHAR("Value ABC")            },
+    { "Empty"      , A_CHAR("")                     },
+    { "Long"       , A_CHAR("A longer value with several words and a comma, too.") },
+    { "LongerName1", A_CHAR("1")                    },
+    { "LongerName2", A_CHAR("2")                    },
+    { "LongerName3", A_CHAR("3")                    },
+    { "X0"         , A_CHAR("x0")                   },
+    { "X1"         , A_CHAR("x1")                   },
+    { "X2"         , A_CHAR("x2")                   },
+    { "X3"         , A_CHAR("x3")                   },
+    { "X4"         , A_CHAR("x4")                   },
+    { "X5"         , A_CHAR("x5")                   },
+    { "X6"         , A_CHAR("x6")                   },
+    { "X7"         , A_CHAR("x7")                   },
+    { "X8"         , A_CHAR("x8")                   },
+    { "X9"         , A_CHAR("x9")                   },
+} );
+
+UT_METHOD( StaticResourceTables )
+{
+    UT_INIT()
+
+    // search each entry and some missing names
+    UT_EQ( integer(18), utStaticResources.Size() )
+    for( auto& entry : utStaticResources.View() )
+        UT_TRUE( utStaticResources.Find( entry.Name ) == &entry )
+    UT_TRUE( utStaticResources.Find( ""        ) == nullptr )
+    UT_TRUE( utStaticResources.Find( "ABCD"    ) == nullptr )
+    UT_TRUE( utStaticResources.Find( "X10"     ) == nullptr )
+    UT_TRUE( utStaticResources.Find( "x1"      ) == nullptr )
+    UT_EQ( A_CHAR("Value AB"), utStaticResources.Find( "AB" )->Value )
+
+    ALIB_LOCK_RECURSIVE_WITH(monomem::GLOBAL_ALLOCATOR_LOCK)
+
+    // a table added to a local pool. Resources added later replace those of the table.
+    resources::LocalResourcePool pool;
+    pool.BootstrapTable( "UT", utStaticResources.View() );
+    UT_EQ  ( A_CHAR("Value ABC"), pool.Get( "UT" , "ABC"   ALIB_DBG(, true ) ) )
+    UT_EQ  ( A_CHAR("")         , pool.Get( "UT" , "Empty" ALIB_DBG(, true ) ) )
+    UT_TRUE(                      pool.Get( "UT2", "ABC"   ALIB_DBG(, false) ).IsNull() )
+    UT_TRUE(                      pool.Get( "UT" , "ABCD"  ALIB_DBG(, false) ).IsNull() )
+    UT_TRUE( pool.BootstrapAddOrReplace( "UT", "X1", A_CHAR("replaced") ) )
+    UT_FALSE(pool.BootstrapAddOrReplace( "UT", "Y1", A_CHAR("added")    ) )
+    UT_EQ  ( A_CHAR("replaced") , pool.Get( "UT" , "X1"    ALIB_DBG(, true ) ) )
+    UT_EQ  ( A_CHAR("added")    , pool.Get( "UT" , "Y1"    ALIB_DBG(, true ) ) )
+    UT_EQ  ( A_CHAR("x2")       , pool.Get( "UT" , "X2"    ALIB_DBG(, true ) ) )
+
+    // camp FILES provides its resources with a static table
+    #if ALIB_FILES
+        UT_EQ( A_CHAR("ta h on gn s dm nal"),
+               BASECAMP.GetResourcePool()->Get( "FILES", "FFMT" ALIB_DBG(, true) ) )
+    #endif
+
+    #if !defined(ALIB_UT_ROUGH_EXECUTION_SPEED_TEST)
+    // compare with a hash map
+    resources::LocalResourcePool mapPool;
+    for( auto& entry : utStaticResources.View() )
+        mapPool.BootstrapAddOrReplace( "UT", entry.Name, entry.Value );
+    const int   qtyLoops= 10000;
+    integer     nonOptimizableUsedResultValue= 0;
+    StopWatch   sw;
+    for( int i= 0; i < qtyLoops; ++i )
+        for( auto& entry : utStaticResources.View() )
+            nonOptimizableUsedResultValue+= mapPool.Get( "UT", entry.Name ALIB_DBG(, true) ).Length();
+    Ticks::Duration mapDuration= sw.Sample();
+    for( int i= 0; i < qtyLoops; ++i )
+        for( auto& entry : utStaticResources.View() )
+            nonOptimizableUsedResultValue+= utStaticResources.Find( entry.Name )->Value.Length();
+    Ticks::Duration tableDuration= sw.Sample();
+    if ( nonOptimizableUsedResultValue > -1 ) {
+        integer qtyLookups= qtyLoops * utStaticResources.Size();
+        UT_PRINT( "Resource lookup: hash map {} ns, static table {} ns",
+                  mapDuration  .InNanoseconds() / qtyLookups,
+                  tableDuration.InNanoseconds() / qtyLookups )
+    }
+    #endif
+}
+
+//--------------------------------------------------------------------------------------------------
+//--- Lazily loaded enum records
+//--------------------------------------------------------------------------------------------------
+UT_METHOD( LazyEnumRecords )
+{
+    UT_INIT()
+
+    // the records of the common enums are loaded with their first use
+    UT_TRUE( enumrecords::TryRecord( lang::Side::Right ) != nullptr )
+    UT_TRUE( enumrecords::TryRecord( lang::Alignment(7)) == nullptr )
+    UT_EQ( A_CHAR("Right"), enumrecords::TryRecord( lang::Side::Right )->EnumElementName )
+    UT_EQ( A_CHAR("Center"), String64() << lang::Alignment::Center )
+    lang::Responsibility responsibility;
+    Substring            input= A_CHAR("keepwithsender");
+    UT_TRUE( enumrecords::Parse( input, responsibility ) )
+    UT_TRUE( responsibility == lang::Responsibility::KeepWithSender )
+    int qty= 0;
+    for( auto it= EnumRecords<lang::Bool>().begin() ; it != EnumRecords<lang::Bool>().end() ; ++it )
+        ++qty;
+    UT_TRUE( qty > 2 )
+
+    // lazy records are read from the resources only with their first use. This is observed
+    // by replacing the resource after the records were registered.
+    static resources::LocalResourcePool lazyPool;
+    {ALIB_LOCK_RECURSIVE_WITH(monomem::GLOBAL_ALLOCATOR_LOCK)
+        lazyPool.BootstrapAddOrReplace( "UT", "UTLR", A_CHAR("0,Null,1") );
+        enumrecords::bootstrap::BootstrapLazy<UTLazyRecords>( lazyPool, "UT", "UTLR" );
+        lazyPool.BootstrapAddOrReplace( "UT", "UTLR", A_CHAR("0,Zero,1,1,One,1,2,Two,2,3,Three,1") );
+    }
+
+    // records loaded with the first use by several threads at once
+    #if !ALIB_SINGLE_THREADED
+    std::atomic<int>         qtyErrors{0};
+    std::vector<std::thread> threads;
+    for( int t= 0 ; t < 4 ; ++t )
+        threads.emplace_back( [&qtyErrors] {
+            for( int i= 0 ; i < 100 ; ++i ) {
+                UTLazyRecords element;
+                Substring     parseInput= A_CHAR("tw");
+                if(    !( String64() << UTLazyRecords::Three ).Equals( A_CHAR("Three") )
+                    || !enumrecords::Parse( parseInput, element )
+                    || element != UTLazyRecords::Two
+                    || enumrecords::TryRecord( UTLazyRecords::One ) == nullptr )
+                    ++qtyErrors;
+        }   } );
+    for( auto& thread : threads )
+        thread.join();
+    UT_EQ( 0, qtyErrors.load() )
+    #endif
+    UT_EQ( A_CHAR("Zero"), String64() << UTLazyRecords::Zero )
+    UT_TRUE( enumrecords::TryRecord( UTLazyRecords::Three ) != nullptr )
+}
+
+//--------------------------------------------------------------------------------------------------
+//--- Bootstrap timings
+//--------------------------------------------------------------------------------------------------
+UT_METHOD( BootstrapTimings )
+{
+    UT_INIT()
+
+    UT_FALSE( BOOTSTRAP_TIMINGS.empty() )
+    Ticks::Duration sum;
+    for( auto& timing : BOOTSTRAP_TIMINGS ) {
+        UT_PRINT( "Bootstrap {:12} phase {}: {:6} µs",
+                  timing.Camp->ResourceCategory, int(timing.Phase),
+                  timing.Duration.InAbsoluteMicroseconds() )
+        sum+= timing.Duration;
+    }
+    UT_PRINT( "Bootstrap of all camps: {} µs", sum.InAbsoluteMicroseconds() )
+}
+
+//--------------------------------------------------------------------------------------------------
+//--- Parallel and lazy bootstrapping
+//--------------------------------------------------------------------------------------------------
+// A camp that sleeps in phases PrepareConfig and Final and counts the phases performed.
+class UTBootstrapCamp : public camp::Camp
+{
+  public:
+    int     qtyFinal                                                                            = 0;
+
+    UTBootstrapCamp( const NCString& category, camp::Camp* dependency, bool isLazy )
+    : Camp( category ) {
+        BootstrapAddDependency( *dependency );
+        BootstrapSetLazy( isLazy );
+    }
+
+    void Bootstrap()                                                                      override {
+        if( GetBootstrapState() == BootstrapPhases::PrepareResources )
+            return;
+        std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+        if( GetBootstrapState() == BootstrapPhases::Final )
+            ++qtyFinal;
+    }
+
+    void Shutdown( ShutdownPhases )                                                   override {}
+};
+
+UTBootstrapCamp utCampA( "UTA", &BASECAMP, false );
+UTBootstrapCamp utCampB( "UTB", &BASECAMP, false );
+UTBootstrapCamp utCampC( "UTC", &utCampA , true  );
+
+UT_METHOD( ParallelAndLazyBootstrap )
+{
+    UT_INIT()
+
+    // camps A and B depend only on BASECAMP, lazy camp C depends on A. All share the resources
+    // and the configuration of BASECAMP.
+    {ALIB_LOCK_RECURSIVE_WITH(monomem::GLOBAL_ALLOCATOR_LOCK)
+        utCampC.BootstrapSetResourcePool( BASECAMP.GetResourcePool() );
+        utCampC.BootstrapSetConfig      ( BASECAMP.GetConfig()       );
+        CAMPS.push_back( &utCampA );
+        CAMPS.push_back( &utCampB );
+        CAMPS.push_back( &utCampC );
+        size_t firstTiming= BOOTSTRAP_TIMINGS.size();
+
+        BOOTSTRAP_PARALLEL= true;
+        alib::Bootstrap( BootstrapPhases::Final, &utCampC );
+        BOOTSTRAP_PARALLEL= false;
+
+        UT_TRUE( utCampA.IsBootstrapped() )
+        UT_TRUE( utCampB.IsBootstrapped() )
+        UT_FALSE( utCampC.IsBootstrapped() )
+        UT_TRUE( utCampC.GetBootstrapState() == BootstrapPhases::PrepareConfig )
+        UT_EQ( 1, utCampA.qtyFinal )
+        UT_EQ( 1, utCampB.qtyFinal )
+        UT_EQ( 0, utCampC.qtyFinal )
+        UT_TRUE( utCampA.GetResourcePool() == utCampC.GetResourcePool() )
+        UT_TRUE( utCampA.GetConfig() == utCampC.GetConfig() )
+
+        // phases PrepareResources (3 camps), PrepareConfig (3) and Final (2)
+        UT_EQ( firstTiming + 8, BOOTSTRAP_TIMINGS.size() )
+        for( size_t i= firstTiming ; i < BOOTSTRAP_TIMINGS.size() ; ++i ) {
+            auto& timing= BOOTSTRAP_TIMINGS[i];
+            UT_PRINT( "Bootstrap {:4} phase {}: start {:6} µs, duration {:6} µs",
+                      timing.Camp->ResourceCategory, int(timing.Phase),
+                      (timing.Start - BOOTSTRAP_TIMINGS[firstTiming].Start).InAbsoluteMicroseconds(),
+                      timing.Duration.InAbsoluteMicroseconds() )
+        }
+
+        // phases PrepareConfig and Final of A and B overlap
+        #if !ALIB_SINGLE_THREADED
+        for( size_t i : { firstTiming + 3, firstTiming + 6 } ) {
+            auto& timingA= BOOTSTRAP_TIMINGS[i    ];
+            auto& timingB= BOOTSTRAP_TIMINGS[i + 1];
+            UT_TRUE( timingA.Camp == &utCampA && timingB.Camp == &utCampB )
+            UT_TRUE( timingB.Start < timingA.Start + timingA.Duration )
+        }
+        #endif
+    }
+
+    // first use of the lazy camp
+    alib::BootstrapOnDemand( utCampC );
+    UT_TRUE( utCampC.IsBootstrapped() )
+    UT_EQ( 1, utCampC.qtyFinal )
+    alib::BootstrapOnDemand( utCampC );
+    UT_EQ( 1, utCampC.qtyFinal )
+
+    // restore list CAMPS
+    {ALIB_LOCK_RECURSIVE_WITH(monomem::GLOBAL_ALLOCATOR_LOCK)
+        for( auto* camp : { &utCampC, &utCampB, &utCampA } ) {
+            UT_TRUE( CAMPS.back() == camp )
+            CAMPS.pop_back();
+    }   }
+}
+
 #include "aworx_unittests_end.hpp"
 
 } //namespace
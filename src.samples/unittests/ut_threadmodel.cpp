@@ -14,7 +14,14 @@
 #include "ALib.Strings.H"
 #include "ALib.Threads.H"
 #include "ALib.ThreadModel.H"
+#include "ALib.Containers.StringTree.H"
+#include "ALib.Containers.StringTreeIterator.H"
 #include <iostream>
+#include <atomic>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <stdexcept>
 
 using namespace alib;
 using namespace std;
@@ -265,6 +272,188 @@ pool.Shutdown();
 DOX_MARKER( [DOX_THREADMODEL_POOL_SIMPLE])
 }
 
+
+//--------------------------------------------------------------------------------------------------
+//--- Priority queue of DedicatedWorker
+//--------------------------------------------------------------------------------------------------
+// A job that records its priority and sequence number when executed.
+struct UTOrderJob : threadmodel::Job {
+    std::vector<std::pair<threadmodel::Priority, int>>* executed;
+    threadmodel::Priority                               priority;
+    int                                                 seq;
+
+    UTOrderJob( std::vector<std::pair<threadmodel::Priority, int>>* pExecuted,
+                threadmodel::Priority pPriority, int pSeq )
+    : Job(typeid(UTOrderJob)), executed(pExecuted), priority(pPriority), seq(pSeq)            {}
+
+    virtual size_t  SizeOf()                              override { return sizeof(UTOrderJob); }
+    bool Do()                       override { executed->emplace_back( priority, seq ); return true; }
+};
+
+// A job that blocks the worker until the given flag is set.
+struct UTGateJob : threadmodel::Job {
+    std::atomic<bool>* open;
+
+    UTGateJob( std::atomic<bool>* pOpen )   : Job(typeid(UTGateJob)), open(pOpen)                {}
+    virtual size_t  SizeOf()                               override { return sizeof(UTGateJob); }
+    bool Do() override {
+        while( !open->load() )
+            Thread::SleepMicros( 10 );
+        return true;
+    }
+};
+
+struct UTOrderWorker : threadmodel::DedicatedWorker {
+    std::vector<std::pair<threadmodel::Priority, int>>  executed;
+
+    UTOrderWorker()                                         : DedicatedWorker(A_CHAR("UT-Order")) {}
+
+    void Block( std::atomic<bool>& gate )
+    { ScheduleVoid<UTGateJob>( threadmodel::Priority::Highest, &gate ); }
+
+    void Push( threadmodel::Priority priority, int seq )
+    { ScheduleVoid<UTOrderJob>( priority, &executed, priority, seq ); }
+};
+
+//--------------------------------------------------------------------------------------------------
+//--- Wakeup heap of Trigger
+//--------------------------------------------------------------------------------------------------
+// A triggered object that counts its invocations.
+struct UTCountTriggered : threadmodel::Triggered {
+    Ticks::Duration period;
+    int             qtyCalls= 0;
+
+    UTCountTriggered()                                 : Triggered(A_CHAR("UT-Count")), period() {}
+    virtual Ticks::Duration triggerPeriod()                            override { return period; }
+    virtual void            trigger()                                       override { ++qtyCalls; }
+};
+
+//--------------------------------------------------------------------------------------------------
+//--- JFuture
+//--------------------------------------------------------------------------------------------------
+// A future job that adds a value to a counter, optionally after a gate was opened.
+struct UTFutureJob : JFuture {
+    std::atomic<int>*   counter;
+    int                 value;
+    State               resultState;
+    std::atomic<bool>*  gate;
+
+    UTFutureJob( std::atomic<int>* pCounter, int pValue, State pResultState= State::OK,
+                 std::atomic<bool>* pGate= nullptr )
+    : JFuture(typeid(UTFutureJob)), counter(pCounter), value(pValue), resultState(pResultState)
+    , gate(pGate)                                                                                 {}
+
+    virtual size_t  SizeOf()                             override { return sizeof(UTFutureJob); }
+    bool Do() override {
+        while( gate && !gate->load() )
+            Thread::SleepMicros( 10 );
+        *counter+= value;
+        Fulfill( resultState );
+        return true;
+    }
+};
+
+// A job scheduled as a continuation.
+struct UTContinuationJob : threadmodel::Job {
+    std::atomic<int>*   counter;
+    int                 value;
+
+    UTContinuationJob( std::atomic<int>* pCounter, int pValue )
+    : Job(typeid(UTContinuationJob)), counter(pCounter), value(pValue)                           {}
+
+    virtual size_t  SizeOf()                       override { return sizeof(UTContinuationJob); }
+    bool Do()                                          override { *counter+= value; return true; }
+};
+
+// The same as UTFutureJob, but using a JPromise.
+struct UTPromiseJob : JPromise {
+    std::atomic<int>*   counter;
+
+    UTPromiseJob( std::atomic<int>* pCounter )
+    : JPromise(typeid(UTPromiseJob)), counter(pCounter)                                           {}
+
+    virtual size_t  SizeOf()                            override { return sizeof(UTPromiseJob); }
+    bool Do()                     override { *counter+= 1; Fulfill(ALIB_CALLER_PRUNED); return true; }
+};
+
+//--------------------------------------------------------------------------------------------------
+//--- Coroutines
+//--------------------------------------------------------------------------------------------------
+// A job that blocks its worker for the given duration.
+struct UTSleepJob : threadmodel::Job {
+    Ticks::Duration duration;
+
+    UTSleepJob( Ticks::Duration pDuration )  : Job(typeid(UTSleepJob)), duration(pDuration)     {}
+    virtual size_t  SizeOf()                              override { return sizeof(UTSleepJob); }
+    bool Do()                                   override { Thread::Sleep( duration ); return true; }
+};
+
+// Continues with a pool and then with a dedicated worker and records the threads.
+Task utHopCoroutine( ThreadPool& pool, UTOrderWorker& worker, std::atomic<int>& step,
+                     std::thread::id& poolThread, std::thread::id& workerThread ) {
+    co_await pool.Resume();
+    poolThread= std::this_thread::get_id();
+    ++step;
+    co_await worker.Resume( threadmodel::Priority::Standard );
+    workerThread= std::this_thread::get_id();
+    ++step;
+}
+
+// Sleeps using a trigger and measures the time slept.
+Task utSleepCoroutine( Trigger& trigger, ThreadPool& pool, Ticks::Duration duration,
+                       Ticks::Duration& slept ) {
+    Ticks start;
+    co_await trigger.Sleep( duration, pool );
+    slept= start.Age();
+}
+
+// Awaits a future and stores its state.
+Task utAwaitFutureCoroutine( JFuture& future, JFuture::State& state )  { state= co_await future; }
+
+// Awaits another task.
+Task utInnerCoroutine( ThreadPool& pool, int& value ) {
+    co_await pool.Resume();
+    value= 42;
+}
+
+Task utOuterCoroutine( ThreadPool& pool, int& value ) {
+    co_await utInnerCoroutine( pool, value );
+    ++value;
+}
+
+// Continues with a pool and waits for the gate to open.
+Task utGatedCoroutine( ThreadPool& pool, std::atomic<bool>& gate, int& value ) {
+    co_await pool.Resume();
+    while( !gate.load() )
+        Thread::SleepMicros( 100 );
+    value= 42;
+}
+
+// Awaits the given task.
+Task utAwaitTaskCoroutine( Task& task, int& value ) {
+    co_await task;
+    ++value;
+}
+
+// Throws after continuing with a pool.
+Task utThrowingCoroutine( ThreadPool& pool ) {
+    co_await pool.Resume();
+    throw std::runtime_error( "UT coroutine exception" );
+}
+
+// Awaits the given task and catches its exception.
+Task utCatchingCoroutine( Task& task, bool& caught ) {
+    try                               { co_await task; }
+    catch( const std::runtime_error& ) { caught= true;  }
+}
+
+// Simulates a request that waits for two milliseconds.
+Task utRequestCoroutine( Trigger& trigger, ThreadPool& pool, std::atomic<int>& qtyDone ) {
+    co_await pool.Resume();
+    co_await trigger.Sleep( Ticks::Duration::FromAbsoluteMilliseconds( 2 ), pool );
+    ++qtyDone;
+}
+
 }// anonymous namespace
 #include "ALib.Lang.CIMethods.H"
 ALIB_WARNINGS_RESTORE // UNUSED_FUNCTION
@@ -310,6 +499,579 @@ UT_METHOD( ThreadmodelSamples )
 
 }
 
+
+UT_METHOD( DedicatedWorkerPriorities )
+{
+    UT_INIT()
+
+    using threadmodel::Priority;
+    const Priority priorities[]= { Priority::Lowest  , Priority::DeferredDeletion, Priority::Low,
+                                   Priority::Standard, Priority(2500)            , Priority::High,
+                                   Priority::Highest };
+    const int      qtyJobs     = 10000;
+    const int      qtyMeasured =  1000;
+
+    UTOrderWorker dw;
+    DWManager::GetSingleton().Add(dw);
+    dw.executed.reserve( qtyJobs );
+
+    // block the worker and push a burst of jobs with mixed priorities
+    std::atomic<bool> gate{false};
+    dw.Block( gate );
+    while( dw.Load() > 0 )
+        Thread::SleepMicros( 10 );
+
+    Ticks::Duration firstPushes, lastPushes;
+    Ticks           start;
+    for( int i= 0 ; i < qtyJobs ; ++i ) {
+        if( i == qtyMeasured ) firstPushes= start.Age();
+        if( i == qtyJobs - qtyMeasured ) start.Reset();
+        dw.Push( priorities[ ( i * 5 + i / 7 ) % 7 ], i );
+    }
+    lastPushes= start.Age();
+    UT_EQ( qtyJobs, dw.Load() )
+    UT_PRINT( "Pushing jobs to an empty queue:          {:5} ns per job",
+              firstPushes.InNanoseconds() / qtyMeasured )
+    UT_PRINT( "Pushing jobs to a queue of {} jobs:   {:5} ns per job",
+              qtyJobs - qtyMeasured, lastPushes.InNanoseconds() / qtyMeasured )
+
+    // release the worker and let it process all jobs
+    gate= true;
+    DWManager::GetSingleton().Remove( dw );
+
+    // jobs have to be executed by descending priority and in the order of pushing
+    UT_EQ( size_t(qtyJobs), dw.executed.size() )
+    for( size_t i= 1 ; i < dw.executed.size() ; ++i ) {
+        auto& prev= dw.executed[i - 1];
+        auto& act = dw.executed[i    ];
+        UT_TRUE(      prev.first > act.first
+                 || ( prev.first == act.first && prev.second < act.second ) )
+    }
+    UT_TRUE( dw.executed.front().first == Priority::Highest )
+    UT_TRUE( dw.executed.back ().first == Priority::Lowest  )
+
+    // more distinct priorities than the worker has levels for
+    UTOrderWorker dwMany;
+    DWManager::GetSingleton().Add(dwMany);
+    gate= false;
+    dwMany.Block( gate );
+    while( dwMany.Load() > 0 )
+        Thread::SleepMicros( 10 );
+    const int qtyPriorities= 40;
+    for( int i= 0 ; i < 10 * qtyPriorities ; ++i )
+        dwMany.Push( Priority( 1000 + ( i * 17 + i / qtyPriorities ) % qtyPriorities * 10 ), i );
+    UT_EQ( 10 * qtyPriorities, dwMany.Load() )
+    gate= true;
+    DWManager::GetSingleton().Remove( dwMany );
+
+    UT_EQ( size_t(10 * qtyPriorities), dwMany.executed.size() )
+    for( size_t i= 1 ; i < dwMany.executed.size() ; ++i ) {
+        auto& prev= dwMany.executed[i - 1];
+        auto& act = dwMany.executed[i    ];
+        UT_TRUE(      prev.first > act.first
+                 || ( prev.first == act.first && prev.second < act.second ) )
+    }
+}
+
+UT_METHOD( TriggerWakeupHeap )
+{
+    UT_INIT()
+
+    Trigger trigger;
+
+    // add and remove many objects
+    {
+        const int   qtyObjects= 10000;
+        std::vector<UTCountTriggered> objects( qtyObjects );
+        for( int i= 0 ; i < qtyObjects ; ++i )
+            objects[size_t(i)].period= std::chrono::milliseconds( 1000 + ( i * 7919 ) % 5000 );
+
+        Ticks start;
+        for( auto& object : objects )
+            trigger.Add( object );
+        Ticks::Duration adding= start.Age();
+        UT_EQ( qtyObjects, trigger.Size() )
+
+        start.Reset();
+        for( int i= 0 ; i < qtyObjects ; ++i )
+            trigger.Remove( objects[size_t( ( i * 7 ) % qtyObjects )] );
+        Ticks::Duration removing= start.Age();
+        UT_EQ( 0, trigger.Size() )
+        UT_PRINT( "Adding {} objects: {:4} ns per object, removing: {:4} ns per object",
+                  qtyObjects, adding  .InNanoseconds() / qtyObjects,
+                              removing.InNanoseconds() / qtyObjects )
+    }
+
+    // coalesce wakeups using a slack
+    {
+        UTCountTriggered t1, t2;
+        t1.period= 10ms;
+        t2.period= 12ms;
+        trigger.Add( t1 );
+        trigger.Add( t2 );
+        trigger.Do( 50ms );
+        UT_PRINT( "Without slack: t1 triggered {} times, t2 {} times", t1.qtyCalls, t2.qtyCalls )
+        UT_TRUE( t1.qtyCalls >= t2.qtyCalls )
+
+        trigger.Remove( t1 );
+        trigger.Remove( t2 );
+        t1.qtyCalls= t2.qtyCalls= 0;
+        trigger.SetSlack( 5ms );
+        trigger.Add( t1 );
+        trigger.Add( t2 );
+        trigger.Do( 50ms );
+        UT_PRINT( "With slack:    t1 triggered {} times, t2 {} times", t1.qtyCalls, t2.qtyCalls )
+        UT_TRUE( t1.qtyCalls > 0 )
+        UT_EQ( t1.qtyCalls, t2.qtyCalls )
+        trigger.Remove( t1 );
+        trigger.Remove( t2 );
+        trigger.SetSlack( Ticks::Duration() );
+    }
+
+    // remove objects from another thread while the trigger thread is running
+    {
+        const int   qtyObjects= 200;
+        std::vector<UTCountTriggered> objects( qtyObjects );
+        for( int i= 0 ; i < qtyObjects ; ++i ) {
+            objects[size_t(i)].period= std::chrono::microseconds( 100 + i );
+            trigger.Add( objects[size_t(i)], true );
+        }
+        trigger.Start();
+        Thread::Sleep( 5ms );
+
+        struct Remover : Runnable {
+            Trigger&                        trigger;
+            std::vector<UTCountTriggered>&  objects;
+            Remover( Trigger& t, std::vector<UTCountTriggered>& o ) : trigger(t), objects(o)     {}
+            void Run()                                                                  override {
+                for( auto& object : objects )
+                    trigger.Remove( object );
+        }   };
+        Remover remover( trigger, objects );
+        Thread  removerThread( &remover, A_CHAR("Remover") );
+        removerThread.Start();
+        removerThread.Join();
+        UT_EQ( 0, trigger.Size() )
+
+        std::vector<int> qtyCalls;
+        for( auto& object : objects )
+            qtyCalls.push_back( object.qtyCalls );
+        Thread::Sleep( 5ms );
+        trigger.Stop();
+        for( size_t i= 0 ; i < objects.size() ; ++i )
+            UT_EQ( qtyCalls[i], objects[i].qtyCalls )
+    }
+}
+
+UT_METHOD( ParallelAlgorithms )
+{
+    UT_INIT()
+
+    ThreadPool pool;
+    const integer qty= 100000;
+
+    // ParallelFor and ParallelReduce
+    std::vector<int> values( size_t(qty), -1 );
+    threadmodel::ParallelFor( pool, 0, qty, 1000, [&values]( integer b, integer e ) {
+        for( ; b < e ; ++b )
+            values[size_t(b)]= int( b % 1000 );
+    } );
+    integer qtyWrong= 0;
+    for( integer i= 0 ; i < qty ; ++i )
+        qtyWrong+= values[size_t(i)] != int( i % 1000 );
+    UT_EQ( 0, qtyWrong )
+
+    int64_t sum= threadmodel::ParallelReduce( pool, 0, qty, 1000, int64_t(0),
+        [&values]( integer b, integer e ) {
+            int64_t partial= 0;
+            for( ; b < e ; ++b )
+                partial+= values[size_t(b)];
+            return partial;
+        },
+        []( int64_t lhs, int64_t rhs ) { return lhs + rhs; } );
+    UT_EQ( int64_t( qty / 1000 ) * 999 * 1000 / 2, sum )
+    UT_EQ( 0, threadmodel::ParallelReduce( pool, 5, 5, 1, 0,
+                                           []( integer, integer ) { return 1; },
+                                           []( int lhs, int rhs ) { return lhs + rhs; } ) )
+
+    // ParallelSort
+    std::vector<int> data( static_cast<size_t>(qty) );
+    uint32_t random= 12345;
+    for( auto& value : data ) {
+        random= random * 1664525u + 1013904223u;
+        value = int( random >> 8 );
+    }
+    std::vector<int> expected= data;
+    std::sort( expected.begin(), expected.end() );
+    std::vector<int> sorted= data;
+    threadmodel::ParallelSort( pool, sorted.begin(), sorted.end(), 1000 );
+    UT_TRUE( sorted == expected )
+    sorted.assign( data.begin(), data.begin() + 100 );
+    threadmodel::ParallelSort( pool, sorted.begin(), sorted.end(), std::greater<>() );
+    UT_TRUE( std::is_sorted( sorted.begin(), sorted.end(), std::greater<>() ) )
+
+    // ParallelForEach over the subtrees of a StringTree
+    {
+        MonoAllocator ma(ALIB_DBG("UTParallel",) 16);
+        StringTree<MonoAllocator, int, StringTreeNamesDynamic<character>> tree( ma, '/' );
+        String16 name;
+        for( int i= 0 ; i < 20 ; ++i ) {
+            auto child= tree.Root().CreateChild( name.Reset() << 'C' << i, i );
+            for( int j= 0 ; j < 50 ; ++j )
+                child.CreateChild( name.Reset() << 'G' << j, i * 100 + j );
+        }
+        std::atomic<int64_t> treeSum{0};
+        threadmodel::ParallelForEach( pool, tree.Root(), [&treeSum]( const auto& child ) {
+            int64_t subtreeSum= *child;
+            for( auto grandChild= child.FirstChild() ; grandChild.IsValid() ;
+                 grandChild.GoToNextSibling() )
+                subtreeSum+= *grandChild;
+            treeSum+= subtreeSum;
+        } );
+        int64_t expectedTreeSum= 0;
+        for( int i= 0 ; i < 20 ; ++i ) {
+            expectedTreeSum+= i;
+            for( int j= 0 ; j < 50 ; ++j )
+                expectedTreeSum+= i * 100 + j;
+        }
+        UT_EQ( expectedTreeSum, treeSum.load() )
+        tree.Clear();
+    }
+    // StringTreeIterator sorting with ParallelSortCache
+    {
+        using STree= StringTree<MonoAllocator, int, StringTreeNamesDynamic<character>>;
+        MonoAllocator ma(ALIB_DBG("UTParallelSortCache",) 16);
+        STree tree( ma, '/' );
+        String64 name;
+        for( int i= 0 ; i < 5000 ; ++i ) {
+            random= random * 1664525u + 1013904223u;
+            tree.Root().CreateChild( name.Reset() << ( (random & 1) ? 'a' : 'B' ) << (random >> 12)
+                                                  << '_' << i, i );
+        }
+        StringTreeIterator<STree>::NameSorter                      sorter;
+        threadmodel::ParallelSortCache<StringTreeIterator<STree>>  cache( pool, 500 );
+        StringTreeIterator<STree>                                  stit;
+        stit.SetSorting  ( &sorter );
+        stit.SetSortCache( &cache  );
+        integer  qtyNodes= 0;
+        bool     ordered = true;
+        String64 last;
+        for( stit.Initialize( tree.Root(), lang::Inclusion::Exclude ); stit.IsValid(); stit.Next() ) {
+            if( qtyNodes++ > 0 && last.CompareTo<CHK, lang::Case::Ignore>( stit.Node().Name() ) >= 0 )
+                ordered= false;
+            last.Reset( stit.Node().Name() );
+        }
+        UT_EQ( 5000, qtyNodes )
+        UT_TRUE( ordered )
+        UT_EQ( 1, cache.Size() )
+        tree.Clear();
+    }
+    pool.WaitForAllIdle( 1min  ALIB_DBG(, 1s) );
+    pool.Shutdown();
+
+    // scaling with the number of workers
+    for( int qtyWorkers= 0 ; qtyWorkers <= 4 ; qtyWorkers= (std::max)( 1, qtyWorkers * 2 ) ) {
+        ThreadPool scalingPool;
+        scalingPool.Strategy.Mode      = ThreadPool::ResizeStrategy::Modes::Fixed;
+        scalingPool.Strategy.WorkersMax= qtyWorkers;
+
+        std::vector<double> results( static_cast<size_t>(qty) );
+        Ticks start;
+        threadmodel::ParallelFor( scalingPool, 0, qty, 256, [&results]( integer b, integer e ) {
+            for( ; b < e ; ++b ) {
+                double x= double(b);
+                for( int i= 0 ; i < 50 ; ++i )
+                    x= x * 0.999 + 1.0 / ( x + 1.0 );
+                results[size_t(b)]= x;
+        }   } );
+        Ticks::Duration forTime= start.Age();
+
+        sorted= data;
+        start.Reset();
+        threadmodel::ParallelSort( scalingPool, sorted.begin(), sorted.end(), 1000 );
+        Ticks::Duration sortTime= start.Age();
+        UT_TRUE( sorted == expected )
+
+        if( results[size_t(qty) / 2] > -1.0 )
+            UT_PRINT( "{} workers (plus caller): ParallelFor {:6} us, ParallelSort {:6} us",
+                      qtyWorkers, forTime.InAbsoluteMicroseconds(),
+                      sortTime.InAbsoluteMicroseconds() )
+        scalingPool.WaitForAllIdle( 1min  ALIB_DBG(, 1s) );
+        scalingPool.Shutdown();
+    }
+}
+
+UT_METHOD( Futures )
+{
+    UT_INIT()
+
+    using State= JFuture::State;
+    ThreadPool pool;
+    pool.Strategy.Mode      = ThreadPool::ResizeStrategy::Modes::Fixed;
+    pool.Strategy.WorkersMax= 2;
+    std::atomic<int> counter{0};
+
+    // wait
+    {
+        auto& future= pool.Schedule<UTFutureJob>( &counter, 1 );
+        UT_TRUE( future.Wait() == State::OK )
+        UT_TRUE( future.IsFulfilled() )
+        UT_EQ( 1, counter.load() )
+        pool.DeleteJob( future );
+    }
+
+    // timed wait
+    {
+        std::atomic<bool> gate{false};
+        auto& future= pool.Schedule<UTFutureJob>( &counter, 1, State::OK, &gate );
+        UT_TRUE( future.WaitFor( 2ms ) == State::Unfulfilled )
+        gate= true;
+        UT_TRUE( future.WaitFor( 10s ) == State::OK )
+        pool.DeleteJob( future );
+    }
+
+    // continuations, added before and after fulfillment
+    {
+        counter= 0;
+        std::atomic<bool> gate{false};
+        auto& future= pool.Schedule<UTFutureJob>( &counter, 1, State::OK, &gate );
+        future.Then<UTContinuationJob>( pool, &counter, 10 );
+        gate= true;
+        future.Wait();
+        future.Then<UTContinuationJob>( pool, &counter, 100 );
+        pool.WaitForAllIdle( 1min  ALIB_DBG(, 1s) );
+        UT_EQ( 111, counter.load() )
+        pool.DeleteJob( future );
+    }
+
+    // WhenAll
+    {
+        counter= 0;
+        auto& f1 = pool.Schedule<UTFutureJob>( &counter, 1 );
+        auto& f2 = pool.Schedule<UTFutureJob>( &counter, 2 );
+        auto& f3 = pool.Schedule<UTFutureJob>( &counter, 4 );
+        auto& all= JFuture::WhenAll( pool, { &f1, &f2, &f3 } );
+        all.Then<UTContinuationJob>( pool, &counter, 100 );
+        UT_TRUE( all.Wait() == State::OK )
+        UT_TRUE( f1.IsFulfilled() && f2.IsFulfilled() && f3.IsFulfilled() )
+        pool.WaitForAllIdle( 1min  ALIB_DBG(, 1s) );
+        UT_EQ( 107, counter.load() )
+        pool.DeleteJob( all );
+        pool.DeleteJob( f1 );
+        pool.DeleteJob( f2 );
+        pool.DeleteJob( f3 );
+
+        auto& f4  = pool.Schedule<UTFutureJob>( &counter, 1 );
+        auto& f5  = pool.Schedule<UTFutureJob>( &counter, 1, State::Error );
+        auto& all2= JFuture::WhenAll( pool, { &f4, &f5 } );
+        UT_TRUE( all2.Wait() == State::Error )
+        pool.DeleteJob( all2 );
+        pool.DeleteJob( f4 );
+        pool.DeleteJob( f5 );
+
+        auto& none= JFuture::WhenAll( pool, {} );
+        UT_TRUE( none.IsFulfilled() )
+        pool.DeleteJob( none );
+    }
+
+    // WhenAny
+    {
+        std::atomic<bool> gate{false};
+        auto& slow= pool.Schedule<UTFutureJob>( &counter, 1, State::OK   , &gate );
+        auto& fast= pool.Schedule<UTFutureJob>( &counter, 1, State::Error );
+        auto& any = JFuture::WhenAny( pool, { &slow, &fast } );
+        UT_TRUE( any.Wait() == State::Error )
+        UT_FALSE( slow.IsFulfilled() )
+        gate= true;
+        slow.Wait();
+        pool.DeleteJob( any );
+        pool.DeleteJob( slow );
+        pool.DeleteJob( fast );
+    }
+
+    // continuation on a dedicated worker
+    {
+        UTOrderWorker dw;
+        DWManager::GetSingleton().Add(dw);
+        auto& future= pool.Schedule<UTFutureJob>( &counter, 1 );
+        future.Then<UTOrderJob>( dw, threadmodel::Priority::Standard,
+                                 &dw.executed, threadmodel::Priority::Standard, 42 );
+        future.Wait();
+        pool.DeleteJob( future );
+        DWManager::GetSingleton().Remove( dw );
+        UT_EQ( size_t(1), dw.executed.size() )
+        UT_EQ( 42, dw.executed.front().second )
+    }
+
+    // round trips of JPromise and JFuture
+    {
+        const int qtyJobs= 2000;
+        Ticks start;
+        for( int i= 0 ; i < qtyJobs ; ++i ) {
+            auto& promise= pool.Schedule<UTPromiseJob>( &counter );
+            promise.Wait(ALIB_CALLER_PRUNED);
+            pool.DeleteJob( promise );
+        }
+        Ticks::Duration promiseTime= start.Age();
+        start.Reset();
+        for( int i= 0 ; i < qtyJobs ; ++i ) {
+            auto& future= pool.Schedule<UTFutureJob>( &counter, 1 );
+            future.Wait();
+            pool.DeleteJob( future );
+        }
+        Ticks::Duration futureTime= start.Age();
+        UT_PRINT( "Schedule, wait and delete: JPromise {:5} ns, JFuture {:5} ns",
+                  promiseTime.InNanoseconds() / qtyJobs, futureTime.InNanoseconds() / qtyJobs )
+    }
+
+    pool.WaitForAllIdle( 1min  ALIB_DBG(, 1s) );
+    pool.Shutdown();
+}
+
+UT_METHOD( Coroutines )
+{
+    UT_INIT()
+
+    ThreadPool pool;
+    pool.Strategy.Mode      = ThreadPool::ResizeStrategy::Modes::Fixed;
+    pool.Strategy.WorkersMax= 4;
+    Trigger trigger;
+    trigger.Start();
+
+    // continue with a pool and a dedicated worker
+    {
+        UTOrderWorker worker;
+        DWManager::GetSingleton().Add( worker );
+        std::atomic<int> step{0};
+        std::thread::id  poolThread, workerThread;
+        Task task= utHopCoroutine( pool, worker, step, poolThread, workerThread );
+        task.Wait();
+        UT_TRUE( task.IsDone() )
+        UT_EQ( 2, step.load() )
+        UT_TRUE( poolThread   != std::this_thread::get_id() )
+        UT_TRUE( workerThread != std::this_thread::get_id() )
+        UT_TRUE( workerThread != poolThread )
+        DWManager::GetSingleton().Remove( worker );
+    }
+
+    // sleep using the trigger
+    {
+        Ticks::Duration slept;
+        Task task= utSleepCoroutine( trigger, pool, Ticks::Duration::FromAbsoluteMilliseconds( 5 ),
+                                     slept );
+        task.Wait();
+        UT_TRUE( slept.InAbsoluteMicroseconds() >= 5000 )
+    }
+
+    // await a future, before and after it is fulfilled
+    {
+        std::atomic<bool> gate{false};
+        std::atomic<int>  counter{0};
+        auto& future= pool.Schedule<UTFutureJob>( &counter, 1, JFuture::State::Error, &gate );
+        JFuture::State state= JFuture::State::Unfulfilled;
+        Task task= utAwaitFutureCoroutine( future, state );
+        gate= true;
+        task.Wait();
+        UT_TRUE( state == JFuture::State::Error )
+
+        state= JFuture::State::Unfulfilled;
+        Task task2= utAwaitFutureCoroutine( future, state );
+        UT_TRUE( task2.IsDone() )
+        UT_TRUE( state == JFuture::State::Error )
+        pool.DeleteJob( future );
+    }
+
+    // await a task
+    {
+        int value= 0;
+        Task task= utOuterCoroutine( pool, value );
+        task.Wait();
+        UT_EQ( 43, value )
+    }
+
+    // await a task, while another thread waits for it
+    {
+        std::atomic<bool> gate{false};
+        std::atomic<bool> waited{false};
+        int value= 0;
+        Task inner= utGatedCoroutine( pool, gate, value );
+        std::thread waiter( [&] { inner.Wait(); waited= true; } );
+        Thread::Sleep( 5ms );
+        Task outer= utAwaitTaskCoroutine( inner, value );
+        UT_FALSE( outer.IsDone() )
+        UT_FALSE( waited.load() )
+        gate= true;
+        outer.Wait();
+        waiter.join();
+        UT_TRUE( waited.load() )
+        UT_TRUE( inner.IsDone() )
+        UT_EQ( 43, value )
+    }
+
+    // exceptions are rethrown by Wait and by co_await
+    {
+        bool caught= false;
+        Task task= utThrowingCoroutine( pool );
+        try                               { task.Wait();  }
+        catch( const std::runtime_error& ) { caught= true; }
+        UT_TRUE( caught )
+        UT_TRUE( task.IsDone() )
+
+        caught= false;
+        Task inner= utThrowingCoroutine( pool );
+        Task outer= utCatchingCoroutine( inner, caught );
+        outer.Wait();
+        UT_TRUE( caught )
+        UT_TRUE( inner.IsDone() )
+
+        // the exception of a detached task is discarded, and its frame is deleted
+        (void) utThrowingCoroutine( pool );
+        pool.WaitForAllIdle( 1min  ALIB_DBG(, 1s) );
+    }
+
+    // detached tasks
+    {
+        std::atomic<int> qtyDone{0};
+        for( int i= 0 ; i < 10 ; ++i )
+            (void) utRequestCoroutine( trigger, pool, qtyDone );
+        while( qtyDone.load() < 10 )
+            Thread::SleepMicros( 100 );
+        pool.WaitForAllIdle( 1min  ALIB_DBG(, 1s) );
+    }
+
+    // requests waiting 2 ms each, with blocking jobs vs. coroutines
+    {
+        const int qtyRequests= 200;
+        ThreadPool blockingPool;
+        blockingPool.Strategy.Mode      = ThreadPool::ResizeStrategy::Modes::Fixed;
+        blockingPool.Strategy.WorkersMax= 4;
+        Ticks start;
+        for( int i= 0 ; i < qtyRequests ; ++i )
+            blockingPool.ScheduleVoid<UTSleepJob>( Ticks::Duration::FromAbsoluteMilliseconds( 2 ) );
+        blockingPool.WaitForAllIdle( 1min  ALIB_DBG(, 1s) );
+        Ticks::Duration blockingTime= start.Age();
+        blockingPool.Shutdown();
+
+        std::atomic<int>  qtyDone{0};
+        std::vector<Task> tasks;
+        tasks.reserve( size_t(qtyRequests) );
+        start.Reset();
+        for( int i= 0 ; i < qtyRequests ; ++i )
+            tasks.emplace_back( utRequestCoroutine( trigger, pool, qtyDone ) );
+        for( auto& task : tasks )
+            task.Wait();
+        Ticks::Duration coroutineTime= start.Age();
+        UT_EQ( qtyRequests, qtyDone.load() )
+        UT_PRINT( "{} requests waiting 2 ms each with 4 workers: blocking jobs {} ms, "
+                  "coroutines {} ms", qtyRequests, blockingTime.InAbsoluteMilliseconds(),
+                  coroutineTime.InAbsoluteMilliseconds() )
+    }
+
+    pool.WaitForAllIdle( 1min  ALIB_DBG(, 1s) );
+    trigger.Stop();
+    pool.Shutdown();
+}
+
 #endif // !defined(ALIB_UT_ROUGH_EXECUTION_SPEED_TEST)
 
 
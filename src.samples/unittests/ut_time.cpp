@@ -19,7 +19,13 @@
 #define TESTCLASSNAME       UT_Time
 #include "aworx_unittests.hpp"
 
+#include <cmath>
 #include <numeric>
+#if !defined( _WIN32 )
+#   include <atomic>
+#   include <ctime>
+#   include <thread>
+#endif
 
 using namespace std;
 using namespace alib;
@@ -225,6 +231,84 @@ UT_METHOD(SpeedTest)
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+//--- TicksClock
+//--------------------------------------------------------------------------------------------------
+UT_METHOD(TicksClockTSC)
+{
+    UT_INIT()
+
+    UT_PRINT("") UT_PRINT( "### TicksClock ###" )
+    if( !TicksClock::IsTSCAvailable() ) {
+        UT_FALSE( TicksClock::UseTSC() )
+        UT_FALSE( TicksClock::IsTSCUsed() )
+        UT_PRINT( "No invariant time stamp counter available. Test skipped." )
+        return;
+    }
+    UT_TRUE( TicksClock::UseTSC() )
+    UT_TRUE( TicksClock::IsTSCUsed() )
+
+    // monotonic within one thread, also across synchronizations
+    Ticks last= Ticks::Now();
+    for( int i= 0 ; i < 100000 ; ++i ) {
+        if( i % 10000 == 0 )
+            TicksClock::Synchronize();
+        Ticks now= Ticks::Now();
+        UT_TRUE( now >= last )
+        last= now;
+    }
+
+    // compare with the steady clock over a busy-waited period of 100 ms, after a calibration
+    // of 50 ms. The smallest relative error of three runs must be below two percent. (The best
+    // run is taken, because the process might be preempted between reading the two clocks.)
+    UT_TRUE( TicksClock::UseTSC( true, 50 ) )
+    double minError= 1.0;
+    for( int run= 0 ; run < 3 ; ++run ) {
+        auto  steadyStart= std::chrono::steady_clock::now();
+        Ticks ticksStart;
+        while( std::chrono::steady_clock::now() - steadyStart < std::chrono::milliseconds(100) ) {}
+        Ticks ticksEnd;
+        auto  steadyEnd  = std::chrono::steady_clock::now();
+        auto  steadyNanos= std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                              steadyEnd - steadyStart ).count();
+        auto  ticksNanos = (ticksEnd - ticksStart).InNanoseconds();
+        double error= std::abs( double( ticksNanos - steadyNanos ) ) / double( steadyNanos );
+        minError= (std::min)( minError, error );
+        UT_PRINT( "100 ms busy wait: steady clock {} ns, TSC {} ns, error {:.3}%",
+                  steadyNanos, ticksNanos, error * 100.0 )
+
+        // the absolute deviation from the steady clock
+        TicksClock::Synchronize();
+        auto deviation= std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            TicksClock::now() - std::chrono::steady_clock::now() ).count();
+        UT_PRINT( "Deviation from steady clock after synchronization: {} ns", deviation )
+        UT_TRUE( deviation > -20000000 && deviation < 20000000 )
+    }
+    UT_TRUE( minError < 0.02 )
+
+    // speed of reading the clocks
+    #if !defined(ALIB_UT_ROUGH_EXECUTION_SPEED_TEST)
+    const int   qtyLoops= 1000000;
+    integer     nonOptimizableUsedResultValue= 0;
+    auto measure= [&]( bool tsc ) {
+        TicksClock::UseTSC( tsc );
+        auto start= std::chrono::steady_clock::now();
+        for( int i= 0; i < qtyLoops; ++i )
+            nonOptimizableUsedResultValue+= Ticks::Now().ToRaw() & 1;
+        return double( std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - start ).count() ) / qtyLoops;
+    };
+    double steady= measure( false );
+    double tsc   = measure( true  );
+    if ( nonOptimizableUsedResultValue > -1 ) {
+        UT_PRINT( "Ticks::Now(): steady clock {:.1} ns, TSC {:.1} ns per call", steady, tsc )
+    }
+    #endif
+
+    UT_FALSE( TicksClock::UseTSC( false ) )
+    UT_FALSE( TicksClock::IsTSCUsed() )
+}
+
 //--------------------------------------------------------------------------------------------------
 //--- DateTimeConversion
 //--------------------------------------------------------------------------------------------------
@@ -837,7 +921,145 @@ UT_METHOD(CalendarDate_Time)
 }
 #endif // ALIB_CAMP
 
+//--------------------------------------------------------------------------------------------------
+//--- CalendarDateTime: cached time zone offsets
+//--------------------------------------------------------------------------------------------------
+#if !defined( _WIN32 )
+#include "ALib.Lang.CIFunctions.H"
+// Converts the calendar time back and checks the result against the given point in time.
+// Only for local times that are repeated with a daylight saving transition, the result may denote
+// the other one of the two points in time, hence then only the local time is compared.
+void checkConversionBack( AWorxUnitTesting& ut, CalendarDateTime& cdt, time_t t ) {
+    struct tm expected, other;
+    localtime_r( &t, &expected );
+    bool repeated= false;
+    for( time_t delta : { -7200, -3600, -1800, 1800, 3600, 7200 } ) {
+        time_t otherTime= t + delta;
+        localtime_r( &otherTime, &other );
+        repeated|=    other.tm_year == expected.tm_year && other.tm_yday == expected.tm_yday
+                   && other.tm_hour == expected.tm_hour && other.tm_min  == expected.tm_min
+                   && other.tm_sec  == expected.tm_sec;
+    }
+
+    time_t back= time_t( cdt.Get().InEpochSeconds() );
+    if( !repeated ) {
+        UT_EQ( integer( t ), integer( back ) )
+        return;
+    }
+
+    struct tm tmBack;
+    localtime_r( &back, &tmBack );
+    UT_EQ( expected.tm_year, tmBack.tm_year )
+    UT_EQ( expected.tm_yday, tmBack.tm_yday )
+    UT_EQ( expected.tm_hour, tmBack.tm_hour )
+    UT_EQ( expected.tm_min , tmBack.tm_min  )
+    UT_EQ( expected.tm_sec , tmBack.tm_sec  )
+}
+#include "ALib.Lang.CIMethods.H"
+
+UT_METHOD(CalendarTimezoneCache)
+{
+    UT_INIT()
+
+    time_t      now= std::time( nullptr );
+    struct tm   tm;
+    gmtime_r( &now, &tm );
+    int         today= tm.tm_yday % 365 + 1;
+    const char* envTZ= getenv( "TZ" );
+    std::string savedTZ( envTZ ? envTZ : "" );
+
+    // Time zones in POSIX notation. The second and third switch to daylight saving time in two
+    // days and back in four, hence the cached window contains two transitions.
+    NString128 dstEast, dstWest;
+    dstEast << "AAA-1BBB,J" << (today + 1) % 365 + 1 << "/2,J" << (today + 3) % 365 + 1 << "/3";
+    dstWest << "CCC+5DDD,J" << (today + 1) % 365 + 1 << "/0,J" << (today + 3) % 365 + 1 << "/1";
+    NString zones[]= { "UTC0", "EEE-10:30", dstEast, dstWest };
+
+    for( auto& zone : zones ) {
+        setenv( "TZ", NString128( zone ).Terminate(), 1 );
+        CalendarDateTime::ResetTimezoneCache();
+        UT_PRINT( "Testing time zone {}", zone )
+
+        // from before the window to behind it, which moves the window
+        for( time_t t= now - 5 * 86400 ; t < now + 20 * 86400 ; t+= 1793 ) {
+            CalendarDateTime cdt( DateTime::FromEpochSeconds( t ), lang::Timezone::Local );
+            localtime_r( &t, &tm );
+            UT_EQ( tm.tm_year + 1900, cdt.Year      )
+            UT_EQ( tm.tm_mon  + 1   , cdt.Month     )
+            UT_EQ( tm.tm_mday       , cdt.Day       )
+            UT_EQ( tm.tm_hour       , cdt.Hour      )
+            UT_EQ( tm.tm_min        , cdt.Minute    )
+            UT_EQ( tm.tm_sec        , cdt.Second    )
+            UT_EQ( tm.tm_wday       , cdt.DayOfWeek )
+
+            checkConversionBack( ut, cdt, t );
+        }
 
+        // times far from now are not cached
+        for( time_t t= 86400 * 7 ; t < 4000000000 ; t+= 86400 * 731 + 3607 ) {
+            CalendarDateTime cdt( DateTime::FromEpochSeconds( t ), lang::Timezone::Local );
+            localtime_r( &t, &tm );
+            UT_EQ( tm.tm_year + 1900, cdt.Year )
+            UT_EQ( tm.tm_mday       , cdt.Day  )
+            UT_EQ( tm.tm_hour       , cdt.Hour )
+            checkConversionBack( ut, cdt, t );
+    }   }
+
+    if( envTZ )
+        setenv( "TZ", savedTZ.c_str(), 1 );
+    else
+        unsetenv( "TZ" );
+    CalendarDateTime::ResetTimezoneCache();
+
+    // UTC is converted without libc
+    for( time_t t= -4000000000 ; t < 8000000000 ; t+= 86400 * 97 + 4099 ) {
+        CalendarDateTime cdt( DateTime::FromEpochSeconds( t ), lang::Timezone::UTC );
+        gmtime_r( &t, &tm );
+        UT_EQ( tm.tm_year + 1900, cdt.Year      )
+        UT_EQ( tm.tm_mon  + 1   , cdt.Month     )
+        UT_EQ( tm.tm_mday       , cdt.Day       )
+        UT_EQ( tm.tm_hour       , cdt.Hour      )
+        UT_EQ( tm.tm_min        , cdt.Minute    )
+        UT_EQ( tm.tm_sec        , cdt.Second    )
+        UT_EQ( tm.tm_wday       , cdt.DayOfWeek )
+        UT_EQ( integer( t ), integer( cdt.Get( lang::Timezone::UTC ).InEpochSeconds() ) )
+    }
+    CalendarDateTime unnormalized( 2024, 14, 31, 25, 61, 61 );
+    UT_EQ( integer( CalendarDateTime( 2025, 3, 4, 2, 2, 1 ).Get( lang::Timezone::UTC ).InEpochSeconds() ),
+           integer( unnormalized.Get( lang::Timezone::UTC ).InEpochSeconds() ) )
+
+    #if !defined(ALIB_UT_ROUGH_EXECUTION_SPEED_TEST) && !ALIB_SINGLE_THREADED
+    // multithreaded conversion to local time, compared with using libc directly
+    const int           qtyLoops= 100000;
+    std::atomic<integer> nonOptimizableUsedResultValue= 0;
+    auto measure= [&]( int qtyThreads, bool cached ) {
+        Ticks start;
+        std::vector<std::thread> threads;
+        for( int i= 0 ; i < qtyThreads ; ++i )
+            threads.emplace_back( [&, i] {
+                integer          sum= 0;
+                CalendarDateTime cdt;
+                struct tm        ltm;
+                for( time_t t= now + i ; t < now + i + qtyLoops ; ++t ) {
+                    if( cached ) { cdt.Set( DateTime::FromEpochSeconds( t ) ); sum+= cdt.Second; }
+                    else         { localtime_r( &t, &ltm );                    sum+= ltm.tm_sec; }
+                }
+                nonOptimizableUsedResultValue+= sum;
+            } );
+        for( auto& thread : threads )
+            thread.join();
+        return start.Age().InNanoseconds() / qtyLoops;
+    };
+    for( int qtyThreads : { 1, 4 } ) {
+        auto libc  = measure( qtyThreads, false );
+        auto cached= measure( qtyThreads, true  );
+        if ( nonOptimizableUsedResultValue > -1 ) {
+            UT_PRINT( "Local time conversion with {} threads: libc {:4} ns, cached {:4} ns per call",
+                      qtyThreads, libc, cached )
+    }   }
+    #endif
+}
+#endif // !defined( _WIN32 )
 
 #include "aworx_unittests_end.hpp"
 
@@ -18,6 +18,7 @@
 #include "ALib.Camp.H"
 #include "ALib.Camp.Base.H"
 #include "ALib.ALox.H"
+#include "ALib.Time.H"
 
 
 #define TESTCLASSNAME       UT_Variables
@@ -179,6 +180,67 @@ UT_METHOD(Basics)
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+//--- VariableHandle
+//--------------------------------------------------------------------------------------------------
+UT_METHOD(VariableHandle)
+{
+    UT_INIT()
+
+    MonoAllocator ma(ALIB_DBG("UTCfgHandle",) 8);
+    Configuration cfg(ma);
+
+    VariableHandle<integer> hInt ( cfg, A_CHAR("H/INT" ), A_CHAR("I"), A_CHAR("42")    );
+    VariableHandle<bool>    hBool( cfg, A_CHAR("H/BOOL"), A_CHAR("B"), A_CHAR("true")  );
+    VariableHandle<double>  hFlt ( cfg, A_CHAR("H/FLT" ), A_CHAR("F"), A_CHAR("1.5")   );
+    VariableHandle<String>  hStr ( cfg, A_CHAR("H/STR" ), A_CHAR("S"), A_CHAR("hello") );
+    VariableHandle<Box>     hBox ( cfg, A_CHAR("H/BOX" ), A_CHAR("BOX"), A_CHAR("7")   );
+
+    UT_EQ  ( 42             , hInt.Get() )
+    UT_TRUE(                  hBool.Get() )
+    UT_EQ  ( 1.5            , hFlt.Get() )
+    UT_EQ  ( A_CHAR("hello"), hStr.Get() )
+    UT_EQ  ( 7              , hBox.Get().Unbox<integer>() )
+    UT_TRUE( hInt.IsCurrent() )
+
+    // modifications through variables are detected
+    Variable var(cfg, A_CHAR("H/INT"), A_CHAR("I") );
+    var.Import( A_CHAR("43"), Priority::Standard );         UT_FALSE( hInt.IsCurrent() )
+                                                            UT_EQ   ( 43, hInt.Get() )
+                                                            UT_TRUE ( hInt.IsCurrent() )
+    var= integer(44);                                       UT_EQ   ( 44, hInt.Get() )
+
+    var.Declare( A_CHAR("H/STR"), A_CHAR("S") );
+    var= String(A_CHAR("world"));                           UT_EQ   ( A_CHAR("world"), hStr.Get() )
+
+    // deletion and re-declaration
+    var.Declare( A_CHAR("H/INT"), A_CHAR("I") );
+    var.Delete();                                           UT_FALSE( hInt.IsDefined() )
+    var.Declare( A_CHAR("H/INT"), A_CHAR("I"), A_CHAR("5") );
+                                                            UT_TRUE ( hInt.IsDefined() )
+                                                            UT_EQ   ( 5, hInt.Get() )
+                                                            UT_EQ   ( A_CHAR("world"), hStr.Get() )
+    // speed comparison
+    {
+        int     aLotOf= 100000;
+        integer sum   = 0;
+        Ticks   tt;
+        for( int i= 0 ; i < aLotOf ; ++i ) {
+            Variable v(cfg);
+            v.Try( A_CHAR("H/INT") );
+            sum+= v.GetInt();
+        }
+        auto durationTry= tt.Age();
+        tt.Reset();
+        for( int i= 0 ; i < aLotOf ; ++i )
+            sum+= hInt.Get();
+        auto durationHandle= tt.Age();
+        UT_EQ( integer(aLotOf) * 10, sum )
+        UT_PRINT( "{} reads with Variable::Try: {}, with VariableHandle: {}",
+                  aLotOf, durationTry, durationHandle )
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 //--- Read and write a configuration file
 //--------------------------------------------------------------------------------------------------
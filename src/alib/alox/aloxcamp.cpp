@@ -67,6 +67,7 @@ ALoxCamp::ALoxCamp()
       ALIB_ASSERT_ERROR( this == &ALOX, "ALOX",
           "Instances of class ALox must not be created. Use singleton alib::ALOX" )
     #endif
+    BootstrapAddDependency( BASECAMP );
 }
 
 void  ALoxCamp::Reset() {
@@ -101,6 +102,9 @@ void  ALoxCamp::Reset() {
 //##################################################################################################
 
 void  ALoxCamp::Bootstrap() {
+    // with parallel bootstrapping, other camps may concurrently use the global allocator
+    ALIB_LOCK_RECURSIVE_WITH(monomem::GLOBAL_ALLOCATOR_LOCK)
+
     if( GetBootstrapState() == BootstrapPhases::PrepareResources ) {
 #if !ALIB_CAMP_OMIT_DEFAULT_RESOURCES
         resourcePool->BootstrapBulk( ResourceCategory,
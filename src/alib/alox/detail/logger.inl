@@ -78,13 +78,16 @@ class Logger
     /// itself.<br>
     /// Parameter \p{logables} contains the objects provided with the log statement as well as
     /// other objects to log, for example,
-    /// \ref alib_mod_alox_prefix_logables_intro "Prefix Logables".
+    /// \ref alib_mod_alox_prefix_logables_intro "Prefix Logables".<br>
+    /// The span refers either to the boxes passed with the log statement or to an internal
+    /// container of the \b Lox. It is valid only during the invocation.
     ///
     /// @param dom       The <em>Log Domain</em>.
     /// @param verbosity The verbosity of the message.
     /// @param logables  The list of objects to log.
     /// @param scope     Information about the scope of the <em>Log Statement</em>..
-    virtual void   Log( Domain& dom, Verbosity verbosity, BoxesMA& logables, ScopeInfo& scope)   =0;
+    virtual void   Log( Domain& dom, Verbosity verbosity, const BoxesSpan& logables,
+                        ScopeInfo& scope)                                                        =0;
 
   //################################################################################################
   // Constructor/Destructor
@@ -1288,19 +1288,29 @@ void LI::State( LoxImpl* impl,
     Entry( impl, domain, verbosity );
 }
 
-BoxesMA&  LI::GetLogableContainer(LoxImpl* impl) {
+BoxesMA&  LI::logableBuffer(LoxImpl* impl) {
     auto cntAcquirements= impl->CountAcquirements();
     ALIB_ASSERT_ERROR(   cntAcquirements >= 1, "ALOX", "Lox not acquired." )
     ALIB_ASSERT_WARNING( cntAcquirements <  5, "ALOX", "Logging recursion depth >= 5" )
     while( int(impl->logableContainers.size()) < cntAcquirements )
         impl->logableContainers.emplace_back( impl->monoAllocator().New<BoxesMA>(impl->monoAllocator) );
-    BoxesMA& logables= *impl->logableContainers[size_t(cntAcquirements - 1)];
+    return *impl->logableContainers[size_t(cntAcquirements - 1)];
+}
+
+BoxesMA&  LI::GetLogableContainer(LoxImpl* impl) {
+    BoxesMA& logables= logableBuffer( impl );
     logables.clear();
     return logables;
 }
 
 void LI::Entry(LoxImpl* impl, const NString& domain, Verbosity verbosity ) {
     ASSERT_ACQUIRED
+    Entry( impl, domain, verbosity, logableBuffer( impl ) );
+}
+
+void LI::Entry(LoxImpl* impl, const NString& domain, Verbosity verbosity,
+               const BoxesSpan& logables ) {
+    ASSERT_ACQUIRED
 
     // auto-initialization of debug loggers
     #if ALOX_DBG_LOG
@@ -1317,10 +1327,18 @@ void LI::Entry(LoxImpl* impl, const NString& domain, Verbosity verbosity ) {
     if ( impl->domains->CountLoggers() == 0 )
         return;
 
-    log( impl,
-         evaluateResultDomain( impl, domain ),
-         verbosity,
-         *impl->logableContainers[size_t(impl->CountAcquirements() - 1)],
+    // Nested lists of boxes are flattened, as the container types of ALib do. This needs a copy.
+    BoxesMA& buffer= logableBuffer( impl );
+    if(    logables.data() != buffer.data()
+        && boxing::detail::FlattenCount( logables.data(), logables.Size() ) != logables.Size() ) {
+        buffer.clear();
+        buffer.AddArray( logables.data(), logables.Size() );
+        log( impl, evaluateResultDomain( impl, domain ), verbosity, buffer, buffer,
+             lang::Inclusion::Include );
+        return;
+    }
+
+    log( impl, evaluateResultDomain( impl, domain ), verbosity, logables, buffer,
          lang::Inclusion::Include );
 }
 
@@ -1353,8 +1371,7 @@ int LI::IsActive(LoxImpl* impl, Verbosity verbosity, const NString& domain, NASt
 
 void LI::IncreaseLogCounter( LoxImpl* impl)                                 { ++impl->CntLogCalls; }
 
-void LI::entryDetectDomainImpl(LoxImpl* impl,  Verbosity verbosity ) {
-    BoxesMA& logables= *impl->logableContainers[size_t(impl->CountAcquirements() - 1)];
+void LI::entryDetectDomainImpl(LoxImpl* impl,  Verbosity verbosity, const BoxesSpan& logables ) {
     if ( logables.Size() > 1 && logables[0].IsArrayOf<nchar>() ) {
         NString firstArg= logables[0].Unbox<NString>();
 
@@ -1380,16 +1397,15 @@ void LI::entryDetectDomainImpl(LoxImpl* impl,  Verbosity verbosity ) {
         }   }
 
         if ( illegalCharacterFound ) {
-            Entry( impl, nullptr, verbosity );
+            Entry( impl, nullptr, verbosity, logables );
             return;
         }
 
-        logables.erase( logables.begin() );
-        Entry( impl, firstArg, verbosity );
+        Entry( impl, firstArg, verbosity, BoxesSpan( logables.data() + 1, logables.Size() - 1 ) );
         return;
     }
 
-    Entry( impl, nullptr, verbosity );
+    Entry( impl, nullptr, verbosity, logables );
 }
 
 
@@ -1764,15 +1780,29 @@ bool LI::isThreadRelatedScope(LoxImpl* impl, Scope scope ) {
 }
 
 void LI::log( LoxImpl*  impl     , Domain*  dom,
-              Verbosity verbosity, BoxesMA& logables, lang::Inclusion includePrefixes ) {
+              Verbosity verbosity, const BoxesSpan& logables, BoxesMA& buffer,
+              lang::Inclusion includePrefixes ) {
     ++dom->CntLogCalls;
     bool logablesCollected= false;
+    BoxesSpan toLog= logables;
     PrefixLogable marker(impl->poolAllocator, nullptr);
     for ( int i= 0; i < dom->CountLoggers() ; ++i )
         if( dom->IsActive( i, verbosity ) ) {
             // lazily collect objects once an active logger is found
             if ( !logablesCollected ) {
                 logablesCollected= true;
+
+                // The given logables are copied to the buffer only with the first prefix found.
+                bool copied= logables.data() == buffer.data();
+                auto insert= [&]( integer idx, const Box& box ) {
+                    if ( !copied ) {
+                        copied= true;
+                        buffer.clear();
+                        buffer.AddArray( logables.data(), logables.Size() );
+                    }
+                    buffer.emplace( buffer.begin() + idx, box );
+                };
+
                 impl->scopePrefixes.InitWalk( Scope::ThreadInner, &marker );
                 const Box* next;
                 int userLogablesSize= int( logables.Size() );
@@ -1784,32 +1814,31 @@ void LI::log( LoxImpl*  impl     , Domain*  dom,
                         if ( includePrefixes == lang::Inclusion::Include ) {
                             // after marker is read, logables need to be prepended. This is checked below
                             // using "qtyThreadInners < 0"
+                            integer insertIdx= threadInnersSize < 0 ? userLogablesSize : 0;
                             if ( next->IsType<BoxesMA*>() ) {
                                 auto* boxes= next->Unbox<BoxesMA*>();
                                 for (auto pfxI= boxes->Size() - 1 ; pfxI >= 0 ; --pfxI )
-                                    logables.emplace( logables.begin() + ( threadInnersSize < 0 ? userLogablesSize : 0 ),
-                                                    (*boxes)[size_t(pfxI)] );
+                                    insert( insertIdx, (*boxes)[size_t(pfxI)] );
                             }
                             else if ( next->IsType<Boxes*>() ) {
                                 auto* boxes= next->Unbox<Boxes*>();
                                 for (auto pfxI= boxes->Size() - 1 ; pfxI >= 0 ; --pfxI )
-                                    logables.emplace( logables.begin() + ( threadInnersSize < 0 ? userLogablesSize : 0 ),
-                                                    (*boxes)[size_t(pfxI)] );
+                                    insert( insertIdx, (*boxes)[size_t(pfxI)] );
                             }
                             else if ( next->IsType<BoxesPA*>() ) {
                                 auto* boxes= next->Unbox<BoxesPA*>();
                                 for (auto pfxI= boxes->Size() - 1 ; pfxI >= 0 ; --pfxI )
-                                    logables.emplace( logables.begin() + ( threadInnersSize < 0 ? userLogablesSize : 0 ),
-                                                    (*boxes)[size_t(pfxI)] );
+                                    insert( insertIdx, (*boxes)[size_t(pfxI)] );
                             }
                             else
-                                logables.emplace( logables.begin() + ( threadInnersSize < 0 ? userLogablesSize : 0 ), *next );
+                                insert( insertIdx, *next );
                     }   }
 
                     // was this the actual? then insert domain-associated logables now
                     else {
                         bool excludeOthers= false;
-                        threadInnersSize= int( logables.Size() ) - userLogablesSize;
+                        threadInnersSize= int( copied ? buffer.Size() : logables.Size() )
+                                        - userLogablesSize;
                         Domain* pflDom= dom;
                         while ( pflDom != nullptr ) {
                             for( auto it= pflDom->PrefixLogables.rbegin() ; it != pflDom->PrefixLogables.rend() ; ++it ) {
@@ -1818,23 +1847,20 @@ void LI::log( LoxImpl*  impl     , Domain*  dom,
                                 if ( prefix.IsType<Boxes*>() ) {
                                     auto* boxes= prefix.Unbox<Boxes*>();
                                     for (auto pfxI= boxes->Size() - 1 ; pfxI >= 0 ; --pfxI )
-                                        logables.emplace( logables.begin(),
-                                                          (*boxes)[size_t(pfxI)] );
+                                        insert( 0, (*boxes)[size_t(pfxI)] );
                                 }
                                 else if ( prefix.IsType<BoxesMA*>() ) {
                                     auto* boxes= prefix.Unbox<BoxesMA*>();
                                     for (auto pfxI= boxes->Size() - 1 ; pfxI >= 0 ; --pfxI )
-                                        logables.emplace( logables.begin(),
-                                                          (*boxes)[size_t(pfxI)] );
+                                        insert( 0, (*boxes)[size_t(pfxI)] );
                                 }
                                 else if ( prefix.IsType<BoxesPA*>() ) {
                                     auto* boxes= prefix.Unbox<BoxesPA*>();
                                     for (auto pfxI= boxes->Size() - 1 ; pfxI >= 0 ; --pfxI )
-                                        logables.emplace( logables.begin(),
-                                                          (*boxes)[size_t(pfxI)] );
+                                        insert( 0, (*boxes)[size_t(pfxI)] );
                                 }
                                 else
-                                    logables.emplace( logables.begin(), prefix );
+                                    insert( 0, prefix );
 
 
                                 if ( it->second == lang::Inclusion::Exclude ) {
@@ -1848,15 +1874,18 @@ void LI::log( LoxImpl*  impl     , Domain*  dom,
                         // found a stoppable one? remove those from thread inner and break
                         if (excludeOthers) {
                             for ( int ii= 0; ii < threadInnersSize ; ++ii )
-                                logables.pop_back();
+                                buffer.pop_back();
                             break;
                 }   }   }
+
+                if ( copied )
+                    toLog= buffer;
             } // end of collection
 
             Logger* logger= dom->GetLogger(i);
             { ALIB_LOCK_RECURSIVE_WITH(*logger)
                 ++logger->CntLogs;
-                logger->Log( *dom, verbosity, logables, impl->scopeInfo );
+                logger->Log( *dom, verbosity, toLog, impl->scopeInfo );
                 logger->TimeOfLastLog= Ticks::Now();
 }       }   }
 
@@ -1871,7 +1900,8 @@ BoxesMA&  LI::acquireInternalLogables(LoxImpl* impl) {
 
 void LI::logInternal(LoxImpl* impl,  Verbosity verbosity, const NString& subDomain, BoxesMA& msg ) {
     ALIB_ASSERT_ERROR(ALOX.IsBootstrapped(), "ALOX", "ALox (ALib) was not properly bootstrapped." )
-    log( impl, findDomain( impl, *impl->internalDomains, subDomain ), verbosity, msg, lang::Inclusion::Exclude );
+    log( impl, findDomain( impl, *impl->internalDomains, subDomain ), verbosity, msg, msg,
+         lang::Inclusion::Exclude );
 
     impl->internalLogables[size_t(--impl->internalLogRecursionCounter)]->clear();
 }
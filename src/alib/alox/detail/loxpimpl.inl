@@ -298,6 +298,17 @@ struct LI
     ALIB_DLL static
     void            Entry( LoxImpl* impl, const NString&  domain, Verbosity verbosity );
 
+    /// Implementation of the method \alib{lox;Lox::Entry} which receives a span of logables.
+    /// The boxes are passed to the loggers without being copied, unless prefix logables
+    /// have to be added.
+    /// @param impl        The implementation struct of the \b Lox.
+    /// @param domain      The domain.
+    /// @param verbosity   The verbosity.
+    /// @param logables    The list of \e Logables.
+    ALIB_DLL static
+    void            Entry( LoxImpl* impl, const NString&  domain, Verbosity verbosity,
+                           const BoxesSpan& logables );
+
     /// Implementation of the method \alib{lox;Lox::IsActive}.
     ///
     /// @param impl         The implementation struct of the \b Lox.
@@ -362,19 +373,31 @@ struct LI
     /// This method is looping over the \e Loggers, checking their verbosity against the given
     /// one, and, if they match, invoke the log method of the \e Logger.
     /// With the first logger identified to be active, the <em>Prefix Objects</em> get
-    /// collected from the scope store.
+    /// collected from the scope store.<br>
+    /// As long as no <em>Prefix Logables</em> apply, the given \p{logables} are passed to the
+    /// loggers as is. Otherwise, they are copied to \p{buffer} (unless they reside there
+    /// already) and the prefixes are inserted.
     /// @param impl         The implementation struct of the \b Lox.
     /// @param dom          The domain to log on
     /// @param verbosity    The verbosity.
     /// @param logables     The objects to log.
+    /// @param buffer       The container used in case prefixes are to be inserted.
     /// @param prefixes     Denotes if prefixes should be included or not.
     ALIB_DLL static
     void            log( LoxImpl*         impl,
                          detail::Domain*  dom,
                          Verbosity        verbosity,
-                         BoxesMA&         logables,
+                         const BoxesSpan& logables,
+                         BoxesMA&         buffer,
                          lang::Inclusion  prefixes    );
 
+    /// Returns the container of logables associated with the current recursion depth of
+    /// acquirements. The container is created if not existing yet, but not cleared.
+    /// @param impl         The implementation struct of the \b Lox.
+    /// @return The container of the current recursion depth.
+    ALIB_DLL static
+    BoxesMA&        logableBuffer( LoxImpl* impl );
+
 
     /// Logs an internal error message using the internal domain tree as defined in
     /// \ref alib::lox::Lox::InternalDomains "Lox::InternalDomains".
@@ -438,8 +461,10 @@ struct LI
     ///
     /// @param impl      The implementation struct of the \b Lox.
     /// @param verbosity The verbosity.
+    /// @param logables  The list of \e Logables, optionally including a domain name at the start.
     ALIB_DLL static
-    void            entryDetectDomainImpl( LoxImpl* impl, Verbosity verbosity);
+    void            entryDetectDomainImpl( LoxImpl* impl, Verbosity verbosity,
+                                           const BoxesSpan& logables );
 
     /// Internal method serving public interface \alib{lox;Lox::Once}.
     ///
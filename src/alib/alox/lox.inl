@@ -806,6 +806,10 @@ class Lox
     /// @return An empty list of boxes.
     BoxesMA&  GetLogableContainer()                { return detail::LI::GetLogableContainer(impl); }
 
+    /// The number of \e Logables that the variadic logging methods, like #Info or #Assert,
+    /// collect on the stack. Only log statements with more arguments allocate heap memory.
+    static constexpr integer LocalLogablesCapacity                                            = 16;
+
     /// Logs the current list of \e Logables that previously have been received using
     /// #GetLogableContainer with the given \p{verbosity}.
     ///
@@ -825,6 +829,20 @@ class Lox
     void Entry( const NString&  domain, Verbosity verbosity )
     { detail::LI::Entry(impl, domain, verbosity); }
 
+    /// Logs the given list of \e Logables with the given \p{verbosity}.
+    /// Any container of boxes, for example, a \alib{boxing;TLocalBoxes;LocalBoxes} instance
+    /// filled on the stack, can be passed. The boxes are handed to the loggers without being
+    /// copied, unless <em>Prefix Logables</em> apply.
+    ///
+    /// As with other variants of this method, this \b Lox has to be acquired before the
+    /// invocation.
+    ///
+    /// @param domain        The domain.
+    /// @param verbosity     The verbosity.
+    /// @param logables      The list of \e Logables.
+    void Entry( const NString&  domain, Verbosity verbosity, const BoxesSpan& logables )
+    { detail::LI::Entry(impl, domain, verbosity, logables); }
+
     /// Logs a list of \e Logables with the given \e %Verbosity.
     ///
     /// If more than one \e Logable is given and the first one is of string-type and comprises a
@@ -852,8 +870,9 @@ class Lox
     template <typename... BoxedObjects>
     void EntryDetectDomain( Verbosity verbosity,  BoxedObjects&&...  logables )
     {
-        detail::LI::GetLogableContainer(impl).Add( std::forward<BoxedObjects>(logables)... );
-        detail::LI::entryDetectDomainImpl( impl, verbosity );
+        LocalBoxes<LocalLogablesCapacity> boxes;
+        boxes.Add( std::forward<BoxedObjects>(logables)... );
+        detail::LI::entryDetectDomainImpl( impl, verbosity, boxes );
     }
 
     /// Logs given logables using \alib{lox;Verbosity;Verbosity::Verbose}.
@@ -870,8 +889,9 @@ class Lox
     template <typename... BoxedObjects>
     void Verbose( BoxedObjects&&... logables )
     {
-        detail::LI::GetLogableContainer(impl).Add( std::forward<BoxedObjects>(logables)... );
-        detail::LI::entryDetectDomainImpl( impl, Verbosity::Verbose );
+        LocalBoxes<LocalLogablesCapacity> boxes;
+        boxes.Add( std::forward<BoxedObjects>(logables)... );
+        detail::LI::entryDetectDomainImpl( impl, Verbosity::Verbose, boxes );
     }
 
     /// Logs given logables using \alib{lox;Verbosity;Verbosity::Info}.
@@ -888,8 +908,9 @@ class Lox
     template <typename... BoxedObjects>
     void Info( BoxedObjects&&... logables )
     {
-        detail::LI::GetLogableContainer(impl).Add( std::forward<BoxedObjects>(logables)... );
-        detail::LI::entryDetectDomainImpl( impl, Verbosity::Info );
+        LocalBoxes<LocalLogablesCapacity> boxes;
+        boxes.Add( std::forward<BoxedObjects>(logables)... );
+        detail::LI::entryDetectDomainImpl( impl, Verbosity::Info, boxes );
     }
 
     /// Logs given logables using \alib{lox;Verbosity;Verbosity::Warning}.
@@ -906,8 +927,9 @@ class Lox
     template <typename... BoxedObjects>
     void Warning( BoxedObjects&&... logables )
     {
-        detail::LI::GetLogableContainer(impl).Add( std::forward<BoxedObjects>(logables)... );
-        detail::LI::entryDetectDomainImpl( impl, Verbosity::Warning );
+        LocalBoxes<LocalLogablesCapacity> boxes;
+        boxes.Add( std::forward<BoxedObjects>(logables)... );
+        detail::LI::entryDetectDomainImpl( impl, Verbosity::Warning, boxes );
     }
 
     /// Logs given logables using \alib{lox;Verbosity;Verbosity::Error}.
@@ -924,8 +946,9 @@ class Lox
     template <typename... BoxedObjects>
     void Error( BoxedObjects&&... logables )
     {
-        detail::LI::GetLogableContainer(impl).Add( std::forward<BoxedObjects>(logables)... );
-        detail::LI::entryDetectDomainImpl( impl, Verbosity::Error );
+        LocalBoxes<LocalLogablesCapacity> boxes;
+        boxes.Add( std::forward<BoxedObjects>(logables)... );
+        detail::LI::entryDetectDomainImpl( impl, Verbosity::Error, boxes );
     }
 
     /// Logs given logables only if the parameter \p{condition} is not \c true.
@@ -944,8 +967,9 @@ class Lox
     template <typename... BoxedObjects>
     void Assert( bool condition, BoxedObjects&&... logables ) {
         if (!condition ) {
-            detail::LI::GetLogableContainer(impl).Add( std::forward<BoxedObjects>(logables)... );
-            detail::LI::entryDetectDomainImpl( impl, Verbosity::Error );
+            LocalBoxes<LocalLogablesCapacity> boxes;
+            boxes.Add( std::forward<BoxedObjects>(logables)... );
+            detail::LI::entryDetectDomainImpl( impl, Verbosity::Error, boxes );
         }
         else
             detail::LI::IncreaseLogCounter( impl );
@@ -964,8 +988,9 @@ class Lox
     void If( bool condition, const NString& domain, Verbosity verbosity,
              BoxedObjects&&... logables ) {
         if ( condition ) {
-            detail::LI::GetLogableContainer(impl).Add( std::forward<BoxedObjects>(logables)... );
-            detail::LI::Entry( impl, domain, verbosity );
+            LocalBoxes<LocalLogablesCapacity> boxes;
+            boxes.Add( std::forward<BoxedObjects>(logables)... );
+            detail::LI::Entry( impl, domain, verbosity, boxes );
         }
         else
             detail::LI::IncreaseLogCounter( impl );
@@ -990,8 +1015,9 @@ class Lox
     template <typename... BoxedObjects>
     void If( bool condition, Verbosity verbosity, BoxedObjects&&... logables ) {
         if ( condition ) {
-            detail::LI::GetLogableContainer(impl).Add( std::forward<BoxedObjects>(logables)... );
-            detail::LI::entryDetectDomainImpl( impl, verbosity );
+            LocalBoxes<LocalLogablesCapacity> boxes;
+            boxes.Add( std::forward<BoxedObjects>(logables)... );
+            detail::LI::entryDetectDomainImpl( impl, verbosity, boxes );
         }
         else
             detail::LI::IncreaseLogCounter( impl );
@@ -65,7 +65,7 @@ StandardConverter::~StandardConverter() {
         delete elem;
 }
 
-void StandardConverter::ConvertObjects( AString& target, BoxesMA& logables  ) {
+void StandardConverter::ConvertObjects( AString& target, const BoxesSpan& logables  ) {
     ++cntRecursion;
 
         ALIB_ASSERT_WARNING( cntRecursion < 5, "ALOX", "Logging recursion depth >= 5" )
@@ -686,7 +686,7 @@ void TextLogger::ClearReplacements()                            { GetReplacement
 void TextLogger::ResetAutoSizes()                                   { Converter->ResetAutoSizes(); }
 
 
-void TextLogger::Log( detail::Domain& domain, Verbosity verbosity, BoxesMA& logables,
+void TextLogger::Log( detail::Domain& domain, Verbosity verbosity, const BoxesSpan& logables,
                       detail::ScopeInfo& scope ) {
     // we store the current msgBuf length and reset the buffer to this length when exiting.
     // This allows recursive calls! Recursion might happen with the evaluation of the
@@ -26,7 +26,7 @@ class ObjectConverter
     /// The conversion method.
     /// @param target     An AString that takes the result.
     /// @param logables   The objects to convert.
-    virtual void        ConvertObjects( AString& target, BoxesMA& logables )                     =0;
+    virtual void        ConvertObjects( AString& target, const BoxesSpan& logables )             =0;
 
     /// If this converter uses an \alib{strings::util;AutoSizes} object, this method passes
     /// an external object to use.
@@ -97,7 +97,7 @@ class StandardConverter : public ObjectConverter
     /// @param target     An AString that takes the result.
     /// @param logables   The objects to convert.
     ALIB_DLL
-    virtual void        ConvertObjects( AString& target, BoxesMA& logables )               override;
+    virtual void        ConvertObjects( AString& target, const BoxesSpan& logables )       override;
 
     /// Checks if the first formatter in #Formatters is of type
     /// \alib{format;FormatterPythonStyle}. If so, its \b AutoSizes member is set to
@@ -400,7 +400,7 @@ class TextLogger : public Logger
     /// @param logables  The list of objects to log.
     /// @param scope     Information about the scope of the <em>Log Statement</em>..
     ALIB_DLL
-    virtual void Log( detail::Domain& domain, Verbosity verbosity, BoxesMA& logables,
+    virtual void Log( detail::Domain& domain, Verbosity verbosity, const BoxesSpan& logables,
                       detail::ScopeInfo& scope)                                            override;
 
   //################################################################################################
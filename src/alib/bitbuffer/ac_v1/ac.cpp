@@ -90,6 +90,10 @@ void ArrayCompressor::Statistics::Print(AString& result, const String& headline,
                            , double(100 * allSizes   ) / double( ArrayCompressor::NumberOfAlgorithms * sumUncompressed )
                            , double(100 * winnerSizes) / double(sumUncompressed)     );
     }
+    if( ctdEstimations )
+        fmt.Format( result, "Estimation   {:>8,}     (average of {} estimations)\n"
+                          , estimationTime.InNanoseconds() / ctdEstimations
+                          , ctdEstimations                                                     );
     result.NewLine();
 }
 
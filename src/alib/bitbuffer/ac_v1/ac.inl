@@ -30,14 +30,16 @@ namespace ac_v1 {
 /// The general assumption of the approaches (besides the <em>Huffman coding</em>) is that the
 /// data contains "signal data", which is either
 /// - sparsely filled,
-/// - has incremental values, or
-/// - has just values of a certain smaller range.
+/// - has incremental values,
+/// - has just values of a certain smaller range, locally or over the whole array,
+/// - increases with a nearly constant rate (e.g., timestamps), or
+/// - changes with small steps in both directions (e.g., noisy measurements).
 /// Also, combinations of these attributes are matched. Such data is often found in real-world
 /// applications and may be compressed much better than the generic \e Huffman approach may achieve.
 class ArrayCompressor
 {
   public:
-    static constexpr int NumberOfAlgorithms= 6;  ///< The number of algorithms implemented.
+    static constexpr int NumberOfAlgorithms= 10; ///< The number of algorithms implemented.
 
     /// Helper-class that allows access the array data. The design goal for introducing
     /// this class (instead of providing array references in the interface methods) is
@@ -252,9 +254,37 @@ class ArrayCompressor
         /// Huffman encoding (byte based).
         Huffman            =  32,
 
+        /// Frame of reference with a bit width per block of values, while values exceeding
+        /// this width are patched in as exceptions.
+        PFOR               =  64,
+
+        /// The differences between adjacent differences are written using a few buckets of
+        /// bit widths.
+        DeltaOfDelta       = 128,
+
+        /// The zig-zag encoded differences of adjacent values are written with a bit width per
+        /// block of values.
+        ZigZagDelta        = 256,
+
+        /// Runs of equal values are written as length and value, others are bit-packed.
+        RLEBitPacked       = 512,
+
         /// End of enumeration marker necessary for use of \ref ALIB_ENUMS_MAKE_ITERABLE with
         /// this enum type.
-        END_OF_ENUM        = 64,
+        END_OF_ENUM        = 1024,
+    };
+
+    /// Denotes how method #Compress selects the algorithm to use, if more than one is given.
+    enum class Selection {
+        /// Each algorithm is performed and the one with the shortest result is chosen.
+        /// With debug-compilations and symbol \ref ALIB_DEBUG_ARRAY_COMPRESSION set, the result
+        /// of each algorithm is read back and compared to the original data.
+        Trial,
+
+        /// The result sizes of all algorithms are calculated in one pass over the data, using
+        /// method #Estimate. Only the algorithm with the shortest result is performed.
+        /// As the calculated sizes are exact, the same algorithm as with \b Trial is chosen.
+        Estimation,
     };
 
     /// Statistic struct to collect information about the performance of different array
@@ -296,6 +326,15 @@ class ArrayCompressor
         /// The number of executed compressions.
         int             ctdCompressions                                                          =0;
 
+        /// The overall time spent in method #Estimate when compressing with
+        /// lib{bitbuffer::ac_v1::ArrayCompressor;Selection::Estimation}.
+        /// Note that with this selection mode, field #writeTimes receives only the time of the
+        /// chosen algorithm, and fields #sumCompressed receive the estimated sizes.
+        Ticks::Duration estimationTime                                                          ={};
+
+        /// The number of estimations measured with #estimationTime.
+        int             ctdEstimations                                                           =0;
+
 
         /// Adds another statistic object to this one.
         /// @param other The statistics to add to this one.
@@ -312,6 +351,8 @@ class ArrayCompressor
             }
             sumUncompressed+= other.sumUncompressed;
             ctdCompressions+= other.ctdCompressions;
+            estimationTime += other.estimationTime;
+            ctdEstimations += other.ctdEstimations;
             return *this;
         }
 
@@ -335,6 +376,52 @@ class ArrayCompressor
     /// Deleted default constructor (this class cannot be created)
     ArrayCompressor()                                                                       =delete;
 
+  protected:
+    /// Writes the number of the algorithm used. Numbers below \c 7 are written with three bits,
+    /// which was the format before further algorithms had been added. Higher numbers are written
+    /// as \c 7, followed by three more bits.
+    /// @param bw     The bit writer to use.
+    /// @param algoNo The sequential number of the algorithm.
+    static void         writeAlgorithmNo( BitWriter& bw, int algoNo ) {
+        if( algoNo < 7 )
+            bw.Write<3>( algoNo );
+        else
+            bw.Write<6>( 7 | ((algoNo - 7) << 3) );
+    }
+
+    /// Returns the number of bits that #writeAlgorithmNo writes.
+    /// @param algoNo The sequential number of the algorithm.
+    /// @return \c 3 for algorithm numbers below \c 7, \c 6 otherwise.
+    static constexpr size_t algorithmNoBits( int algoNo )       { return algoNo < 7 ? 3 : 6; }
+
+    /// Reads the algorithm written with #writeAlgorithmNo.
+    /// @param br The bit reader to use.
+    /// @return The algorithm.
+    static Algorithm    readAlgorithm( BitReader& br ) {
+        int algoNo= br.Read<3>();
+        if( algoNo == 7 )
+            algoNo+= br.Read<3>();
+        return Algorithm( 1 << algoNo );
+    }
+
+    /// Writes the given array using the given single algorithm.
+    /// @tparam TValue The integral type of array data to compress.
+    /// @param  bw     The bit writer to use.
+    /// @param  data   The array to compress.
+    /// @param  algo   The algorithm to use.
+    template <typename TValue>
+    static void         write( BitWriter& bw, Array<TValue>& data, Algorithm algo );
+
+    /// Reads the given array using the given single algorithm.
+    /// @tparam TValue The integral type of array data to decompress.
+    /// @param  br     The bit reader to use.
+    /// @param  data   The array to decompress data to.
+    /// @param  algo   The algorithm to use.
+    template <typename TValue>
+    static void         read( BitReader& br, Array<TValue>& data, Algorithm algo );
+
+  public:
+
 
 // clang 14.0.6 (as of today 221216) falsely reports:
 // "warning: '@tparam' command used in a comment that is not attached to a template declaration
@@ -351,7 +438,10 @@ class ArrayCompressor
     /// corresponding mask in \p{algorithmsToTry}. However, in many use case scenarios, the
     /// execution time is a less critical design factor than the compression factor reached.
     /// The decompression speed is solely dependent on the algorithm finally chosen, not on
-    /// the number of algorithms tested on compression.
+    /// the number of algorithms tested on compression.<br>
+    /// Alternatively, with \p{selection} set to \alib{bitbuffer::ac_v1::ArrayCompressor;Selection::Estimation},
+    /// the result sizes of all algorithms are calculated with one pass over the data and only
+    /// the best algorithm is performed.
     ///
     /// \attention
     ///   If only one algorithm is specified in parameter \p{algorithmsToTry}, then no
@@ -371,6 +461,8 @@ class ArrayCompressor
     ///                   which algorithm is most efficient for typical datasets found and
     ///                   a programmer may, based on such heuristics decide to exclude certain
     ///                   algorithms not efficient in a use case.
+    /// @param selection  Determines how the algorithm is chosen, if more than one is given.
+    ///                   Defaults to \alib{bitbuffer::ac_v1::ArrayCompressor;Selection::Trial}.
     /// @return A pair of value containing the resulting size in bits and the algorithm
     ///         chosen.
 
@@ -379,9 +471,57 @@ class ArrayCompressor
     std::pair<size_t, Algorithm>    Compress  ( BitWriter&      bitWriter,
                                                 Array<TValue>&  data,
                                                 Algorithm       algorithmsToTry = Algorithm::ALL,
-                                                Statistics*     statistics      = nullptr
+                                                Statistics*     statistics      = nullptr,
+                                                Selection       selection       = Selection::Trial
                                                 );
 
+    /// Calculates the number of bits that each of the given algorithms produces when compressing
+    /// the given array. All sizes are calculated with a single pass over the data, which collects
+    /// the minimum and maximum values and differences, runs of equal values, the differences of
+    /// adjacent values and differences and a histogram of the bytes.<br>
+    /// The sizes are exact and do not include the bits that #Compress writes to denote the
+    /// chosen algorithm.
+    ///
+    /// The minimum and maximum values are stored in \p{data}, as done by
+    /// \alib{bitbuffer::ac_v1::ArrayCompressor;Array::calcMinMax}. Apart from this, the method
+    /// does not modify \p{data}. Hence, it is allowed to invoke it in parallel for different
+    /// algorithms and the same array, if \b calcMinMax was invoked before.
+    ///
+    /// @tparam TValue     The integral type of array data.
+    /// @param  data       The array to calculate the compressed sizes for.
+    /// @param  algorithms The algorithms to calculate the sizes for.
+    /// @param  sizes      An array of length #NumberOfAlgorithms that receives the sizes.
+    ///                    Only the entries that correspond to the sequential numbers of the
+    ///                    given \p{algorithms} are set.
+    template <typename TValue>
+    static
+    void                            Estimate  ( Array<TValue>&  data,
+                                                Algorithm       algorithms,
+                                                size_t*         sizes            );
+
+    /// Compresses the given array with that one of the given algorithms, which has the smallest
+    /// size in \p{estimatedSizes}. This is used by method #Compress with selection mode
+    /// \alib{bitbuffer::ac_v1::ArrayCompressor;Selection::Estimation} and may be used when the
+    /// sizes were calculated otherwise, for example, in parallel.
+    /// With debug-compilations, it is asserted that the given size is met.
+    ///
+    /// @tparam TValue         The integral type of array data to compress.
+    /// @param  bitWriter      A bit writer to compress the data to.
+    /// @param  data           The array to compress.
+    /// @param  algorithms     The set of algorithms to choose from.
+    /// @param  estimatedSizes The sizes calculated with #Estimate for the given \p{algorithms}.
+    /// @param  statistics     An optional statistics record. See method #Compress for more
+    ///                        information.
+    /// @return A pair of value containing the resulting size in bits and the algorithm
+    ///         chosen.
+    template <typename TValue>
+    static
+    std::pair<size_t, Algorithm>    CompressEstimated( BitWriter&      bitWriter,
+                                                       Array<TValue>&  data,
+                                                       Algorithm       algorithms,
+                                                       const size_t*   estimatedSizes,
+                                                       Statistics*     statistics  = nullptr );
+
 
     /// Decompresses an integral array from the given bit reader, which previously was encoded
     /// with methods #Compress.
@@ -427,12 +567,53 @@ ALIB_ENUMS_MAKE_ITERABLE( alib::bitbuffer::ac_v1::ArrayCompressor::Algorithm,
 ALIB_EXPORT namespace alib {  namespace bitbuffer { namespace ac_v1 {
 
 #include "ALib.Lang.CIFunctions.H"
+template <typename TValue>
+void ArrayCompressor::write( BitWriter& bw, Array<TValue>& data, Algorithm algo ) {
+    ALIB_WARNINGS_ALLOW_SPARSE_ENUM_SWITCH
+    switch( algo ) {
+        case Algorithm::Uncompressed: writeUncompressed(bw, data); break;
+        case Algorithm::MinMax:       writeMinMax      (bw, data); break;
+        case Algorithm::Sparse:       writeSparse      (bw, data); break;
+        case Algorithm::VerySparse:   writeVerySparse  (bw, data); break;
+        case Algorithm::Incremental:  writeIncremental (bw, data); break;
+        case Algorithm::Huffman:      writeHuffman     (bw, data); break;
+        case Algorithm::PFOR:         writePFOR        (bw, data); break;
+        case Algorithm::DeltaOfDelta: writeDeltaOfDelta(bw, data); break;
+        case Algorithm::ZigZagDelta:  writeZigZagDelta (bw, data); break;
+        case Algorithm::RLEBitPacked: writeRLEBitPacked(bw, data); break;
+        default:  ALIB_ERROR("BITBUFFER/AC", "Internal error: Unknown compression algorithm")
+                  break;
+    }
+    ALIB_WARNINGS_RESTORE
+}
+
+template <typename TValue>
+void ArrayCompressor::read( BitReader& br, Array<TValue>& data, Algorithm algo ) {
+    ALIB_WARNINGS_ALLOW_SPARSE_ENUM_SWITCH
+    switch( algo ) {
+        case Algorithm::Uncompressed:   readUncompressed(br, data ); break;
+        case Algorithm::MinMax:         readMinMax      (br, data ); break;
+        case Algorithm::Sparse:         readSparse      (br, data ); break;
+        case Algorithm::VerySparse:     readVerySparse  (br, data ); break;
+        case Algorithm::Incremental:    readIncremental (br, data ); break;
+        case Algorithm::Huffman:        readHuffman     (br, data ); break;
+        case Algorithm::PFOR:           readPFOR        (br, data ); break;
+        case Algorithm::DeltaOfDelta:   readDeltaOfDelta(br, data ); break;
+        case Algorithm::ZigZagDelta:    readZigZagDelta (br, data ); break;
+        case Algorithm::RLEBitPacked:   readRLEBitPacked(br, data ); break;
+        default: ALIB_ERROR("BITBUFFER","Internal error: Unknown compression "
+                                        "algorithm number read")   break;
+    }
+    ALIB_WARNINGS_RESTORE
+}
+
 template <typename TValue>
 std::pair<size_t, ArrayCompressor::Algorithm> ArrayCompressor::Compress(
                                                 BitWriter&      bw,
                                                 Array<TValue>&  data,
                                                 Algorithm       algorithmsToTry,
-                                                Statistics*     statistics          ) {
+                                                Statistics*     statistics,
+                                                Selection       selection           ) {
 ALIB_ASSERT_ERROR( data.length() * bitsof(TValue) < bw.RemainingSize(), "BITBUFFER/AC",
     "BitBuffer is smaller than uncompressed data."
     " No buffer overflow checks are performed during compression." )
@@ -445,6 +626,18 @@ auto initialBufferFill = bw.Usage();
 int  multipleAlgorithms= CountElements(algorithmsToTry) > 1;
 ALIB_ASSERT_ERROR(int(algorithmsToTry) != 0, "BITBUFFER/AC", "No algorithms to check given" )
 
+// calculate the sizes and write only the best algorithm
+if( multipleAlgorithms && selection == Selection::Estimation ) {
+    size_t sizes[NumberOfAlgorithms];
+    Ticks tm;
+    Estimate( data, algorithmsToTry, sizes );
+    if( statistics ) {
+        statistics->estimationTime+= tm.Age();
+        statistics->ctdEstimations++;
+    }
+    return CompressEstimated( bw, data, algorithmsToTry, sizes, statistics );
+}
+
 auto bestAlgo  = ArrayCompressor::Algorithm::NONE;
 auto bestAlgoNo= (std::numeric_limits<int>::max)();
 auto lastAlgo  = ArrayCompressor::Algorithm::NONE;
@@ -465,20 +658,9 @@ for( ArrayCompressor::Algorithm algo :  enumops::EnumIterator<ArrayCompressor::A
 
     // write algo number
     if( multipleAlgorithms )
-        bw.Write<3>( algoNo );
-        Ticks tm;
-    ALIB_WARNINGS_ALLOW_SPARSE_ENUM_SWITCH
-    switch( lastAlgo= algo ) {
-        case Algorithm::Uncompressed: writeUncompressed(bw, data); break;
-        case Algorithm::MinMax:       writeMinMax      (bw, data); break;
-        case Algorithm::Sparse:       writeSparse      (bw, data); break;
-        case Algorithm::VerySparse:   writeVerySparse  (bw, data); break;
-        case Algorithm::Incremental:  writeIncremental (bw, data); break;
-        case Algorithm::Huffman:      writeHuffman     (bw, data); break;
-        default:  ALIB_ERROR("BITBUFFER/AC",
-                         "Internal error: Unknown compression algorithm number read")   break;
-    }
-    ALIB_WARNINGS_RESTORE
+        writeAlgorithmNo( bw, algoNo );
+    Ticks tm;
+    write( bw, data, lastAlgo= algo );
     auto bufferFill= bw.Usage();
 
     if( statistics ) {
@@ -500,27 +682,13 @@ for( ArrayCompressor::Algorithm algo :  enumops::EnumIterator<ArrayCompressor::A
         bw.Flush();
         BitReader br(bw.GetBuffer(), initialBufferState);
         if( multipleAlgorithms ) {
-            auto readBackAlgo=  Algorithm( 1 << br.Read<3>() );
+            auto readBackAlgo=  readAlgorithm( br );
             ALIB_ASSERT_ERROR( readBackAlgo == algo, "BITBUFFER/AC",
                                "Wrong algorithm id was read back. This must never happen." )
         }
 
         data.dbgIsCheckRead= true;
-
-            ALIB_WARNINGS_ALLOW_SPARSE_ENUM_SWITCH
-            switch( algo ) {
-                case Algorithm::Uncompressed:   readUncompressed(br, data ); break;
-                case Algorithm::MinMax:         readMinMax      (br, data ); break;
-                case Algorithm::Sparse:         readSparse      (br, data ); break;
-                case Algorithm::VerySparse:     readVerySparse  (br, data ); break;
-                case Algorithm::Incremental:    readIncremental (br, data ); break;
-                case Algorithm::Huffman:        readHuffman     (br, data ); break;
-                default:   ALIB_ERROR("BITBUFFER",
-                              "Internal error: Unknown compression algorithm number read")
-                           break;
-            }
-            ALIB_WARNINGS_RESTORE
-
+            read( br, data, algo );
         data.dbgIsCheckRead= false;
     }
     #endif
@@ -541,25 +709,97 @@ if( statistics ) {
 // write with best algorithm found (if this was not the last one anyhow)
 if( multipleAlgorithms && (bestAlgo != lastAlgo) ) {
     bw.Reset( initialBufferState );
-    bw.Write<3>( bestAlgoNo );
-    ALIB_WARNINGS_ALLOW_SPARSE_ENUM_SWITCH
-    switch( bestAlgo ) {
-        case Algorithm::Uncompressed: writeUncompressed(bw, data); break;
-        case Algorithm::MinMax:       writeMinMax      (bw, data); break;
-        case Algorithm::Sparse:       writeSparse      (bw, data); break;
-        case Algorithm::VerySparse:   writeVerySparse  (bw, data); break;
-        case Algorithm::Incremental:  writeIncremental (bw, data); break;
-        case Algorithm::Huffman:      writeHuffman     (bw, data); break;
-        default:  ALIB_ERROR("BITBUFFER/AC", "Internal error: Unknown compression "
-                                             "algorithm number read")   break;
-    }
-    ALIB_WARNINGS_RESTORE
+    writeAlgorithmNo( bw, bestAlgoNo );
+    write( bw, data, bestAlgo );
 }
 
 bw.Flush();
 return std::make_pair( leastBits, bestAlgo );
 }
 
+template <typename TValue>
+void ArrayCompressor::Estimate( Array<TValue>& data, Algorithm algorithms, size_t* sizes ) {
+    estimateSizes( data, algorithms, sizes );
+}
+
+template <typename TValue>
+std::pair<size_t, ArrayCompressor::Algorithm> ArrayCompressor::CompressEstimated(
+                                                BitWriter&      bw,
+                                                Array<TValue>&  data,
+                                                Algorithm       algorithms,
+                                                const size_t*   estimatedSizes,
+                                                Statistics*     statistics          ) {
+    ALIB_ASSERT_ERROR( data.length() * bitsof(TValue) < bw.RemainingSize(), "BITBUFFER/AC",
+        "BitBuffer is smaller than uncompressed data."
+        " No buffer overflow checks are performed during compression." )
+    ALIB_ASSERT_ERROR(int(algorithms) != 0, "BITBUFFER/AC", "No algorithms to check given" )
+    bool multipleAlgorithms= CountElements(algorithms) > 1;
+
+    // find the algorithm with the least size, including the algorithm number written.
+    // (The first one wins with equal sizes, as done with trial compression.)
+    auto   bestAlgo  = Algorithm::NONE;
+    int    bestAlgoNo= -1;
+    size_t leastBits = 0;
+    int    algoNo    = -1;
+    for( Algorithm algo : enumops::EnumIterator<Algorithm>() ) {
+        algoNo++;
+        if( !HasBits( algorithms, algo ) )
+            continue;
+        size_t bits= estimatedSizes[algoNo] + ( multipleAlgorithms ? algorithmNoBits(algoNo) : 0 );
+        if( bestAlgoNo < 0 || bits < leastBits ) {
+            bestAlgo  = algo;
+            bestAlgoNo= algoNo;
+            leastBits = bits;
+    }   }
+
+    // write
+    auto initialBufferFill = bw.Usage();
+    #if ALIB_DEBUG_ARRAY_COMPRESSION
+        auto initialBufferState= bw.GetIndex();
+    #endif
+    if( multipleAlgorithms )
+        writeAlgorithmNo( bw, bestAlgoNo );
+    size_t headerBits= bw.Usage() - initialBufferFill;
+    Ticks tm;
+    write( bw, data, bestAlgo );
+    size_t bits= bw.Usage() - initialBufferFill;
+    ALIB_ASSERT_ERROR( bits == headerBits + estimatedSizes[bestAlgoNo], "BITBUFFER/AC",
+                       "Estimated size {} of algorithm #{} differs from written size {}.",
+                       estimatedSizes[bestAlgoNo], bestAlgoNo, bits - headerBits )
+
+    if( statistics ) {
+        statistics->writeTimes[bestAlgoNo]+= tm.Age();
+        algoNo= -1;
+        for( Algorithm algo : enumops::EnumIterator<Algorithm>() ) {
+            algoNo++;
+            if( HasBits( algorithms, algo ) )
+                statistics->sumCompressed[algoNo]+= ( estimatedSizes[algoNo]
+                         + ( multipleAlgorithms ? algorithmNoBits(algoNo) : 0 ) ) / 8;
+        }
+        statistics->ctdCompressions++;
+        statistics->sumUncompressed+= data.length() * sizeof(TValue);
+        statistics->ctdWins           [bestAlgoNo]++;
+        statistics->sumCompressedWon  [bestAlgoNo]+= bits/8;
+        statistics->sumUnCompressedWon[bestAlgoNo]+= data.length() * sizeof(TValue);
+    }
+
+    // DEBUG-Test: Read back values right away and check for equal data
+    #if ALIB_DEBUG_ARRAY_COMPRESSION
+    {
+        bw.Flush();
+        BitReader br(bw.GetBuffer(), initialBufferState);
+        if( multipleAlgorithms )
+            readAlgorithm( br );
+        data.dbgIsCheckRead= true;
+            read( br, data, bestAlgo );
+        data.dbgIsCheckRead= false;
+    }
+    #endif
+
+    bw.Flush();
+    return std::make_pair( bits, bestAlgo );
+}
+
 template <typename TValue>
 void ArrayCompressor::Decompress(   BitReader&      br,
                                     Array<TValue>&  data,
@@ -570,20 +810,9 @@ void ArrayCompressor::Decompress(   BitReader&      br,
     bool multipleAlgorithms= CountElements(algorithmsToTry) > 1;
 
     Ticks tm;
-    auto algo=  multipleAlgorithms  ?  Algorithm( 1 << br.Read<3>() )
+    auto algo=  multipleAlgorithms  ?  readAlgorithm( br )
                                     :  algorithmsToTry;
-    ALIB_WARNINGS_ALLOW_SPARSE_ENUM_SWITCH
-    switch( algo ) {
-        case Algorithm::Uncompressed:   readUncompressed(br, data ); break;
-        case Algorithm::MinMax:         readMinMax      (br, data ); break;
-        case Algorithm::Sparse:         readSparse      (br, data ); break;
-        case Algorithm::VerySparse:     readVerySparse  (br, data ); break;
-        case Algorithm::Incremental:    readIncremental (br, data ); break;
-        case Algorithm::Huffman:        readHuffman     (br, data ); break;
-        default: ALIB_ERROR("BITBUFFER","Internal error: Unknown compression "
-                                        "algorithm number read")   break;
-    }
-    ALIB_WARNINGS_RESTORE
+    read( br, data, algo );
 
     if( statistics ) {
         auto algoNo= ToSequentialEnumeration( algo );
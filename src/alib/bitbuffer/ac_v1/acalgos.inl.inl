@@ -7,6 +7,73 @@
 //==================================================================================================
 ALIB_EXPORT namespace alib {  namespace bitbuffer { namespace ac_v1 {
 
+/// The number of values that the algorithms convert into a local array to pass them to
+/// the bulk methods \alib{bitbuffer;BitWriter::Write(lang::ShiftOpRHS, const TValue*, size_t)}
+/// and \alib{bitbuffer;BitReader::Read(lang::ShiftOpRHS, TValue*, size_t)}.
+inline constexpr size_t BulkBlockSize= 256;
+
+/// The number of bits used by algorithm \b PFOR to store the position of an exception within a
+/// block, which defines its block size.
+inline constexpr int    PFORPositionBits= 7;
+
+/// The number of values that algorithms \b PFOR and \b ZigZagDelta store with a common bit width.
+inline constexpr size_t PFORBlockSize= size_t(1) << PFORPositionBits;
+
+/// The bit widths of the four buckets that algorithm \b DeltaOfDelta uses to store non-zero
+/// differences of adjacent deltas. The widths are limited to the bit width of the array type.
+inline constexpr int    DeltaOfDeltaBucketWidths[4]= { 7, 12, 20, 64 };
+
+/// The minimum number of equal values that algorithm \b RLEBitPacked stores as a run.
+inline constexpr size_t RLEMinRunLength= 8;
+
+/// Zig-zag encodes the given value, which is interpreted as a signed value in two's complement
+/// notation.
+/// @tparam TUI   The unsigned integral type.
+/// @param  value The value to encode.
+/// @return The encoded value.
+template<typename TUI>
+constexpr TUI zigZagEncode( TUI value ) {
+    return TUI( TUI( value << 1 ) ^ TUI( TUI(0) - TUI( value >> (bitsof(TUI) - 1) ) ) );
+}
+
+/// Reverts the encoding performed with \alib{bitbuffer::ac_v1;zigZagEncode}.
+/// @tparam TUI   The unsigned integral type.
+/// @param  value The value to decode.
+/// @return The decoded value.
+template<typename TUI>
+constexpr TUI zigZagDecode( TUI value ) {
+    return TUI( TUI( value >> 1 ) ^ TUI( TUI(0) - TUI( value & 1 ) ) );
+}
+
+/// Converts a value received with \alib{bitbuffer::ac_v1;ArrayCompressor::Array::get} to the
+/// bit pattern of the original value. For signed types, this reverts the zig-zag encoding
+/// performed by the accessor. This is used by the algorithms that calculate differences of
+/// adjacent values, which have to wrap around in two's complement notation.
+/// @tparam TI    The integral type of the array.
+/// @param  value The value received from the array.
+/// @return The bit pattern of the array value.
+template<typename TI>
+constexpr typename std::make_unsigned<TI>::type
+toRaw( typename std::make_unsigned<TI>::type value ) {
+    if constexpr ( std::is_unsigned<TI>::value )
+        return value;
+    else
+        return zigZagDecode( value );
+}
+
+/// Reverts the conversion performed with \alib{bitbuffer::ac_v1;toRaw}.
+/// @tparam TI    The integral type of the array.
+/// @param  value The bit pattern of the array value.
+/// @return The value to pass to \alib{bitbuffer::ac_v1;ArrayCompressor::Array::set}.
+template<typename TI>
+constexpr typename std::make_unsigned<TI>::type
+fromRaw( typename std::make_unsigned<TI>::type value ) {
+    if constexpr ( std::is_unsigned<TI>::value )
+        return value;
+    else
+        return zigZagEncode( value );
+}
+
 /// Writes data compressed using class \alib{bitbuffer::ac_v1;HuffmanEncoder}.
 /// @tparam TI    The integral type of the array to write.
 /// @param  bw    The bit writer to use.
@@ -118,9 +185,13 @@ void writeMinMax(BitWriter& bw, ArrayCompressor::Array<TI>& data ) {
     if( !bitCnt )
         return;
 
-    for(size_t i= 0; i < data.length(); ++i )
-        bw.Write( bitCnt, TUI( data.get(i) - data.min ) );
-}
+    TUI block[BulkBlockSize];
+    for(size_t i= 0; i < data.length(); i+= BulkBlockSize ) {
+        size_t qty= (std::min)( BulkBlockSize, data.length() - i );
+        for(size_t j= 0; j < qty; ++j )
+            block[j]= TUI( data.get(i + j) - data.min );
+        bw.Write( bitCnt, block, qty );
+}   }
 
 /// Reads data compressed with method \alib{bitbuffer::ac_v1;writeMinMax}.
 /// @tparam TI   The integral type of the array to read back.
@@ -137,9 +208,13 @@ void readMinMax( BitReader& br, ArrayCompressor::Array<TI>& data ) {
             data.set(i, min );
         return;
     }
-    for(size_t i= 0; i < data.length(); ++i)
-        data.set(i, br.Read<TUI>( bitCnt ) + min );
-}
+    TUI block[BulkBlockSize];
+    for(size_t i= 0; i < data.length(); i+= BulkBlockSize ) {
+        size_t qty= (std::min)( BulkBlockSize, data.length() - i );
+        br.Read( bitCnt, block, qty );
+        for(size_t j= 0; j < qty; ++j )
+            data.set(i + j, TUI( block[j] + min ) );
+}   }
 
 /// Writes array data assuming it is sparsely set.
 /// @tparam TI    The integral type of the array to write.
@@ -242,8 +317,13 @@ void writeVerySparse(BitWriter& bw, ArrayCompressor::Array<TI>& data ) {
                 else
                 {                                  // write an extra 1 to indicate non-sparse mode
                     bw.Write( bitCntRep +1, ((segEnd - segStart) << 1) | 1 );
-                    for( size_t j= segStart; j < segEnd; ++j)
-                        bw.Write( bitCntVal, TUI(data.get(j) - data.min ) );
+                    TUI block[BulkBlockSize];
+                    for( size_t j= segStart; j < segEnd; j+= BulkBlockSize) {
+                        size_t qty= (std::min)( BulkBlockSize, segEnd - j );
+                        for( size_t k= 0; k < qty; ++k)
+                            block[k]= TUI(data.get(j + k) - data.min );
+                        bw.Write( bitCntVal, block, qty );
+                    }
             }   }
 
             // next segment
@@ -289,9 +369,13 @@ void readVerySparse( BitReader& br, ArrayCompressor::Array<TI>& data ) {
                 data.set(i, val);
         }
         else { // different values
-            for( size_t i= segStart ; i < segEnd ; ++i )
-                data.set(i, br.Read<TUI>( bitCntVal ) + minVal);
-        }
+            TUI block[BulkBlockSize];
+            for( size_t i= segStart ; i < segEnd ; i+= BulkBlockSize ) {
+                size_t qty= (std::min)( BulkBlockSize, segEnd - i );
+                br.Read( bitCntVal, block, qty );
+                for( size_t j= 0 ; j < qty ; ++j )
+                    data.set(i + j, TUI( block[j] + minVal ) );
+        }   }
         segStart= segEnd;
 }   }
 
@@ -376,6 +460,636 @@ void readIncremental( BitReader& br, ArrayCompressor::Array<TI>& data) {
         data.set(i, prevVal= val);
 }   }
 
+/// Chooses the bit width of a block of algorithm \b PFOR that minimizes the size of the block.
+/// Values that do not fit into this width are stored as exceptions.
+/// @tparam TUI      The unsigned integral type of the array.
+/// @param  block    The values of the block, with the frame of reference subtracted already.
+/// @param  qty      The number of values in \p{block}.
+/// @param  bitCnt   Output parameter receiving the chosen bit width.
+/// @param  ctdExc   Output parameter receiving the number of exceptions.
+/// @param  maxWidth Output parameter receiving the bit width of the largest value.
+/// @return The number of bits needed for the bit-packed values and the exceptions.
+template<typename TUI>
+size_t pforChooseWidth( const TUI* block, size_t qty, int& bitCnt, int& ctdExc, int& maxWidth ) {
+    // get a histogram of the bit widths needed
+    int widths[bitsof(TUI) + 1]= {};
+    maxWidth= 0;
+    for(size_t j= 0; j < qty; ++j ) {
+        int width= lang::MSB0( block[j] );
+        ++widths[width];
+        maxWidth= (std::max)( maxWidth, width );
+    }
+
+    // choose the width with the least costs
+    bitCnt= maxWidth;
+    ctdExc= 0;
+    int    ctdLarger = 0;
+    size_t leastBits = qty * size_t(maxWidth);
+    for( int width= maxWidth - 1; width >= 0; --width ) {
+        ctdLarger+= widths[width + 1];
+        size_t bits=   qty * size_t(width)
+                     + size_t(ctdLarger) * size_t(PFORPositionBits + maxWidth - width);
+        if( bits < leastBits ) {
+            leastBits= bits;
+            bitCnt   = width;
+            ctdExc   = ctdLarger;
+    }   }
+    return leastBits;
+}
+
+/// Writes array data using blocks of \alib{bitbuffer::ac_v1;PFORBlockSize} values, each with an own
+/// frame of reference (the minimum value of the block) and an own bit width. The bit width is
+/// chosen to minimize the size of the block: Values that do not fit are stored as "exceptions",
+/// hence their upper bits are patched in after the bit-packed lower bits.
+/// @tparam TI    The integral type of the array to write.
+/// @param  bw    The bit writer to use.
+/// @param  data  The array to read the data from.
+template<typename TI>
+void writePFOR( BitWriter& bw, ArrayCompressor::Array<TI>& data ) {
+    using TUI= typename std::make_unsigned<TI>::type;
+    constexpr int widthBits= lang::Log2OfSize<TUI>() + 1;
+
+    TUI block[PFORBlockSize];
+    for(size_t i= 0; i < data.length(); i+= PFORBlockSize ) {
+        size_t qty= (std::min)( PFORBlockSize, data.length() - i );
+
+        // get the frame of reference and choose the bit width
+        TUI blockMin= data.get(i);
+        for(size_t j= 0; j < qty; ++j ) {
+            block[j]= data.get(i + j);
+            blockMin= (std::min)( blockMin, block[j] );
+        }
+        for(size_t j= 0; j < qty; ++j )
+            block[j]= TUI( block[j] - blockMin );
+        int bitCnt, ctdExc, maxWidth;
+        pforChooseWidth( block, qty, bitCnt, ctdExc, maxWidth );
+
+        // write block. (The number of exceptions is always lower than the block size.)
+        bw.Write( blockMin );
+        bw.Write<widthBits + PFORPositionBits>( bitCnt | (ctdExc << widthBits) );
+        if( ctdExc )
+            bw.Write<widthBits>( maxWidth - bitCnt );
+        bw.Write( bitCnt, block, qty );
+        if( ctdExc )
+            for(size_t j= 0; j < qty; ++j )
+                if( TUI( block[j] >> bitCnt ) != 0 ) {
+                    bw.Write<PFORPositionBits>( j );
+                    bw.Write( maxWidth - bitCnt, TUI( block[j] >> bitCnt ) );
+}   }           }
+
+/// Reads data compressed with method \alib{bitbuffer::ac_v1;writePFOR}.
+/// @tparam TI   The integral type of the array to read back.
+/// @param br    The bit reader to use.
+/// @param data  The array to read the data to.
+template<typename TI>
+void readPFOR( BitReader& br, ArrayCompressor::Array<TI>& data ) {
+    using TUI= typename std::make_unsigned<TI>::type;
+    constexpr int widthBits= lang::Log2OfSize<TUI>() + 1;
+
+    TUI block[PFORBlockSize];
+    for(size_t i= 0; i < data.length(); i+= PFORBlockSize ) {
+        size_t qty= (std::min)( PFORBlockSize, data.length() - i );
+        TUI  blockMin= br.Read<TUI>();
+        auto bitCnt  = br.Read<widthBits + PFORPositionBits>();
+        auto ctdExc  = bitCnt >> widthBits;
+             bitCnt &= lang::LowerMask<widthBits, int>();
+        auto excWidth= ctdExc ? br.Read<widthBits>() : 0;
+        br.Read( bitCnt, block, qty );
+        for( int exc= 0; exc < ctdExc; ++exc ) {
+            auto pos= br.Read<PFORPositionBits>();
+            block[pos]|= TUI( br.Read<TUI>( excWidth ) << bitCnt );
+        }
+        for(size_t j= 0; j < qty; ++j )
+            data.set(i + j, TUI( block[j] + blockMin ) );
+}   }
+
+/// Writes array data by storing the first value, the first difference of adjacent values and
+/// then the differences of adjacent differences. Zero-differences are stored in one bit, others
+/// with a prefix that selects one of the bit widths given with
+/// \alib{bitbuffer::ac_v1;DeltaOfDeltaBucketWidths}.
+/// This algorithm is suitable for timestamps and other values that increase with a nearly
+/// constant rate.
+/// @tparam TI    The integral type of the array to write.
+/// @param  bw    The bit writer to use.
+/// @param  data  The array to read the data from.
+template<typename TI>
+void writeDeltaOfDelta( BitWriter& bw, ArrayCompressor::Array<TI>& data ) {
+    using TUI= typename std::make_unsigned<TI>::type;
+    if( !data.length() )
+        return;
+
+    TUI prevVal= data.get(0);
+    bw.Write( prevVal );
+    if( data.length() == 1 )
+        return;
+
+    prevVal      = toRaw<TI>( prevVal );
+    TUI val      = toRaw<TI>( data.get(1) );
+    TUI prevDelta= TUI( val - prevVal );
+    bw.Write( zigZagEncode( prevDelta ) );
+    prevVal= val;
+
+    for(size_t i= 2; i < data.length(); ++i) {
+        val        = toRaw<TI>( data.get(i) );
+        TUI delta  = TUI( val - prevVal );
+        TUI dod    = zigZagEncode( TUI( delta - prevDelta ) );
+        if( dod == 0 )
+            bw.Write<1>( 0 );
+        else {
+            // find the bucket and write its prefix: one bit per bucket number, terminated by
+            // a zero bit, unless the last bucket is chosen.
+            int width = lang::MSB( dod );
+            int bucket= 0;
+            while( (std::min)( DeltaOfDeltaBucketWidths[bucket], bitsof(TUI) ) < width )
+                ++bucket;
+            if( bucket < 3 )
+                bw.Write( bucket + 2, (1u << (bucket + 1)) - 1 );
+            else
+                bw.Write<4>( 15u );
+            bw.Write( (std::min)( DeltaOfDeltaBucketWidths[bucket], bitsof(TUI) ), dod );
+        }
+        prevDelta= delta;
+        prevVal  = val;
+}   }
+
+/// Reads data compressed with method \alib{bitbuffer::ac_v1;writeDeltaOfDelta}.
+/// @tparam TI   The integral type of the array to read back.
+/// @param br    The bit reader to use.
+/// @param data  The array to read the data to.
+template<typename TI>
+void readDeltaOfDelta( BitReader& br, ArrayCompressor::Array<TI>& data ) {
+    using TUI= typename std::make_unsigned<TI>::type;
+    if( !data.length() )
+        return;
 
+    TUI prevVal= br.Read<TUI>();
+    data.set(0, prevVal);
+    if( data.length() == 1 )
+        return;
+
+    TUI prevDelta= zigZagDecode( br.Read<TUI>() );
+    prevVal      = TUI( toRaw<TI>( prevVal ) + prevDelta );
+    data.set(1, fromRaw<TI>( prevVal ) );
+
+    for(size_t i= 2; i < data.length(); ++i) {
+        int bucket= 0;
+        while( bucket < 4 && br.Read<1>() )
+            ++bucket;
+        if( bucket )
+            prevDelta= TUI( prevDelta + zigZagDecode( br.Read<TUI>(
+                            (std::min)( DeltaOfDeltaBucketWidths[bucket - 1], bitsof(TUI) ) ) ) );
+        prevVal= TUI( prevVal + prevDelta );
+        data.set(i, fromRaw<TI>( prevVal ) );
+}   }
+
+/// Writes the first value and then the zig-zag encoded differences of adjacent values. The
+/// differences are bit-packed in blocks of \alib{bitbuffer::ac_v1;PFORBlockSize} values, each
+/// with an own bit width.
+/// This algorithm is suitable for noisy signals, which change in both directions.
+/// @tparam TI    The integral type of the array to write.
+/// @param  bw    The bit writer to use.
+/// @param  data  The array to read the data from.
+template<typename TI>
+void writeZigZagDelta( BitWriter& bw, ArrayCompressor::Array<TI>& data ) {
+    using TUI= typename std::make_unsigned<TI>::type;
+    constexpr int widthBits= lang::Log2OfSize<TUI>() + 1;
+    if( !data.length() )
+        return;
+
+    TUI prevVal= data.get(0);
+    bw.Write( prevVal );
+    prevVal= toRaw<TI>( prevVal );
+
+    TUI block[PFORBlockSize];
+    for(size_t i= 1; i < data.length(); i+= PFORBlockSize ) {
+        size_t qty= (std::min)( PFORBlockSize, data.length() - i );
+        TUI    allBits= 0;
+        for(size_t j= 0; j < qty; ++j ) {
+            TUI val= toRaw<TI>( data.get(i + j) );
+            block[j]= zigZagEncode( TUI( val - prevVal ) );
+            allBits|= block[j];
+            prevVal = val;
+        }
+        int bitCnt= lang::MSB0( allBits );
+        bw.Write<widthBits>( bitCnt );
+        bw.Write( bitCnt, block, qty );
+}   }
+
+/// Reads data compressed with method \alib{bitbuffer::ac_v1;writeZigZagDelta}.
+/// @tparam TI   The integral type of the array to read back.
+/// @param br    The bit reader to use.
+/// @param data  The array to read the data to.
+template<typename TI>
+void readZigZagDelta( BitReader& br, ArrayCompressor::Array<TI>& data ) {
+    using TUI= typename std::make_unsigned<TI>::type;
+    constexpr int widthBits= lang::Log2OfSize<TUI>() + 1;
+    if( !data.length() )
+        return;
+
+    TUI prevVal= br.Read<TUI>();
+    data.set(0, prevVal);
+    prevVal= toRaw<TI>( prevVal );
+
+    TUI block[PFORBlockSize];
+    for(size_t i= 1; i < data.length(); i+= PFORBlockSize ) {
+        size_t qty= (std::min)( PFORBlockSize, data.length() - i );
+        br.Read( br.Read<widthBits>(), block, qty );
+        for(size_t j= 0; j < qty; ++j ) {
+            prevVal= TUI( prevVal + zigZagDecode( block[j] ) );
+            data.set(i + j, fromRaw<TI>( prevVal ) );
+}   }   }
+
+/// Writes array data as a sequence of runs and literal groups. Runs of at least
+/// \alib{bitbuffer::ac_v1;RLEMinRunLength} equal values are stored as length and value. The values
+/// in between are bit-packed with the bit width needed for the difference between the maximum
+/// and the minimum value of the array.
+/// @tparam TI    The integral type of the array to write.
+/// @param  bw    The bit writer to use.
+/// @param  data  The array to read the data from.
+template<typename TI>
+void writeRLEBitPacked( BitWriter& bw, ArrayCompressor::Array<TI>& data ) {
+    using TUI= typename std::make_unsigned<TI>::type;
+    if( !data.length() )
+        return;
+
+    // calc min/max
+    data.calcMinMax();
+    int bitCnt= lang::MSB0( TUI( data.max - data.min ) );
+    bw.Write<lang::Log2OfSize<TUI>() + 1>( bitCnt );
+    bw.Write( data.min );
+
+    // returns the number of equal values starting at the given index
+    auto runLength= [&data]( size_t idx ) {
+        TUI    val= data.get( idx );
+        size_t end= idx + 1;
+        while( end < data.length() && data.get( end ) == val )
+            ++end;
+        return end - idx;
+    };
+
+    TUI    block[BulkBlockSize];
+    size_t segStart= 0;
+    size_t run     = runLength( 0 );
+    while( segStart < data.length() ) {
+        // write a run
+        if( run >= RLEMinRunLength ) {
+            bw.Write<1>( 1 );
+            bw.Write( run - RLEMinRunLength );
+            if( bitCnt )
+                bw.Write( bitCnt, TUI( data.get( segStart ) - data.min ) );
+            segStart+= run;
+            if( segStart < data.length() )
+                run= runLength( segStart );
+            continue;
+        }
+
+        // write literals up to the next run
+        size_t segEnd= segStart + run;
+        while(     segEnd < data.length()
+               && (run= runLength( segEnd )) < RLEMinRunLength )
+            segEnd+= run;
+
+        bw.Write<1>( 0 );
+        bw.Write( segEnd - segStart - 1 );
+        for( size_t j= segStart; j < segEnd; j+= BulkBlockSize) {
+            size_t qty= (std::min)( BulkBlockSize, segEnd - j );
+            for( size_t k= 0; k < qty; ++k)
+                block[k]= TUI( data.get(j + k) - data.min );
+            bw.Write( bitCnt, block, qty );
+        }
+        segStart= segEnd;
+}   }
+
+/// Reads data compressed with method \alib{bitbuffer::ac_v1;writeRLEBitPacked}.
+/// @tparam TI   The integral type of the array to read back.
+/// @param br    The bit reader to use.
+/// @param data  The array to read the data to.
+template<typename TI>
+void readRLEBitPacked( BitReader& br, ArrayCompressor::Array<TI>& data ) {
+    using TUI= typename std::make_unsigned<TI>::type;
+    if( !data.length() )
+        return;
+
+    auto bitCnt= br.Read<lang::Log2OfSize<TUI>() + 1>();
+    TUI  minVal= br.Read<TUI>();
+
+    TUI    block[BulkBlockSize];
+    size_t segStart= 0;
+    while( segStart < data.length() ) {
+        if( br.Read<1>() ) { // run
+            size_t segEnd= segStart + RLEMinRunLength + br.Read<size_t>();
+            TUI    val   = bitCnt ? TUI( br.Read<TUI>( bitCnt ) + minVal ) : minVal;
+            for( size_t i= segStart ; i < segEnd ; ++i )
+                data.set(i, val);
+            segStart= segEnd;
+            continue;
+        }
+
+        // literals
+        size_t segEnd= segStart + 1 + br.Read<size_t>();
+        for( size_t i= segStart ; i < segEnd ; i+= BulkBlockSize ) {
+            size_t qty= (std::min)( BulkBlockSize, segEnd - i );
+            br.Read( bitCnt, block, qty );
+            for( size_t j= 0 ; j < qty ; ++j )
+                data.set(i + j, TUI( block[j] + minVal ) );
+        }
+        segStart= segEnd;
+}   }
+
+#include "ALib.Lang.CIFunctions.H"
+/// Calculates the sizes that the algorithms given with \p{algorithms} produce for the given
+/// \p{data}, in one pass over the array. This is the implementation of
+/// \alib{bitbuffer::ac_v1;ArrayCompressor::Estimate}.
+/// @tparam TI         The integral type of the array.
+/// @param  data       The array to estimate the compressed sizes for.
+/// @param  algorithms The algorithms to calculate the sizes for.
+/// @param  sizes      An array of length \alib{bitbuffer::ac_v1;ArrayCompressor::NumberOfAlgorithms}
+///                    that receives the size in bits for each algorithm included in
+///                    \p{algorithms}. Other entries are not modified.
+template<typename TI>
+void estimateSizes( ArrayCompressor::Array<TI>& data, ArrayCompressor::Algorithm algorithms,
+                    size_t* sizes ) {
+    using TUI      = typename std::make_unsigned<TI>::type;
+    using Algorithm= ArrayCompressor::Algorithm;
+    constexpr int widthBits= lang::Log2OfSize<TUI>() + 1;
+    const size_t  length   = data.length();
+
+    const bool doUncompressed= HasBits( algorithms, Algorithm::Uncompressed );
+    const bool doSparse      = HasBits( algorithms, Algorithm::Sparse       );
+    const bool doVerySparse  = HasBits( algorithms, Algorithm::VerySparse   );
+    const bool doHuffman     = HasBits( algorithms, Algorithm::Huffman      );
+    const bool doPFOR        = HasBits( algorithms, Algorithm::PFOR         );
+    const bool doDeltaOfDelta= HasBits( algorithms, Algorithm::DeltaOfDelta );
+    const bool doZigZagDelta = HasBits( algorithms, Algorithm::ZigZagDelta  );
+    const bool doRLE         = HasBits( algorithms, Algorithm::RLEBitPacked );
+    const bool doRuns        = doVerySparse || doRLE;
+
+    // zero-length arrays: only MinMax writes its header
+    if( !length ) {
+        data.calcMinMax();
+        for( int algoNo= 0; algoNo < ArrayCompressor::NumberOfAlgorithms ; ++algoNo )
+            if( HasBits( algorithms, Algorithm( 1 << algoNo ) ) )
+                sizes[algoNo]= Algorithm( 1 << algoNo ) == Algorithm::MinMax
+                               ? size_t( widthBits + BitWriter::EncodedSize( data.min ) )
+                               : 0;
+        return;
+    }
+
+    // minimum and maximum values and differences, unless cached in the array already
+    const bool calcMinMax= data.max < data.min;
+    TUI minVal= 0, maxVal= 0, minInc= 0, maxInc= 0, minDec= 0, maxDec= 0;
+    if( calcMinMax ) {
+        minVal= (std::numeric_limits<TUI>::max)();
+        minInc= (std::numeric_limits<TUI>::max)();
+        minDec= (std::numeric_limits<TUI>::max)();
+    }
+
+    // Uncompressed, Sparse, Incremental
+    size_t sumUncompressed= 0;
+    size_t sumSparse      = 0;
+    size_t ctdEqual       = 0;
+    size_t ctdInc         = 0;
+    size_t ctdDec         = 0;
+
+    // Huffman
+    size_t frequencies[256]= {};
+
+    // VerySparse: the segments are formed from the runs of equal values, as done by
+    // writeVerySparse. Runs of length 1 are collected in non-sparse segments.
+    size_t ctdSegments     = 0;
+    size_t ctdSparseSegs   = 0;
+    size_t ctdNonSparseVals= 0;
+    size_t maxSegLen       = 0;
+    size_t ctdSingles      = 0;
+
+    // RLEBitPacked: runs are at least RLEMinRunLength long, the rest are literal groups.
+    size_t sumRLE          = 0;
+    size_t ctdRLERuns      = 0;
+    size_t ctdLiterals     = 0;
+    size_t literalGroup    = 0;
+
+    // PFOR and ZigZagDelta blocks
+    TUI    pforBlock[PFORBlockSize];
+    size_t pforQty         = 0;
+    size_t sumPFOR         = 0;
+    TUI    zzAllBits       = 0;
+    size_t zzQty           = 0;
+    size_t sumZigZag       = 0;
+
+    // DeltaOfDelta
+    size_t sumDoD          = 0;
+    TUI    prevDelta       = 0;
+
+    // processes a run of equal values with VerySparse and RLEBitPacked
+    auto processRun= [&]( size_t run ) {
+        if( doVerySparse ) {
+            if( run == 1 )
+                ++ctdSingles;
+            else {
+                if( ctdSingles ) {
+                    ++ctdSegments;
+                    ctdNonSparseVals+= ctdSingles;
+                    maxSegLen        = (std::max)( maxSegLen, ctdSingles );
+                    ctdSingles       = 0;
+                }
+                ++ctdSegments;
+                ++ctdSparseSegs;
+                maxSegLen= (std::max)( maxSegLen, run );
+        }   }
+        if( doRLE ) {
+            if( run < RLEMinRunLength )
+                literalGroup+= run;
+            else {
+                if( literalGroup ) {
+                    sumRLE     += 1 + size_t( BitWriter::EncodedSize( literalGroup - 1 ) );
+                    ctdLiterals+= literalGroup;
+                    literalGroup= 0;
+                }
+                sumRLE+= 1 + size_t( BitWriter::EncodedSize( run - RLEMinRunLength ) );
+                ++ctdRLERuns;
+    }   }   };
+
+    // processes a full or the last PFOR block
+    auto processPFORBlock= [&]() {
+        TUI blockMin= pforBlock[0];
+        for( size_t j= 1; j < pforQty; ++j )
+            blockMin= (std::min)( blockMin, pforBlock[j] );
+        for( size_t j= 0; j < pforQty; ++j )
+            pforBlock[j]= TUI( pforBlock[j] - blockMin );
+        int bitCnt, ctdExc, maxWidth;
+        sumPFOR+=   size_t( BitWriter::EncodedSize( blockMin ) + widthBits + PFORPositionBits )
+                  + pforChooseWidth( pforBlock, pforQty, bitCnt, ctdExc, maxWidth )
+                  + ( ctdExc ? size_t(widthBits) : 0 );
+        pforQty= 0;
+    };
+
+    TUI    firstVal= data.get(0);
+    TUI    prevVal = firstVal;
+    TUI    prevRaw = toRaw<TI>( firstVal );
+    size_t run     = 1;
+    for( size_t i= 0; i < length; ++i ) {
+        TUI val= i ? data.get(i) : firstVal;
+
+        if( calcMinMax ) {
+            minVal= (std::min)( minVal, val );
+            maxVal= (std::max)( maxVal, val );
+        }
+        if( doUncompressed )
+            sumUncompressed+= size_t( BitWriter::EncodedSize( val ) );
+        if( doHuffman ) {
+            TUI bytes= val;
+            for( int byte= 0; byte < int(sizeof(TUI)); ++byte ) {
+                ++frequencies[uint8_t( bytes )];
+                ALIB_WARNINGS_ALLOW_SHIFT_COUNT_OVERFLOW
+                bytes>>= 8;
+                ALIB_WARNINGS_RESTORE
+        }   }
+        if( doPFOR ) {
+            pforBlock[pforQty++]= val;
+            if( pforQty == PFORBlockSize )
+                processPFORBlock();
+        }
+
+        if( i == 0 )
+            continue;
+
+        // differences
+        if( val >= prevVal ) {
+            if( calcMinMax ) {
+                minInc= (std::min)( minInc, TUI( val - prevVal ) );
+                maxInc= (std::max)( maxInc, TUI( val - prevVal ) );
+            }
+            if( val == prevVal ) ++ctdEqual;
+            else                 ++ctdInc;
+        } else {
+            if( calcMinMax ) {
+                minDec= (std::min)( minDec, TUI( prevVal - val ) );
+                maxDec= (std::max)( maxDec, TUI( prevVal - val ) );
+            }
+            ++ctdDec;
+        }
+        if( doSparse )
+            sumSparse+= val == prevVal ? 1 : 1 + size_t( BitWriter::EncodedSize( val ) );
+
+        if( doRuns ) {
+            if( val == prevVal )
+                ++run;
+            else {
+                processRun( run );
+                run= 1;
+        }   }
+
+        if( doDeltaOfDelta || doZigZagDelta ) {
+            TUI raw  = toRaw<TI>( val );
+            TUI delta= TUI( raw - prevRaw );
+            if( doDeltaOfDelta ) {
+                if( i == 1 )
+                    sumDoD+= size_t( BitWriter::EncodedSize( zigZagEncode( delta ) ) );
+                else {
+                    TUI dod= zigZagEncode( TUI( delta - prevDelta ) );
+                    if( dod == 0 )
+                        ++sumDoD;
+                    else {
+                        int width = lang::MSB( dod );
+                        int bucket= 0;
+                        while( (std::min)( DeltaOfDeltaBucketWidths[bucket], bitsof(TUI) ) < width )
+                            ++bucket;
+                        sumDoD+= size_t( (bucket < 3 ? bucket + 2 : 4)
+                                        + (std::min)( DeltaOfDeltaBucketWidths[bucket], bitsof(TUI) ) );
+                }   }
+                prevDelta= delta;
+            }
+            if( doZigZagDelta ) {
+                TUI zz= zigZagEncode( delta );
+                zzAllBits|= zz;
+                if( ++zzQty == PFORBlockSize ) {
+                    sumZigZag+= size_t( widthBits ) + zzQty * size_t( lang::MSB0( zzAllBits ) );
+                    zzQty    = 0;
+                    zzAllBits= 0;
+            }   }
+            prevRaw= raw;
+        }
+        prevVal= val;
+    }
+
+    // finalize the pending runs and blocks
+    if( doRuns )
+        processRun( run );
+    if( doVerySparse && ctdSingles ) {
+        // writeVerySparse writes the last value of a group of single values at the end of the
+        // array as an own segment.
+        ctdSegments     += ctdSingles > 1 ? 2 : 1;
+        ctdNonSparseVals+= ctdSingles;
+        maxSegLen        = (std::max)( maxSegLen, ctdSingles > 1 ? ctdSingles - 1 : 1 );
+    }
+    if( doRLE && literalGroup ) {
+        sumRLE     += 1 + size_t( BitWriter::EncodedSize( literalGroup - 1 ) );
+        ctdLiterals+= literalGroup;
+    }
+    if( doPFOR && pforQty )
+        processPFORBlock();
+    if( doZigZagDelta && zzQty )
+        sumZigZag+= size_t( widthBits ) + zzQty * size_t( lang::MSB0( zzAllBits ) );
+
+    // store the minimum and maximum values in the array, as done with Array::calcMinMax
+    if( calcMinMax ) {
+        if( maxDec == 0 )
+            minDec= 0;
+        data.min   = minVal;   data.max   = maxVal;
+        data.minInc= minInc;   data.maxInc= maxInc;
+        data.minDec= minDec;   data.maxDec= maxDec;
+    }
+    const size_t valBits= size_t( lang::MSB0( TUI( data.max - data.min ) ) );
+    const size_t minBits= size_t( BitWriter::EncodedSize( data.min ) );
+
+    // calculate the sizes
+    int algoNo= -1;
+    for( Algorithm algo : enumops::EnumIterator<Algorithm>() ) {
+        algoNo++;
+        if ( !HasBits( algorithms, algo ) )
+            continue;
+        size_t& size= sizes[algoNo];
+
+        ALIB_WARNINGS_ALLOW_SPARSE_ENUM_SWITCH
+        switch( algo ) {
+            case Algorithm::Uncompressed: size= sumUncompressed;                    break;
+            case Algorithm::MinMax:       size= size_t(widthBits) + minBits + length * valBits;
+                                          break;
+            case Algorithm::Sparse:       size= size_t( BitWriter::EncodedSize( firstVal ) )
+                                              + sumSparse;
+                                          break;
+            case Algorithm::VerySparse:   size=   size_t( lang::Log2OfSize<uint32_t>() + 1 + widthBits )
+                                                + minBits
+                                                + ctdSegments * size_t( lang::MSB( maxSegLen ) + 1 )
+                                                + (ctdSparseSegs + ctdNonSparseVals) * valBits;
+                                          break;
+            case Algorithm::Incremental:
+                if( length == 1 )
+                    size= size_t( BitWriter::EncodedSize( firstVal ) );
+                else
+                    size=   size_t( 2 * widthBits )
+                          + size_t( BitWriter::EncodedSize( data.minInc ) )
+                          + size_t( BitWriter::EncodedSize( data.minDec ) )
+                          + size_t( BitWriter::EncodedSize( firstVal    ) )
+                          + ctdEqual
+                          + ctdInc * size_t( 2 + lang::MSB0( TUI( data.maxInc - data.minInc ) ) )
+                          + ctdDec * size_t( 2 + lang::MSB0( TUI( data.maxDec - data.minDec ) ) );
+                break;
+            case Algorithm::Huffman:      size= HuffmanEncoder::EncodedSize( frequencies );  break;
+            case Algorithm::PFOR:         size= sumPFOR;                                      break;
+            case Algorithm::DeltaOfDelta: size= size_t( BitWriter::EncodedSize( firstVal ) ) + sumDoD;
+                                          break;
+            case Algorithm::ZigZagDelta:  size= size_t( BitWriter::EncodedSize( firstVal ) )
+                                              + sumZigZag;
+                                          break;
+            case Algorithm::RLEBitPacked: size=   size_t(widthBits) + minBits + sumRLE
+                                                + (ctdRLERuns + ctdLiterals) * valBits;
+                                          break;
+            default:  ALIB_ERROR("BITBUFFER/AC", "Internal error: Unknown compression algorithm")
+                      break;
+        }
+        ALIB_WARNINGS_RESTORE
+}   }
+#include "ALib.Lang.CIMethods.H"
 
 }}} // namespace [alib::bitbuffer::ac_v1]
@@ -0,0 +1,164 @@
+//##################################################################################################
+//  ALib C++ Library
+//
+//  Copyright 2013-2025 A-Worx GmbH, Germany
+//  Published under 'Boost Software License' (a free software license, see LICENSE.txt)
+//##################################################################################################
+#include "alib_precompile.hpp"
+#if !defined(ALIB_C20_MODULES) || ((ALIB_C20_MODULES != 0) && (ALIB_C20_MODULES != 1))
+#   error "Symbol ALIB_C20_MODULES has to be given to the compiler as either 0 or 1"
+#endif
+#if ALIB_C20_MODULES
+    module;
+#endif
+//========================================= Global Fragment ========================================
+#include "alib/bitbuffer/bitbuffer.prepro.hpp"
+#include <istream>
+#include <ostream>
+
+//============================================== Module ============================================
+#if ALIB_C20_MODULES
+    module ALib.BitBuffer;
+#else
+#   include "ALib.BitBuffer.H"
+#endif
+//========================================== Implementation ========================================
+namespace alib {  namespace bitbuffer { namespace ac_v1 {
+
+#if !DOXYGEN
+namespace {
+
+// writes the given value in little endian byte order
+void putLE( char* dest, uint64_t value, int qtyBytes ) {
+    for( int i= 0; i < qtyBytes; ++i ) {
+        dest[i]= char( value & 0xFF );
+        value>>= 8;
+}   }
+
+// reads a value written with putLE
+uint64_t getLE( const char* src, int qtyBytes ) {
+    uint64_t result= 0;
+    for( int i= qtyBytes - 1; i >= 0; --i )
+        result= (result << 8) | uint8_t( src[i] );
+    return result;
+}
+
+// reads the given number of bytes into the start of the given buffer
+bool readBytes( std::istream& is, BitBufferBase& bb, uint64_t bytes ) {
+    using TStorage= BitBufferBase::TStorage;
+    if( bytes == 0 )
+        return false;
+    uinteger words= uinteger( (bytes + sizeof(TStorage) - 1) / sizeof(TStorage) );
+    bb.EnsureCapacity( words * bitsof(TStorage), BitBufferBase::Index() );
+    bb.Data()[words - 1]= 0;
+    is.read( bb.CharStream(), std::streamsize( bytes ) );
+    if( !is.good() )
+        return false;
+    bb.FromLittleEndianEncoding( BitBufferBase::Index(), BitBufferBase::Index( words, 0 ) );
+    return true;
+}
+
+} // anonymous namespace
+#endif
+
+bool ChunkedArrayFormat::WriteHeader( std::ostream& os ) {
+    char header[HeaderSize]= {};
+    putLE( header, Magic, 4 );
+    header[4]= char( Version );
+    os.write( header, HeaderSize );
+    return os.good();
+}
+
+uint64_t ChunkedArrayFormat::WriteBuffer( std::ostream& os, BitBufferBase& bb,
+                                          BitBufferBase::Index terminationIdx ) {
+    bb.ToLittleEndianEncoding( BitBufferBase::Index(), terminationIdx );
+    uint64_t bytes= uint64_t( terminationIdx.GetByteOffset() );
+    os.write( bb.CharStream(), std::streamsize( bytes ) );
+    return os.good() ? bytes : 0;
+}
+
+bool ChunkedArrayFormat::WriteDirectory( std::ostream& os, const Directory& directory ) {
+    size_t    qtyChunks= directory.CountChunks();
+    BitBuffer bb( ( qtyChunks + 5 ) * 72 );
+    BitBufferBase::Index idx;
+    {
+        BitWriter bw( bb );
+        bw.Write( directory.typeCode );
+        bw.Write( uint32_t( directory.algorithms ) );
+        bw.Write( directory.chunkLength );
+        bw.Write( directory.length );
+        bw.Write( uint64_t( qtyChunks ) );
+        for( size_t i= 0; i < qtyChunks; ++i )
+            bw.Write( directory.offsets[i + 1] - directory.offsets[i] );
+        idx= bw.GetIndex();
+    } // <bw.Flush
+    if( WriteBuffer( os, bb, bb.Terminate( idx ) ) == 0 )
+        return false;
+
+    char footer[FooterSize];
+    putLE( footer    , directory.offsets.back(), 8 );
+    putLE( footer + 8, Magic                   , 4 );
+    os.write( footer, FooterSize );
+    return os.good();
+}
+
+bool ChunkedArrayFormat::ReadDirectory( std::istream& is, std::istream::pos_type start,
+                                        Directory& directory ) {
+    // header
+    char header[HeaderSize];
+    is.seekg( start );
+    is.read( header, HeaderSize );
+    if(    !is.good()
+        || getLE( header, 4 ) != Magic
+        || uint8_t( header[4] ) > Version )
+        return false;
+
+    // footer
+    is.seekg( 0, std::ios_base::end );
+    uint64_t containerSize= uint64_t( is.tellg() - start );
+    if( !is.good() || containerSize < HeaderSize + FooterSize )
+        return false;
+    char footer[FooterSize];
+    is.seekg( start + std::streamoff( containerSize - FooterSize ) );
+    is.read( footer, FooterSize );
+    uint64_t directoryOffset= getLE( footer, 8 );
+    if(    !is.good()
+        || getLE( footer + 8, 4 ) != Magic
+        || directoryOffset < HeaderSize
+        || directoryOffset >= containerSize - FooterSize )
+        return false;
+
+    // directory
+    uint64_t  directoryBytes= containerSize - FooterSize - directoryOffset;
+    BitBuffer bb( uinteger( directoryBytes * 8 ) );
+    is.seekg( start + std::streamoff( directoryOffset ) );
+    if( !readBytes( is, bb, directoryBytes ) )
+        return false;
+
+    BitReader br( bb );
+    directory.typeCode   = br.Read<uint8_t >();
+    directory.algorithms = ArrayCompressor::Algorithm( br.Read<uint32_t>() );
+    directory.chunkLength= br.Read<uint64_t>();
+    directory.length     = br.Read<uint64_t>();
+    uint64_t qtyChunks   = br.Read<uint64_t>();
+    if(    directory.chunkLength == 0
+        || qtyChunks != ( directory.length + directory.chunkLength - 1 ) / directory.chunkLength
+        || qtyChunks * 11 > directoryBytes * 8 )
+        return false;
+
+    directory.offsets.clear();
+    directory.offsets.reserve( size_t( qtyChunks + 1 ) );
+    directory.offsets.push_back( HeaderSize );
+    for( uint64_t i= 0; i < qtyChunks; ++i )
+        directory.offsets.push_back( directory.offsets.back() + br.Read<uint64_t>() );
+    return directory.offsets.back() == directoryOffset;
+}
+
+bool ChunkedArrayFormat::ReadBuffer( std::istream& is, std::istream::pos_type start,
+                                     const Directory& directory, size_t chunkNo,
+                                     BitBufferBase& bb ) {
+    is.seekg( start + std::streamoff( directory.offsets[chunkNo] ) );
+    return readBytes( is, bb, directory.offsets[chunkNo + 1] - directory.offsets[chunkNo] );
+}
+
+}}} // namespace [alib::bitbuffer::ac_v1]
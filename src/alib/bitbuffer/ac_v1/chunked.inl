@@ -0,0 +1,495 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of module \alib_bitbuffer of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib {  namespace bitbuffer { namespace ac_v1 {
+
+//==================================================================================================
+/// Defines the format of the chunked container written by class
+/// \alib{bitbuffer::ac_v1;ChunkedArrayWriter} and read by class
+/// \alib{bitbuffer::ac_v1;ChunkedArrayReader}, and provides the non-templated parts of both.
+///
+/// Class \alib{bitbuffer::ac_v1;ArrayCompressor} compresses a whole array into one bit buffer,
+/// which has to be at least as large as the uncompressed data. This is not feasible with arrays
+/// of several gigabytes, which, furthermore, might not even be available in memory as a whole.
+/// The container format defined here splits such arrays into chunks of a fixed number of values.
+/// Each chunk is compressed independently with the algorithm that suits its data best.
+/// The container consists of:
+/// - A header of #HeaderSize bytes, containing #Magic and #Version.
+/// - The compressed chunks. Each chunk is a \ref alib::bitbuffer::BitBufferBase::Terminate "terminated"
+///   bit buffer in \alib{bitbuffer::BitBufferBase;ToLittleEndianEncoding;little endian encoding}.
+/// - The chunk directory (see struct #Directory), which is likewise a terminated bit buffer.
+/// - A footer of #FooterSize bytes, containing the byte offset of the directory and #Magic.
+///
+/// Because the directory is written behind the chunks, containers can be written to streams
+/// that are not seekable, like pipes or sockets. Reading a container requires a seekable stream.
+/// Using the directory, the chunks containing a range of values are decompressed without
+/// decoding the rest of the container.
+//==================================================================================================
+struct ChunkedArrayFormat
+{
+    /// The magic number found at the start and the end of a container: <c>"ALCA"</c>
+    /// in little endian byte order.
+    static constexpr uint32_t   Magic                                                = 0x41434C41;
+
+    /// The version of the format.
+    static constexpr uint8_t    Version                                                      =  1;
+
+    /// The size of the container header in bytes.
+    static constexpr size_t     HeaderSize                                                   =  8;
+
+    /// The size of the container footer in bytes.
+    static constexpr size_t     FooterSize                                                   = 12;
+
+    /// The default number of values stored in one chunk.
+    static constexpr size_t     DefaultChunkLength                           = size_t(1) << 16;
+
+    /// The chunk directory.
+    struct Directory
+    {
+        /// The size of the value type in bytes, with bit \c 7 set for signed types.
+        /// See #TypeCode.
+        uint8_t                     typeCode                                                 =0;
+
+        /// The algorithms that chunks were compressed with.
+        ArrayCompressor::Algorithm  algorithms               = ArrayCompressor::Algorithm::NONE;
+
+        /// The number of values in each chunk, except the last, which may contain fewer.
+        uint64_t                    chunkLength                                              =0;
+
+        /// The overall number of values stored.
+        uint64_t                    length                                                   =0;
+
+        /// The byte offsets of the chunks, relative to the start of the container.
+        /// An additional last entry holds the offset of the directory, which is the end of the
+        /// last chunk.
+        std::vector<uint64_t>       offsets;
+
+        /// @return The number of chunks.
+        size_t  CountChunks()        const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+        /// Returns the number of values stored in the chunk with the given number.
+        /// @param chunkNo The number of the chunk.
+        /// @return The number of values in the chunk.
+        size_t  ChunkQty( size_t chunkNo )                                                   const {
+            return chunkNo + 1 < CountChunks() ? size_t(chunkLength)
+                                               : size_t(length - chunkLength * chunkNo);
+        }
+    };
+
+    /// Returns the code stored in field \alib{bitbuffer::ac_v1::ChunkedArrayFormat;Directory::typeCode}
+    /// for type \p{TValue}.
+    /// @tparam TValue The integral type of array data.
+    /// @return The size of \p{TValue} in bytes, with bit \c 7 set for signed types.
+    template<typename TValue>
+    static constexpr uint8_t    TypeCode()
+    { return uint8_t( sizeof(TValue) | ( std::is_signed<TValue>::value ? 0x80 : 0 ) ); }
+
+    /// The maximum number of bits that the encoding table of algorithm
+    /// \alib{bitbuffer::ac_v1;ArrayCompressor::Algorithm;Huffman} occupies: 9 bits for each
+    /// of the 256 leaves and, with some reserve, 3 bits for each of the 255 inner nodes of the tree.
+    static constexpr uinteger   HuffmanTableBits   = 9 * 256 + 3 * 255;
+
+    /// Returns the number of bits that a bit buffer has to provide to compress a chunk of
+    /// \p{qty} values of type \p{TValue}.
+    /// Besides twice the uncompressed size, this includes the bits of the algorithm number and
+    /// #HuffmanTableBits. The latter is needed with small chunks, because with selection mode
+    /// \alib{bitbuffer::ac_v1;ArrayCompressor::Selection;Trial}, each algorithm is written to
+    /// the buffer.
+    /// @tparam TValue The integral type of array data.
+    /// @param  qty    The number of values of the chunk.
+    /// @return The capacity to ensure.
+    template<typename TValue>
+    static constexpr uinteger   ChunkCapacity( size_t qty ) {
+        return uinteger( qty * bitsof(TValue) * 2 ) + HuffmanTableBits + 6
+               + 2 * bitsof(BitBufferBase::TStorage);
+    }
+
+    /// Compresses \p{qty} values into the given bit buffer, which is terminated afterward.
+    /// This method is thread-safe, as long as different buffers are given.
+    /// @tparam TValue     The integral type of array data.
+    /// @param  bb         The bit buffer to compress to. Its capacity is ensured.
+    /// @param  values     The values to compress.
+    /// @param  qty        The number of values.
+    /// @param  algorithms The algorithms to choose from.
+    /// @param  selection  The selection mode passed to \alib{bitbuffer::ac_v1;ArrayCompressor::Compress}.
+    /// @param  statistics An optional statistics record.
+    /// @return The termination index, to be passed to #WriteBuffer.
+    template<typename TValue>
+    static BitBufferBase::Index CompressChunk( BitBufferBase&                bb,
+                                               const TValue*                 values,
+                                               size_t                        qty,
+                                               ArrayCompressor::Algorithm    algorithms,
+                                               ArrayCompressor::Selection    selection,
+                                               ArrayCompressor::Statistics*  statistics ) {
+        bb.EnsureCapacity( ChunkCapacity<TValue>( qty ), BitBufferBase::Index() );
+        BitBufferBase::Index idx;
+        {
+            BitWriter bw( bb );
+            ArrayCompressor::Array<TValue> array( values, qty );
+            ArrayCompressor::Compress( bw, array, algorithms, statistics, selection );
+            idx= bw.GetIndex();
+        } // <bw.Flush
+        return bb.Terminate( idx );
+    }
+
+    /// Decompresses a chunk loaded with #ReadBuffer.
+    /// This method is thread-safe, as long as different buffers are given.
+    /// @tparam TValue     The integral type of array data.
+    /// @param  bb         The bit buffer holding the compressed chunk.
+    /// @param  algorithms The algorithms that the chunk was compressed with.
+    /// @param  dest       The destination of the values.
+    /// @param  qty        The number of values in the chunk.
+    template<typename TValue>
+    static void                 DecompressChunk( BitBufferBase&              bb,
+                                                 ArrayCompressor::Algorithm  algorithms,
+                                                 TValue*                     dest,
+                                                 size_t                      qty ) {
+        BitReader br( bb );
+        ArrayCompressor::Array<TValue> array( dest, qty );
+        ArrayCompressor::Decompress( br, array, algorithms );
+    }
+
+    /// Writes the container header.
+    /// @param os The stream to write to.
+    /// @return \c true on success, \c false if the stream failed.
+    ALIB_DLL static bool        WriteHeader( std::ostream& os );
+
+    /// Converts the given terminated buffer to little endian encoding and writes it.
+    /// @param os              The stream to write to.
+    /// @param bb              The buffer to write.
+    /// @param terminationIdx  The index returned by \alib{bitbuffer;BitBufferBase::Terminate}.
+    /// @return The number of bytes written, \c 0 if the stream failed.
+    ALIB_DLL static uint64_t    WriteBuffer( std::ostream& os, BitBufferBase& bb,
+                                             BitBufferBase::Index terminationIdx );
+
+    /// Writes the directory and the footer.
+    /// @param os        The stream to write to.
+    /// @param directory The directory to write. Its last offset has to be the current position
+    ///                  relative to the start of the container.
+    /// @return \c true on success, \c false if the stream failed.
+    ALIB_DLL static bool        WriteDirectory( std::ostream& os, const Directory& directory );
+
+    /// Reads and checks the header, the footer and the directory of a container.
+    /// The container has to end with the stream.
+    /// @param is        The stream to read from. Has to be seekable.
+    /// @param start     The position of the container in the stream.
+    /// @param directory The directory to fill.
+    /// @return \c true on success, \c false if the stream failed or does not contain a
+    ///         valid container.
+    ALIB_DLL static bool        ReadDirectory( std::istream& is, std::istream::pos_type start,
+                                               Directory& directory );
+
+    /// Reads the buffer of a chunk written with #WriteBuffer.
+    /// @param is        The stream to read from. Has to be seekable.
+    /// @param start     The position of the container in the stream.
+    /// @param directory The directory of the container.
+    /// @param chunkNo   The number of the chunk to read.
+    /// @param bb        The buffer to read into. Its capacity is ensured.
+    /// @return \c true on success, \c false if the stream failed.
+    ALIB_DLL static bool        ReadBuffer( std::istream& is, std::istream::pos_type start,
+                                            const Directory& directory, size_t chunkNo,
+                                            BitBufferBase& bb );
+};
+
+//==================================================================================================
+/// Writes arrays of arbitrary length to a <c>std::ostream</c>, using the chunked container
+/// format described with class \alib{bitbuffer::ac_v1;ChunkedArrayFormat}.
+///
+/// Values are passed with one or more invocations of #Write and are buffered until a chunk is
+/// complete. Then the chunk is compressed and written to the stream. Hence, the memory used is
+/// independent of the overall length of the array. Method #Finish has to be invoked after the
+/// last value was passed.
+///
+/// With the inclusion of module \alib_threadmodel in the \alibbuild, function
+/// \alib{bitbuffer::ac_v1;WriteParallel} compresses the chunks of larger arrays in parallel.
+///
+/// @tparam TValue The integral type of array data.
+//==================================================================================================
+template<typename TValue>
+class ChunkedArrayWriter
+{
+    static_assert( std::is_integral<TValue>::value, "TValue has to be an integral type." );
+
+  protected:
+    std::ostream&                       os;             ///< The stream to write to.
+    ArrayCompressor::Statistics*        statistics;     ///< The optional statistics record.
+    ArrayCompressor::Selection          selection;      ///< The selection mode.
+    ChunkedArrayFormat::Directory       directory;      ///< The directory created.
+    std::vector<TValue>                 pending;        ///< Values of an incomplete chunk.
+    BitBuffer                           bb;             ///< The buffer used to compress chunks.
+    bool                                ok;             ///< Cleared when the stream failed.
+    bool                                finished;       ///< Set by #Finish.
+
+  public:
+    /// Constructor. Writes the container header.
+    /// @param stream         The stream to write to. Does not need to be seekable.
+    /// @param chunkLength    The number of values per chunk.
+    ///                       Defaults to \alib{bitbuffer::ac_v1;ChunkedArrayFormat::DefaultChunkLength}.
+    /// @param algorithms     The algorithms to choose from with each chunk.
+    ///                       Defaults to \alib{bitbuffer::ac_v1;ArrayCompressor::Algorithm::ALL}.
+    /// @param selectionMode  Determines how the algorithm of each chunk is chosen.
+    ///                       Defaults to \alib{bitbuffer::ac_v1::ArrayCompressor;Selection::Estimation}.
+    /// @param stats          An optional statistics record. Chunks compressed with
+    ///                       \alib{bitbuffer::ac_v1;WriteParallel} are not recorded.
+    ChunkedArrayWriter( std::ostream&                 stream,
+                        size_t                        chunkLength = ChunkedArrayFormat::DefaultChunkLength,
+                        ArrayCompressor::Algorithm    algorithms  = ArrayCompressor::Algorithm::ALL,
+                        ArrayCompressor::Selection    selectionMode
+                                                        = ArrayCompressor::Selection::Estimation,
+                        ArrayCompressor::Statistics*  stats       = nullptr )
+    : os        ( stream )
+    , statistics( stats )
+    , selection ( selectionMode )
+    , bb        ( ChunkedArrayFormat::ChunkCapacity<TValue>( chunkLength ) )
+    , finished  ( false ) {
+        ALIB_ASSERT_ERROR( chunkLength > 0, "BITBUFFER/AC", "Chunk length must not be 0." )
+        ALIB_ASSERT_ERROR( algorithms != ArrayCompressor::Algorithm::NONE, "BITBUFFER/AC",
+                           "No algorithms given" )
+        directory.typeCode   = ChunkedArrayFormat::TypeCode<TValue>();
+        directory.algorithms = algorithms;
+        directory.chunkLength= chunkLength;
+        pending.reserve( chunkLength );
+        ok= ChunkedArrayFormat::WriteHeader( os );
+        directory.offsets.push_back( ChunkedArrayFormat::HeaderSize );
+    }
+
+    /// Destructor. With debug-compilations, asserts that #Finish was invoked.
+    ~ChunkedArrayWriter() {
+        ALIB_ASSERT_WARNING( finished, "BITBUFFER/AC",
+                             "ChunkedArrayWriter destructed without invoking Finish()." )
+    }
+
+    /// @return The number of values per chunk.
+    size_t          ChunkLength()              const { return size_t(directory.chunkLength); }
+
+    /// @return The algorithms to choose from with each chunk.
+    ArrayCompressor::Algorithm GetAlgorithms()            const { return directory.algorithms; }
+
+    /// @return The selection mode used with each chunk.
+    ArrayCompressor::Selection GetSelection()                      const { return selection; }
+
+    /// @return The number of values passed with #Write so far.
+    uint64_t        Length()                                 const { return directory.length; }
+
+    /// @return The number of values passed with #Write that are not written to the stream yet.
+    size_t          CountPending()                              const { return pending.size(); }
+
+    /// @return The number of bytes of the header and the chunks written to the stream so far.
+    uint64_t        BytesWritten()                      const { return directory.offsets.back(); }
+
+    /// @return \c false if writing to the stream failed, \c true otherwise.
+    bool            IsOK()                                                   const { return ok; }
+
+    /// Passes values to be written. Complete chunks are compressed and written to the stream.
+    /// @param values The values to write.
+    /// @param qty    The number of values.
+    /// @return \c false if writing to the stream failed, \c true otherwise.
+    bool            Write( const TValue* values, size_t qty ) {
+        ALIB_ASSERT_ERROR( !finished, "BITBUFFER/AC", "Write() invoked after Finish()." )
+        size_t chunkLength= size_t(directory.chunkLength);
+        directory.length+= qty;
+
+        // complete a pending chunk
+        if( !pending.empty() ) {
+            size_t take= (std::min)( qty, chunkLength - pending.size() );
+            pending.insert( pending.end(), values, values + take );
+            values+= take;
+            qty   -= take;
+            if( pending.size() < chunkLength )
+                return ok;
+            writeChunk( pending.data(), chunkLength );
+            pending.clear();
+        }
+
+        // compress complete chunks directly from the given values
+        while( qty >= chunkLength ) {
+            writeChunk( values, chunkLength );
+            values+= chunkLength;
+            qty   -= chunkLength;
+        }
+
+        pending.insert( pending.end(), values, values + qty );
+        return ok;
+    }
+
+    /// Appends a chunk that was compressed with
+    /// \alib{bitbuffer::ac_v1;ChunkedArrayFormat::CompressChunk} by the caller.
+    /// This is used to compress chunks in parallel. No values must be pending.
+    /// @param compressed      The buffer holding the compressed chunk.
+    /// @param terminationIdx  The index returned by \b CompressChunk.
+    /// @param qty             The number of values in the chunk. Has to equal #ChunkLength.
+    /// @return \c false if writing to the stream failed, \c true otherwise.
+    bool            AppendChunk( BitBufferBase& compressed, BitBufferBase::Index terminationIdx,
+                                 size_t qty ) {
+        ALIB_ASSERT_ERROR( !finished, "BITBUFFER/AC", "AppendChunk() invoked after Finish()." )
+        ALIB_ASSERT_ERROR( pending.empty() && qty == size_t(directory.chunkLength),
+                           "BITBUFFER/AC", "AppendChunk() requires complete chunks." )
+        directory.length+= qty;
+        appendBuffer( compressed, terminationIdx );
+        return ok;
+    }
+
+    /// Writes the values pending, the directory and the footer.
+    /// Must be invoked once after the last invocation of #Write.
+    /// @return \c false if writing to the stream failed, \c true otherwise.
+    bool            Finish() {
+        ALIB_ASSERT_ERROR( !finished, "BITBUFFER/AC", "Finish() invoked twice." )
+        finished= true;
+        if( !pending.empty() ) {
+            writeChunk( pending.data(), pending.size() );
+            pending.clear();
+        }
+        if( ok )
+            ok= ChunkedArrayFormat::WriteDirectory( os, directory );
+        return ok;
+    }
+
+  protected:
+    /// Compresses and writes a chunk.
+    /// @param values The values of the chunk.
+    /// @param qty    The number of values.
+    void            writeChunk( const TValue* values, size_t qty ) {
+        auto terminationIdx= ChunkedArrayFormat::CompressChunk( bb, values, qty,
+                                                                directory.algorithms, selection,
+                                                                statistics );
+        appendBuffer( bb, terminationIdx );
+    }
+
+    /// Writes a compressed chunk and adds it to the directory.
+    /// @param buffer          The buffer holding the compressed chunk.
+    /// @param terminationIdx  The termination index of \p{buffer}.
+    void            appendBuffer( BitBufferBase& buffer, BitBufferBase::Index terminationIdx ) {
+        if( !ok )
+            return;
+        uint64_t bytes= ChunkedArrayFormat::WriteBuffer( os, buffer, terminationIdx );
+        ok= bytes != 0;
+        directory.offsets.push_back( directory.offsets.back() + bytes );
+    }
+}; // class ChunkedArrayWriter
+
+//==================================================================================================
+/// Reads arrays written by class \alib{bitbuffer::ac_v1;ChunkedArrayWriter}.
+///
+/// On construction, the directory of the container is read. Then, ranges of values can be read
+/// with #Read in any order. Only the chunks that contain the range are decompressed.
+/// The last chunk decompressed partially is cached, so that reading adjacent small ranges
+/// does not decompress a chunk repeatedly.
+///
+/// With the inclusion of module \alib_threadmodel in the \alibbuild, function
+/// \alib{bitbuffer::ac_v1;ReadParallel} decompresses the chunks of larger ranges in parallel.
+///
+/// @tparam TValue The integral type of array data. Has to match the type that the container
+///                was written with.
+//==================================================================================================
+template<typename TValue>
+class ChunkedArrayReader
+{
+    static_assert( std::is_integral<TValue>::value, "TValue has to be an integral type." );
+
+  protected:
+    std::istream&                       is;             ///< The stream to read from.
+    std::istream::pos_type              start;          ///< The start of the container.
+    ChunkedArrayFormat::Directory       directory;      ///< The directory read.
+    BitBuffer                           bb;             ///< The buffer used to load chunks.
+    std::vector<TValue>                 cache;          ///< The values of #cachedChunk.
+    size_t                              cachedChunk;    ///< The number of the cached chunk.
+    bool                                ok;             ///< The result of reading the directory.
+
+  public:
+    /// Constructor. Reads the directory of the container.
+    /// Method #IsOK has to be checked before values are read.
+    /// @param stream The stream to read from. Has to be seekable, and the container has to
+    ///               start at its current read position and end with the stream.
+    ChunkedArrayReader( std::istream& stream )
+    : is         ( stream )
+    , start      ( stream.tellg() )
+    , bb         ( 1024 )
+    , cachedChunk( (std::numeric_limits<size_t>::max)() ) {
+        ok=    ChunkedArrayFormat::ReadDirectory( is, start, directory )
+            && directory.typeCode == ChunkedArrayFormat::TypeCode<TValue>();
+    }
+
+    /// @return \c false if the stream failed or does not contain a container of values of
+    ///         type \p{TValue}, \c true otherwise.
+    bool            IsOK()                                                   const { return ok; }
+
+    /// @return The overall number of values stored.
+    uint64_t        Length()                                 const { return directory.length; }
+
+    /// @return The number of values per chunk.
+    size_t          ChunkLength()              const { return size_t(directory.chunkLength); }
+
+    /// @return The number of chunks.
+    size_t          CountChunks()                       const { return directory.CountChunks(); }
+
+    /// @return The directory of the container.
+    const ChunkedArrayFormat::Directory& GetDirectory()                const { return directory; }
+
+    /// Loads the compressed data of a chunk. Together with
+    /// \alib{bitbuffer::ac_v1;ChunkedArrayFormat::DecompressChunk}, this allows decompressing
+    /// chunks in parallel.
+    /// @param chunkNo The number of the chunk to load.
+    /// @param buffer  The buffer to load to.
+    /// @return \c false if the stream failed, \c true otherwise.
+    bool            LoadChunk( size_t chunkNo, BitBufferBase& buffer ) {
+        ALIB_ASSERT_ERROR( ok && chunkNo < CountChunks(), "BITBUFFER/AC",
+                           "Chunk number {} out of range [0, {}).", chunkNo, CountChunks() )
+        return ChunkedArrayFormat::ReadBuffer( is, start, directory, chunkNo, buffer );
+    }
+
+    /// Decompresses a whole chunk.
+    /// @param chunkNo The number of the chunk.
+    /// @param dest    The destination, with space for
+    ///                \alib{bitbuffer::ac_v1;ChunkedArrayFormat::Directory::ChunkQty} values.
+    /// @return \c false if the stream failed, \c true otherwise.
+    bool            ReadChunk( size_t chunkNo, TValue* dest ) {
+        if( !LoadChunk( chunkNo, bb ) )
+            return false;
+        ChunkedArrayFormat::DecompressChunk( bb, directory.algorithms, dest,
+                                             directory.ChunkQty( chunkNo ) );
+        return true;
+    }
+
+    /// Reads a range of values. Chunks that are covered completely are decompressed directly
+    /// to \p{dest}. Others are decompressed to an internal cache.
+    /// @param first  The index of the first value to read.
+    /// @param qty    The number of values to read.
+    /// @param dest   The destination of the values.
+    /// @return \c false if the stream failed, \c true otherwise.
+    bool            Read( uint64_t first, size_t qty, TValue* dest ) {
+        ALIB_ASSERT_ERROR( ok && first + qty <= directory.length, "BITBUFFER/AC",
+                           "Range [{}, {}) exceeds array length {}.",
+                           first, first + qty, directory.length )
+        uint64_t chunkLength= directory.chunkLength;
+        while( qty > 0 ) {
+            size_t chunkNo   = size_t(first / chunkLength);
+            size_t offset    = size_t(first % chunkLength);
+            size_t chunkQty  = directory.ChunkQty( chunkNo );
+            size_t take      = (std::min)( qty, chunkQty - offset );
+
+            if( take == chunkQty ) {
+                if( !ReadChunk( chunkNo, dest ) )
+                    return false;
+            } else {
+                if( cachedChunk != chunkNo ) {
+                    cache.resize( chunkQty );
+                    cachedChunk= (std::numeric_limits<size_t>::max)();
+                    if( !ReadChunk( chunkNo, cache.data() ) )
+                        return false;
+                    cachedChunk= chunkNo;
+                }
+                std::copy_n( cache.data() + offset, take, dest );
+            }
+            first+= take;
+            dest += take;
+            qty  -= take;
+        }
+        return true;
+    }
+}; // class ChunkedArrayReader
+
+}}} // namespace [alib::bitbuffer::ac_v1]
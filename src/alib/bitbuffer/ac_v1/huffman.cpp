@@ -217,6 +217,32 @@ TEMP_PT(        NString512 bits; bits << Bin(node->symbol->words[0], node->symbo
 TEMP_PT(  Log_Warning("------End of Huffman Encoding Table ----------")  )
 }   }
 
+size_t HuffmanEncoder::EncodedSize( const std::size_t (&frequencies)[256] ) {
+    struct cmp { bool operator()(size_t l, size_t r)  { return l > r; } };
+
+    FixedCapacityVector<size_t, 256> underlyingVector;
+    for (std::size_t i = 0; i < 256 ; ++i)
+        if( frequencies[i] > 0 )
+            underlyingVector.push_back( frequencies[i] );
+    if( underlyingVector.empty() )
+        return 0;
+    size_t ctdSymbols= underlyingVector.size();
+    FixedSizePriorityQueue<size_t, 256, cmp> sortedFrequencies(cmp(), std::move(underlyingVector));
+
+    // The sum of the code lengths of all symbols equals the sum of the frequencies of all
+    // internal nodes created when building the tree.
+    size_t result= 0;
+    while (sortedFrequencies.size() > 1) {
+        size_t merged= sortedFrequencies.top();   sortedFrequencies.pop();
+        merged+=       sortedFrequencies.top();   sortedFrequencies.pop();
+        result+= merged;
+        sortedFrequencies.push( merged );
+    }
+
+    // Generate writes 9 bits for each leaf and 3 bits for each internal node
+    return result + 9 * ctdSymbols + 3 * (ctdSymbols - 1);
+}
+
 void HuffmanDecoder::ReadTree() {
 TEMP_PT(  Log_Warning("------ Huffman Decoding Table ----------")    )
 TEMP_PT( String512 dbgWord; )
@@ -67,6 +67,14 @@ ALIB_DBG( bool      dbgAllValuesAreSame;  )
     ALIB_DLL
     void Generate();
 
+    /// Calculates the number of bits that the encoding of symbols with the given frequencies
+    /// produces, including the encoding table written by #Generate.
+    /// This allows determining the size of a Huffman compression without performing it.
+    /// @param frequencies The frequencies of the 256 symbols.
+    /// @return The number of bits written.
+    ALIB_DLL
+    static size_t EncodedSize( const std::size_t (&frequencies)[256] );
+
     /// Writes the given \p{symbol} to the bit stream.
     /// @param symbol The symbol to write.
     void Write(uint8_t symbol) {
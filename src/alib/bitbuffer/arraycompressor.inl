@@ -23,4 +23,16 @@ using    HuffmanEncoder =  bitbuffer::ac_v1::HuffmanEncoder;
 /// \see Namespace #alib::bitbuffer::ac_v1 for more information.
 using    HuffmanDecoder =  bitbuffer::ac_v1::HuffmanDecoder;
 
+/// Type alias in namespace \b alib, referencing the sub-namespace within #alib::bitbuffer
+/// which provides the current version of array compression.
+/// \see Namespace #alib::bitbuffer::ac_v1 for more information.
+template<typename TValue>
+using    ChunkedArrayWriter =  bitbuffer::ac_v1::ChunkedArrayWriter<TValue>;
+
+/// Type alias in namespace \b alib, referencing the sub-namespace within #alib::bitbuffer
+/// which provides the current version of array compression.
+/// \see Namespace #alib::bitbuffer::ac_v1 for more information.
+template<typename TValue>
+using    ChunkedArrayReader =  bitbuffer::ac_v1::ChunkedArrayReader<TValue>;
+
 } // namespace [alib]
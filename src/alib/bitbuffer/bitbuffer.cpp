@@ -13,6 +13,23 @@
 #endif
 //========================================= Global Fragment ========================================
 #include "alib/bitbuffer/bitbuffer.prepro.hpp"
+#include <array>
+#include <bit>
+#include <cstring>
+#include <utility>
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+#   define ALIB_BITBUFFER_SSE2    1
+#   include <emmintrin.h>
+#   if defined(__SSE4_1__)
+#       include <smmintrin.h>
+#   endif
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#   define ALIB_BITBUFFER_NEON    1
+#   include <arm_neon.h>
+#endif
 
 //============================================== Module ============================================
 #if ALIB_C20_MODULES
@@ -260,4 +277,344 @@ uint64_t BitReader::readUIntegral64() {
        default: return uint64_t(result >> 3 |  (Read< 56, uint64_t>() << 8 ));
 }   }
 
+//##################################################################################################
+// Bulk writing and reading
+//##################################################################################################
+#if !DOXYGEN
+namespace {
+
+using TStorage= BitBufferBase::TStorage;
+static_assert( bitsof(TStorage) == 32, "Bulk kernels assume 32-bit storage words." );
+
+// The state of bulk writing and reading. The accumulator holds the bits of the current storage
+// word that are not written to, respectively not read from, the buffer, yet.
+struct BulkState
+{
+    TStorage*   word;       // the current storage word
+    uint64_t    acc;        // the accumulator
+    int         accBits;    // the number of valid bits in the accumulator
+};
+
+//--------------------------------------------- packing --------------------------------------------
+// Writes the values with a width known at compile-time. With widths up to 32 bits, at most one
+// storage word is completed per value. Wider values are written in two steps.
+template<int TWidth, typename TValue>
+void pack( BulkState& st, const TValue* values, size_t qty ) {
+    TStorage*   dest   = st.word;
+    uint64_t    acc    = st.acc;
+    int         accBits= st.accBits;
+
+    if constexpr ( TWidth <= 32 ) {
+        constexpr uint64_t mask= lang::LowerMask<TWidth, uint64_t>();
+        for( size_t i= 0 ; i < qty ; ++i ) {
+            acc    |= ( uint64_t(values[i]) & mask ) << accBits;
+            accBits+= TWidth;
+            if( accBits >= 32 ) {
+                *dest++ = TStorage(acc);
+                acc   >>= 32;
+                accBits-= 32;
+    }   }   }
+    else {
+        constexpr uint64_t mask= lang::LowerMask<TWidth - 32, uint64_t>();
+        for( size_t i= 0 ; i < qty ; ++i ) {
+            uint64_t value= uint64_t(values[i]);
+            acc    |= ( value & 0xFFFFFFFFu ) << accBits;
+            *dest++ = TStorage(acc);
+            acc   >>= 32;
+            acc    |= ( ( value >> 32 ) & mask ) << accBits;
+            accBits+= TWidth - 32;
+            if( accBits >= 32 ) {
+                *dest++ = TStorage(acc);
+                acc   >>= 32;
+                accBits-= 32;
+    }   }   }
+
+    st.word= dest;  st.acc= acc;  st.accBits= accBits;
+}
+
+// Reads the values with a width known at compile-time.
+template<int TWidth, typename TValue>
+void unpack( BulkState& st, TValue* values, size_t qty ) {
+    TStorage*   src    = st.word;
+    uint64_t    acc    = st.acc;
+    int         accBits= st.accBits;
+
+    if constexpr ( TWidth <= 32 ) {
+        constexpr uint64_t mask= lang::LowerMask<TWidth, uint64_t>();
+        for( size_t i= 0 ; i < qty ; ++i ) {
+            if( accBits < TWidth ) {
+                acc    |= uint64_t( *++src ) << accBits;
+                accBits+= 32;
+            }
+            values[i]= TValue( acc & mask );
+            acc    >>= TWidth;
+            accBits -= TWidth;
+    }   }
+    else {
+        constexpr uint64_t mask= lang::LowerMask<TWidth - 32, uint64_t>();
+        for( size_t i= 0 ; i < qty ; ++i ) {
+            if( accBits < 32 ) {
+                acc    |= uint64_t( *++src ) << accBits;
+                accBits+= 32;
+            }
+            uint64_t value= acc & 0xFFFFFFFFu;
+            acc    >>= 32;
+            accBits -= 32;
+            if( accBits < TWidth - 32 ) {
+                acc    |= uint64_t( *++src ) << accBits;
+                accBits+= 32;
+            }
+            values[i]= TValue( value | ( ( acc & mask ) << 32 ) );
+            acc    >>= TWidth - 32;
+            accBits -= TWidth - 32;
+    }   }
+
+    st.word= src;  st.acc= acc;  st.accBits= accBits;
+}
+
+// Tables of the kernels, indexed by the width minus one.
+template<typename TValue> using PackKernel  = void (*)( BulkState&, const TValue*, size_t );
+template<typename TValue> using UnpackKernel= void (*)( BulkState&,       TValue*, size_t );
+
+template<typename TValue, size_t... TWidths>
+constexpr std::array<PackKernel<TValue>, sizeof...(TWidths)>
+makePackKernels( std::index_sequence<TWidths...> )     { return { &pack  <int(TWidths) + 1, TValue>... }; }
+
+template<typename TValue, size_t... TWidths>
+constexpr std::array<UnpackKernel<TValue>, sizeof...(TWidths)>
+makeUnpackKernels( std::index_sequence<TWidths...> )   { return { &unpack<int(TWidths) + 1, TValue>... }; }
+
+template<typename TValue>
+constexpr auto packKernels  = makePackKernels  <TValue>( std::make_index_sequence<bitsof(TValue)>() );
+template<typename TValue>
+constexpr auto unpackKernels= makeUnpackKernels<TValue>( std::make_index_sequence<bitsof(TValue)>() );
+
+//------------------------------------------- byte widths ------------------------------------------
+// Stores values in a narrower (or equally wide) integral type of TSize bytes at the given
+// (unaligned) address. Used to write values of 8, 16 or 32 bits to byte-aligned positions.
+template<size_t TSize, typename TValue>
+void narrow( const TValue* src, size_t qty, uint8_t* dest ) {
+    if constexpr ( TSize == sizeof(TValue) ) {
+        std::memcpy( dest, src, qty * TSize );
+        return;
+    }
+    size_t i= 0;
+
+    #if defined(__AVX2__)
+        if constexpr ( sizeof(TValue) == 2 && TSize == 1 ) {
+            const __m256i mask= _mm256_set1_epi16( 0x00FF );
+            for( ; i + 32 <= qty ; i+= 32 ) {
+                const __m256i* s= reinterpret_cast<const __m256i*>( src + i );
+                __m256i a= _mm256_and_si256( mask, _mm256_loadu_si256( s     ) );
+                __m256i b= _mm256_and_si256( mask, _mm256_loadu_si256( s + 1 ) );
+                _mm256_storeu_si256( reinterpret_cast<__m256i*>( dest + i ),
+                                     _mm256_permute4x64_epi64( _mm256_packus_epi16( a, b ), 0xD8 ) );
+        }   }
+        if constexpr ( sizeof(TValue) == 4 && TSize == 2 ) {
+            const __m256i mask= _mm256_set1_epi32( 0x0000FFFF );
+            for( ; i + 16 <= qty ; i+= 16 ) {
+                const __m256i* s= reinterpret_cast<const __m256i*>( src + i );
+                __m256i a= _mm256_and_si256( mask, _mm256_loadu_si256( s     ) );
+                __m256i b= _mm256_and_si256( mask, _mm256_loadu_si256( s + 1 ) );
+                _mm256_storeu_si256( reinterpret_cast<__m256i*>( dest + 2 * i ),
+                                     _mm256_permute4x64_epi64( _mm256_packus_epi32( a, b ), 0xD8 ) );
+        }   }
+    #endif
+
+    #if ALIB_BITBUFFER_SSE2
+        if constexpr ( sizeof(TValue) == 2 && TSize == 1 ) {
+            const __m128i mask= _mm_set1_epi16( 0x00FF );
+            for( ; i + 16 <= qty ; i+= 16 ) {
+                const __m128i* s= reinterpret_cast<const __m128i*>( src + i );
+                __m128i a= _mm_and_si128( mask, _mm_loadu_si128( s     ) );
+                __m128i b= _mm_and_si128( mask, _mm_loadu_si128( s + 1 ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( dest + i ), _mm_packus_epi16( a, b ) );
+        }   }
+        #if defined(__SSE4_1__)
+        if constexpr ( sizeof(TValue) == 4 && TSize == 2 ) {
+            const __m128i mask= _mm_set1_epi32( 0x0000FFFF );
+            for( ; i + 8 <= qty ; i+= 8 ) {
+                const __m128i* s= reinterpret_cast<const __m128i*>( src + i );
+                __m128i a= _mm_and_si128( mask, _mm_loadu_si128( s     ) );
+                __m128i b= _mm_and_si128( mask, _mm_loadu_si128( s + 1 ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( dest + 2 * i ), _mm_packus_epi32( a, b ) );
+        }   }
+        #endif
+    #elif ALIB_BITBUFFER_NEON
+        if constexpr ( sizeof(TValue) == 2 && TSize == 1 )
+            for( ; i + 16 <= qty ; i+= 16 ) {
+                const uint16_t* s= reinterpret_cast<const uint16_t*>( src + i );
+                vst1q_u8( dest + i, vcombine_u8( vmovn_u16( vld1q_u16( s     ) ),
+                                                 vmovn_u16( vld1q_u16( s + 8 ) ) ) );
+            }
+        if constexpr ( sizeof(TValue) == 4 && TSize == 2 )
+            for( ; i + 8 <= qty ; i+= 8 ) {
+                const uint32_t* s= reinterpret_cast<const uint32_t*>( src + i );
+                vst1q_u8( dest + 2 * i, vreinterpretq_u8_u16(
+                                        vcombine_u16( vmovn_u32( vld1q_u32( s     ) ),
+                                                      vmovn_u32( vld1q_u32( s + 4 ) ) ) ) );
+            }
+    #endif
+
+    // portable fallback and remainder
+    using TDest= std::conditional_t<TSize == 1, uint8_t,
+                 std::conditional_t<TSize == 2, uint16_t, uint32_t> >;
+    for( ; i < qty ; ++i ) {
+        TDest value= TDest( src[i] );
+        std::memcpy( dest + TSize * i, &value, TSize );
+}   }
+
+// Loads values of an integral type of TSize bytes from the given (unaligned) address into a
+// wider (or equally wide) type. Used to read values of 8, 16 or 32 bits from byte-aligned
+// positions.
+template<size_t TSize, typename TValue>
+void widen( const uint8_t* src, size_t qty, TValue* dest ) {
+    if constexpr ( TSize == sizeof(TValue) ) {
+        std::memcpy( dest, src, qty * TSize );
+        return;
+    }
+    size_t i= 0;
+
+    #if defined(__AVX2__)
+        if constexpr ( TSize == 1 && sizeof(TValue) == 2 )
+            for( ; i + 16 <= qty ; i+= 16 )
+                _mm256_storeu_si256( reinterpret_cast<__m256i*>( dest + i ), _mm256_cvtepu8_epi16(
+                                     _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + i ) ) ) );
+        if constexpr ( TSize == 1 && sizeof(TValue) == 4 )
+            for( ; i + 8 <= qty ; i+= 8 )
+                _mm256_storeu_si256( reinterpret_cast<__m256i*>( dest + i ), _mm256_cvtepu8_epi32(
+                                     _mm_loadl_epi64( reinterpret_cast<const __m128i*>( src + i ) ) ) );
+        if constexpr ( TSize == 2 && sizeof(TValue) == 4 )
+            for( ; i + 8 <= qty ; i+= 8 )
+                _mm256_storeu_si256( reinterpret_cast<__m256i*>( dest + i ), _mm256_cvtepu16_epi32(
+                                     _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + 2 * i ) ) ) );
+    #endif
+
+    #if ALIB_BITBUFFER_SSE2
+        const __m128i zero= _mm_setzero_si128();
+        if constexpr ( TSize == 1 && sizeof(TValue) == 2 )
+            for( ; i + 16 <= qty ; i+= 16 ) {
+                __m128i  v= _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + i ) );
+                __m128i* d= reinterpret_cast<__m128i*>( dest + i );
+                _mm_storeu_si128( d    , _mm_unpacklo_epi8( v, zero ) );
+                _mm_storeu_si128( d + 1, _mm_unpackhi_epi8( v, zero ) );
+            }
+        if constexpr ( TSize == 2 && sizeof(TValue) == 4 )
+            for( ; i + 8 <= qty ; i+= 8 ) {
+                __m128i  v= _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + 2 * i ) );
+                __m128i* d= reinterpret_cast<__m128i*>( dest + i );
+                _mm_storeu_si128( d    , _mm_unpacklo_epi16( v, zero ) );
+                _mm_storeu_si128( d + 1, _mm_unpackhi_epi16( v, zero ) );
+            }
+    #elif ALIB_BITBUFFER_NEON
+        if constexpr ( TSize == 1 && sizeof(TValue) == 2 )
+            for( ; i + 16 <= qty ; i+= 16 ) {
+                uint8x16_t v= vld1q_u8( src + i );
+                uint16_t*  d= reinterpret_cast<uint16_t*>( dest + i );
+                vst1q_u16( d    , vmovl_u8     ( vget_low_u8( v ) ) );
+                vst1q_u16( d + 8, vmovl_high_u8( v )                 );
+            }
+        if constexpr ( TSize == 2 && sizeof(TValue) == 4 )
+            for( ; i + 8 <= qty ; i+= 8 ) {
+                uint16x8_t v= vreinterpretq_u16_u8( vld1q_u8( src + 2 * i ) );
+                uint32_t*  d= reinterpret_cast<uint32_t*>( dest + i );
+                vst1q_u32( d    , vmovl_u16     ( vget_low_u16( v ) ) );
+                vst1q_u32( d + 4, vmovl_high_u16( v )                  );
+            }
+    #endif
+
+    // portable fallback and remainder
+    using TSrc= std::conditional_t<TSize == 1, uint8_t,
+                std::conditional_t<TSize == 2, uint16_t, uint32_t> >;
+    for( ; i < qty ; ++i ) {
+        TSrc value;
+        std::memcpy( &value, src + TSize * i, TSize );
+        dest[i]= TValue( value );
+}   }
+
+// Returns true if values of the given width can be copied bytewise to the given bit position.
+bool isByteCopyable( ShiftOpRHS width, ShiftOpRHS bit ) {
+    return     std::endian::native == std::endian::little
+           &&  ( width == 8 || width == 16 || width == 32 )
+           &&  ( bit % 8 ) == 0;
+}
+
+// Copies values with the given width of 8, 16 or 32 bits to or from the given byte address.
+template<bool TWrite, size_t TSize, typename TValue>
+void copyBytes( uint8_t* bytes, TValue* values, size_t qty ) {
+    if constexpr ( TWrite )  narrow<TSize>( values, qty, bytes  );
+    else                     widen <TSize>( bytes , qty, values );
+}
+
+template<bool TWrite, typename TValue>
+void copyBytes( ShiftOpRHS width, uint8_t* bytes, TValue* values, size_t qty ) {
+    if( width == 8 )
+        copyBytes<TWrite, 1>( bytes, values, qty );
+    if constexpr ( sizeof(TValue) >= 2 )
+        if( width == 16 )
+            copyBytes<TWrite, 2>( bytes, values, qty );
+    if constexpr ( sizeof(TValue) >= 4 )
+        if( width == 32 )
+            copyBytes<TWrite, 4>( bytes, values, qty );
+}
+
+} // anonymous namespace
+#endif // !DOXYGEN
+
+template<typename TValue>
+void BitWriter::writeBulkImpl( ShiftOpRHS width, const TValue* values, size_t qty ) {
+    if( isByteCopyable( width, idx.bit ) ) {
+        // store the current word and copy the values behind its used bytes
+        bb.SetWord( idx, word );
+        copyBytes<true>( width, reinterpret_cast<uint8_t*>( bb.Data() + idx.pos ) + idx.bit / 8,
+                         const_cast<TValue*>( values ), qty );
+        uinteger bits= uinteger( idx.bit ) + uinteger( width ) * qty;
+        idx.pos+= bits / 32;
+        idx.bit = ShiftOpRHS( bits % 32 );
+        word    = idx.bit ? bb.GetWord( idx ) & lang::LowerMask<TStorage>( idx.bit ) : 0;
+        return;
+    }
+
+    BulkState st{ bb.Data() + idx.pos, word, idx.bit };
+    packKernels<TValue>[size_t( width - 1 )]( st, values, qty );
+    idx.pos= uinteger( st.word - bb.Data() );
+    idx.bit= st.accBits;
+    word   = TStorage( st.acc );
+}
+
+template<typename TValue>
+void BitReader::readBulkImpl( ShiftOpRHS width, TValue* values, size_t qty ) {
+    if( isByteCopyable( width, idx.bit ) ) {
+        copyBytes<false>( width, reinterpret_cast<uint8_t*>( bb.Data() + idx.pos ) + idx.bit / 8,
+                          values, qty );
+        uinteger bits= uinteger( idx.bit ) + uinteger( width ) * qty;
+        idx.pos+= bits / 32;
+        idx.bit = ShiftOpRHS( bits % 32 );
+        Sync();
+        return;
+    }
+
+    // the accumulator starts with the unread bits of the current word
+    BulkState st{ bb.Data() + idx.pos, word, 32 - idx.bit };
+    unpackKernels<TValue>[size_t( width - 1 )]( st, values, qty );
+    idx.pos= uinteger( st.word - bb.Data() );
+    idx.bit= 32 - st.accBits;
+    if( idx.bit == 32 ) {
+        idx.pos++;
+        idx.bit= 0;
+        word= bb.GetWord( idx );
+    }
+    else
+        word= TStorage( st.acc );
+}
+
+void BitWriter::writeBulk( ShiftOpRHS w, const uint8_t*  v, size_t qty ) { writeBulkImpl( w, v, qty ); }
+void BitWriter::writeBulk( ShiftOpRHS w, const uint16_t* v, size_t qty ) { writeBulkImpl( w, v, qty ); }
+void BitWriter::writeBulk( ShiftOpRHS w, const uint32_t* v, size_t qty ) { writeBulkImpl( w, v, qty ); }
+void BitWriter::writeBulk( ShiftOpRHS w, const uint64_t* v, size_t qty ) { writeBulkImpl( w, v, qty ); }
+void BitReader::readBulk ( ShiftOpRHS w,       uint8_t*  v, size_t qty ) { readBulkImpl ( w, v, qty ); }
+void BitReader::readBulk ( ShiftOpRHS w,       uint16_t* v, size_t qty ) { readBulkImpl ( w, v, qty ); }
+void BitReader::readBulk ( ShiftOpRHS w,       uint32_t* v, size_t qty ) { readBulkImpl ( w, v, qty ); }
+void BitReader::readBulk ( ShiftOpRHS w,       uint64_t* v, size_t qty ) { readBulkImpl ( w, v, qty ); }
+
 }} // namespace [alib::bitbuffer]
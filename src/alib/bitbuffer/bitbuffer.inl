@@ -483,6 +483,15 @@ class BitRWBase
     BitBufferBase&          bb;    ///< The bit buffer to write into. Provided on construction.
     BitBufferBase::Index    idx;   ///< The current reading/writing index within #bb.
 
+    /// Maps an unsigned integral type to the fixed-width type of the same size.
+    /// Used to pass arrays to the non-templated bulk methods of the derived classes.
+    /// @tparam TUIntegral The unsigned integral type.
+    template<typename TUIntegral>
+    using TFixedWidth= std::conditional_t<sizeof(TUIntegral) == 1, uint8_t,
+                       std::conditional_t<sizeof(TUIntegral) == 2, uint16_t,
+                       std::conditional_t<sizeof(TUIntegral) == 4, uint32_t,
+                                                                   uint64_t > > >;
+
     /// Protected constructor, used by derived classes only.
     /// @param buffer The bit buffer to work on.
     explicit BitRWBase( BitBufferBase& buffer )
@@ -729,7 +738,7 @@ class BitWriter : public BitRWBase
                 "BITBUFFER", "Upper bits dirty while TMaskValue not set.")
 
         if constexpr (TMaskValue)
-            if( width <= bitsof(TValue) )
+            if( width < bitsof(TValue) )
                 value&= lang::LowerMask<TValue>(width);
 
         if( width <= bitsof(TStorage) ) {
@@ -815,6 +824,58 @@ class BitWriter : public BitRWBase
                                     : TUnsigned( (TUnsigned(-(value+ 1)) << 1) | 1 )   );
     }
 
+    /// Returns the number of bits that method \alib{bitbuffer::BitWriter;Write<TUIntegral>}
+    /// writes for the given value. This allows calculating the size of an encoding without
+    /// performing it.
+    /// @tparam TUIntegral  The type of the given unsigned integral.
+    /// @param  value       The value to calculate the encoded size for.
+    /// @return The number of bits needed to write \p{value}.
+    template<typename TUIntegral>
+    requires ( std::unsigned_integral<TUIntegral> && !std::same_as< TUIntegral, bool> )
+    static constexpr lang::ShiftOpRHS EncodedSize( TUIntegral value ) {
+        if constexpr ( bitsof(TUIntegral) == 8 )
+            return value < (1 << 3) ? 4 : 9;
+        else if constexpr ( bitsof(TUIntegral) == 16 )
+            return value < (1 << 8) ? 9 : 17;
+        else {
+            // the number of bytes needed, prefixed by two (32-bit) or three (64-bit) bits
+            constexpr lang::ShiftOpRHS prefixBits= bitsof(TUIntegral) == 32 ? 2 : 3;
+            return prefixBits + 8 * (std::max)( 1, (lang::MSB0( value ) + 7) / 8 );
+    }   }
+
+    /// Writes an array of unsigned integral values, each with the given number of bits.
+    /// The result is the same as if #Write<TValue,TMaskValue>(ShiftOpRHS,TValue) was invoked
+    /// for each value with template parameter \p{TMaskValue} set to \c true. Hence, bits
+    /// beyond \p{width} are ignored.
+    ///
+    /// Bulk writing is considerably faster than writing single values: The bits are packed with
+    /// a kernel function that is specialized for the given width, using a 64-bit accumulator
+    /// and writing whole storage words. If \p{width} is \c 8, \c 16 or \c 32 and the current
+    /// bit position is a multiple of eight, the values are copied bytewise, using SSE2/SSE4.1,
+    /// AVX2 or NEON instructions where available. (The latter is done only on little-endian
+    /// platforms.)
+    ///
+    /// \attention
+    ///   The buffer capacity is not increased by this method. It is asserted in debug-compilations
+    ///   that the values fit into the buffer.
+    ///
+    /// @tparam TValue  The unsigned integral type of the values.
+    ///                 (Deduced from parameter \p{values}.)
+    /// @param  width   The number of bits to write for each value. Must be in the range
+    ///                 <c>[0, bitsof(TValue)]</c>. If \c 0, nothing is written.
+    /// @param  values  The values to write.
+    /// @param  qty     The number of values.
+    template<typename TValue>
+    requires ( std::unsigned_integral<TValue> && !std::same_as< TValue, bool> )
+    void Write( lang::ShiftOpRHS width, const TValue* values, size_t qty ) {
+        ALIB_ASSERT_ERROR( width >= 0 && width <= bitsof(TValue), "BITBUFFER",
+                           "Bit width {} given for {}-bit values.", width, bitsof(TValue) )
+        ALIB_ASSERT_ERROR( idx.CountBits() + uinteger(width) * qty <= bb.Capacity(), "BITBUFFER",
+                           "BitBufferBase overflow" )
+        if( width > 0 && qty > 0 )
+            writeBulk( width, reinterpret_cast<const TFixedWidth<TValue>*>( values ), qty );
+    }
+
   protected:
 
     /// Internal method that writes a unsigned 8-bit value.
@@ -833,6 +894,38 @@ class BitWriter : public BitRWBase
     /// @param value The value to write.
     ALIB_DLL void      writeUIntegral( uint64_t value );
 
+    /// Internal method that writes an array of unsigned 8-bit values.
+    /// @param width  The number of bits to write for each value.
+    /// @param values The values to write.
+    /// @param qty    The number of values.
+    ALIB_DLL void      writeBulk( lang::ShiftOpRHS width, const uint8_t*  values, size_t qty );
+
+    /// Internal method that writes an array of unsigned 16-bit values.
+    /// @param width  The number of bits to write for each value.
+    /// @param values The values to write.
+    /// @param qty    The number of values.
+    ALIB_DLL void      writeBulk( lang::ShiftOpRHS width, const uint16_t* values, size_t qty );
+
+    /// Internal method that writes an array of unsigned 32-bit values.
+    /// @param width  The number of bits to write for each value.
+    /// @param values The values to write.
+    /// @param qty    The number of values.
+    ALIB_DLL void      writeBulk( lang::ShiftOpRHS width, const uint32_t* values, size_t qty );
+
+    /// Internal method that writes an array of unsigned 64-bit values.
+    /// @param width  The number of bits to write for each value.
+    /// @param values The values to write.
+    /// @param qty    The number of values.
+    ALIB_DLL void      writeBulk( lang::ShiftOpRHS width, const uint64_t* values, size_t qty );
+
+    /// Implementation of the overloaded methods #writeBulk.
+    /// @tparam TValue The unsigned integral type of the values.
+    /// @param  width  The number of bits to write for each value.
+    /// @param  values The values to write.
+    /// @param  qty    The number of values.
+    template<typename TValue>
+    void               writeBulkImpl( lang::ShiftOpRHS width, const TValue* values, size_t qty );
+
 
 }; // class BitWriter
 
@@ -1019,11 +1112,13 @@ class BitReader : public BitRWBase
                                                      "Read size given greater than value type.")
 
         TResult     result;
-        if ( width < bitsof(TStorage)  )
+        if ( width < bitsof(TStorage)  ) {
             result= TResult( word   & lang::LowerMask<TStorage>(width) );
-        else
+            word>>= width;
+        } else {
             result= TResult( word  );
-        word>>= width;
+            word  = 0;
+        }
 
         idx.bit+= width;
         if(idx.bit >= bitsof(TStorage)) {
@@ -1033,8 +1128,10 @@ class BitReader : public BitRWBase
 
             if( idx.bit ) {
                 lang::ShiftOpRHS bitsRead= width - idx.bit;
-                result |= TResult( (   word << bitsRead )
-                                     & lang::LowerMask<TStorage>(width) );
+                TStorage upper= word << bitsRead;
+                if( width < bitsof(TStorage) )
+                    upper&= lang::LowerMask<TStorage>(width);
+                result |= TResult( upper );
                 word>>= idx.bit;
         }   }
 
@@ -1064,11 +1161,13 @@ class BitReader : public BitRWBase
 
         if( width <= bitsof(TStorage)) {
             TResult     result;
-            if ( width < bitsof(TStorage)  )
+            if ( width < bitsof(TStorage)  ) {
                 result= TResult( word   & lang::LowerMask<TStorage>(width) );
-            else
+                word>>= width;
+            } else {
                 result= TResult( word  );
-            word>>= width;
+                word  = 0;
+            }
 
             idx.bit+= width;
             if(idx.bit >= bitsof(TStorage)) {
@@ -1078,8 +1177,10 @@ class BitReader : public BitRWBase
 
                 if( idx.bit ) {
                     lang::ShiftOpRHS bitsRead= width - idx.bit;
-                    result |= TResult( (   word << bitsRead )
-                                         & lang::LowerMask<TStorage>(width) );
+                    TStorage upper= word << bitsRead;
+                    if( width < bitsof(TStorage) )
+                        upper&= lang::LowerMask<TStorage>(width);
+                    result |= TResult( upper );
                     word>>= idx.bit;
             }   }
 
@@ -1102,8 +1203,9 @@ class BitReader : public BitRWBase
                 idx.pos++;
                 word= bb.GetWord(idx);
             } else {
-                result= lang::LowerBits<TResult>( width, result );
-                word>>= width;
+                if( width < bitsof(TResult) )
+                    result= lang::LowerBits<TResult>( width, result );
+                word>>= idx.bit;
             }
             return result;
     }   }
@@ -1166,6 +1268,33 @@ class BitReader : public BitRWBase
                              :  TSIntegral(              result >> 1 );
     }
 
+    /// Reads an array of unsigned integral values, each with the given number of bits.
+    /// This is the counterpart of method
+    /// \alib{bitbuffer;BitWriter::Write(lang::ShiftOpRHS, const TValue*, size_t)}, but may also
+    /// be used to read values that were written one by one.
+    /// The implementation uses kernel functions specialized for the given width, as documented
+    /// with the writing method.
+    ///
+    /// @tparam TValue  The unsigned integral type of the values.
+    ///                 (Deduced from parameter \p{values}.)
+    /// @param  width   The number of bits to read for each value. Must be in the range
+    ///                 <c>[0, bitsof(TValue)]</c>. If \c 0, the values are set to \c 0.
+    /// @param  values  The array to read the values to.
+    /// @param  qty     The number of values.
+    template<typename TValue>
+    requires ( std::unsigned_integral<TValue> && !std::same_as< TValue, bool> )
+    void Read( lang::ShiftOpRHS width, TValue* values, size_t qty ) {
+        ALIB_ASSERT_ERROR( width >= 0 && width <= bitsof(TValue), "BITBUFFER",
+                           "Bit width {} given for {}-bit values.", width, bitsof(TValue) )
+        ALIB_ASSERT_ERROR( idx.pos < bb.Capacity(), "BITBUFFER", "BitBufferBase overflow" )
+        if( width == 0 ) {
+            std::fill( values, values + qty, TValue(0) );
+            return;
+        }
+        if( qty > 0 )
+            readBulk( width, reinterpret_cast<TFixedWidth<TValue>*>( values ), qty );
+    }
+
   protected:
     /// Internal method that reads a unsigned 8-bit value.
     /// @return The value read.
@@ -1183,6 +1312,38 @@ class BitReader : public BitRWBase
     /// @return The value read.
     ALIB_DLL uint64_t  readUIntegral64();
 
+    /// Internal method that reads an array of unsigned 8-bit values.
+    /// @param width  The number of bits to read for each value.
+    /// @param values The array to read the values to.
+    /// @param qty    The number of values.
+    ALIB_DLL void      readBulk( lang::ShiftOpRHS width, uint8_t*  values, size_t qty );
+
+    /// Internal method that reads an array of unsigned 16-bit values.
+    /// @param width  The number of bits to read for each value.
+    /// @param values The array to read the values to.
+    /// @param qty    The number of values.
+    ALIB_DLL void      readBulk( lang::ShiftOpRHS width, uint16_t* values, size_t qty );
+
+    /// Internal method that reads an array of unsigned 32-bit values.
+    /// @param width  The number of bits to read for each value.
+    /// @param values The array to read the values to.
+    /// @param qty    The number of values.
+    ALIB_DLL void      readBulk( lang::ShiftOpRHS width, uint32_t* values, size_t qty );
+
+    /// Internal method that reads an array of unsigned 64-bit values.
+    /// @param width  The number of bits to read for each value.
+    /// @param values The array to read the values to.
+    /// @param qty    The number of values.
+    ALIB_DLL void      readBulk( lang::ShiftOpRHS width, uint64_t* values, size_t qty );
+
+    /// Implementation of the overloaded methods #readBulk.
+    /// @tparam TValue The unsigned integral type of the values.
+    /// @param  width  The number of bits to read for each value.
+    /// @param  values The array to read the values to.
+    /// @param  qty    The number of values.
+    template<typename TValue>
+    void               readBulkImpl( lang::ShiftOpRHS width, TValue* values, size_t qty );
+
 
 }; // class BitReader
 
@@ -0,0 +1,151 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of module \alib_bitbuffer of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib {  namespace bitbuffer { namespace ac_v1 {
+
+/// Returns the number of chunks that functions \alib{bitbuffer::ac_v1;WriteParallel} and
+/// \alib{bitbuffer::ac_v1;ReadParallel} process with one invocation of
+/// \alib{threadmodel;ParallelFor}. Each chunk of a batch occupies an own bit buffer, while
+/// the stream is written, respectively read, by the calling thread between the batches.
+/// @return Twice the number of hardware threads.
+inline integer ParallelChunkBatchSize()
+{ return integer( 2 * (std::max)( ThreadPool::HardwareConcurrency(), 1 ) ); }
+
+/// Same as \alib{bitbuffer::ac_v1;ChunkedArrayWriter::Write}, but compresses complete chunks
+/// in parallel. The chunks are written to the stream in their order, hence the output is the
+/// same as produced by \b Write.
+///
+/// Values pending in the writer are completed to a chunk first, and the values that do not fill
+/// a complete chunk remain pending, until further values are passed or
+/// \alib{bitbuffer::ac_v1;ChunkedArrayWriter::Finish} is invoked.
+/// The statistics record optionally given with the writer does not receive the chunks compressed
+/// in parallel.
+///
+/// @tparam TValue  The integral type of array data.
+/// @param  pool    The thread pool to use.
+/// @param  writer  The writer to write the compressed chunks with.
+/// @param  values  The values to write.
+/// @param  qty     The number of values.
+/// @return \c false if writing to the stream failed, \c true otherwise.
+template<typename TValue>
+bool WriteParallel( ThreadPool&                   pool,
+                    ChunkedArrayWriter<TValue>&   writer,
+                    const TValue*                 values,
+                    uint64_t                      qty      ) {
+    size_t chunkLength= writer.ChunkLength();
+
+    // complete a pending chunk
+    if( writer.CountPending() > 0 ) {
+        size_t take= size_t( (std::min)( qty, uint64_t( chunkLength - writer.CountPending() ) ) );
+        writer.Write( values, take );
+        values+= take;
+        qty   -= take;
+    }
+
+    // compress complete chunks in batches
+    uint64_t qtyChunks= qty / chunkLength;
+    if( qtyChunks > 1 ) {
+        integer batchSize= (std::min)( integer( qtyChunks ), ParallelChunkBatchSize() );
+        std::vector<BitBuffer>              buffers;
+        std::vector<BitBufferBase::Index>   terminationIdxs;
+        buffers        .reserve( size_t( batchSize ) );
+        terminationIdxs.resize ( size_t( batchSize ) );
+        for( integer i= 0; i < batchSize; ++i )
+            buffers.emplace_back( ChunkedArrayFormat::ChunkCapacity<TValue>( chunkLength ) );
+
+        while( qtyChunks > 0 && writer.IsOK() ) {
+            integer batch= (std::min)( integer( qtyChunks ), batchSize );
+            threadmodel::ParallelFor( pool, 0, batch, 1, [&]( integer begin, integer end ) {
+                for( integer i= begin; i < end; ++i )
+                    terminationIdxs[size_t(i)]= ChunkedArrayFormat::CompressChunk(
+                            buffers[size_t(i)], values + size_t(i) * chunkLength, chunkLength,
+                            writer.GetAlgorithms(), writer.GetSelection(), nullptr );
+            } );
+            for( integer i= 0; i < batch; ++i )
+                writer.AppendChunk( buffers[size_t(i)], terminationIdxs[size_t(i)], chunkLength );
+            values   += size_t(batch) * chunkLength;
+            qty      -= uint64_t(batch) * chunkLength;
+            qtyChunks-= uint64_t(batch);
+        }
+        if( !writer.IsOK() )
+            return false;
+    }
+
+    return writer.Write( values, size_t( qty ) );
+}
+
+#include "ALib.Lang.CIFunctions.H"
+/// Same as \alib{bitbuffer::ac_v1;ChunkedArrayReader::Read}, but decompresses the chunks that
+/// are covered completely by the range in parallel. The compressed chunks are loaded from the
+/// stream by the calling thread.
+///
+/// @tparam TValue  The integral type of array data.
+/// @param  pool    The thread pool to use.
+/// @param  reader  The reader to read the chunks with.
+/// @param  first   The index of the first value to read.
+/// @param  qty     The number of values to read.
+/// @param  dest    The destination of the values.
+/// @return \c false if the stream failed, \c true otherwise.
+template<typename TValue>
+bool ReadParallel( ThreadPool&                   pool,
+                   ChunkedArrayReader<TValue>&   reader,
+                   uint64_t                      first,
+                   uint64_t                      qty,
+                   TValue*                       dest     ) {
+    const auto& directory  = reader.GetDirectory();
+    uint64_t    chunkLength= directory.chunkLength;
+    ALIB_ASSERT_ERROR( reader.IsOK() && first + qty <= directory.length, "BITBUFFER/AC",
+                       "Range [{}, {}) exceeds array length {}.",
+                       first, first + qty, directory.length )
+
+    // leading part of a chunk
+    if( first % chunkLength != 0 ) {
+        size_t take= size_t( (std::min)( qty, chunkLength - first % chunkLength ) );
+        if( !reader.Read( first, take, dest ) )
+            return false;
+        first+= take;
+        dest += take;
+        qty  -= take;
+    }
+
+    // complete chunks in batches
+    size_t chunkNo = size_t( first / chunkLength );
+    size_t chunkEnd=    first + qty == directory.length ? directory.CountChunks()
+                                                        : size_t( (first + qty) / chunkLength );
+    if( chunkEnd > chunkNo + 1 ) {
+        integer batchSize= (std::min)( integer( chunkEnd - chunkNo ), ParallelChunkBatchSize() );
+        std::vector<BitBuffer> buffers;
+        buffers.reserve( size_t( batchSize ) );
+        for( integer i= 0; i < batchSize; ++i )
+            buffers.emplace_back( ChunkedArrayFormat::ChunkCapacity<TValue>( size_t(chunkLength) ) );
+
+        while( chunkNo < chunkEnd ) {
+            integer batch= (std::min)( integer( chunkEnd - chunkNo ), batchSize );
+            for( integer i= 0; i < batch; ++i )
+                if( !reader.LoadChunk( chunkNo + size_t(i), buffers[size_t(i)] ) )
+                    return false;
+            threadmodel::ParallelFor( pool, 0, batch, 1, [&]( integer begin, integer end ) {
+                for( integer i= begin; i < end; ++i )
+                    ChunkedArrayFormat::DecompressChunk( buffers[size_t(i)], directory.algorithms,
+                                                         dest + size_t(i) * size_t(chunkLength),
+                                                         directory.ChunkQty( chunkNo + size_t(i) ) );
+            } );
+            uint64_t done= (std::min)( qty, uint64_t(batch) * chunkLength );
+            dest   += size_t(done);
+            first  += done;
+            qty    -= done;
+            chunkNo+= size_t(batch);
+        }
+    }
+
+    // the rest
+    return reader.Read( first, size_t( qty ), dest );
+}
+
+#include "ALib.Lang.CIMethods.H"
+
+}}} // namespace [alib::bitbuffer::ac_v1]
@@ -0,0 +1,84 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of module \alib_bitbuffer of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib {  namespace bitbuffer { namespace ac_v1 {
+
+/// The minimum array length for which function \alib{bitbuffer::ac_v1;CompressParallel}
+/// calculates the sizes of the algorithms in parallel. Shorter arrays are estimated by the
+/// calling thread, because the costs of scheduling exceed the gain.
+inline constexpr size_t ParallelCompressionMinLength= size_t(1) << 16;
+
+/// Same as \alib{bitbuffer::ac_v1;ArrayCompressor::Estimate}, but calculates the sizes of the
+/// given algorithms in parallel, one algorithm per chunk of function
+/// \alib{threadmodel;ParallelFor}. The calling thread participates in the calculation.
+///
+/// Each algorithm performs an own pass over the data. Hence, the overall work done is higher
+/// than with the single pass of \b Estimate, while the wall-clock time is lower for large arrays
+/// and sufficient hardware threads.
+///
+/// @tparam TValue     The integral type of array data.
+/// @param  pool       The thread pool to use.
+/// @param  data       The array to calculate the compressed sizes for.
+/// @param  algorithms The algorithms to calculate the sizes for.
+/// @param  sizes      An array of length
+///                    \alib{bitbuffer::ac_v1;ArrayCompressor::NumberOfAlgorithms} that receives
+///                    the sizes.
+template<typename TValue>
+void EstimateParallel( ThreadPool&                         pool,
+                       ArrayCompressor::Array<TValue>&     data,
+                       ArrayCompressor::Algorithm          algorithms,
+                       size_t*                             sizes       ) {
+    // the minimum and maximum values are cached in the array and hence have to be calculated
+    // before the concurrent estimations read them.
+    data.calcMinMax();
+    threadmodel::ParallelFor( pool, 0, ArrayCompressor::NumberOfAlgorithms, 1,
+        [&]( integer begin, integer end ) {
+            for( integer algoNo= begin; algoNo < end; ++algoNo ) {
+                auto algo= ArrayCompressor::Algorithm( 1 << algoNo );
+                if( HasBits( algorithms, algo ) )
+                    ArrayCompressor::Estimate( data, algo, sizes );
+        }   } );
+}
+
+/// Same as \alib{bitbuffer::ac_v1;ArrayCompressor::Compress} with selection mode
+/// \alib{bitbuffer::ac_v1::ArrayCompressor;Selection::Estimation}, but with arrays of at least
+/// \alib{bitbuffer::ac_v1;ParallelCompressionMinLength} values, the sizes of the algorithms are
+/// calculated in parallel using \alib{bitbuffer::ac_v1;EstimateParallel}.
+/// The output is the same as produced by \b Compress.
+///
+/// @tparam TValue          The integral type of array data to compress.
+/// @param  pool            The thread pool to use.
+/// @param  bitWriter       A bit writer to compress the data to.
+/// @param  data            The array to compress.
+/// @param  algorithmsToTry The set of algorithms to choose from.
+///                         Defaults to \alib{bitbuffer::ac_v1;ArrayCompressor::Algorithm::ALL}.
+/// @param  statistics      An optional statistics record.
+/// @return A pair of value containing the resulting size in bits and the algorithm chosen.
+template<typename TValue>
+std::pair<size_t, ArrayCompressor::Algorithm>
+CompressParallel( ThreadPool&                      pool,
+                  BitWriter&                       bitWriter,
+                  ArrayCompressor::Array<TValue>&  data,
+                  ArrayCompressor::Algorithm       algorithmsToTry = ArrayCompressor::Algorithm::ALL,
+                  ArrayCompressor::Statistics*     statistics      = nullptr ) {
+    if(    data.length() < ParallelCompressionMinLength
+        || CountElements( algorithmsToTry ) < 2 )
+        return ArrayCompressor::Compress( bitWriter, data, algorithmsToTry, statistics,
+                                          ArrayCompressor::Selection::Estimation );
+
+    size_t sizes[ArrayCompressor::NumberOfAlgorithms];
+    Ticks tm;
+    EstimateParallel( pool, data, algorithmsToTry, sizes );
+    if( statistics ) {
+        statistics->estimationTime+= tm.Age();
+        statistics->ctdEstimations++;
+    }
+    return ArrayCompressor::CompressEstimated( bitWriter, data, algorithmsToTry, sizes,
+                                               statistics );
+}
+
+}}} // namespace [alib::bitbuffer::ac_v1]
@@ -47,9 +47,13 @@
 #include <iostream>
 #include <iomanip>
 
-#if (ALIB_SINGLE_THREADED && ALIB_EXT_LIB_THREADS_AVAILABLE)
+#if (ALIB_SINGLE_THREADED && ALIB_EXT_LIB_THREADS_AVAILABLE) || (ALIB_CAMP && !ALIB_SINGLE_THREADED)
 #  include <thread>
 #endif
+#if ALIB_CAMP
+#  include <algorithm>
+#  include <atomic>
+#endif
 
 //============================================== Module ============================================
 #if ALIB_C20_MODULES
@@ -613,6 +617,10 @@ enumrecords::bootstrap::Bootstrap<bitbuffer::ac_v1::ArrayCompressor::Algorithm>(
     { bitbuffer::ac_v1::ArrayCompressor::Algorithm::VerySparse  , A_CHAR("VerySparse"  ) , 1 },
     { bitbuffer::ac_v1::ArrayCompressor::Algorithm::Incremental , A_CHAR("Incremental" ) , 1 },
     { bitbuffer::ac_v1::ArrayCompressor::Algorithm::Huffman     , A_CHAR("Huffman"     ) , 1 },
+    { bitbuffer::ac_v1::ArrayCompressor::Algorithm::PFOR        , A_CHAR("PFOR"        ) , 1 },
+    { bitbuffer::ac_v1::ArrayCompressor::Algorithm::DeltaOfDelta, A_CHAR("DeltaOfDelta") , 1 },
+    { bitbuffer::ac_v1::ArrayCompressor::Algorithm::ZigZagDelta , A_CHAR("ZigZagDelta" ) , 1 },
+    { bitbuffer::ac_v1::ArrayCompressor::Algorithm::RLEBitPacked, A_CHAR("RLEBitPacked") , 1 },
 });
 #endif
 
@@ -677,7 +685,105 @@ void Shutdown()
 
 #if !DOXYGEN
 ListMA<camp::Camp*>   CAMPS(monomem::GLOBAL_ALLOCATOR);
+bool                          BOOTSTRAP_PARALLEL= false;
+std::vector<BootstrapTiming>  BOOTSTRAP_TIMINGS;
 #   include "ALib.Lang.CIFunctions.H"
+
+namespace {
+
+// Performs the given phase with the given camp and measures the time spent.
+BootstrapTiming bootstrapCamp( camp::Camp* camp, BootstrapPhases phase ) {
+    ALIB_ASSERT_ERROR( int(camp->GetBootstrapState()) == int(phase) - 1, "CAMPS",
+      "With this invocation of Bootstrap() a camp skips a bootstrap phase.\n"
+      "Resource category of the target camp: ", camp->ResourceCategory         )
+    camp->BootstrapSetPhase( phase );
+    Ticks start;
+    camp->Bootstrap();
+    return { camp, phase, start, start.Age() };
+}
+
+// Tests if camp 'camp' depends on camp 'other', which precedes it in list CAMPS.
+bool dependsOn( camp::Camp* camp, camp::Camp* other ) {
+    auto& deps= camp->GetDependencies();
+    return deps.empty() || std::find( deps.begin(), deps.end(), other ) != deps.end();
+}
+
+// Removes lazy camps from the given list of camps to finalize, unless a remaining camp depends
+// on them.
+void removeLazyCamps( std::vector<camp::Camp*>& camps ) {
+    std::vector<bool> needed( camps.size() );
+    for( size_t i= camps.size() ; i-- > 0 ; ) {
+        needed[i]= needed[i] || !camps[i]->IsLazy();
+        if( needed[i] )
+            for( size_t j= 0 ; j < i ; ++j )
+                if( dependsOn( camps[i], camps[j] ) )
+                    needed[j]= true;
+    }
+    size_t qty= 0;
+    for( size_t i= 0 ; i < camps.size() ; ++i )
+        if( needed[i] )
+            camps[qty++]= camps[i];
+    camps.resize( qty );
+}
+
+// Performs the given phase with the given camps, which are sorted in the order of list CAMPS.
+// With parallel bootstrapping, the camps are grouped by their depth in the dependency graph and
+// the camps of each group are bootstrapped concurrently.
+void bootstrapCamps( std::vector<camp::Camp*>& camps, BootstrapPhases phase ) {
+    #if !ALIB_SINGLE_THREADED
+    if(    BOOTSTRAP_PARALLEL
+        && camps.size() > 1
+        && ( phase == BootstrapPhases::PrepareConfig || phase == BootstrapPhases::Final ) ) {
+        // calculate the depth of each camp in the dependency graph
+        std::vector<int> depths( camps.size(), 0 );
+        int              maxDepth= 0;
+        for( size_t i= 0 ; i < camps.size() ; ++i ) {
+            for( size_t j= 0 ; j < i ; ++j )
+                if( dependsOn( camps[i], camps[j] ) )
+                    depths[i]= (std::max)( depths[i], depths[j] + 1 );
+            maxDepth= (std::max)( maxDepth, depths[i] );
+            #if ALIB_DEBUG
+            for( auto* dep : camps[i]->GetDependencies() )
+                ALIB_ASSERT_ERROR( std::find( camps.begin() + integer(i), camps.end(), dep )
+                                   == camps.end(), "CAMPS",
+                  "Camp \"{}\" depends on camp \"{}\", which is not bootstrapped before.",
+                  camps[i]->ResourceCategory, dep->ResourceCategory  )
+            #endif
+        }
+
+        // bootstrap the camps of each depth with a temporary set of threads
+        std::vector<BootstrapTiming> timings( camps.size() );
+        std::vector<size_t>          group;
+        for( int depth= 0 ; depth <= maxDepth ; ++depth ) {
+            group.clear();
+            for( size_t i= 0 ; i < camps.size() ; ++i )
+                if( depths[i] == depth )
+                    group.push_back( i );
+
+            std::atomic<size_t> next= 0;
+            auto work= [&] {
+                for( size_t n= next++ ; n < group.size() ; n= next++ )
+                    timings[group[n]]= bootstrapCamp( camps[group[n]], phase );
+            };
+            // (The number of threads is not limited to the number of hardware threads, because
+            // camps typically wait for I/O, e.g., when loading configuration files.)
+            std::vector<std::thread> threads;
+            for( size_t t= 1 ; t < group.size() ; ++t )
+                threads.emplace_back( work );
+            work();
+            for( auto& thread : threads )
+                thread.join();
+        }
+        BOOTSTRAP_TIMINGS.insert( BOOTSTRAP_TIMINGS.end(), timings.begin(), timings.end() );
+        return;
+    }
+    #endif
+
+    for( auto* camp : camps )
+        BOOTSTRAP_TIMINGS.push_back( bootstrapCamp( camp, phase ) );
+}
+
+} // anonymous namespace
 #endif
 
 void BootstrapAddDefaultCamps() {
@@ -755,11 +861,11 @@ DOX_MARKER([DOX_CRITICAL_SECTIONS_ADD_LOCK2])
                 resources::LocalResourcePool* lPool= dynamic_cast<resources::LocalResourcePool*>(spPool.Get());
 
                 // \releasetask{Update resource numbers numbers. Create resource reference dox for that}
+                // (Camp FILES provides its resources in a static table.)
                 integer                  expectedSize=   102     // [ALib]
                 IF_ALIB_ALOX(                          + 48   )
                 IF_ALIB_CLI            (               + 17   )
-                IF_ALIB_EXPRESSIONS    (               + 256  )
-                IF_ALIB_FILES          (               + 49    ) ;
+                IF_ALIB_EXPRESSIONS    (               + 256  ) ;
 
                 auto& hashMap= lPool->BootstrapGetInternalHashMap();
                 hashMap.BaseLoadFactor( 2.0 );
@@ -775,10 +881,9 @@ DOX_MARKER([DOX_CRITICAL_SECTIONS_ADD_LOCK2])
             for(auto campIt=  targetCampIt ; campIt != CAMPS.rend() ; ++campIt ) {
                 if ( skipOne ) { skipOne= false; continue; }
 
-                // if a different resources object is set, then use that one from now on
-                if(    (*campIt)->GetResourcePool() != nullptr
-                    && (*campIt)->GetResourcePool() != actPool  )
-                {
+                // if a resources object is set, then use that one from now on
+                // (Camps might have been added to list CAMPS after others were bootstrapped.)
+                if( (*campIt)->GetResourcePool() != nullptr ) {
                     actPool= (*campIt)->GetResourcePool();
                     continue;
                 }
@@ -808,8 +913,8 @@ DOX_MARKER([DOX_CRITICAL_SECTIONS_ADD_LOCK2])
             for(auto module=   targetCampIt ; module != CAMPS.rend() ; ++module ) {
                 if ( skipOne ) { skipOne= false; continue; }
 
-                // if a different config object is set, then use that one from now on
-                if( (*module)->GetConfig() != nullptr && (*module)->GetConfig() != *actConfig)
+                // if a config object is set, then use that one from now on
+                if( (*module)->GetConfig() != nullptr )
                     actConfig    = &(*module)->GetConfig();
                 else
                     (*module)->BootstrapSetConfig( *actConfig );
@@ -817,26 +922,25 @@ DOX_MARKER([DOX_CRITICAL_SECTIONS_ADD_LOCK2])
             } // resources distribution loop
         }
 
-        // initialize modules on this phase
+        // collect the camps to initialize on this phase
         ALIB_DBG( bool foundThisModuleInList = false; )
+        std::vector<camp::Camp*> camps;
         for ( auto* camp : CAMPS ) {
-            // bootstrap camp
-            if(int(camp->GetBootstrapState()) >= int(actualPhase ) )
-                 continue;
-
-            //std::cout << "Camp::Bootstrap  '" << module->ResourceCategory << "', phase: " << int(actualPhase) << std::endl;
-
-            ALIB_ASSERT_ERROR( int(camp->GetBootstrapState()) == phaseIntegral - 1,
-              "With this invocation of Bootstrap() a camp skips a bootstrap phase.\n"
-              "Resource category of the target camp: ", camp->ResourceCategory         )
-            camp->BootstrapSetPhase(actualPhase);
-            camp->Bootstrap();
+            if( int(camp->GetBootstrapState()) < int(actualPhase ) )
+                camps.push_back( camp );
 
             // stop if this is us
             if (camp == targetCamp ) {
-                ALIB_DBG( foundThisModuleInList = true );
+                ALIB_DBG( foundThisModuleInList = !camps.empty() && camps.back() == camp );
                 break;
         }   }
+
+        // lazy camps are finalized with their first use
+        if( actualPhase == BootstrapPhases::Final )
+            removeLazyCamps( camps );
+
+        bootstrapCamps( camps, actualPhase );
+
         ALIB_ASSERT_ERROR( foundThisModuleInList, "CAMPS",
           "The target camp of function Bootstrap is not included in list alib::CAMPS "
           "or was already bootstrapped for this phase!\n"
@@ -851,6 +955,25 @@ DOX_MARKER([DOX_CRITICAL_SECTIONS_ADD_LOCK2])
         #endif
 }   }
 
+void BootstrapOnDemand( camp::Camp& camp ) {
+    ALIB_LOCK_RECURSIVE_WITH(monomem::GLOBAL_ALLOCATOR_LOCK)
+    if( camp.GetBootstrapState() != BootstrapPhases::PrepareConfig )
+        return;
+    ALIB_ASSERT_ERROR( camp.IsLazy(), "CAMPS",
+      "BootstrapOnDemand() invoked with camp \"{}\", which is neither lazy nor bootstrapped "
+      "to phase PrepareConfig.", camp.ResourceCategory )
+
+    // bootstrap lazy dependencies first
+    for( auto* other : CAMPS ) {
+        if( other == &camp )
+            break;
+        if( other->IsLazy() && dependsOn( &camp, other ) )
+            BootstrapOnDemand( *other );
+    }
+
+    BOOTSTRAP_TIMINGS.push_back( bootstrapCamp( &camp, BootstrapPhases::Final ) );
+}
+
 void Shutdown( ShutdownPhases targetPhase, camp::Camp*    targetCamp ) {
     #if ALIB_DEBUG_CRITICAL_SECTIONS && ALIB_MONOMEM
         monomem::GLOBAL_ALLOCATOR.DbgCriticalSectionsPH.Get()->DCSLock= nullptr;
@@ -884,8 +1007,12 @@ void Shutdown( ShutdownPhases targetPhase, camp::Camp*    targetCamp ) {
 
         // shutdown in reverse order
         for(auto campIt= CAMPS.rbegin() ; campIt != CAMPS.rend() ; ++campIt ) {
+            // lazy camps that were never used are shut down without being finalized
+            ALIB_DBG( bool unusedLazy=    ( *campIt )->IsLazy()
+                                       && ( *campIt )->GetBootstrapState() == BootstrapPhases::PrepareConfig; )
             ALIB_ASSERT_ERROR(    int(( *campIt )->GetBootstrapState()) < 0
-                               || int(( *campIt )->GetBootstrapState()) == int(BootstrapPhases::Final),
+                               || int(( *campIt )->GetBootstrapState()) == int(BootstrapPhases::Final)
+                               || unusedLazy,
                 "CAMPS", "Trying to terminate a not (fully) initialized module. "
                          "Module Name (resource category): ", targetCamp->ResourceCategory )
 
@@ -894,6 +1021,7 @@ void Shutdown( ShutdownPhases targetPhase, camp::Camp*    targetCamp ) {
                 //std::cout << "Camp::Shutdown '" << (*campIt)->ResourceCategory << "', phase: " << int(actualPhase) << std::endl;
 
                 ALIB_ASSERT_ERROR(    ( int(( *campIt )->GetBootstrapState()) == 3  &&  phaseIntegral == 1 )
+                                   || ( unusedLazy                                &&  phaseIntegral == 1 )
                                    || ( int(( *campIt )->GetBootstrapState()) == -1 &&  phaseIntegral == 2 ),
                   "CAMPS", "With this invocation of Bootstrap(), a camp skips a bootstrap phase \n"
                            "Resource category of the target camp: ", ( *campIt )->ResourceCategory )
@@ -946,6 +1074,10 @@ void Shutdown( ShutdownPhases targetPhase, camp::Camp*    targetCamp ) {
 
         CAMPS.Reset();
         NonCampModulesInitialized= false;
+
+        // a subsequent bootstrap lists its timings anew
+        BOOTSTRAP_TIMINGS.clear();
+        BOOTSTRAP_TIMINGS.shrink_to_fit();
 }   }
 
 #endif // ALIB_CAMP
@@ -58,32 +58,33 @@ extern  bool dbgLongDoubleTrueLengthTest();
 
 #if !DOXYGEN
 
-namespace {
-integer flattenCount(const Box* boxArray, integer length) {
+namespace detail {
+
+integer FlattenCount(const Box* boxArray, integer length) {
     integer ctdFlattened= 0;
     for( integer i= 0; i < length ; ++i ) {
         const Box& box= boxArray[i];
 
         if( box.IsType<boxing::TBoxes<lang::HeapAllocator>*>() ) {
             const auto* boxes= box.Unbox<boxing::TBoxes<lang::HeapAllocator>*>();
-            ctdFlattened+= flattenCount( boxes->data(), integer(boxes->size()) );
+            ctdFlattened+= FlattenCount( boxes->data(), integer(boxes->size()) );
             continue;
         }
     #if ALIB_MONOMEM
         if( box.IsType<boxing::TBoxes<MonoAllocator>*>() ) {
             const auto* boxes= box.Unbox<boxing::TBoxes<MonoAllocator>*>();
-            ctdFlattened+= flattenCount( boxes->data(), integer(boxes->size()) );
+            ctdFlattened+= FlattenCount( boxes->data(), integer(boxes->size()) );
             continue;
         }
         if( box.IsType<boxing::TBoxes<PoolAllocator>*>() ) {
             const auto* boxes= box.Unbox<boxing::TBoxes<PoolAllocator>*>();
-            ctdFlattened+= flattenCount( boxes->data(), integer(boxes->size()) );
+            ctdFlattened+= FlattenCount( boxes->data(), integer(boxes->size()) );
             continue;
         }
     #endif
 
         if( box.IsArrayOf<Box>() ) {
-            ctdFlattened+= flattenCount( box.UnboxArray<Box>(), box.UnboxLength() );
+            ctdFlattened+= FlattenCount( box.UnboxArray<Box>(), box.UnboxLength() );
             continue;
         }
 
@@ -93,58 +94,60 @@ integer flattenCount(const Box* boxArray, integer length) {
     return ctdFlattened;
 }
 
-template<typename TAllocator>
-void flattenInsert(typename TBoxes<TAllocator>::iterator& it, const Box* boxArray, integer length) {
+void FlattenCopy(Box*& dest, const Box* boxArray, integer length) {
     for( integer i= 0; i < length ; ++i ) {
         const Box& box= boxArray[i];
 
         if( box.IsType<boxing::TBoxes<lang::HeapAllocator>*>() ) {
             const auto* boxes= box.Unbox<boxing::TBoxes<lang::HeapAllocator>*>();
-            flattenInsert<TAllocator>( it, boxes->data(), integer(boxes->size()) );
+            FlattenCopy( dest, boxes->data(), integer(boxes->size()) );
             continue;
         }
     #if ALIB_MONOMEM
         if( box.IsType<boxing::TBoxes<MonoAllocator>*>() ) {
             const auto* boxes= box.Unbox<boxing::TBoxes<MonoAllocator>*>();
-            flattenInsert<TAllocator>( it, boxes->data(), integer(boxes->size()) );
+            FlattenCopy( dest, boxes->data(), integer(boxes->size()) );
             continue;
         }
         if( box.IsType<boxing::TBoxes<PoolAllocator>*>() ) {
             const auto* boxes= box.Unbox<boxing::TBoxes<PoolAllocator>*>();
-            flattenInsert<TAllocator>( it, boxes->data(), integer(boxes->size()) );
+            FlattenCopy( dest, boxes->data(), integer(boxes->size()) );
             continue;
         }
     #endif
 
         if( box.IsArrayOf<Box>() ) {
-            flattenInsert<TAllocator>( it, box.UnboxArray<Box>(), box.UnboxLength() );
+            FlattenCopy( dest, box.UnboxArray<Box>(), box.UnboxLength() );
             continue;
         }
 
-        new( &*it ) Box( box );
-        ++it;
+        new( dest ) Box( box );
+        ++dest;
 }   }
 
-} // anonymous namespace
+} // namespace [alib::boxing::detail]
 
 
 template<typename TAllocator>
 void  TBoxes<TAllocator>::AddArray( const Box* boxArray, integer length ) {
     // 1. Count the number of boxes if "recursively flattened"
-    integer ctdFlattened= flattenCount( boxArray, length );
+    integer ctdFlattened= detail::FlattenCount( boxArray, length );
 
     // 2. create space in vector
-    auto it= vectorBase::insert(vectorBase::end(), size_t(ctdFlattened), Box() );
+    size_t oldSize= vectorBase::size();
+    vectorBase::insert(vectorBase::end(), size_t(ctdFlattened), Box() );
 
     // 3. insert recursively all boxes found (flatten)
-    flattenInsert<TAllocator>( it, boxArray, length);
+    Box* dest= vectorBase::data() + oldSize;
+    detail::FlattenCopy( dest, boxArray, length);
 
-    ALIB_ASSERT( it == vectorBase::end(), "BOXING" )
+    ALIB_ASSERT( dest == vectorBase::data() + vectorBase::size(), "BOXING" )
 }
 
 template ALIB_DLL  void TBoxes<   lang::HeapAllocator>::AddArray( const Box* boxArray, integer length );
 #if ALIB_MONOMEM
 template ALIB_DLL  void TBoxes<MonoAllocator>::AddArray( const Box* boxArray, integer length );
+template ALIB_DLL  void TBoxes<PoolAllocator>::AddArray( const Box* boxArray, integer length );
 #endif
 
 
@@ -7,6 +7,91 @@
 //==================================================================================================
 ALIB_EXPORT namespace alib { namespace boxing {
 
+namespace detail {
+/// Counts the boxes found in the given array, with elements of types \alib{boxing;TBoxes}
+/// and boxed arrays of class \b %Box being "flattened" recursively.
+/// @param boxArray Pointer to the start of the array of boxes.
+/// @param length   The number of boxes contained in \p{boxArray}.
+/// @return The number of boxes after flattening.
+ALIB_DLL integer FlattenCount( const Box* boxArray, integer length );
+
+/// Copy-constructs the boxes found in the given array to \p{dest}, with elements of types
+/// \alib{boxing;TBoxes} and boxed arrays of class \b %Box being "flattened" recursively.
+/// @param[in,out] dest The destination, which is increased by the number of boxes written.
+///                     Needs to provide space for the number of boxes returned by
+///                     #FlattenCount.
+/// @param boxArray     Pointer to the start of the array of boxes.
+/// @param length       The number of boxes contained in \p{boxArray}.
+ALIB_DLL void    FlattenCopy( Box*& dest, const Box* boxArray, integer length );
+} // namespace alib::boxing[::detail]
+
+//==================================================================================================
+/// A non-owning view on a contiguous sequence of boxes.
+/// Objects of this type are implicitly constructible from any container that provides methods
+/// \c data() and \c size(), namely \alib{boxing;TBoxes}, \alib{boxing;TLocalBoxes},
+/// <c>std::vector<Box></c> and <c>std::array<Box, N></c>.
+///
+/// This type is accepted by interface methods that process a list of boxes, independent of the
+/// container type and allocator that the boxes are collected in, for example,
+/// \alib{format;Formatter::FormatArgs}, \alib{format;Paragraphs::Add} or
+/// \alib{lox;Lox::Entry}.
+///
+/// If boxed, objects of this type are boxed as arrays of boxes. Hence, when added to a
+/// \alib{boxing;TBoxes} container, the boxes viewed are inserted ("flattened").
+//==================================================================================================
+class BoxesSpan
+{
+  protected:
+    const Box*  buffer;   ///< The first box.
+    integer     length;   ///< The number of boxes.
+
+  public:
+    /// Constructor.
+    /// @param pBuffer The first box.
+    /// @param pLength The number of boxes.
+    constexpr BoxesSpan( const Box* pBuffer, integer pLength )   noexcept
+    : buffer(pBuffer)
+    , length(pLength)                                                                             {}
+
+    /// Implicit constructor from containers of boxes.
+    /// @tparam TContainer The container type. Deduced by the compiler.
+    /// @param  container  The container whose boxes are viewed.
+    template<typename TContainer>
+    requires requires( const TContainer& c ) {
+        { c.data() } -> std::convertible_to<const Box*>;
+        { c.size() } -> std::convertible_to<size_t>;
+    }
+    constexpr BoxesSpan( const TContainer& container )                                     noexcept
+    : buffer( container.data() )
+    , length( integer( container.size() ) )                                                      {}
+
+    /// @return The number of boxes.
+    constexpr integer     Size()                                    const noexcept { return length; }
+
+    /// @return The number of boxes.
+    constexpr size_t      size()                            const noexcept { return size_t(length); }
+
+    /// @return \c true if this span is empty.
+    constexpr bool        IsEmpty()                            const noexcept { return length == 0; }
+
+    /// @return A pointer to the first box.
+    constexpr const Box*  data()                                    const noexcept { return buffer; }
+
+    /// @return A pointer to the first box.
+    constexpr const Box*  begin()                                   const noexcept { return buffer; }
+
+    /// @return A pointer behind the last box.
+    constexpr const Box*  end()                            const noexcept { return buffer + length; }
+
+    /// @return The last box. Must not be called on empty spans.
+    constexpr const Box&  back()                        const noexcept { return buffer[length - 1]; }
+
+    /// Returns the box at the given position.
+    /// @param idx The index of the box.
+    /// @return The box at \p{idx}.
+    constexpr const Box&  operator[]( size_t idx )            const noexcept { return buffer[idx]; }
+};
+
 //==================================================================================================
 /// A vector of objects of type \alib{boxing;Box}.
 /// Specializes class \c std::vector<Box> (publicly) with a constructor and methods to add a
@@ -181,13 +266,216 @@ class TBoxes : public    std::vector<Box, lang::StdAllocator<Box, TAllocator>>
 extern template ALIB_DLL  void TBoxes<lang::HeapAllocator>::AddArray( const Box* boxArray, integer length );
 #if ALIB_MONOMEM
 extern template ALIB_DLL  void TBoxes<MonoAllocator      >::AddArray( const Box* boxArray, integer length );
+extern template ALIB_DLL  void TBoxes<PoolAllocator      >::AddArray( const Box* boxArray, integer length );
 #endif
 
+//==================================================================================================
+/// A container of boxes with the same interface for adding boxes as class
+/// \alib{boxing;TBoxes}, which stores up to \p{TCapacity} boxes in an internal buffer.
+/// Only if more boxes are added, the boxes are moved to a <c>std::vector</c> which uses
+/// allocator \p{TAllocator}. Objects of this type are intended to be created as local variables
+/// to collect arguments, for example, of formatting or logging calls, without allocating memory.
+///
+/// The boxes are passed to interface methods which accept a \alib{boxing;BoxesSpan}.
+/// Similar to class \b %TBoxes, objects of this type are flattened when added to a
+/// \b %TBoxes container, because they are boxed as arrays of boxes.
+///
+/// This type is to class \b %TBoxes what \alib{strings;TLocalString;LocalString} is to
+/// class \alib{strings;TAString;AString}.
+///
+/// @tparam TCapacity  The number of boxes stored without allocating memory.
+/// @tparam TAllocator The allocator used once \p{TCapacity} is exceeded.
+///                    Defaults to \alib{lang;HeapAllocator}.
+//==================================================================================================
+template<integer TCapacity, typename TAllocator= lang::HeapAllocator>
+class TLocalBoxes
+{
+    static_assert( std::is_trivially_destructible_v<Box>,
+                   "TLocalBoxes relies on trivially destructible boxes." );
+
+  protected:
+    /// The vector that receives the boxes once \p{TCapacity} is exceeded.
+    std::vector<Box, lang::StdAllocator<Box, TAllocator>>   spill;
+
+    /// The number of boxes in #localBuffer. Unused, if #spilled is \c true.
+    integer                                             length                                 = 0;
+
+    /// Denotes whether the boxes are stored in #spill.
+    bool                                                spilled                            = false;
+
+    /// The internal buffer.
+    alignas(Box) unsigned char                          localBuffer[TCapacity * sizeof(Box)];
+
+    /// @return The internal buffer.
+    Box*        localBoxes()      noexcept { return std::launder( reinterpret_cast<Box*>(localBuffer) ); }
+
+    /// @return The internal buffer.
+    const Box*  localBoxes()                                                           const noexcept
+    { return std::launder( reinterpret_cast<const Box*>(localBuffer) ); }
+
+  public:
+    /// The allocator type that \p{TAllocator} specifies.
+    using AllocatorType=        TAllocator;
+
+    /// Defaulted default constructor, usable only with heap allocation.
+    TLocalBoxes()                                                                                 {}
+
+    /// Constructor.
+    /// @param pAllocator The allocator to use once \p{TCapacity} is exceeded.
+    TLocalBoxes( TAllocator& pAllocator )
+    : spill( pAllocator )                                                                         {}
+
+    /// Deleted copy constructor.
+    TLocalBoxes( const TLocalBoxes& )                                                       =delete;
+
+    /// Deleted copy assignment operator.
+    /// @return Nothing (deleted).
+    TLocalBoxes& operator=( const TLocalBoxes& )                                            =delete;
+
+    /// Empty method. Needed to allow adding empty variadic template parameter packs.
+    /// @return A reference to this object.
+    TLocalBoxes& Add()                                                             { return *this; }
+
+    /// Adds one box for each given variadic argument.
+    ///
+    /// @tparam TBoxables The types of the variadic arguments.
+    /// @param  args      The variadic arguments. Each argument is converted into one box to be
+    ///                   appended.
+    /// @return A reference to this object.
+    template <typename... TBoxables>
+    TLocalBoxes& Add( TBoxables&&... args ) {
+        Box boxes[sizeof...(args)]= { std::forward<TBoxables>( args )... };
+        AddArray( boxes, sizeof...(args) );
+        return *this;
+    }
+
+    /// Adds one box.
+    /// @param  box The box to append.
+    /// @return A reference to this object.
+    TLocalBoxes& Add( const Box& box )                       { AddArray( &box, 1 ); return *this; }
+
+    /// Adds an array of boxes. Array elements of types \b %TBoxes and boxed arrays of
+    /// class \b %Box are recursively "flattened".
+    ///
+    /// @param boxArray Pointer to the start of the array of boxes.
+    /// @param qty      The number of boxes contained in \p{boxArray}.
+    void AddArray( const Box* boxArray, integer qty ) {
+        integer ctdFlattened= detail::FlattenCount( boxArray, qty );
+        if( !spilled && length + ctdFlattened <= TCapacity ) {
+            Box* dest= localBoxes() + length;
+            detail::FlattenCopy( dest, boxArray, qty );
+            length+= ctdFlattened;
+            return;
+        }
+
+        if( !spilled ) {
+            spill.reserve( size_t( 2 * ( length + ctdFlattened ) ) );
+            spill.insert( spill.end(), localBoxes(), localBoxes() + length );
+            spilled= true;
+        }
+        size_t oldSize= spill.size();
+        spill.insert( spill.end(), size_t(ctdFlattened), Box() );
+        Box* dest= spill.data() + oldSize;
+        detail::FlattenCopy( dest, boxArray, qty );
+    }
+
+    /// Inline operator that simply aliases method #Add.
+    ///
+    /// @param src The value to be boxed and added.
+    /// @return Returns a mutable reference to \c this.
+    template <typename TBoxable>
+    TLocalBoxes& operator+=( TBoxable&& src )                                 { return Add( src ); }
+
+    /// Inline operator that simply aliases method #Add.
+    ///
+    /// @param src The value to be boxed and added.
+    /// @return Returns a mutable reference to \c this.
+    template <typename TBoxable>
+    TLocalBoxes& operator<<( TBoxable&& src )                                 { return Add( src ); }
+
+    /// Removes all boxes. If the boxes had been moved to the vector, subsequent boxes are
+    /// again stored in the internal buffer.
+    void        clear()                         noexcept { spill.clear(); length= 0; spilled= false; }
+
+    /// Returns \c true if the boxes are stored in the internal buffer, \c false if they have been
+    /// moved to the allocated vector because \p{TCapacity} was exceeded.
+    /// @return \c true if no memory was allocated.
+    bool        IsLocal()                                        const noexcept { return !spilled; }
+
+    /// Returns the quantity of elements stored in ths container.
+    /// @return The element count.
+    integer     Size()               const noexcept { return spilled ? integer(spill.size()) : length; }
+
+    /// Returns the quantity of elements stored in ths container.
+    /// @return The element count.
+    size_t      size()                                   const noexcept { return size_t( Size() ); }
+
+    /// @return A pointer to the first box.
+    Box*        data()                noexcept { return spilled ? spill.data() : localBoxes(); }
+
+    /// @return A pointer to the first box.
+    const Box*  data()          const noexcept { return spilled ? spill.data() : localBoxes(); }
+
+    /// @return A pointer to the first box.
+    Box*        begin()                                             noexcept { return data(); }
+
+    /// @return A pointer behind the last box.
+    Box*        end()                                      noexcept { return data() + Size(); }
+
+    /// @return A pointer to the first box.
+    const Box*  begin()                                       const noexcept { return data(); }
+
+    /// @return A pointer behind the last box.
+    const Box*  end()                                const noexcept { return data() + Size(); }
+
+    /// Returns the box at the given position.
+    /// @param idx The index of the box.
+    /// @return The box at \p{idx}.
+    Box&        operator[]( size_t idx )                              noexcept { return data()[idx]; }
+
+    /// Returns the box at the given position.
+    /// @param idx The index of the box.
+    /// @return The box at \p{idx}.
+    const Box&  operator[]( size_t idx )                  const noexcept { return data()[idx]; }
+
+    /// @return A non-owning view on the boxes.
+    BoxesSpan   Span()                            const noexcept { return BoxesSpan( *this ); }
+}; // class TLocalBoxes
+
+#if !DOXYGEN
+template<>
+struct BoxTraits<BoxesSpan>
+{
+    using                   Mapping=  Box;
+    static constexpr bool   IsArray=  true;
+    static void Write( Placeholder& box, const BoxesSpan& value )
+    { box.Write( value.data(), value.Size() ); }
+    static void Read( const Placeholder& box);
+};
+
+template<integer TCapacity, typename TAllocator>
+struct BoxTraits<TLocalBoxes<TCapacity, TAllocator>>
+{
+    using                   Mapping=  Box;
+    static constexpr bool   IsArray=  true;
+    static void Write( Placeholder& box, const TLocalBoxes<TCapacity, TAllocator>& value )
+    { box.Write( value.data(), value.Size() ); }
+    static void Read( const Placeholder& box);
+};
+#endif // !DOXYGEN
+
 } // namespace alib[::boxing]
 
 /// Type alias in namespace \b alib.
 using     Boxes= boxing::TBoxes<lang::HeapAllocator>;
 
+/// Type alias in namespace \b alib.
+using     BoxesSpan= boxing::BoxesSpan;
+
+/// Type alias in namespace \b alib.
+template<integer TCapacity>
+using     LocalBoxes= boxing::TLocalBoxes<TCapacity, lang::HeapAllocator>;
+
 #if ALIB_MONOMEM
 /// Type alias in namespace \b alib.
 using     BoxesMA= boxing::TBoxes<MonoAllocator>;
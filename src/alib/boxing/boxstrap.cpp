@@ -16,7 +16,6 @@
 #include <functional>
 #include <cstring>
 #include <typeindex>
-#include <span>
 
 #   include "ALib.Lang.H"
 #   include "ALib.Characters.Functions.H"
@@ -91,48 +90,12 @@ std::size_t FHashcode_Default( const Box& self ) {
     }
 
     if( self.IsArray() ) {
-        std::size_t result=    0xa925eb91L
-                             + std::size_t( self.ElementTypeID().hash_code() );
-
-        // do different loops depending on array element size
-        auto size  = self.ArrayElementSize();
-        auto length= self.UnboxLength();
-        if( size == 2 || size == 6 ) {
-            if (size == 6)
-                length*= 3;
-
-            std::span<uint16_t> array= {self.Data().GetPointer<uint16_t>(), size_t(length) };
-            for( uint16_t v : array )
-                result = 67 * result + v;
-
-            return size_t( result );
-        }
-
-        if( size == 4 ) {
-            std::span<uint32_t> array= {self.Data().GetPointer<uint32_t>(), size_t(length) };
-            for( uint32_t v : array )
-                result = 67*result + v;
-
-            return size_t( result );
-        }
-
-        if( size == 8 ) {
-            std::span<uint64_t> array= {self.Data().GetPointer<uint64_t>(), size_t(length) };
-            for( uint64_t v : array )
-                result = std::size_t( 67 * result + v );
-
-            return std::size_t( result );
-        }
-
-        // any other size
-        {
-            length*= size;
-            std::span<unsigned char> array= {self.Data().GetPointer<unsigned char>(), size_t(length) };
-            for( unsigned char v : array )
-                result = 67 * result + v;
-
-            return size_t( result );
-    }   }
+        // the array data is hashed as a whole, seeded with the element type
+        return size_t( characters::HashBytes(
+                         self.Data().GetPointer<unsigned char>(),
+                         size_t( self.UnboxLength() ) * self.ArrayElementSize(),
+                         uint64_t( 0xa925eb91UL + self.ElementTypeID().hash_code() ) ) );
+    }
 
     //--- default (value types) ---
     size_t result=  size_t(0xcf670957UL)
@@ -275,13 +275,17 @@ DOX_MARKER([DOX_VARIABLES_DECLARATION6])
 
     #if ALIB_BITBUFFER && ALIB_ENUMRECORDS
        "ACAlgos"     , A_CHAR(  "0"    ",NONE"                 ","   "1"      ","
-                               "31"    ",ALL"                  ","   "1"      ","
+                             "1023"    ",ALL"                  ","   "1"      ","
                                 "1"    ",Uncompressed"         ","   "1"      ","
                                 "2"    ",MinMax"               ","   "1"      ","
                                 "4"    ",Sparse"               ","   "1"      ","
                                 "8"    ",VerySparse"           ","   "1"      ","
                                "16"    ",Incremental"          ","   "1"      ","
-                               "32"    ",Huffman"              ","   "1"            ),
+                               "32"    ",Huffman"              ","   "1"      ","
+                               "64"    ",PFOR"                 ","   "1"      ","
+                              "128"    ",DeltaOfDelta"         ","   "1"      ","
+                              "256"    ",ZigZagDelta"          ","   "1"      ","
+                              "512"    ",RLEBitPacked"         ","   "1"            ),
     #endif
 
         // Calendar
@@ -726,33 +730,34 @@ DOX_MARKER([DOX_VARIABLES_DECLARATION6])
 #endif // !ALIB_CAMP_OMIT_DEFAULT_RESOURCES
 
         // CodeMarker_CommonEnums
-        enbs::Bootstrap<alib::lang::Alignment        >( *this, "Alignment"      );
-        enbs::Bootstrap<alib::lang::Bool             >( *this, "Bool"           );
-        enbs::Bootstrap<alib::lang::Caching          >( *this, "Caching"        );
+        // (The records of these types are loaded with their first use.)
+        enbs::BootstrapLazy<alib::lang::Alignment        >( *this, "Alignment"      );
+        enbs::BootstrapLazy<alib::lang::Bool             >( *this, "Bool"           );
+        enbs::BootstrapLazy<alib::lang::Caching          >( *this, "Caching"        );
 DOX_MARKER( [DOX_ENUMS_MAKE_PARSABLE_22] )
         enbs::Bootstrap<alib::lang::Case>( *this, "Case"  );
 DOX_MARKER( [DOX_ENUMS_MAKE_PARSABLE_22] )
-        enbs::Bootstrap<alib::lang::ContainerOp      >( *this, "ContainerOp"    );
-        enbs::Bootstrap<alib::lang::CreateDefaults   >( *this, "Bool"           );
-        enbs::Bootstrap<alib::lang::CreateIfNotExists>( *this, "Bool"           );
-        enbs::Bootstrap<alib::lang::CurrentData      >( *this, "CurrentData"    );
-        enbs::Bootstrap<alib::lang::Inclusion        >( *this, "Inclusion"      );
-        enbs::Bootstrap<alib::lang::Initialization   >( *this, "Initialization" );
-        enbs::Bootstrap<alib::lang::LineFeeds        >( *this, "LineFeeds"      );
-        enbs::Bootstrap<alib::lang::Phase            >( *this, "Phase"          );
-        enbs::Bootstrap<alib::lang::Propagation      >( *this, "Propagation"    );
-        enbs::Bootstrap<alib::lang::Reach            >( *this, "Reach"          );
-        enbs::Bootstrap<alib::lang::Recursive        >( *this, "Bool"           );
-        enbs::Bootstrap<alib::lang::Responsibility   >( *this, "Responsibility" );
-        enbs::Bootstrap<alib::lang::Safeness         >( *this, "Safeness"       );
-        enbs::Bootstrap<alib::lang::Side             >( *this, "Side"           );
-        enbs::Bootstrap<alib::lang::SortOrder        >( *this, "SortOrder"      );
-        enbs::Bootstrap<alib::lang::SourceData       >( *this, "SourceData"     );
-        enbs::Bootstrap<alib::lang::Switch           >( *this, "Switch"         );
-        enbs::Bootstrap<alib::lang::Timezone         >( *this, "Timezone"       );
-        enbs::Bootstrap<alib::lang::Timing           >( *this, "Timing"         );
-        enbs::Bootstrap<alib::lang::ValueReference   >( *this, "ValueReference" );
-        enbs::Bootstrap<alib::lang::Whitespaces      >( *this, "Whitespaces"    );
+        enbs::BootstrapLazy<alib::lang::ContainerOp      >( *this, "ContainerOp"    );
+        enbs::BootstrapLazy<alib::lang::CreateDefaults   >( *this, "Bool"           );
+        enbs::BootstrapLazy<alib::lang::CreateIfNotExists>( *this, "Bool"           );
+        enbs::BootstrapLazy<alib::lang::CurrentData      >( *this, "CurrentData"    );
+        enbs::BootstrapLazy<alib::lang::Inclusion        >( *this, "Inclusion"      );
+        enbs::BootstrapLazy<alib::lang::Initialization   >( *this, "Initialization" );
+        enbs::BootstrapLazy<alib::lang::LineFeeds        >( *this, "LineFeeds"      );
+        enbs::BootstrapLazy<alib::lang::Phase            >( *this, "Phase"          );
+        enbs::BootstrapLazy<alib::lang::Propagation      >( *this, "Propagation"    );
+        enbs::BootstrapLazy<alib::lang::Reach            >( *this, "Reach"          );
+        enbs::BootstrapLazy<alib::lang::Recursive        >( *this, "Bool"           );
+        enbs::BootstrapLazy<alib::lang::Responsibility   >( *this, "Responsibility" );
+        enbs::BootstrapLazy<alib::lang::Safeness         >( *this, "Safeness"       );
+        enbs::BootstrapLazy<alib::lang::Side             >( *this, "Side"           );
+        enbs::BootstrapLazy<alib::lang::SortOrder        >( *this, "SortOrder"      );
+        enbs::BootstrapLazy<alib::lang::SourceData       >( *this, "SourceData"     );
+        enbs::BootstrapLazy<alib::lang::Switch           >( *this, "Switch"         );
+        enbs::BootstrapLazy<alib::lang::Timezone         >( *this, "Timezone"       );
+        enbs::BootstrapLazy<alib::lang::Timing           >( *this, "Timing"         );
+        enbs::BootstrapLazy<alib::lang::ValueReference   >( *this, "ValueReference" );
+        enbs::BootstrapLazy<alib::lang::Whitespaces      >( *this, "Whitespaces"    );
 
 IF_ALIB_BITBUFFER(  enbs::Bootstrap<alib::bitbuffer::ac_v1::ArrayCompressor::Algorithm>( *this, "ACAlgos"  ); )
 IF_ALIB_THREADS(    enbs::Bootstrap<alib::threads::Thread::State>( *this, "TSts"     ); )
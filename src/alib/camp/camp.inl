@@ -103,6 +103,15 @@ class Camp
     /// Access to the field is provided with method #GetConfig.
     SharedConfiguration config;
 
+    /// The camps that this camp depends on.
+    /// @see Method #BootstrapAddDependency.
+    std::vector<Camp*>  dependencies;
+
+    /// Flag denoting whether phase \alib{BootstrapPhases;Final} of this camp is deferred until
+    /// the camp is first used.
+    /// @see Method #BootstrapSetLazy.
+    bool                lazy                                                                = false;
+
    //###############################################################################################
    // Public fields
    //###############################################################################################
@@ -186,6 +195,39 @@ class Camp
                 || bootstrapState == -int(ShutdownPhases::Announce);
     }
 
+    /// Declares that this camp depends on the given \p{camp}, which consequently has to appear
+    /// in list \alib{CAMPS} before this camp.
+    ///
+    /// The dependencies are evaluated only if global flag \alib{BOOTSTRAP_PARALLEL} is set:
+    /// Phases \alib{BootstrapPhases;PrepareConfig} and \alib{BootstrapPhases;Final} of camps
+    /// that do not depend on each other are then performed concurrently.
+    /// A camp that does not declare any dependency is assumed to depend on all camps that
+    /// precede it in list \alib{CAMPS}.
+    ///
+    /// This method is to be invoked in the constructor of a derived camp type.
+    /// @param camp The camp that this camp depends on.
+    void            BootstrapAddDependency( Camp& camp )     { dependencies.push_back( &camp ); }
+
+    /// Returns the camps that this camp declared to depend on.
+    /// @see Method #BootstrapAddDependency.
+    /// @return The list of dependencies.
+    const std::vector<Camp*>&  GetDependencies()                    const { return dependencies; }
+
+    /// Declares this camp to be bootstrapped lazily. Phase \alib{BootstrapPhases;Final} of lazy
+    /// camps is skipped by function \alib{Bootstrap}, unless a camp that is not lazy depends on
+    /// it. Instead, the phase is performed with the first invocation of function
+    /// \alib{BootstrapOnDemand}, which a lazy camp has to call before its functionality is used.
+    ///
+    /// This method is to be invoked in the constructor of a derived camp type or before
+    /// bootstrapping.
+    /// @param isLazy Denotes whether this camp is bootstrapped lazily. Defaults to \c true.
+    void            BootstrapSetLazy( bool isLazy= true )                      { lazy= isLazy; }
+
+    /// Returns whether this camp was declared to be bootstrapped lazily.
+    /// @see Method #BootstrapSetLazy.
+    /// @return \c true if phase \alib{BootstrapPhases;Final} of this camp is deferred.
+    bool            IsLazy()                                                  const { return lazy; }
+
   //################################################################################################
   // Other public interface methods
   //################################################################################################
@@ -327,6 +369,29 @@ void Bootstrap( camp::Camp&        camp,
                 character          outerDelim= ','    )
 { Bootstrap<TEnum>(*camp.GetResourcePool(), camp.ResourceCategory, name, innerDelim, outerDelim); }
 
+/// Invokes #BootstrapLazy(ResourcePool&, const NString&, const NString&, character, character)
+/// accepting a \alib{camp;Camp} and using its \alib{resources;ResourcePool} and
+/// field \alib{camp;Camp::ResourceCategory}.
+///
+/// \par Availability
+///   This namespace function is available only if the module \alib_camp is included in
+///   the \alibbuild.
+///
+/// @tparam TEnum      The enumeration type to load resourced records for.
+/// @param  camp       The module to use the resource pool and category name from.
+/// @param  name       The resource name of the externalized name.
+/// @param  innerDelim The delimiter used for separating the fields of a record.
+///                    Defaults to <c>','</c>.
+/// @param  outerDelim The character delimiting enum records.
+///                    Defaults to <c>','</c>.
+template<typename TEnum>
+requires enumrecords::HasRecords<TEnum>
+void BootstrapLazy( camp::Camp&        camp,
+                    const NString&     name,
+                    character          innerDelim= ',' ,
+                    character          outerDelim= ','    )
+{ BootstrapLazy<TEnum>(*camp.GetResourcePool(), camp.ResourceCategory, name, innerDelim, outerDelim); }
+
 } // namespace [alib::enumrecords::bootstrap]
 
 //==================================================================================================
@@ -0,0 +1,197 @@
+//##################################################################################################
+//  ALib C++ Library
+//
+//  Copyright 2013-2025 A-Worx GmbH, Germany
+//  Published under 'Boost Software License' (a free software license, see LICENSE.txt)
+//##################################################################################################
+#include "alib_precompile.hpp"
+#if !defined(ALIB_C20_MODULES) || ((ALIB_C20_MODULES != 0) && (ALIB_C20_MODULES != 1))
+#   error "Symbol ALIB_C20_MODULES has to be given to the compiler as either 0 or 1"
+#endif
+#if ALIB_C20_MODULES
+    module;
+#endif
+//========================================= Global Fragment ========================================
+#include "alib/alib.inl"
+#include <cstring>
+#include <type_traits>
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__SIZEOF_INT128__)
+#   include <intrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+#   define ALIB_HASH_SSE2   1
+#   include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#   define ALIB_HASH_NEON   1
+#   include <arm_neon.h>
+#endif
+//============================================== Module ============================================
+#if ALIB_C20_MODULES
+    module ALib.Characters.Functions;
+    import   ALib.Lang;
+#else
+#   include "ALib.Lang.H"
+#   include "ALib.Characters.Functions.H"
+#endif
+//========================================== Implementation ========================================
+namespace alib::characters {
+
+#if !DOXYGEN
+namespace {
+
+constexpr uint64_t secret[4]= { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+                                0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+// Multiplies a and b to 128 bits and stores the lower half in a and the upper half in b.
+inline void mum( uint64_t& a, uint64_t& b ) {
+    #if defined(__SIZEOF_INT128__)
+        unsigned __int128 r= a;
+        r*= b;
+        a= uint64_t( r );
+        b= uint64_t( r >> 64 );
+    #elif defined(_MSC_VER) && defined(_M_X64)
+        a= _umul128( a, b, &b );
+    #else
+        uint64_t ha= a >> 32, hb= b >> 32, la= uint32_t(a), lb= uint32_t(b);
+        uint64_t rh= ha * hb, rm0= ha * lb, rm1= hb * la, rl= la * lb;
+        uint64_t t= rl + ( rm0 << 32 );
+        uint64_t c= t < rl;
+        uint64_t lo= t + ( rm1 << 32 );
+        c+= lo < t;
+        b= rh + ( rm0 >> 32 ) + ( rm1 >> 32 ) + c;
+        a= lo;
+    #endif
+}
+
+inline uint64_t mix( uint64_t a, uint64_t b )                        { mum( a, b ); return a ^ b; }
+
+inline uint64_t read8( const unsigned char* p ) { uint64_t v; std::memcpy( &v, p, 8 ); return v; }
+inline uint64_t read4( const unsigned char* p ) { uint32_t v; std::memcpy( &v, p, 4 ); return v; }
+inline uint64_t read3( const unsigned char* p, size_t k )
+{ return ( uint64_t(p[0]) << 16 ) | ( uint64_t(p[k >> 1]) << 8 ) | p[k - 1]; }
+
+// Converts a character to upper case. 7-bit characters are converted without invoking ToUpper.
+template<typename TChar>
+inline TChar toUpper( TChar c ) {
+    using TUnsigned= std::make_unsigned_t<TChar>;
+    TUnsigned u= TUnsigned( c );
+    if( u < 0x80 )
+        return TChar( u - ( TUnsigned( u - 'a' ) < 26 ? 0x20 : 0 ) );
+    return ToUpper<TChar>( c );
+}
+
+// Converts a chunk of characters to upper case. Blocks of 7-bit characters are converted
+// with SIMD instructions, if available.
+template<typename TChar>
+void foldChunk( const TChar* src, integer len, TChar* dest ) {
+    integer i= 0;
+
+    #if ALIB_HASH_SSE2
+    if constexpr ( sizeof(TChar) <= 2 ) {
+        constexpr integer blockLen= 16 / integer(sizeof(TChar));
+        for( ; i + blockLen <= len ; i+= blockLen ) {
+            __m128i v= _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + i ) );
+            __m128i isLower;
+            __m128i nonASCII;
+            if constexpr ( sizeof(TChar) == 1 ) {
+                nonASCII= v;
+                // signed compare: 'a'-1 < v < 'z'+1 (non-ASCII bytes are negative)
+                isLower = _mm_and_si128( _mm_cmpgt_epi8( v, _mm_set1_epi8( 'a' - 1 ) ),
+                                         _mm_cmplt_epi8( v, _mm_set1_epi8( 'z' + 1 ) ) );
+                isLower = _mm_and_si128( isLower, _mm_set1_epi8( 0x20 ) );
+            } else {
+                // flag values >= 0x80 in the sign bit of the lower byte of each unit
+                nonASCII= _mm_cmpgt_epi16( _mm_xor_si128( v, _mm_set1_epi16( short(0x8000) ) ),
+                                           _mm_set1_epi16( short(0x807F) ) );
+                isLower = _mm_and_si128( _mm_cmpgt_epi16( v, _mm_set1_epi16( 'a' - 1 ) ),
+                                         _mm_cmplt_epi16( v, _mm_set1_epi16( 'z' + 1 ) ) );
+                isLower = _mm_and_si128( isLower, _mm_set1_epi16( 0x20 ) );
+            }
+            if( _mm_movemask_epi8( nonASCII ) != 0 ) {
+                for( integer j= 0 ; j < blockLen ; ++j )
+                    dest[i + j]= toUpper( src[i + j] );
+                continue;
+            }
+            _mm_storeu_si128( reinterpret_cast<__m128i*>( dest + i ), _mm_sub_epi8( v, isLower ) );
+    }   }
+    #elif ALIB_HASH_NEON
+    if constexpr ( sizeof(TChar) == 1 ) {
+        for( ; i + 16 <= len ; i+= 16 ) {
+            uint8x16_t v= vld1q_u8( reinterpret_cast<const uint8_t*>( src + i ) );
+            if( vmaxvq_u8( v ) >= 0x80 ) {
+                for( integer j= 0 ; j < 16 ; ++j )
+                    dest[i + j]= toUpper( src[i + j] );
+                continue;
+            }
+            uint8x16_t isLower= vcltq_u8( vsubq_u8( v, vdupq_n_u8( 'a' ) ), vdupq_n_u8( 26 ) );
+            vst1q_u8( reinterpret_cast<uint8_t*>( dest + i ),
+                      vsubq_u8( v, vandq_u8( isLower, vdupq_n_u8( 0x20 ) ) ) );
+    }   }
+    #endif
+
+    for( ; i < len ; ++i )
+        dest[i]= toUpper( src[i] );
+}
+
+} // anonymous namespace
+#endif // !DOXYGEN
+
+uint64_t HashBytes( const void* data, size_t length, uint64_t seed ) {
+    const unsigned char* p= static_cast<const unsigned char*>( data );
+    seed^= mix( seed ^ secret[0], secret[1] );
+    uint64_t a, b;
+    if( length <= 16 ) {
+        if( length >= 4 ) {
+            size_t off= ( length >> 3 ) << 2;
+            a= ( read4( p              ) << 32 ) | read4( p + off              );
+            b= ( read4( p + length - 4 ) << 32 ) | read4( p + length - 4 - off );
+        }
+        else if( length > 0 ) { a= read3( p, length ); b= 0; }
+        else                  { a= b= 0;                     }
+    } else {
+        size_t i= length;
+        if( i >= 48 ) {
+            // three independent lanes
+            uint64_t see1= seed, see2= seed;
+            do {
+                seed= mix( read8( p      ) ^ secret[1], read8( p +  8 ) ^ seed );
+                see1= mix( read8( p + 16 ) ^ secret[2], read8( p + 24 ) ^ see1 );
+                see2= mix( read8( p + 32 ) ^ secret[3], read8( p + 40 ) ^ see2 );
+                p+= 48;
+                i-= 48;
+            } while( i >= 48 );
+            seed^= see1 ^ see2;
+        }
+        while( i > 16 ) {
+            seed= mix( read8( p ) ^ secret[1], read8( p + 8 ) ^ seed );
+            i-= 16;
+            p+= 16;
+        }
+        a= read8( p + i - 16 );
+        b= read8( p + i -  8 );
+    }
+    a^= secret[1];
+    b^= seed;
+    mum( a, b );
+    return mix( a ^ secret[0] ^ length, b ^ secret[1] );
+}
+
+template<typename TChar>
+uint64_t HashIgnoreCase( const TChar* src, integer length, uint64_t seed ) {
+    constexpr integer chunkLen= 256;
+    TChar buf[chunkLen];
+    do {
+        integer len= (std::min)( length, chunkLen );
+        foldChunk( src, len, buf );
+        seed  = Hash( buf, len, seed );
+        src   += len;
+        length-= len;
+    } while( length > 0 );
+    return seed;
+}
+
+template ALIB_DLL uint64_t HashIgnoreCase<nchar>( const nchar*, integer, uint64_t );
+template ALIB_DLL uint64_t HashIgnoreCase<wchar>( const wchar*, integer, uint64_t );
+template ALIB_DLL uint64_t HashIgnoreCase<xchar>( const xchar*, integer, uint64_t );
+
+} // namespace [alib::characters]
@@ -0,0 +1,69 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of module \alib_characters of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib {  namespace characters {
+
+//==================================================================================================
+/// Computes a 64-bit hash value of an array of bytes.
+///
+/// The algorithm follows the design of the <em>"wyhash"</em> function (final version 4):
+/// Input is read in words of 64 bits and mixed with 128-bit multiplications. Inputs of more than
+/// 48 bytes are processed in three independent lanes, which allows the processor to execute the
+/// multiplications in parallel. Short inputs (which are the common case with keys of hash tables)
+/// are processed without any loop.
+///
+/// The hash value is not guaranteed to be the same with different platforms or versions of this
+/// library. It must not be stored persistently.
+///
+/// @param data   Pointer to the data to hash.
+/// @param length The number of bytes to hash.
+/// @param seed   A seed value. Different seeds produce independent hash values. Hash values of
+///               multiple inputs may be combined by passing the hash value of one input as the
+///               seed to the next.
+/// @return The hash value.
+//==================================================================================================
+ALIB_DLL
+uint64_t    HashBytes( const void* data, size_t length, uint64_t seed= 0 );
+
+//==================================================================================================
+/// Computes a hash value of a character array using function \alib{characters;HashBytes}.
+///
+/// @tparam TChar  The character type.
+/// @param src     Pointer to the character array.
+/// @param length  The length of the array.
+/// @param seed    A seed value. See \alib{characters;HashBytes} for details.
+/// @return The hash value.
+//==================================================================================================
+template<typename TChar>
+uint64_t    Hash( const TChar* src, integer length, uint64_t seed= 0 )
+{ return HashBytes( src, size_t(length) * sizeof(TChar), seed ); }
+
+//==================================================================================================
+/// Computes a hash value of a character array converted to upper case letters.
+/// Two arrays which are equal when compared ignoring letter case, result in the same hash value.
+///
+/// The characters are converted in chunks to a local buffer, which is then hashed with
+/// \alib{characters;HashBytes}. Characters of the 7-bit ASCII range are converted in blocks
+/// using SSE2, respectively NEON instructions (if available with the compilation target).
+/// Other characters are converted with function \alib{characters;ToUpper}.
+///
+/// @tparam TChar  The character type.
+/// @param src     Pointer to the character array.
+/// @param length  The length of the array.
+/// @param seed    A seed value. See \alib{characters;HashBytes} for details.
+/// @return The hash value.
+//==================================================================================================
+template<typename TChar>
+uint64_t    HashIgnoreCase( const TChar* src, integer length, uint64_t seed= 0 );
+
+#if !DOXYGEN
+extern template ALIB_DLL uint64_t HashIgnoreCase<nchar>( const nchar*, integer, uint64_t );
+extern template ALIB_DLL uint64_t HashIgnoreCase<wchar>( const wchar*, integer, uint64_t );
+extern template ALIB_DLL uint64_t HashIgnoreCase<xchar>( const xchar*, integer, uint64_t );
+#endif // !DOXYGEN
+
+}} // namespace [alib::characters]
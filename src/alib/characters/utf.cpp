@@ -0,0 +1,390 @@
+//##################################################################################################
+//  ALib C++ Library
+//
+//  Copyright 2013-2025 A-Worx GmbH, Germany
+//  Published under 'Boost Software License' (a free software license, see LICENSE.txt)
+//##################################################################################################
+#include "alib_precompile.hpp"
+#if !defined(ALIB_C20_MODULES) || ((ALIB_C20_MODULES != 0) && (ALIB_C20_MODULES != 1))
+#   error "Symbol ALIB_C20_MODULES has to be given to the compiler as either 0 or 1"
+#endif
+#if ALIB_C20_MODULES
+    module;
+#endif
+//========================================= Global Fragment ========================================
+#include "alib/alib.inl"
+#include <cstring>
+#include <type_traits>
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+#   define ALIB_UTF_SSE2    1
+#   include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#   define ALIB_UTF_NEON    1
+#   include <arm_neon.h>
+#endif
+//============================================== Module ============================================
+#if ALIB_C20_MODULES
+    module ALib.Characters.Functions;
+    import   ALib.Lang;
+#else
+#   include "ALib.Lang.H"
+#   include "ALib.Characters.Functions.H"
+#endif
+//========================================== Implementation ========================================
+namespace alib::characters {
+
+#if !DOXYGEN
+namespace {
+
+// Returns the unsigned value of a wide character.
+template<typename TChar>
+uint32_t unitValue( TChar c )       { return uint32_t( std::make_unsigned_t<TChar>( c ) ); }
+
+//------------------------------------------- ASCII runs -------------------------------------------
+// Both functions return the length of the run of 7-bit characters found at the start of src.
+// If TStore is given, the run is copied to dest. Only full blocks are processed, hence the
+// remaining characters of a run are left to the caller.
+template<bool TStore, typename TDest>
+integer asciiRunFromNarrow( const unsigned char* src, integer len, TDest* dest ) {
+    integer i= 0;
+
+    #if defined(__AVX2__)
+        for( ; i + 32 <= len ; i+= 32 ) {
+            __m256i v= _mm256_loadu_si256( reinterpret_cast<const __m256i*>( src + i ) );
+            if( _mm256_movemask_epi8( v ) != 0 )
+                break;
+            if constexpr ( TStore ) {
+                __m128i lo= _mm256_castsi256_si128( v );
+                __m128i hi= _mm256_extracti128_si256( v, 1 );
+                __m256i* d= reinterpret_cast<__m256i*>( dest + i );
+                if constexpr ( sizeof(TDest) == 2 ) {
+                    _mm256_storeu_si256( d    , _mm256_cvtepu8_epi16( lo ) );
+                    _mm256_storeu_si256( d + 1, _mm256_cvtepu8_epi16( hi ) );
+                } else {
+                    _mm256_storeu_si256( d    , _mm256_cvtepu8_epi32( lo                        ) );
+                    _mm256_storeu_si256( d + 1, _mm256_cvtepu8_epi32( _mm_srli_si128( lo, 8 ) ) );
+                    _mm256_storeu_si256( d + 2, _mm256_cvtepu8_epi32( hi                        ) );
+                    _mm256_storeu_si256( d + 3, _mm256_cvtepu8_epi32( _mm_srli_si128( hi, 8 ) ) );
+        }   }   }
+    #endif
+
+    #if ALIB_UTF_SSE2
+        const __m128i zero= _mm_setzero_si128();
+        for( ; i + 16 <= len ; i+= 16 ) {
+            __m128i v= _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + i ) );
+            if( _mm_movemask_epi8( v ) != 0 )
+                break;
+            if constexpr ( TStore ) {
+                __m128i  lo= _mm_unpacklo_epi8( v, zero );
+                __m128i  hi= _mm_unpackhi_epi8( v, zero );
+                __m128i* d = reinterpret_cast<__m128i*>( dest + i );
+                if constexpr ( sizeof(TDest) == 2 ) {
+                    _mm_storeu_si128( d    , lo );
+                    _mm_storeu_si128( d + 1, hi );
+                } else {
+                    _mm_storeu_si128( d    , _mm_unpacklo_epi16( lo, zero ) );
+                    _mm_storeu_si128( d + 1, _mm_unpackhi_epi16( lo, zero ) );
+                    _mm_storeu_si128( d + 2, _mm_unpacklo_epi16( hi, zero ) );
+                    _mm_storeu_si128( d + 3, _mm_unpackhi_epi16( hi, zero ) );
+        }   }   }
+    #elif ALIB_UTF_NEON
+        for( ; i + 16 <= len ; i+= 16 ) {
+            uint8x16_t v= vld1q_u8( src + i );
+            if( vmaxvq_u8( v ) >= 0x80 )
+                break;
+            if constexpr ( TStore ) {
+                uint16x8_t lo= vmovl_u8     ( vget_low_u8( v ) );
+                uint16x8_t hi= vmovl_high_u8( v );
+                if constexpr ( sizeof(TDest) == 2 ) {
+                    uint16_t* d= reinterpret_cast<uint16_t*>( dest + i );
+                    vst1q_u16( d    , lo );
+                    vst1q_u16( d + 8, hi );
+                } else {
+                    uint32_t* d= reinterpret_cast<uint32_t*>( dest + i );
+                    vst1q_u32( d     , vmovl_u16     ( vget_low_u16( lo ) ) );
+                    vst1q_u32( d +  4, vmovl_high_u16( lo )                 );
+                    vst1q_u32( d +  8, vmovl_u16     ( vget_low_u16( hi ) ) );
+                    vst1q_u32( d + 12, vmovl_high_u16( hi )                 );
+        }   }   }
+    #endif
+
+    // portable fallback and remainder: eight bytes per step
+    for( ; i + 8 <= len ; i+= 8 ) {
+        uint64_t word;
+        std::memcpy( &word, src + i, 8 );
+        if( word & 0x8080808080808080ull )
+            break;
+        if constexpr ( TStore )
+            for( integer k= 0 ; k < 8 ; ++k )
+                dest[i + k]= TDest( src[i + k] );
+    }
+    return i;
+}
+
+template<bool TStore, typename TSrc>
+integer asciiRunToNarrow( const TSrc* src, integer len, nchar* dest ) {
+    integer i= 0;
+
+    #if ALIB_UTF_SSE2
+        const __m128i zero= _mm_setzero_si128();
+        if constexpr ( sizeof(TSrc) == 2 ) {
+            const __m128i mask= _mm_set1_epi16( int16_t( 0xFF80 ) );
+            for( ; i + 16 <= len ; i+= 16 ) {
+                const __m128i* s= reinterpret_cast<const __m128i*>( src + i );
+                __m128i a= _mm_loadu_si128( s     );
+                __m128i b= _mm_loadu_si128( s + 1 );
+                __m128i high= _mm_and_si128( _mm_or_si128( a, b ), mask );
+                if( _mm_movemask_epi8( _mm_cmpeq_epi16( high, zero ) ) != 0xFFFF )
+                    break;
+                if constexpr ( TStore )
+                    _mm_storeu_si128( reinterpret_cast<__m128i*>( dest + i ),
+                                      _mm_packus_epi16( a, b ) );
+            }
+        } else {
+            const __m128i mask= _mm_set1_epi32( int32_t( 0xFFFFFF80 ) );
+            for( ; i + 16 <= len ; i+= 16 ) {
+                const __m128i* s= reinterpret_cast<const __m128i*>( src + i );
+                __m128i a= _mm_loadu_si128( s     );
+                __m128i b= _mm_loadu_si128( s + 1 );
+                __m128i c= _mm_loadu_si128( s + 2 );
+                __m128i d= _mm_loadu_si128( s + 3 );
+                __m128i high= _mm_and_si128( _mm_or_si128( _mm_or_si128( a, b ),
+                                                           _mm_or_si128( c, d ) ), mask );
+                if( _mm_movemask_epi8( _mm_cmpeq_epi32( high, zero ) ) != 0xFFFF )
+                    break;
+                if constexpr ( TStore )
+                    _mm_storeu_si128( reinterpret_cast<__m128i*>( dest + i ),
+                                      _mm_packus_epi16( _mm_packs_epi32( a, b ),
+                                                        _mm_packs_epi32( c, d ) ) );
+        }   }
+    #elif ALIB_UTF_NEON
+        if constexpr ( sizeof(TSrc) == 2 ) {
+            for( ; i + 16 <= len ; i+= 16 ) {
+                const uint16_t* s= reinterpret_cast<const uint16_t*>( src + i );
+                uint16x8_t a= vld1q_u16( s     );
+                uint16x8_t b= vld1q_u16( s + 8 );
+                if( vmaxvq_u16( vorrq_u16( a, b ) ) >= 0x80 )
+                    break;
+                if constexpr ( TStore )
+                    vst1q_u8( reinterpret_cast<uint8_t*>( dest + i ),
+                              vcombine_u8( vmovn_u16( a ), vmovn_u16( b ) ) );
+            }
+        } else {
+            for( ; i + 16 <= len ; i+= 16 ) {
+                const uint32_t* s= reinterpret_cast<const uint32_t*>( src + i );
+                uint32x4_t a= vld1q_u32( s      );
+                uint32x4_t b= vld1q_u32( s +  4 );
+                uint32x4_t c= vld1q_u32( s +  8 );
+                uint32x4_t d= vld1q_u32( s + 12 );
+                if( vmaxvq_u32( vorrq_u32( vorrq_u32( a, b ), vorrq_u32( c, d ) ) ) >= 0x80 )
+                    break;
+                if constexpr ( TStore )
+                    vst1q_u8( reinterpret_cast<uint8_t*>( dest + i ),
+                              vcombine_u8( vmovn_u16( vcombine_u16( vmovn_u32( a ), vmovn_u32( b ) ) ),
+                                           vmovn_u16( vcombine_u16( vmovn_u32( c ), vmovn_u32( d ) ) ) ) );
+        }   }
+    #else
+        (void) src; (void) len; (void) dest;
+    #endif
+
+    return i;
+}
+
+//------------------------------------- reading code points ----------------------------------------
+// Each function reads one code point from src and returns the number of characters consumed.
+// Invalid sequences are returned as UTFReplacementCharacter.
+integer readCodePoint( const unsigned char* src, integer len, char32_t& cp ) {
+    unsigned b0= src[0];
+    if( b0 < 0x80 ) {
+        cp= b0;
+        return 1;
+    }
+
+    // determine the number of continuation bytes and the valid range of the first of them
+    integer  qtyCont;
+    unsigned lo= 0x80, hi= 0xBF;
+         if( b0 >= 0xC2 && b0 <= 0xDF ) { qtyCont= 1; cp= b0 & 0x1F; }
+    else if( b0 >= 0xE0 && b0 <= 0xEF ) { qtyCont= 2; cp= b0 & 0x0F;
+                                          if( b0 == 0xE0 ) lo= 0xA0;       // overlong
+                                          if( b0 == 0xED ) hi= 0x9F;  }    // surrogates
+    else if( b0 >= 0xF0 && b0 <= 0xF4 ) { qtyCont= 3; cp= b0 & 0x07;
+                                          if( b0 == 0xF0 ) lo= 0x90;       // overlong
+                                          if( b0 == 0xF4 ) hi= 0x8F;  }    // > U+10FFFF
+    else {
+        cp= UTFReplacementCharacter;
+        return 1;
+    }
+
+    // read continuation bytes. On error, the maximal subpart read so far is skipped
+    for( integer i= 1 ; i <= qtyCont ; ++i ) {
+        if( i >= len || src[i] < lo || src[i] > hi ) {
+            cp= UTFReplacementCharacter;
+            return i;
+        }
+        cp= ( cp << 6 ) | ( src[i] & 0x3F );
+        lo= 0x80;
+        hi= 0xBF;
+    }
+    return qtyCont + 1;
+}
+
+template<typename TSrc>
+integer readCodePoint( const TSrc* src, integer len, char32_t& cp ) {
+    uint32_t u= unitValue( src[0] );
+    if constexpr ( sizeof(TSrc) == 2 ) {
+        if( ( u & 0xF800 ) != 0xD800 ) {
+            cp= u;
+            return 1;
+        }
+        if( u < 0xDC00 && len > 1 ) {
+            uint32_t u2= unitValue( src[1] );
+            if( ( u2 & 0xFC00 ) == 0xDC00 ) {
+                cp= 0x10000 + ( ( u - 0xD800 ) << 10 ) + ( u2 - 0xDC00 );
+                return 2;
+        }   }
+        cp= UTFReplacementCharacter;
+        return 1;
+    } else {
+        cp= ( u > 0x10FFFF || ( u & 0xFFFFF800 ) == 0xD800 ) ? UTFReplacementCharacter
+                                                             : char32_t( u );
+        return 1;
+    }
+}
+
+//------------------------------------- writing code points ----------------------------------------
+// Each function writes a valid code point and returns the number of characters written.
+// If TStore is not given, nothing is written.
+template<bool TStore>
+integer writeCodePoint( char32_t cp, nchar* dest ) {
+    if( cp < 0x80 ) {
+        if constexpr ( TStore )
+            dest[0]= nchar( cp );
+        return 1;
+    }
+    if( cp < 0x800 ) {
+        if constexpr ( TStore ) {
+            dest[0]= nchar( 0xC0 | ( cp >>  6 ) );
+            dest[1]= nchar( 0x80 | ( cp & 0x3F ) );
+        }
+        return 2;
+    }
+    if( cp < 0x10000 ) {
+        if constexpr ( TStore ) {
+            dest[0]= nchar( 0xE0 | (   cp >> 12 ) );
+            dest[1]= nchar( 0x80 | ( ( cp >>  6 ) & 0x3F ) );
+            dest[2]= nchar( 0x80 | (   cp         & 0x3F ) );
+        }
+        return 3;
+    }
+    if constexpr ( TStore ) {
+        dest[0]= nchar( 0xF0 | (   cp >> 18 ) );
+        dest[1]= nchar( 0x80 | ( ( cp >> 12 ) & 0x3F ) );
+        dest[2]= nchar( 0x80 | ( ( cp >>  6 ) & 0x3F ) );
+        dest[3]= nchar( 0x80 | (   cp         & 0x3F ) );
+    }
+    return 4;
+}
+
+template<bool TStore, typename TDest>
+integer writeCodePoint( char32_t cp, TDest* dest ) {
+    if constexpr ( sizeof(TDest) == 2 ) {
+        if( cp >= 0x10000 ) {
+            if constexpr ( TStore ) {
+                cp-= 0x10000;
+                dest[0]= TDest( 0xD800 + ( cp >> 10   ) );
+                dest[1]= TDest( 0xDC00 + ( cp & 0x3FF ) );
+            }
+            return 2;
+    }   }
+    if constexpr ( TStore )
+        dest[0]= TDest( cp );
+    return 1;
+}
+
+//------------------------------------------- transcoding ------------------------------------------
+template<bool TStore, typename TDest, typename TSrc>
+integer transcode( const TSrc* pSrc, integer srcLength, TDest* dest ) {
+    static_assert( sizeof(TDest) != sizeof(TSrc), "Transcoding requires different encodings." );
+    using TSrcUnit= std::conditional_t<sizeof(TSrc) == 1, unsigned char, TSrc>;
+    const TSrcUnit* src= reinterpret_cast<const TSrcUnit*>( pSrc );
+
+    integer srcIdx = 0;
+    integer destIdx= 0;
+    while( srcIdx < srcLength ) {
+        // ASCII run?
+        if constexpr ( sizeof(TSrc) == 1 || sizeof(TDest) == 1 ) {
+            if( unitValue( src[srcIdx] ) < 0x80 ) {
+                integer run;
+                if constexpr ( sizeof(TSrc) == 1 )
+                    run= asciiRunFromNarrow<TStore>( src + srcIdx, srcLength - srcIdx,
+                                                     TStore ? dest + destIdx : nullptr );
+                else
+                    run= asciiRunToNarrow  <TStore>( src + srcIdx, srcLength - srcIdx,
+                                                     TStore ? dest + destIdx : nullptr );
+                srcIdx += run;
+                destIdx+= run;
+
+                // the remainder of the run, character by character
+                while( srcIdx < srcLength && unitValue( src[srcIdx] ) < 0x80 ) {
+                    if constexpr ( TStore )
+                        dest[destIdx]= TDest( src[srcIdx] );
+                    ++srcIdx;
+                    ++destIdx;
+                }
+                continue;
+        }   }
+
+        char32_t cp;
+        srcIdx += readCodePoint( src + srcIdx, srcLength - srcIdx, cp );
+        destIdx+= writeCodePoint<TStore>( cp, TStore ? dest + destIdx : nullptr );
+    }
+    return destIdx;
+}
+
+} // anonymous namespace
+#endif // !DOXYGEN
+
+template<typename TDest, typename TSrc>
+integer Transcode( const TSrc* src, integer srcLength, TDest* dest )
+{ return transcode<true>( src, srcLength, dest ); }
+
+template<typename TDest, typename TSrc>
+integer TranscodedLength( const TSrc* src, integer srcLength )
+{ return transcode<false>( src, srcLength, static_cast<TDest*>( nullptr ) ); }
+
+//! @cond NO_DOX
+template integer Transcode<char16_t, nchar   >( const nchar*   , integer, char16_t* );
+template integer Transcode<char32_t, nchar   >( const nchar*   , integer, char32_t* );
+template integer Transcode<wchar_t , nchar   >( const nchar*   , integer, wchar_t*  );
+template integer Transcode<nchar   , char16_t>( const char16_t*, integer, nchar*    );
+template integer Transcode<nchar   , char32_t>( const char32_t*, integer, nchar*    );
+template integer Transcode<nchar   , wchar_t >( const wchar_t* , integer, nchar*    );
+template integer Transcode<char16_t, char32_t>( const char32_t*, integer, char16_t* );
+template integer Transcode<char32_t, char16_t>( const char16_t*, integer, char32_t* );
+
+template integer TranscodedLength<char16_t, nchar   >( const nchar*   , integer );
+template integer TranscodedLength<char32_t, nchar   >( const nchar*   , integer );
+template integer TranscodedLength<wchar_t , nchar   >( const nchar*   , integer );
+template integer TranscodedLength<nchar   , char16_t>( const char16_t*, integer );
+template integer TranscodedLength<nchar   , char32_t>( const char32_t*, integer );
+template integer TranscodedLength<nchar   , wchar_t >( const wchar_t* , integer );
+template integer TranscodedLength<char16_t, char32_t>( const char32_t*, integer );
+template integer TranscodedLength<char32_t, char16_t>( const char16_t*, integer );
+
+#if ALIB_SIZEOF_WCHAR_T == 4
+template integer Transcode<char16_t, wchar_t >( const wchar_t* , integer, char16_t* );
+template integer Transcode<wchar_t , char16_t>( const char16_t*, integer, wchar_t*  );
+template integer TranscodedLength<char16_t, wchar_t >( const wchar_t* , integer );
+template integer TranscodedLength<wchar_t , char16_t>( const char16_t*, integer );
+#else
+template integer Transcode<char32_t, wchar_t >( const wchar_t* , integer, char32_t* );
+template integer Transcode<wchar_t , char32_t>( const char32_t*, integer, wchar_t*  );
+template integer TranscodedLength<char32_t, wchar_t >( const wchar_t* , integer );
+template integer TranscodedLength<wchar_t , char32_t>( const char32_t*, integer );
+#endif
+//! @endcond
+
+} // namespace [alib::characters]
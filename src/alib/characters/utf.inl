@@ -0,0 +1,118 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of module \alib_characters of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib {  namespace characters {
+
+//==================================================================================================
+/// The character that invalid input sequences are replaced with by the transcoding functions
+/// \alib{characters;Transcode} and \alib{characters;TranscodedLength}. This is the Unicode
+/// <em>"replacement character"</em> <c>U+FFFD</c>.
+//==================================================================================================
+inline constexpr char32_t   UTFReplacementCharacter                                        = 0xFFFD;
+
+//==================================================================================================
+/// Returns the maximum number of characters of type \p{TDest} that function
+/// \alib{characters;Transcode} writes when a character array of type \p{TSrc} and length
+/// \p{srcLength} is converted.
+/// The value is an upper bound that does not require inspecting the source. To receive the
+/// exact length, function \alib{characters;TranscodedLength} can be used.
+///
+/// Narrow strings are UTF-8 encoded, wide characters of size two are UTF-16 and wide characters
+/// of size four are UTF-32 encoded.
+///
+/// @tparam TDest One of the \ref alib_characters_chars "character types" to convert to.
+/// @tparam TSrc  One of the \ref alib_characters_chars "character types" to convert from.
+///               Must be of a different size than \p{TDest}.
+/// @param srcLength The length of the source array.
+/// @return The maximum length of the converted string.
+//==================================================================================================
+template<typename TDest, typename TSrc>
+requires ( sizeof(TDest) != sizeof(TSrc) )
+constexpr integer  TranscodedLengthMax( integer srcLength ) {
+    if constexpr ( sizeof(TDest) == 1 )  return srcLength * ( sizeof(TSrc) == 2 ? 3 : 4 );
+    if constexpr ( sizeof(TSrc)  == 1 )  return srcLength;
+    if constexpr ( sizeof(TDest) == 2 )  return srcLength * 2;
+    return srcLength;
+}
+
+//==================================================================================================
+/// Converts a character array from one Unicode encoding to another.
+/// Narrow strings are interpreted and written as UTF-8, wide characters of size two as UTF-16
+/// and wide characters of size four as UTF-32.
+///
+/// The conversion is independent of the locale settings of the C library (see
+/// <em>setlocale()</em>). The input is validated: Each invalid sequence is replaced by one
+/// \alib{characters;UTFReplacementCharacter}. With UTF-8, a <em>"maximal subpart"</em> of an
+/// ill-formed sequence (e.g., a truncated sequence of three bytes) counts as one invalid
+/// sequence, as recommended by the Unicode standard. With UTF-16, unpaired surrogates are
+/// invalid, and with UTF-32, surrogates and values exceeding <c>U+10FFFF</c>.
+///
+/// Runs of 7-bit ASCII characters, which are the same in all encodings, are converted in blocks.
+/// Depending on the compilation target, SSE2, AVX2 or NEON instructions are used for that.
+///
+/// The destination array has to provide capacity for the number of characters returned by
+/// \alib{characters;TranscodedLengthMax} or \alib{characters;TranscodedLength}.
+///
+/// @tparam TDest    One of the \ref alib_characters_chars "character types" to convert to.
+/// @tparam TSrc     One of the \ref alib_characters_chars "character types" to convert from.
+///                  Must be of a different size than \p{TDest}.
+/// @param src       Pointer to the source array.
+/// @param srcLength The length of the source array.
+/// @param dest      Pointer to the destination array.
+/// @return The number of characters written to \p{dest}.
+//==================================================================================================
+template<typename TDest, typename TSrc>
+integer     Transcode( const TSrc* src, integer srcLength, TDest* dest );
+
+//==================================================================================================
+/// Returns the exact number of characters that function \alib{characters;Transcode} writes for
+/// the given source. This function does not write any data. Like \b Transcode, it uses fast paths
+/// for runs of 7-bit ASCII characters.
+///
+/// @tparam TDest    One of the \ref alib_characters_chars "character types" to convert to.
+/// @tparam TSrc     One of the \ref alib_characters_chars "character types" to convert from.
+///                  Must be of a different size than \p{TDest}.
+/// @param src       Pointer to the source array.
+/// @param srcLength The length of the source array.
+/// @return The length of the converted string.
+//==================================================================================================
+template<typename TDest, typename TSrc>
+integer     TranscodedLength( const TSrc* src, integer srcLength );
+
+#if !DOXYGEN
+extern template ALIB_DLL integer Transcode<char16_t, nchar   >( const nchar*   , integer, char16_t* );
+extern template ALIB_DLL integer Transcode<char32_t, nchar   >( const nchar*   , integer, char32_t* );
+extern template ALIB_DLL integer Transcode<wchar_t , nchar   >( const nchar*   , integer, wchar_t*  );
+extern template ALIB_DLL integer Transcode<nchar   , char16_t>( const char16_t*, integer, nchar*    );
+extern template ALIB_DLL integer Transcode<nchar   , char32_t>( const char32_t*, integer, nchar*    );
+extern template ALIB_DLL integer Transcode<nchar   , wchar_t >( const wchar_t* , integer, nchar*    );
+extern template ALIB_DLL integer Transcode<char16_t, char32_t>( const char32_t*, integer, char16_t* );
+extern template ALIB_DLL integer Transcode<char32_t, char16_t>( const char16_t*, integer, char32_t* );
+
+extern template ALIB_DLL integer TranscodedLength<char16_t, nchar   >( const nchar*   , integer );
+extern template ALIB_DLL integer TranscodedLength<char32_t, nchar   >( const nchar*   , integer );
+extern template ALIB_DLL integer TranscodedLength<wchar_t , nchar   >( const nchar*   , integer );
+extern template ALIB_DLL integer TranscodedLength<nchar   , char16_t>( const char16_t*, integer );
+extern template ALIB_DLL integer TranscodedLength<nchar   , char32_t>( const char32_t*, integer );
+extern template ALIB_DLL integer TranscodedLength<nchar   , wchar_t >( const wchar_t* , integer );
+extern template ALIB_DLL integer TranscodedLength<char16_t, char32_t>( const char32_t*, integer );
+extern template ALIB_DLL integer TranscodedLength<char32_t, char16_t>( const char16_t*, integer );
+
+#   if ALIB_SIZEOF_WCHAR_T == 4
+extern template ALIB_DLL integer Transcode<char16_t, wchar_t >( const wchar_t* , integer, char16_t* );
+extern template ALIB_DLL integer Transcode<wchar_t , char16_t>( const char16_t*, integer, wchar_t*  );
+extern template ALIB_DLL integer TranscodedLength<char16_t, wchar_t >( const wchar_t* , integer );
+extern template ALIB_DLL integer TranscodedLength<wchar_t , char16_t>( const char16_t*, integer );
+#   else
+extern template ALIB_DLL integer Transcode<char32_t, wchar_t >( const wchar_t* , integer, char32_t* );
+extern template ALIB_DLL integer Transcode<wchar_t , char32_t>( const char32_t*, integer, wchar_t*  );
+extern template ALIB_DLL integer TranscodedLength<char32_t, wchar_t >( const wchar_t* , integer );
+extern template ALIB_DLL integer TranscodedLength<wchar_t , char32_t>( const char32_t*, integer );
+#   endif
+#endif // !DOXYGEN
+
+}} // namespace [alib::characters]
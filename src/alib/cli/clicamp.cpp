@@ -26,11 +26,13 @@
 #  endif
 #  if ALIB_CAMP
     import   ALib.Camp;
+    import   ALib.Camp.Base;
 #  endif
 #else
 #   include "ALib.Strings.H"
 #   include "ALib.Boxing.H"
 #   include "ALib.Camp.H"
+#   include "ALib.Camp.Base.H"
 #   include "ALib.CLI.H"
 #endif
 #   include "ALib.Characters.Functions.H"
@@ -56,6 +58,7 @@ CliCamp::CliCamp()
       ALIB_ASSERT_ERROR( this == &CLI, "CLI",
           "Instances of class Cli must not be created. Use singleton alib::CLI" )
     #endif
+    BootstrapAddDependency( BASECAMP );
 }
 
 #define EOS ,
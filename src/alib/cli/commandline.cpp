@@ -150,31 +150,45 @@ Option*  CommandLine::GetOption( Enum element ) {
 
 
 void CommandLine::ReadNextCommands() {
+    ALIB_ASSERT_ERROR( CommandDecls.size() > 0,  "CLI", "No commands declared." )
+
+    // (re-)build the index of command identifiers
+    if( commandIndexGeneration != commandDeclsGeneration ) {
+        commandIndexGeneration= commandDeclsGeneration;
+        commandIndex.Reset();
+        commandIndexDecls.clear();
+        for( auto* commandDecl : CommandDecls ) {
+            commandIndex.Add( commandDecl->Identifier(), commandDecl->MinimumRecognitionLength() );
+            commandIndexDecls.push_back( commandDecl );
+    }   }
+
     // loop over all arg indices in ArgsLeft
     bool   lastCommandFullyParsed= true;
     while( lastCommandFullyParsed &&  ArgsLeft.size() > 0 ) {
-        // create a command object and search decl with actual argument
-        Command* command= allocator().New<Command>(this);
-        ALIB_ASSERT_ERROR( CommandDecls.size() > 0,  "CLI", "No commands declared." )
-        for( auto* commandDecl : CommandDecls ) {
-            try
-            {
-                lastCommandFullyParsed= command->Read( *commandDecl );
-            }
-            catch ( Exception& e )
-            {
-                e.Add( ALIB_CALLER_NULLED, cli::Exceptions::ParsingCommand,
-                       CLIUtil::GetCommandUsageFormat( *this, *commandDecl ),
-                       commandDecl->HelpTextShort()                    );
-                throw;
-            }
+        // search the decl with the actual argument
+        integer idx= commandIndex.FindAbbreviation( PeekArg() );
+        if( idx < 0 )
+            break;
+
+        // create a command object and read it
+        CommandDecl* commandDecl= commandIndexDecls[size_t(idx)];
+        Command*     command    = allocator().New<Command>(this);
+        try
+        {
+            lastCommandFullyParsed= command->Read( *commandDecl );
+        }
+        catch ( Exception& e )
+        {
+            e.Add( ALIB_CALLER_NULLED, cli::Exceptions::ParsingCommand,
+                   CLIUtil::GetCommandUsageFormat( *this, *commandDecl ),
+                   commandDecl->HelpTextShort()                    );
+            throw;
+        }
 
-            if( command->ConsumedArguments > 0 ) {
-                CommandsParsed.push_back( command );
-                if( NextCommandIt == CommandsParsed.end() )
-                    --NextCommandIt;
-                break;
-}   }   }   }
+        CommandsParsed.push_back( command );
+        if( NextCommandIt == CommandsParsed.end() )
+            --NextCommandIt;
+}   }
 
 Command* CommandLine::NextCommand() {
     if( NextCommandIt == CommandsParsed.end() )
@@ -58,6 +58,20 @@ class CommandLine
     /// \alib{cli;Command::ParametersOptional}.
     ListMA<Parameter*, Recycling::Shared>::SharedRecyclerType    paramListRecycler;
 
+    /// A trie of the identifiers of the commands in #CommandDecls. Used by method
+    /// #ReadNextCommands to find the declaration of a command without testing each declaration.
+    /// Rebuilt if #commandDeclsGeneration changed since the last use.
+    enumrecords::detail::PrefixIndex<character, lang::Case::Ignore> commandIndex;
+
+    /// The command declarations in the order of the entries of #commandIndex.
+    StdVectorMA<CommandDecl*>                       commandIndexDecls;
+
+    /// Incremented with each change of #CommandDecls. See method #CommandDeclsChanged.
+    unsigned                                        commandDeclsGeneration                     = 1;
+
+    /// The value of #commandDeclsGeneration that #commandIndex was built for.
+    unsigned                                        commandIndexGeneration                     = 0;
+
   //################################################################################################
   // Fields
   //################################################################################################
@@ -81,6 +95,8 @@ class CommandLine
 
       //############################## Declarations (from custom enums) ############################
     /// Commands defined.
+    /// If this list is modified other than with method #DefineCommands, method
+    /// #CommandDeclsChanged has to be invoked.
     ListMA<CommandDecl*>                            CommandDecls;
 
     /// Possible Options.
@@ -140,6 +156,7 @@ class CommandLine
     : allocator        ( ALIB_DBG("CommandLine",) 2 )
     , stringListRecycler(allocator)
     , paramListRecycler(allocator)
+    , commandIndexDecls(allocator)
     , AppInfo          (A_CHAR("<AppInfo not set>") )
     , ArgStrings       (allocator)
     , ArgsLeft         (allocator)
@@ -251,7 +268,13 @@ class CommandLine
             auto& name= CommandDecls.back()->Identifier();
             if ( MaxNameLength[0] < name.Length() )
                  MaxNameLength[0]=  name.Length();
-    }   }
+        }
+        CommandDeclsChanged();
+    }
+
+    /// Has to be invoked if field #CommandDecls is modified directly. Makes method
+    /// #ReadNextCommands rebuild its lookup index of command identifiers.
+    void CommandDeclsChanged()                                     { ++commandDeclsGeneration; }
 
 
     /// Defines options given with enumeration \p{TEnum}.
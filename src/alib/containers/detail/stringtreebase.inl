@@ -97,8 +97,7 @@ struct StringTreeBase
             /// @param  key The key to hash.
             /// @return The hash code.
             std::size_t operator()(const NodeKey& key)                                       const {
-                return   key.name.key.Hashcode()
-                       + reinterpret_cast<std::size_t>(key.parent) * 29;
+                return key.name.key.Hashcode( uint64_t(reinterpret_cast<std::size_t>(key.parent)) );
             }
         };
 
@@ -249,6 +248,7 @@ struct StringTreeBase
                 TNodeHandler::InitializeNode( *static_cast<Node*>(child), *tree );
                 children.pushEnd( child );
                 ++qtyChildren;
+                ++tree->structureStamp;
             }
 
             return std::make_pair( child, childCreation.second );
@@ -269,6 +269,7 @@ struct StringTreeBase
                 "STRINGTREE", "The given node is not a child of this node.")
 
             --qtyChildren;
+            ++tree->structureStamp;
             child->remove(); // remove from linked list
             auto count= child->deleteChildren( tree );
             auto handle= tree->nodeTable.Extract( *child );
@@ -286,6 +287,7 @@ struct StringTreeBase
                 return 0;
 
             uinteger     count= qtyChildren;
+            ++tree->structureStamp;
 
             auto* child= children.first();
             while( child != &children.hook ) {
@@ -436,6 +438,11 @@ struct StringTreeBase
                lang::Caching::Enabled,
                TRecycling                 >  nodeTable;
 
+    /// A counter which is increased with each insertion and deletion of nodes.
+    /// Used to detect outdated sort indices stored with instances of class
+    /// \alib{containers;StringTreeIterator::SortCache}.
+    uinteger            structureStamp                                                          =0;
+
     /// This type definition may be used to define an externally managed shared recycler,
     /// which can be passed to the alternative constructor of this class when template
     /// parameter \p{TRecycling} equals \alib{containers;Recycling;Shared}.
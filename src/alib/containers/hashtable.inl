@@ -7,6 +7,32 @@
 /// Published under \ref mainpage_license "Boost Software License".
 //==================================================================================================
 ALIB_EXPORT namespace alib { namespace containers {
+
+//==================================================================================================
+/// Concept that is satisfied by types which carry a pre-calculated hash code of a key value.
+/// Such types can be passed to methods \alib{containers;HashTable::Find(const THashedKey&)} and
+/// \alib{containers;HashTable::Contains(const THashedKey&)const}, which then do not recalculate
+/// the hash code.
+///
+/// The requirements are:
+/// - \p{T} is implicitly convertible to <c>const TKey&</c>, usually because \p{TKey} is a
+///   base class of \p{T},
+/// - \p{T} defines type \c HashType, which equals \p{THash}, and
+/// - \p{T} provides method <c>Hashcode()</c>, which returns the hash code that \p{THash}
+///   calculates for the key value.
+///
+/// With module \alib_strings, class \alib{strings;THashedString} satisfies this concept.
+///
+/// @tparam T     The type to test.
+/// @tparam TKey  The key type of the hash table.
+/// @tparam THash The hash functor of the hash table.
+//==================================================================================================
+template<typename T, typename TKey, typename THash>
+concept IsHashedKey=     std::is_convertible_v<const T&, const TKey&>
+                     &&  std::same_as<typename T::HashType, THash>
+                     &&  requires( const T& key )
+                         { { key.Hashcode() } -> std::convertible_to<size_t>; };
+
 //==================================================================================================
 /// # Contents #
 /// \ref alib_ns_containers_hashtable_intro                   "1. Introduction"                  <br>
@@ -287,6 +313,11 @@ ALIB_EXPORT namespace alib { namespace containers {
 /// - Situations where the result of a find operation may lead to further operations with the
 ///   same object.
 ///
+/// Furthermore, methods #Find(const THashedKey&) and #Contains(const THashedKey&)const accept
+/// key objects that carry their hash code with them, as specified with concept
+/// \alib{containers;IsHashedKey}. With strings, class \alib{strings;THashedString;HashedString}
+/// is such a type.
+///
 ///\I{#############################################################################################}
 /// \anchor alib_ns_containers_hashtable_hashquality
 /// ## 6.3 Hash Code Quality ##
@@ -1685,6 +1716,32 @@ class HashTable : protected detail::HashTableBase<TAllocator,TValueDescriptor,TH
         return ConstIterator( this, elem == nullptr ? base::bucketCount : bucketIdx, elem );
     }
 
+    /// Overloaded version of method \alib{containers::HashTable;Find(const KeyType&)} which
+    /// accepts a key object that carries its pre-calculated hash code.
+    ///
+    /// @tparam THashedKey The type of the key object. Has to satisfy the concept
+    ///                    \alib{containers;IsHashedKey}.
+    /// @param  key        The key to search for.
+    /// @return An iterator pointing to the first element found with equal <em>key-portion</em>,
+    ///         respectively, one being equal to #end, if no element was found with \p{key}.
+    template<typename THashedKey>
+    requires IsHashedKey<THashedKey, KeyType, THash>
+    Iterator        Find( const THashedKey& key )
+    { return Find( static_cast<const KeyType&>(key), size_t( key.Hashcode() ) ); }
+
+    /// Overloaded version of method \alib{containers::HashTable;Find(const KeyType&)const} which
+    /// accepts a key object that carries its pre-calculated hash code.
+    ///
+    /// @tparam THashedKey The type of the key object. Has to satisfy the concept
+    ///                    \alib{containers;IsHashedKey}.
+    /// @param  key        The key to search for.
+    /// @return An iterator pointing to the first element found with equal <em>key-portion</em>,
+    ///         respectively, one being equal to #end, if no element was found with \p{key}.
+    template<typename THashedKey>
+    requires IsHashedKey<THashedKey, KeyType, THash>
+    ConstIterator   Find( const THashedKey& key )                                              const
+    { return Find( static_cast<const KeyType&>(key), size_t( key.Hashcode() ) ); }
+
     /// Tests if an element with given \p{key} is stored in this container.
     /// @param  key   The key to search for.
     /// @return \c true if this hash table contains at least one element with given
@@ -1695,6 +1752,22 @@ class HashTable : protected detail::HashTableBase<TAllocator,TValueDescriptor,TH
                 != nullptr;
     }
 
+    /// Overloaded version of method \alib{containers::HashTable;Contains(const KeyType&)const}
+    /// which accepts a key object that carries its pre-calculated hash code.
+    ///
+    /// @tparam THashedKey The type of the key object. Has to satisfy the concept
+    ///                    \alib{containers;IsHashedKey}.
+    /// @param  key        The key to search for.
+    /// @return \c true if this hash table contains at least one element with given
+    ///         <em>key-portion</em> \p{key}, \c false otherwise.
+    template<typename THashedKey>
+    requires IsHashedKey<THashedKey, KeyType, THash>
+    bool            Contains( const THashedKey& key )                                 const {DCSSHRD
+        auto hashCode= size_t( key.Hashcode() );
+        return  base::findElement( hashCode % base::bucketCount,
+                                   static_cast<const KeyType&>(key), hashCode ) != nullptr;
+    }
+
     /// Searches a key and returns a pair of iterators. The first is pointing to the first
     /// element of the range, the second is pointing to the first element past the range.
     ///
@@ -1478,6 +1478,7 @@ class StringTree : protected detail::StringTreeBase<TAllocator,T,TNodeHandler,TR
 
             baseCursor::node->children.pushEnd( child );
             ++baseCursor::node->qtyChildren;
+            ++baseCursor::tree->structureStamp;
             return TCursor( child, baseCursor::tree );
         }
 
@@ -1505,6 +1506,7 @@ class StringTree : protected detail::StringTreeBase<TAllocator,T,TNodeHandler,TR
             handle.Value().remove();
 
             --baseCursor::node->qtyChildren;
+            ++baseCursor::tree->structureStamp;
             return true;
         }
 
@@ -1713,6 +1715,7 @@ class StringTree : protected detail::StringTreeBase<TAllocator,T,TNodeHandler,TR
         // re-initialize root node
         basetree::root.root.children.reset();
         basetree::root.root.qtyChildren= 0;
+        ++basetree::structureStamp;
     }
 
     /// Clears all nodes and values. The use of this method is more efficient than deleting the
@@ -1736,6 +1739,7 @@ class StringTree : protected detail::StringTreeBase<TAllocator,T,TNodeHandler,TR
         basetree::nodeTable.Reset();
         basetree::root.root.children.reset();
         basetree::root.root.qtyChildren= 0;
+        ++basetree::structureStamp;
     }
 
     /// Counts the number of currently allocated but unused (not contained) element nodes
@@ -1764,6 +1768,14 @@ class StringTree : protected detail::StringTreeBase<TAllocator,T,TNodeHandler,TR
     /// @return \c true if this tree is empty, \c false otherwise.
     bool        IsEmpty()                          const { return basetree::nodeTable.Size() == 0; }
 
+    /// Returns a counter that is increased with each insertion and deletion of nodes.
+    /// Changes of node values are not reflected.<br>
+    /// This is used by class \alib{containers;StringTreeIterator::SortCache} to detect outdated
+    /// sort indices.
+    ///
+    /// @return The number of structural changes performed on this tree.
+    uinteger    StructureStamp()                        const { return basetree::structureStamp; }
+
     /// Invokes \alib{containers;HashTable::ReserveRecyclables} on the internal hashtable.
     ///
     /// @see Chapter \ref alib_contmono_containers_recycling_reserving of the Programmer's
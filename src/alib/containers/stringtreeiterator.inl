@@ -86,10 +86,32 @@ class StringTreeIterator {
                                                        typename StringTreeType::CursorHandle,
                                                        typename StringTreeType::ConstCursorHandle>;
 
+    /// A shared vector of cursor handles, used to store sorted children.
+    using                 sharedHandles= SharedVal<std::vector<cursorHandle>>;
+
 
   //############################################# Sorter ###########################################
   public:
 
+    /// A precomputed sort key which optionally is provided by method
+    /// \alib{containers::StringTreeIterator;Sorter::GetSortKey}.
+    /// Keys are compared lexicographically, first by field #Primary, then by field #Secondary.
+    struct SortKey {
+        uint64_t    Primary;    ///< The primary key.
+        uint64_t    Secondary;  ///< The secondary key, compared if the primary keys are equal.
+
+        /// Inverts both keys. Used to implement descending sort orders.
+        void Invert()                                   { Primary= ~Primary; Secondary= ~Secondary; }
+
+        /// Comparison operator.
+        /// @param rhs The key to compare this key to.
+        /// @return \c true if this key is smaller than \p{rhs}, \c false otherwise.
+        bool operator<( const SortKey& rhs )                                                 const {
+            return     Primary <  rhs.Primary
+                   || (Primary == rhs.Primary && Secondary < rhs.Secondary);
+        }
+    };
+
     /// Abstract base type to be used to implement custom sorting.
     /// One simple built-in descendant is provided with struct #NameSorter.
     struct Sorter {
@@ -103,6 +125,23 @@ class StringTreeIterator {
         ///         otherwise.
         virtual bool  Compare( const StringTreeType::ConstCursor& lhs,
                                const StringTreeType::ConstCursor& rhs)                           =0;
+
+        /// May be overridden to provide a key which is calculated once per node before the
+        /// children of a node are sorted. Nodes are then ordered by their keys, and method
+        /// #Compare is only invoked for nodes with equal keys.
+        /// Therefore, the order of the keys has to be consistent with method #Compare:
+        /// if the key of one node is smaller than the key of another, #Compare has to
+        /// return \c true for these nodes.
+        ///
+        /// This default implementation returns \c false, which disables the use of keys.
+        /// Whether keys are used is decided with the first child of a node.
+        /// @param node  The node to create a key for.
+        /// @param key   The key to set.
+        /// @return \c true if \p{key} was set, \c false otherwise.
+        virtual bool  GetSortKey( const StringTreeType::ConstCursor& node, SortKey& key ) {
+            (void) node; (void) key;
+            return false;
+        }
     };
 
     /// Built-in descendant of struct #Sorter used to perform simple sorting based on
@@ -128,6 +167,171 @@ class StringTreeIterator {
             return Descending ? compResult > 0
                               : compResult < 0;
         }
+
+        /// Overrides the parent's method to provide the key returned by #NameKey.
+        /// With case-insensitive sorting of 2- or 4-byte characters, no key is provided, because
+        /// the case conversion of non-ASCII characters cannot be mapped to a key.
+        /// @param node  The node to create a key for.
+        /// @param key   The key to set.
+        /// @return \c true if a key was set, \c false otherwise.
+        bool GetSortKey( const StringTreeType::ConstCursor& node, SortKey& key )         override {
+            if constexpr ( sizeof(CharacterType) > 1 )
+                if( !CaseSensitive )
+                    return false;
+            key= NameKey( node.Name(), CaseSensitive );
+            if( Descending )
+                key.Invert();
+            return true;
+        }
+
+        /// Packs the leading characters of the given \p{name} into a sort key.
+        /// With 1-byte characters, these are 16 characters, with 2-byte characters 8, and
+        /// with 4-byte characters 4.
+        /// If \p{caseSensitive} is \c false, ASCII letters are folded in the same direction as
+        /// function \alib{characters;CompareIgnoreCase} does, and a first non-ASCII character is
+        /// replaced by a maximum value which ends the key.
+        ///
+        /// With case-sensitive comparison, the order of the keys is consistent with the order
+        /// of the names. With case-insensitive comparison, this is only true for 1-byte
+        /// characters: Functions \c towupper and \c towlower, which are used with wider
+        /// characters, map some non-ASCII characters to ASCII letters, for example,
+        /// <c>U+017F</c> to \c 'S' or <c>U+0130</c> to \c 'i'.
+        /// Therefore, method #GetSortKey does not use this method in that case.
+        /// @param name           The name to create a key for.
+        /// @param caseSensitive  Denotes whether the key is used with case-sensitive comparison.
+        /// @return The key.
+        static SortKey NameKey( const strings::TString<CharacterType>& name, bool caseSensitive ) {
+            using TUChar= std::make_unsigned_t<CharacterType>;
+            constexpr int      charBits    = int( bitsof(CharacterType) );
+            constexpr int      charsPerWord= 64 / charBits;
+            constexpr uint64_t maxChar     = (uint64_t(1) << charBits) - 1;
+            static const CharacterType underscoreA[2]= { '_', 'a' };
+            static const bool foldToLower= characters::CompareIgnoreCase<CharacterType>(
+                                             &underscoreA[0], &underscoreA[1], 1 ) < 0;
+
+            SortKey key{0, 0};
+            integer qty= (std::min)( name.Length(), integer( 2 * charsPerWord ) );
+            for( integer i= 0; i < qty; ++i ) {
+                uint64_t c   = uint64_t( TUChar( name.template CharAt<NC>(i) ) );
+                bool     stop= false;
+                if( !caseSensitive ) {
+                    if( c >= 0x80 ) {
+                        c   = maxChar;
+                        stop= true;
+                    }
+                    else if( foldToLower && c >= 'A' && c <= 'Z' )   c+= 'a' - 'A';
+                    else if(!foldToLower && c >= 'a' && c <= 'z' )   c-= 'a' - 'A';
+                }
+                int shift= 64 - charBits * ( int(i % charsPerWord) + 1 );
+                ( i < charsPerWord ? key.Primary : key.Secondary ) |= c << shift;
+                if( stop )
+                    break;
+            }
+            return key;
+        }
+    };
+
+    /// An entry of the vector of children that is sorted with the recursion into a node.
+    struct SortEntry {
+        SortKey         key;     ///< The key of the child. Zeroed if the sorter provides no keys.
+        cursorHandle    handle;  ///< The child.
+    };
+
+    /// The comparison function object used to sort vectors of #SortEntry elements.
+    /// Compares the keys first and invokes method
+    /// \alib{containers::StringTreeIterator;Sorter::Compare} only with equal keys.
+    struct EntryCompare {
+        TStringTree*    tree;    ///< The tree that the sorted nodes belong to.
+        Sorter*         sorter;  ///< The sorter.
+
+        /// Function call operator.
+        /// @param lhs  The left-hand side entry.
+        /// @param rhs  The right-hand side entry.
+        /// @return \c true if \p{lhs} is 'smaller' than \p{rhs}, and \c false otherwise.
+        bool operator()( const SortEntry& lhs, const SortEntry& rhs )                        const {
+            if( lhs.key < rhs.key )  return true;
+            if( rhs.key < lhs.key )  return false;
+            return sorter->Compare( tree->ImportCursor(lhs.handle),
+                                    tree->ImportCursor(rhs.handle) );
+        }
+    };
+
+  //########################################### SortCache ##########################################
+    /// Stores the sorted children of nodes to avoid sorting them again with subsequent
+    /// iterations. An instance is attached to one or more iterators with method
+    /// #SetSortCache. The cache is keyed by the node and the sorter instance used.
+    ///
+    /// All entries are removed with the first recursion after an insertion or deletion of nodes
+    /// in the tree, which is detected with \alib{containers;StringTree::StructureStamp}.
+    /// This way, the cache does not keep entries of deleted nodes.
+    /// Changes of node values or of the settings of a sorter are not detected.
+    /// If sorters depend on such data, method #Clear has to be invoked after a change.
+    ///
+    /// Derived types may override the protected method #sort, for example, to sort large sets
+    /// of siblings in parallel. A corresponding type is given with
+    /// \alib{threadmodel;ParallelSortCache}.
+    ///
+    /// This type is not thread-safe. One cache must not be used by iterators running in
+    /// parallel.
+    class SortCache {
+        friend class StringTreeIterator;
+
+      protected:
+        /// The key of the cache entries.
+        struct CacheKey {
+            uinteger        node;    ///< The node whose children are sorted.
+            const Sorter*   sorter;  ///< The sorter used.
+
+            /// Comparison operator.
+            /// @param rhs The key to compare this key to.
+            /// @return \c true if both keys are equal, \c false otherwise.
+            bool operator==( const CacheKey& rhs )                                           const
+            { return node == rhs.node && sorter == rhs.sorter; }
+
+            /// Hash functor for this type.
+            struct Hash {
+                /// Calculates a hash code.
+                /// @param key The key to hash.
+                /// @return The hash code.
+                std::size_t operator()( const CacheKey& key )                                const {
+                    return   std::size_t( key.node ) * 31
+                           ^ std::size_t( reinterpret_cast<uinteger>(key.sorter) ) >> 4;
+                }
+            };
+        };
+
+        /// The cached vectors of sorted children. These are shared with the iterators that
+        /// visit the children.
+        HashMap<lang::HeapAllocator, CacheKey, sharedHandles, typename CacheKey::Hash>  entries;
+
+        /// The tree that the entries refer to.
+        const TStringTree*  tree                                                           =nullptr;
+
+        /// The structure stamp of the #tree when the entries were created.
+        uinteger            stamp                                                                =0;
+
+        /// Sorts the given range of entries. Invoked with each recursion into a node,
+        /// for which no valid entry exists.
+        /// This default implementation invokes <c>std::sort</c>.
+        /// @param first   The start of the range to sort.
+        /// @param last    The end of the range to sort.
+        /// @param compare The comparison function object.
+        virtual void sort( SortEntry* first, SortEntry* last, const EntryCompare& compare )
+        { std::sort( first, last, compare ); }
+
+      public:
+        /// Defaulted default constructor.
+        SortCache()                                                                        =default;
+
+        /// Virtual destructor.
+        virtual ~SortCache()                                                               =default;
+
+        /// Removes all entries.
+        void     Clear()                                           { entries.Clear(); tree= nullptr; }
+
+        /// Returns the number of nodes whose sorted children are stored.
+        /// @return The number of entries.
+        integer  Size()                                              const { return entries.Size(); }
     };
 
   //#################################### Inner type RecursionData ##################################
@@ -158,8 +362,10 @@ class StringTreeIterator {
         /// equals \c true.
         cursorHandle              unsortedParent;
 
-        /// A pointer to a dynamically allocated vector of children used with sorting.
-        std::vector<cursorHandle> sortedChildren;
+        /// The sorted children of the actual node. Either shared with an entry of a
+        /// #SortCache, or owned by this object and reused with the next sorted recursion.
+        /// \e Nulled with unsorted iteration.
+        sharedHandles             sortedChildren;
 
         /// The (optional) sorter used with the actual node.
         /// Unless changed by the caller, this is copied with every recursion step.
@@ -217,6 +423,12 @@ class StringTreeIterator {
     /// A pointer to a user-defined comparison object used with the next iteration.
     Sorter*                             nextSorter                                         =nullptr;
 
+    /// The optional cache of sorted children. Set with #SetSortCache.
+    SortCache*                          sortCache                                          =nullptr;
+
+    /// A vector reused to sort the children of nodes.
+    std::vector<SortEntry>              sortEntries;
+
 //###################################### Constructor/Destructor ####################################
   public:
     /// Default constructor.
@@ -276,7 +488,7 @@ class StringTreeIterator {
             RecursionData& rd= stack.emplace_back();
             node= startNode.Export();
             rd.actChild.sortedIdx= 0;
-            rd.sortedChildren.emplace_back(node);
+            rd.sortedChildren= sharedHandles( std::vector<cursorHandle>( 1, node ) );
             actDepth= 0;
             return;
         }
@@ -322,6 +534,12 @@ class StringTreeIterator {
     ///                of nodes.
     void        SetSorting(Sorter *sorter)                                   { nextSorter= sorter; }
 
+    /// Sets a cache of sorted children which is used with sorted recursions.
+    /// The given \p{cache} may be shared between iterators that work on the same tree and are
+    /// not used in parallel.
+    /// @param cache  The cache to use. If \c nullptr, the children are sorted with each recursion.
+    void        SetSortCache(SortCache* cache)                                 { sortCache= cache; }
+
     /// Iterates to the first child of the current node. If no such child exists,
     /// to the next sibling node. If also no sibling exists, iteration continues
     /// with the next available node of a previous recursion level.
@@ -439,6 +657,37 @@ class StringTreeIterator {
 
   //################################## StringTreeIterator Internals ################################
   protected:
+    /// Sorts the children of the actual node.
+    /// @param sorter  The sorter to use.
+    /// @param result  The vector to receive the sorted children.
+    /// @param cache   The cache whose method \alib{containers::StringTreeIterator;SortCache::sort}
+    ///                is used. If \c nullptr, <c>std::sort</c> is used.
+    void  sortChildren( Sorter* sorter, std::vector<cursorHandle>& result, SortCache* cache ) {
+        auto cursor= tree->ImportCursor(node);
+        sortEntries.clear();
+        sortEntries.reserve( size_t( cursor.CountChildren() ) );
+        cursor.GoToFirstChild();
+        SortKey probe;
+        bool    useKeys= sorter->GetSortKey( cursor, probe );
+        for( ; cursor.IsValid() ; cursor.GoToNextSibling() ) {
+            sortEntries.push_back( SortEntry{ SortKey{0, 0}, cursor.Export() } );
+            SortEntry& entry= sortEntries.back();
+            if( useKeys )
+                sorter->GetSortKey( cursor, entry.key );
+        }
+
+        EntryCompare compare{ tree, sorter };
+        if( cache )
+            cache->sort( sortEntries.data(), sortEntries.data() + sortEntries.size(), compare );
+        else
+            std::sort( sortEntries.begin(), sortEntries.end(), compare );
+
+        result.clear();
+        result.reserve( sortEntries.size() );
+        for( auto& entry : sortEntries )
+            result.emplace_back( entry.handle );
+    }
+
     /// Sets this iterator to point to the first child of the actual node.
     /// If sorting is enabled, copies all children from the map to a vector and sorts
     /// them there.
@@ -448,38 +697,40 @@ class StringTreeIterator {
             stack.emplace_back();
 
         auto& rd=  stack[size_t(actDepth)];
-
-        auto cursor= tree->ImportCursor(node);
         rd.sorter= nextSorter;
 
         // no sorting: set link to node's child hook
         if (!rd.sorter) {
+            rd.sortedChildren= nullptr;
             rd.unsortedParent= tree->ImportCursor(node).FirstChild().Export();
             node= (rd.actChild.unsortedHandle= rd.unsortedParent);
         } else {
 
-            // sorting: copy children to a sortable vector
-            rd.sortedChildren.clear();
-            rd.sortedChildren.reserve( size_t( cursor.CountChildren() ) );
-            cursor.GoToFirstChild();
-            while( cursor.IsValid() ) {
-                rd.sortedChildren.emplace_back( cursor.Export() );
-                cursor.GoToNextSibling();
+            // sorting: use the cache or sort the children
+            if( sortCache ) {
+                if( sortCache->tree != tree || sortCache->stamp != tree->StructureStamp() ) {
+                    sortCache->entries.Clear();
+                    sortCache->tree = tree;
+                    sortCache->stamp= tree->StructureStamp();
+                }
+                auto  result= sortCache->entries.EmplaceIfNotExistent(
+                                  typename SortCache::CacheKey{ node.value, rd.sorter } );
+                auto& children= result.first.Mapped();
+                if( result.second ) {
+                    children= sharedHandles( std::vector<cursorHandle>() );
+                    sortChildren( rd.sorter, *children, sortCache );
+                }
+                rd.sortedChildren= children;
+            } else {
+                // reuse the vector, unless it is shared with a cache
+                if( !rd.sortedChildren.Unique() )
+                    rd.sortedChildren= sharedHandles( std::vector<cursorHandle>() );
+                sortChildren( rd.sorter, *rd.sortedChildren, nullptr );
             }
 
-            // sort
-            std::sort( rd.sortedChildren.begin(), rd.sortedChildren.end(),
-                       [this,&rd]( cursorHandle lhs,
-                                   cursorHandle rhs  )
-                       {
-                            return rd.sorter->Compare( tree->ImportCursor(lhs),
-                                                       tree->ImportCursor(rhs) );
-                       }
-                      );
-
             // set to first child
             rd.actChild.sortedIdx= 0;
-            node= rd.sortedChildren[0];
+            node= (*rd.sortedChildren)[0];
         }
 
         // add path information
@@ -525,10 +776,10 @@ class StringTreeIterator {
             if( skipMode != 2 ) {
                 // next sibling
                 RecursionData& rd= stack[ size_t(actDepth) ];
-                if( rd.sortedChildren.size() ) {
+                if( rd.sortedChildren != nullptr ) {
                     ++rd.actChild.sortedIdx;
-                    if( rd.actChild.sortedIdx < rd.sortedChildren.size() ) {
-                        node= rd.sortedChildren[rd.actChild.sortedIdx];
+                    if( rd.actChild.sortedIdx < rd.sortedChildren->size() ) {
+                        node= (*rd.sortedChildren)[rd.actChild.sortedIdx];
                         break;
                     }
                 } else {
@@ -67,8 +67,10 @@ void Bootstrap(TEnum element, TArgs &&... args)
            .New<typename detail::EnumRecordHook<
                 TEnum>::Node>(element, std::forward<TArgs>(args)...);
 
-    detail::setEnumRecord(typeid(TEnum), integer(element), &(*lastP)->record);
+    if( !records.isLazy )
+        detail::setEnumRecord(typeid(TEnum), integer(element), &(*lastP)->record);
     (*lastP)->next = nullptr;
+    records.generation.fetch_add( 1, std::memory_order_release );
 }
 
 
@@ -106,11 +108,13 @@ void Bootstrap(std::initializer_list<Initializer<TEnum> > definitions) {
                .New<typename detail::EnumRecordHook<
                     TEnum>::Node>(table[i].element, table[i].record);
 
-        detail::setEnumRecord(typeid(TEnum), integer(table[i].element), &(*lastP)->record);
+        if( !records.isLazy )
+            detail::setEnumRecord(typeid(TEnum), integer(table[i].element), &(*lastP)->record);
         lastP = &(*lastP)->next;
     }
 
     (*lastP) = nullptr;
+    records.generation.fetch_add( 1, std::memory_order_release );
 }
 
 /// Reads a list of enum data records from given string \p{input}.
@@ -155,7 +159,8 @@ void Bootstrap(const String &input,
         EnumRecordParser::Get(element->integral);
         element->record.Parse();
 
-        detail::setEnumRecord(typeid(TEnum), integer(element->integral), &element->record);
+        if( !records.isLazy )
+            detail::setEnumRecord(typeid(TEnum), integer(element->integral), &element->record);
 
         // next?
         lastP = &element->next;
@@ -165,6 +170,7 @@ void Bootstrap(const String &input,
     }
     EnumRecordParser::assertEndOfInput();
     (*lastP) = nullptr;
+    records.generation.fetch_add( 1, std::memory_order_release );
 }
 
 #include "ALib.Lang.CIMethods.H"
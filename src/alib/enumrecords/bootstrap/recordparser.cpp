@@ -220,6 +220,7 @@ void shutdown() {
     #if ALIB_MONOMEM && ALIB_CONTAINERS
     getInternalRecordMap().Reset();
     #endif
+    clearLazyEnumRecords();
 }
 
 } // namespace [alib::enumrecords::detail]
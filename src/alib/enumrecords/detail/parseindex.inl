@@ -0,0 +1,233 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of the module \alib_enumrecords of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib {  namespace enumrecords { namespace detail {
+
+//==================================================================================================
+/// A trie of names which may be abbreviated down to a minimum length.
+/// The type is used to speed up parsing names from a list of declarations, which otherwise
+/// needs a linear search: It finds the first matching name in the time needed to walk the
+/// characters of the input, independent of the number of names in the list.
+///
+/// Entries are identified by the order they were added with #Add. If more than one name matches,
+/// the lowest index is returned, which gives the same results as a linear search through
+/// the list of names.
+///
+/// This type is used by function \alib{enumrecords;Parse} (through type
+/// \alib{enumrecords::detail;EnumParseIndex}) and by class \alib{cli;CommandLine}.
+/// Abbreviations of "camel humps", as accepted by \alib{strings::util;Token::Match}, are not
+/// supported. Lists of tokens are therefore still searched linearly.
+///
+/// @tparam TChar        The character type of the names.
+/// @tparam TSensitivity The letter case sensitivity of the comparison.
+//==================================================================================================
+template<typename TChar, lang::Case TSensitivity>
+class PrefixIndex
+{
+  protected:
+    /// A node of the trie. The children of a node are stored as a linked list of siblings.
+    struct Node
+    {
+        TChar    c;             ///< The (case-folded) character that leads to this node.
+        int32_t  firstChild;    ///< The index of the first child node, \c -1 if none.
+        int32_t  nextSibling;   ///< The index of the next sibling node, \c -1 if none.
+        int32_t  entry;         ///< The lowest entry that is matched when this node is reached.
+    };
+
+    /// The nodes of the trie. The first node is the root node.
+    std::vector<Node>   nodes;
+
+    /// The number of entries added.
+    int32_t             qtyEntries;
+
+    /// Folds the given character to upper case, if \p{TSensitivity} equals \b Case::Ignore.
+    /// @param c The character to fold.
+    /// @return The character to use with the trie.
+    static TChar    fold( TChar c ) {
+        if constexpr ( TSensitivity == lang::Case::Ignore )
+            return characters::ToUpper( c );
+        else
+            return c;
+    }
+
+    /// Searches the child of \p{node} that is reached with character \p{c}.
+    /// @param node The index of the parent node.
+    /// @param c    The (case-folded) character.
+    /// @return The index of the child or \c -1 if no such child exists.
+    int32_t         child( int32_t node, TChar c )                                         const {
+        int32_t result= nodes[size_t(node)].firstChild;
+        while( result >= 0 && nodes[size_t(result)].c != c )
+            result= nodes[size_t(result)].nextSibling;
+        return result;
+    }
+
+  public:
+    /// Constructor.
+    PrefixIndex()                                                             { Reset(); }
+
+    /// Removes all entries.
+    void            Reset() {
+        nodes.clear();
+        nodes.push_back( Node{ TChar(0), -1, -1, -1 } );
+        qtyEntries= 0;
+    }
+
+    /// @return The number of entries added.
+    integer         Size()                                       const { return qtyEntries; }
+
+    /// Adds an entry. The index of the entry is the number of entries added before.
+    ///
+    /// @param name      The name of the entry.
+    /// @param minLength The minimum number of characters of \p{name} that have to be matched.
+    ///                  Entries with a minimum length greater than the length of \p{name} are
+    ///                  counted but never found.
+    void            Add( const strings::TString<TChar>& name, integer minLength ) {
+        int32_t entry= qtyEntries++;
+        if( minLength > name.Length() )
+            return;
+        if( minLength <= 0 && nodes[0].entry < 0 )
+            nodes[0].entry= entry;
+
+        int32_t node= 0;
+        for( integer depth= 1 ; depth <= name.Length() ; ++depth ) {
+            TChar   c   = fold( name.template CharAt<NC>( depth - 1 ) );
+            int32_t next= child( node, c );
+            if( next < 0 ) {
+                next= int32_t( nodes.size() );
+                nodes.push_back( Node{ c, -1, nodes[size_t(node)].firstChild, -1 } );
+                nodes[size_t(node)].firstChild= next;
+            }
+            node= next;
+            if( depth >= minLength && nodes[size_t(node)].entry < 0 )
+                nodes[size_t(node)].entry= entry;
+    }   }
+
+    /// Searches the first entry whose name shares a common prefix with \p{input} that is at
+    /// least as long as the entry's minimum length. This corresponds to method
+    /// \alib{strings;TSubstring::ConsumePartOf}.
+    ///
+    /// @param input The input string, which may be longer than the name found.
+    /// @return The index of the entry found, \c -1 if no entry matches.
+    integer         FindPartOf( const strings::TString<TChar>& input )                     const {
+        int32_t result= nodes[0].entry;
+        int32_t node  = 0;
+        for( integer i= 0 ; i < input.Length() ; ++i ) {
+            if( (node= child( node, fold( input.template CharAt<NC>( i ) ) )) < 0 )
+                break;
+            int32_t entry= nodes[size_t(node)].entry;
+            if( entry >= 0 && ( result < 0 || entry < result ) )
+                result= entry;
+        }
+        return result;
+    }
+
+    /// Searches the first entry whose name starts with \p{input}, while the length of
+    /// \p{input} is not smaller than the entry's minimum length.
+    ///
+    /// @param input The abbreviated name to search.
+    /// @return The index of the entry found, \c -1 if no entry matches.
+    integer         FindAbbreviation( const strings::TString<TChar>& input )               const {
+        int32_t node= 0;
+        for( integer i= 0 ; i < input.Length() && node >= 0 ; ++i )
+            node= child( node, fold( input.template CharAt<NC>( i ) ) );
+
+        // the entry stored with the node is the lowest entry matched at this or a lower depth.
+        // Because all entries that pass a node share its prefix, this is the result.
+        return node >= 0 ? nodes[size_t(node)].entry : -1;
+    }
+}; // class PrefixIndex
+
+//==================================================================================================
+/// The lookup index used by function \alib{enumrecords;Parse}. One instance is created
+/// per combination of template parameters, when \b Parse is invoked the first time.
+///
+/// The index is rebuilt if records have been added to \p{TEnum} since the index was built.
+/// As with \alib{enumrecords::detail;EnumRecordTable}, this is detected without locking by
+/// comparing the \alib{enumrecords::detail;EnumRecordHook::Generation;generation} of the
+/// records, and the index is rebuilt while a mutex is acquired.
+///
+/// @tparam TEnum        The enumeration type equipped with enum records of type
+///                      \alib{enumrecords;ERSerializable}.
+/// @tparam TChar        The character type of the input.
+/// @tparam TSensitivity The letter case sensitivity of the comparison.
+//==================================================================================================
+template<typename TEnum, typename TChar, lang::Case TSensitivity>
+class EnumParseIndex
+{
+  protected:
+    /// Shortcut to the node type of the list of records.
+    using RecordNode= typename EnumRecordHook<TEnum>::Node;
+
+    /// The trie of record names.
+    PrefixIndex<TChar, TSensitivity>    index;
+
+    /// The records in the order of their definition.
+    std::vector<const RecordNode*>      records;
+
+    /// The \alib{enumrecords::detail;EnumRecordHook::Generation;generation} of the records
+    /// that the index was built from.
+    std::atomic<unsigned>               builtGeneration                                        = 0;
+
+    #if !ALIB_SINGLE_THREADED
+    /// Protects rebuilding the index.
+    std::mutex                          lock;
+    #endif
+
+    /// Builds the index from scratch.
+    void build() {
+        unsigned generation= EnumRecordHook<TEnum>::GetSingleton().Generation();
+        index.Reset();
+        records.clear();
+        for( auto* node= EnumRecordHook<TEnum>::GetSingleton().First(); node; node= node->next ) {
+            const auto& name  = node->record.EnumElementName;
+            integer minLength = node->record.MinimumRecognitionLength;
+            if( minLength <= 0 )
+                minLength= name.Length();
+            if( minLength == 0 )
+                minLength= 1;       // empty names are never matched
+            index.Add( name, minLength );
+            records.push_back( node );
+        }
+        builtGeneration.store( generation, std::memory_order_release );
+    }
+
+    /// Constructor. Builds the index.
+    EnumParseIndex()                                                              { build(); }
+
+  public:
+    /// Returns the index for the template parameters. If records have been added since the
+    /// last invocation, the index is rebuilt.
+    /// @return The singleton of this type.
+    static EnumParseIndex&  Get() {
+        static EnumParseIndex singleton;
+        auto& hook= EnumRecordHook<TEnum>::GetSingleton();
+        if( singleton.builtGeneration.load( std::memory_order_acquire ) != hook.Generation() ) {
+            #if !ALIB_SINGLE_THREADED
+            std::lock_guard<std::mutex> guard( singleton.lock );
+            #endif
+            if( singleton.builtGeneration.load( std::memory_order_relaxed ) != hook.Generation() )
+                singleton.build();
+        }
+        return singleton;
+    }
+
+    /// Searches the first record whose name is matched by the start of \p{input}, as
+    /// function \alib{enumrecords;Parse} specifies.
+    /// @param      input     The input string.
+    /// @param[out] matchLen  Receives the number of characters matched.
+    /// @return The node of the record found, \c nullptr if no record matches.
+    const RecordNode* Find( const strings::TString<TChar>& input, integer& matchLen )        const {
+        integer idx= index.FindPartOf( input );
+        if( idx < 0 )
+            return nullptr;
+        const RecordNode* node= records[size_t(idx)];
+        matchLen= input.IndexOfFirstDifference( node->record.EnumElementName, TSensitivity );
+        return node;
+    }
+}; // class EnumParseIndex
+
+}}} // namespace [alib::enumrecords::detail]
@@ -0,0 +1,254 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of the module \alib_enumrecords of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib {  namespace enumrecords { namespace detail {
+
+//==================================================================================================
+/// A lookup table of the enum records of type \p{TEnum}, used to write enum elements to
+/// \alib{strings;TAString;AStrings}. While function \alib{enumrecords;TryRecord} searches the
+/// central hash table of all enum records, which needs to hash and compare the run-time type
+/// information with each invocation, this type provides the records of a single enumeration type:
+/// - If the integral values of the records are contiguous (gaps of up to the number of records
+///   are tolerated), a dense array indexed by the integral value is used.
+/// - Otherwise, a table sorted by integral values is searched with a binary search.
+///
+/// For bitwise enumerations (see \alib{enumops;IsBitwise}), in addition a table of the records
+/// of single bits is created, which allows writing the names of the bits set in a value without
+/// testing each record. See method #AppendBitwise for details.
+///
+/// One instance is created per enumeration type, when #Get is invoked the first time.
+/// The table is rebuilt if records have been added to \p{TEnum} since the table was built,
+/// which is detected with \alib{enumrecords::detail;EnumRecordHook::Generation}.
+/// The first use of a table may happen from concurrent threads, for example, with records
+/// that are \alib{enumrecords::bootstrap;BootstrapLazy;loaded lazily}. Therefore, the
+/// generation is checked without locking, and only if it changed, the table is rebuilt while
+/// a mutex is acquired.
+///
+/// @tparam TEnum The enumeration type equipped with enum records.
+//==================================================================================================
+template<typename TEnum>
+requires alib::enumrecords::HasRecords<TEnum>
+class EnumRecordTable
+{
+  protected:
+    /// Shortcut to the node type of the list of records.
+    using Node     = typename EnumRecordHook<TEnum>::Node;
+
+    /// The enum's underlying integer type.
+    using TIntegral= typename EnumRecordHook<TEnum>::TIntegral;
+
+    /// The unsigned version of #TIntegral. (Type \c bool is mapped to \c uint8_t.)
+    using TUnsigned= typename std::conditional_t< std::same_as<TIntegral, bool>,
+                                                  std::type_identity<uint8_t>,
+                                                  std::make_unsigned<TIntegral>   >::type;
+
+    /// The enum's associated record type.
+    using TRecord  = typename EnumRecordHook<TEnum>::TRecord;
+
+    /// The records of the integral values <c>denseMin</c> to <c>denseMin + dense.size() - 1</c>.
+    /// Empty if the integral values are not contiguous.
+    std::vector<const TRecord*>                         dense;
+
+    /// The integral value of the first entry in #dense.
+    TIntegral                                           denseMin;
+
+    /// The records sorted by their integral value. Used if #dense is empty.
+    std::vector<std::pair<TIntegral, const TRecord*>>   sorted;
+
+    /// Bitwise enumerations: The first record of integral value \c 0.
+    const Node*                                         zeroRecord;
+
+    /// Bitwise enumerations: The records that represent more than one bit.
+    std::vector<const Node*>                            aggregates;
+
+    /// Bitwise enumerations: The first record of each single bit.
+    const TRecord*                                      singleBits[bitsof(TIntegral)];
+
+    /// Bitwise enumerations: \c true if all records of #aggregates are defined before the records
+    /// of single bits and the latter are defined in the order of their bits.
+    /// Only in this case, the names of the bits can be written in the order of their bits, while
+    /// otherwise the records need to be tested in the order of their definition.
+    bool                                                bitsOrdered;
+
+    /// The \alib{enumrecords::detail;EnumRecordHook::Generation;generation} of the records
+    /// that the table was built from.
+    std::atomic<unsigned>                               builtGeneration                        = 0;
+
+    #if !ALIB_SINGLE_THREADED
+    /// Protects rebuilding the table.
+    std::mutex                                          lock;
+    #endif
+
+    /// Builds the table from scratch.
+    void build() {
+        unsigned generation= EnumRecordHook<TEnum>::GetSingleton().Generation();
+        dense .clear();
+        sorted.clear();
+        aggregates.clear();
+        zeroRecord= nullptr;
+        std::fill( std::begin(singleBits), std::end(singleBits), nullptr );
+        bitsOrdered= true;
+        int lastBit= -1;
+
+        for( auto* node= EnumRecordHook<TEnum>::GetSingleton().First(); node; node= node->next ) {
+            sorted.emplace_back( node->integral, &node->record );
+
+            if constexpr ( enumops::IsBitwise<TEnum> ) {
+                int bitCount= lang::BitCount( node->integral );
+                if( bitCount == 0 ) {
+                    if( zeroRecord == nullptr )
+                        zeroRecord= node;
+                    continue;
+                }
+                if( bitCount > 1 ) {
+                    aggregates.push_back( node );
+                    if( lastBit >= 0 )
+                        bitsOrdered= false;
+                    continue;
+                }
+                int bit= lang::CTZ( node->integral );
+                if( singleBits[bit] == nullptr )
+                    singleBits[bit]= &node->record;
+                if( bit < lastBit )
+                    bitsOrdered= false;
+                lastBit= bit;
+        }   }
+
+        // sort by integral value. With duplicates, the first definition is used.
+        std::stable_sort( sorted.begin(), sorted.end(),
+                          []( const auto& lhs, const auto& rhs ) { return lhs.first < rhs.first; } );
+        sorted.erase( std::unique( sorted.begin(), sorted.end(),
+                                   []( const auto& lhs, const auto& rhs )
+                                   { return lhs.first == rhs.first; } ),
+                      sorted.end() );
+
+        // use a dense array if the range of integral values is small enough
+        if( !sorted.empty() ) {
+            uint64_t range= uint64_t( TUnsigned(   TUnsigned(sorted.back ().first)
+                                                 - TUnsigned(sorted.front().first) ) );
+            if( range < uint64_t( 2 * sorted.size() ) ) {
+                denseMin= sorted.front().first;
+                dense.resize( size_t(range) + 1, nullptr );
+                for( auto& entry : sorted )
+                    dense[size_t( TUnsigned( entry.first - denseMin ) )]= entry.second;
+                sorted.clear();
+                sorted.shrink_to_fit();
+        }   }
+
+        builtGeneration.store( generation, std::memory_order_release );
+    }
+
+    /// Constructor. Builds the table.
+    EnumRecordTable()                                                             { build(); }
+
+  public:
+    /// Returns the table of \p{TEnum}. If records have been added since the last invocation,
+    /// the table is rebuilt.
+    /// @return The singleton of this type.
+    static EnumRecordTable&  Get() {
+        static EnumRecordTable singleton;
+        auto& hook= EnumRecordHook<TEnum>::GetSingleton();
+        if( singleton.builtGeneration.load( std::memory_order_acquire ) != hook.Generation() ) {
+            #if !ALIB_SINGLE_THREADED
+            std::lock_guard<std::mutex> guard( singleton.lock );
+            #endif
+            if( singleton.builtGeneration.load( std::memory_order_relaxed ) != hook.Generation() )
+                singleton.build();
+        }
+        return singleton;
+    }
+
+    /// Returns the record of the given \p{element}. If more than one record is defined for
+    /// the element, the first one is returned, the same as with function
+    /// \alib{enumrecords;TryRecord}.
+    /// @param element The element to search the record for.
+    /// @return A pointer to the record of \p{element}, \c nullptr if no record is defined.
+    const TRecord*  Find( TEnum element )                                                    const {
+        TIntegral integral= TIntegral( element );
+        if( !dense.empty() ) {
+            size_t idx= size_t( TUnsigned( TUnsigned(integral) - TUnsigned(denseMin) ) );
+            return idx < dense.size() ? dense[idx] : nullptr;
+        }
+        auto it= std::lower_bound( sorted.begin(), sorted.end(), integral,
+                                   []( const auto& entry, TIntegral value )
+                                   { return entry.first < value; } );
+        return it != sorted.end() && it->first == integral ? it->second : nullptr;
+    }
+
+    /// Writes a comma-separated list of the names of the records covering the bits set
+    /// in \p{elements}. This implements the appendable of bitwise enumerations, as documented
+    /// with \alib{strings::APPENDABLES;AppendableTraits<TBitwiseEnum,TChar,TAllocator>}:
+    /// Records representing more than one bit are tested first. For the remaining bits,
+    /// the records of single bits are fetched from a table, iterating only over the bits set.
+    ///
+    /// If the records of single bits are not defined in the order of their bits, or if
+    /// aggregations are defined after single bits, then all records are tested in the order of
+    /// their definition.
+    ///
+    /// @tparam TChar      The character type of the target \b %AString.
+    /// @tparam TAllocator The allocator type of the target \b %AString.
+    /// @param  target     The \b AString that \p{elements} is to be appended to.
+    /// @param  elements   The bits to write.
+    /// @return The bits that were covered by the names written.
+    template<typename TChar, typename TAllocator>
+    requires enumops::IsBitwise<TEnum>
+    TEnum   AppendBitwise( strings::TAString<TChar,TAllocator>& target, TEnum elements )     const {
+        TUnsigned bits= TUnsigned( elements );
+        if( bits == 0 ) {
+            if( zeroRecord != nullptr )
+                target << zeroRecord->record.EnumElementName;
+            return elements;
+        }
+
+        integer   len    = target.Length();
+        TUnsigned covered= 0;
+        if( bitsOrdered ) {
+            // aggregations
+            for( auto* node : aggregates ) {
+                TUnsigned nodeBits= TUnsigned( node->integral );
+                if( (bits & nodeBits) == nodeBits && (covered & nodeBits) != nodeBits ) {
+                    covered|= nodeBits;
+                    target << node->record.EnumElementName << ',';
+            }   }
+
+            // single bits
+            for( TUnsigned remaining= bits & TUnsigned(~covered) ; remaining != 0 ;
+                 remaining&= TUnsigned( remaining - 1 ) ) {
+                int bit= lang::CTZ( remaining );
+                if( singleBits[bit] != nullptr ) {
+                    covered|= TUnsigned( TUnsigned(1) << bit );
+                    target << singleBits[bit]->EnumElementName << ',';
+            }   }
+        }
+        else
+            for( auto* node= EnumRecordHook<TEnum>::GetSingleton().First(); node; node= node->next ) {
+                TUnsigned nodeBits= TUnsigned( node->integral );
+                if(    nodeBits != 0
+                    && (bits    & nodeBits) == nodeBits
+                    && (covered & nodeBits) != nodeBits ) {
+                    covered|= nodeBits;
+                    target << node->record.EnumElementName << ',';
+            }   }
+
+        // remove the last comma
+        if( target.Length() != len )
+            target.DeleteEnd( 1 );
+        return TEnum( covered );
+    }
+}; // class EnumRecordTable
+
+/// Searches the record of an element of an enumeration type whose records are loaded lazily.
+/// A pointer to this function is registered with #setLazyEnumRecords.
+/// @tparam TEnum    The enumeration type.
+/// @param  integral The integral value of the element.
+/// @return A pointer to the record, \c nullptr if not found.
+template<typename TEnum>
+requires alib::enumrecords::HasRecords<TEnum>
+const void* findLazyRecord( integer integral )
+{ return EnumRecordTable<TEnum>::Get().Find( TEnum( integral ) ); }
+
+}}} // namespace [alib::enumrecords::detail]
@@ -57,6 +57,19 @@ namespace {
                         EnumRecordKey::Hash,
                         EnumRecordKey::EqualTo       >  ENUM_RECORD_MAP;
 #endif
+
+    // The functions to search the records of lazily loaded types. The element of the key is 0.
+    using LazyRecordFinder= const void* (*)(integer);
+#if ALIB_MONOMEM && ALIB_CONTAINERS
+    HashMap           < MonoAllocator,
+                        EnumRecordKey, LazyRecordFinder,
+                        EnumRecordKey::Hash,
+                        EnumRecordKey::EqualTo       >  LAZY_RECORD_FINDERS( monomem::GLOBAL_ALLOCATOR );
+#else
+    std::unordered_map< EnumRecordKey, LazyRecordFinder,
+                        EnumRecordKey::Hash,
+                        EnumRecordKey::EqualTo       >  LAZY_RECORD_FINDERS;
+#endif
 }
 
 void  setEnumRecord( const std::type_info& rtti, integer elementValue, const void* record ) {
@@ -77,7 +90,33 @@ const void* getEnumRecord( const std::type_info& rtti, integer elementValue ) {
     if ( it != ENUM_RECORD_MAP.end() )
         return it->second;
 
-    return nullptr;
+    // lazily loaded type?
+#if ALIB_MONOMEM && ALIB_CONTAINERS
+    if( LAZY_RECORD_FINDERS.IsEmpty() )
+        return nullptr;
+    auto lazyIt= LAZY_RECORD_FINDERS.Find( EnumRecordKey( rtti, 0 ) );
+#else
+    if( LAZY_RECORD_FINDERS.empty() )
+        return nullptr;
+    auto lazyIt= LAZY_RECORD_FINDERS.find( EnumRecordKey( rtti, 0 ) );
+#endif
+    return lazyIt != LAZY_RECORD_FINDERS.end() ? lazyIt->second( elementValue ) : nullptr;
+}
+
+void setLazyEnumRecords( const std::type_info& rtti, const void* (*finder)(integer) ) {
+    #if ALIB_MONOMEM && ALIB_CONTAINERS
+        LAZY_RECORD_FINDERS.InsertOrAssign( EnumRecordKey( rtti, 0 ), finder );
+    #else
+        LAZY_RECORD_FINDERS.insert_or_assign( EnumRecordKey( rtti, 0 ), finder );
+    #endif
+}
+
+void clearLazyEnumRecords() {
+    #if ALIB_MONOMEM && ALIB_CONTAINERS
+        LAZY_RECORD_FINDERS.Reset();
+    #else
+        LAZY_RECORD_FINDERS.clear();
+    #endif
 }
 
 #if ALIB_MONOMEM && ALIB_CONTAINERS
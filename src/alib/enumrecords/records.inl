@@ -80,6 +80,25 @@ void        setEnumRecord( const std::type_info& rtti, integer integral, const v
 ALIB_DLL
 const void* getEnumRecord( const std::type_info& rtti, integer integral );
 
+//==================================================================================================
+/// Registers a function that searches the records of enum type \p{rtti}, whose records are
+/// loaded lazily. Function #getEnumRecord invokes this function, if a record is not found in
+/// the central hash map. This way, lazily loaded records do not need to be inserted into the
+/// hash map when they are loaded after bootstrapping, when concurrent threads might be
+/// running.
+///
+/// \see Function \alib{enumrecords::bootstrap;BootstrapLazy}.
+/// @param rtti   The enumeration type.
+/// @param finder The function that returns the record of an integral value.
+//==================================================================================================
+ALIB_DLL
+void        setLazyEnumRecords( const std::type_info& rtti, const void* (*finder)(integer) );
+
+/// Removes the functions registered with #setLazyEnumRecords. Invoked with the shutdown of
+/// module \alib_enumrecords_nl.
+ALIB_DLL
+void        clearLazyEnumRecords();
+
 
 //==================================================================================================
 /// This is the internal singleton that provides a link to the first
@@ -134,8 +153,41 @@ struct EnumRecordHook :  Singleton<EnumRecordHook<TEnum>>
     };
 
     /// The hook to the first record defined.
+    /// \attention Apart from the bootstrap functions that add records, this field must be
+    ///            accessed only through method #First.
     Node*    first;
 
+    /// If set, the records are not loaded yet. The function is invoked with the first access
+    /// to the records by method #First.
+    /// \see Function \alib{enumrecords::bootstrap;BootstrapLazy}.
+    std::atomic<void(*)()>  lazyLoader;
+
+    /// Set if the records are loaded lazily. In this case, the records are not inserted into
+    /// the central hash map that is searched by function \alib{enumrecords;TryRecord}.
+    bool     isLazy;
+
+    /// Incremented by the bootstrap functions each time records are added.
+    /// Used by \alib{enumrecords::detail;EnumRecordTable} and
+    /// \alib{enumrecords::detail;EnumParseIndex} to detect that they have to be rebuilt.
+    std::atomic<unsigned>   generation;
+
+    /// Returns #generation. If the records are loaded lazily and this is the first access, the
+    /// records are loaded before.
+    /// @return The number of times records have been added.
+    unsigned Generation() {
+        First();
+        return generation.load( std::memory_order_acquire );
+    }
+
+    /// Returns the first record defined. If the records are loaded lazily and this is the first
+    /// access, the records are loaded.
+    /// @return The first record, \c nullptr if no record is defined.
+    Node*    First() {
+        if( auto* loader= lazyLoader.load( std::memory_order_acquire ) )
+            loader();
+        return first;
+    }
+
     /// Helper methods that returns the address of field
     /// \alib{enumrecords::detail;EnumRecordHook::Node::next} the last element contained in the
     /// list. If no elements have been initialized, yet, the address of field #first is
@@ -154,7 +206,10 @@ struct EnumRecordHook :  Singleton<EnumRecordHook<TEnum>>
     ///
     /// \note As enum record types are trivially destructible types, no destructor is given.
     EnumRecordHook()
-    : first( nullptr )                                                                            {}
+    : first     ( nullptr )
+    , lazyLoader( nullptr )
+    , isLazy    ( false   )
+    , generation( 0       )                                                                       {}
 }; // EnumRecordHook
 } //namespace alib::enumrecords[::detail]
 
@@ -376,7 +431,7 @@ struct EnumRecords
     /// @return An iterator to the first record defined for enumeration type \p{TEnum}.
     static
     ForwardIterator  begin()
-    { return  ForwardIterator( detail::EnumRecordHook<TEnum>::GetSingleton().first ); }
+    { return  ForwardIterator( detail::EnumRecordHook<TEnum>::GetSingleton().First() ); }
 
     /// Returns an iterator referring to the first element behind the list.
     ///
@@ -19,6 +19,13 @@ ALIB_EXPORT namespace alib {  namespace enumrecords {
 ///
 /// In debug-builds, the method asserts that at least one record is defined for \p{TEnum}.
 ///
+/// The records are not searched linearly. Instead, with the first invocation, a trie of the
+/// record names is created (see \alib{enumrecords::detail;EnumParseIndex}), which finds the
+/// matching record in the time needed to walk the characters of the input. The result is the
+/// same as if the records were tested in the order of their definition using
+/// \alib{strings;TSubstring::ConsumePartOf}, passing field
+/// \alib{enumrecords;ERSerializable::MinimumRecognitionLength}.
+///
 /// For more information, consult chapter
 /// \ref alib_enums_records_details_serialization "4.3.1 Serialization/Deserialization" of the
 /// Programmer's Manual of the module \alib_enumrecords_nl.
@@ -59,15 +66,14 @@ bool Parse( strings::TSubstring<TChar>& input,  TEnum&  result ) {
     if constexpr ( TTrimBeforeConsume == lang::Whitespaces::Trim )
         input.TrimStart();
 
-    for( auto recordIt=   EnumRecords<TEnum>().begin() ;
-              recordIt != EnumRecords<TEnum>().end()   ; ++recordIt  )
-        if ( input.template ConsumePartOf<TSensitivity>( recordIt->EnumElementName,
-                                                         recordIt->MinimumRecognitionLength ) > 0 )
-        {
-            result= recordIt.Enum();
-            return true;
-        }
-    return false;
+    integer matchLen;
+    auto* node= detail::EnumParseIndex<TEnum, TChar, TSensitivity>::Get().Find( input, matchLen );
+    if( node == nullptr )
+        return false;
+
+    input.template ConsumeChars<NC>( matchLen );
+    result= TEnum( node->integral );
+    return true;
 }
 
 //==================================================================================================
@@ -272,6 +278,9 @@ struct  AppendableTraits<TEnum, TChar, TAllocator>
     /// If no record exists for \p{element}, its underlying integral value is written.
     /// In debug-builds, the method asserts that at least one record is defined for \p{TEnum}.
     ///
+    /// The record is received from \alib{enumrecords::detail;EnumRecordTable}, which is created
+    /// with the first invocation and provides constant-time access to the records of \p{TEnum}.
+    ///
     ///
     /// @param target    The \b AString that \p{element} is to be appended to.
     /// @param element   The enumeration element to append to \p{target}.
@@ -281,7 +290,7 @@ struct  AppendableTraits<TEnum, TChar, TAllocator>
         ALIB_ASSERT_ERROR( EnumRecords<TEnum>().begin() != EnumRecords<TEnum>().end(), "ENUMS",
                              "No Enum Records for type <{}> found.", &typeid(TEnum) )
 
-        auto* record= enumrecords::TryRecord( element );
+        auto* record= enumrecords::detail::EnumRecordTable<TEnum>::Get().Find( element );
         if( record != nullptr )
             target << record->EnumElementName;
         else
@@ -373,6 +382,10 @@ struct  AppendableTraits<TBitwiseEnum, TChar,TAllocator> {
     /// The enum records defined may aggregate several bits. Aggregations have to be defined
     /// before records that represent the corresponding single bits (or another subset of those).
     ///
+    /// The names are written with method
+    /// \alib{enumrecords::detail;EnumRecordTable::AppendBitwise}, which iterates only over the bits
+    /// set in \p{elements}.
+    ///
     /// \see
     ///   This struct's documentation for more information and a sample.
     ///
@@ -384,37 +397,8 @@ struct  AppendableTraits<TBitwiseEnum, TChar,TAllocator> {
         ALIB_ASSERT_ERROR( EnumRecords<TBitwiseEnum>().begin() != EnumRecords<TBitwiseEnum>().end(),
                     "ENUMS",  "No Enum Records for type <{}> found.", &typeid(TBitwiseEnum) )
 
-        // check what has been covered and omit double entries
-        TBitwiseEnum covered= TBitwiseEnum(0);
-
-        // loop over entry 2 to end, check bit
-        integer len= target.Length();
-
-        for( auto recordIt=   EnumRecords<TBitwiseEnum>().begin() ;
-                  recordIt != EnumRecords<TBitwiseEnum>().end()   ; ++recordIt  )
-        {
-            // no bits are set and this entry does not contain bits, then stop here
-            if( recordIt.Integral() == 0 )
-            {
-                if( elements == TBitwiseEnum(0) )
-                {
-                    target << recordIt->EnumElementName;
-                    return;
-                }
-            }
-            else if(     HasBits( elements, recordIt.Enum() )
-                     && !HasBits( covered , recordIt.Enum() )  )
-            {
-                covered|= recordIt.Enum();
-                target << recordIt->EnumElementName << ',';
-            }
-        }
-        len= target.Length() - len;
-
-        // remove the last comma
-        if( len != 0 )
-            target.DeleteEnd( 1 );
-
+        TBitwiseEnum covered= enumrecords::detail::EnumRecordTable<TBitwiseEnum>::Get()
+                                                                  .AppendBitwise( target, elements );
         ALIB_ASSERT_ERROR( covered == elements, "ENUMS",
            "Not all bits have been covered while writing bitset '{}' of enumeration type <{}>."
                         " Remaining bits are '{}'.", NString128(NBin( elements )),
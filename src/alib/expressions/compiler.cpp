@@ -109,6 +109,7 @@ void    Scope::Reset() {
 Compiler::Compiler()
 : allocator                      (ALIB_DBG("ExpressionCompiler",) 4)
 , typeMap                        (allocator, 2.0, 5.0) // we don't care about speed here, just for log output
+, typeSamples                    (allocator, 2.0, 5.0)
 , namedExpressions               (allocator)
 , UnaryOperators                 (allocator)
 , AlphabeticUnaryOperatorAliases (allocator)
@@ -117,6 +118,7 @@ Compiler::Compiler()
 , CfgNormalizationDisallowed     (allocator) {
     // create a clone of the default formatter.
     CfgFormatter= Formatter::Default->Clone();
+    ALIB_DBG( IF_ALIB_THREADS( namedExpressionsLock.Dbg.Name= "ExpressionNamed"; ) )
 
     // register compiler types
     constexpr std::pair<Box&,NString> typeKeys[]=
@@ -146,7 +148,12 @@ Compiler::Compiler()
     CfgNestedExpressionThrowIdentifier= EXPRESSIONS.GetResource( "EFT" );
 }
 
-Compiler::~Compiler()                             { if( Repository != nullptr ) delete Repository; }
+Compiler::~Compiler() {
+    if( Repository != nullptr )
+        delete Repository;
+    delete dispatchIndex;
+    delete callbackRegistry;
+}
 
 Scope* Compiler::createCompileTimeScope(MonoAllocator& ctAllocator)
 {
@@ -246,6 +253,13 @@ Expression   Compiler::Compile( const String& expressionString ) {
     if (parser == nullptr)
         parser= Parser::Create( *this );
 
+    // plug-in dispatch index
+    if( !HasBits( CfgCompilation, Compilation::NoPluginDispatchIndex ) ) {
+        if( dispatchIndex == nullptr )
+            dispatchIndex= new PluginDispatchIndex();
+        dispatchIndex->Update( plugins );
+    }
+
     AST*                 ast = nullptr;
 
     // prevent cleaning memory with recursive compilation (may happen with nested expressions)
@@ -314,6 +328,13 @@ Expression   Compiler::Compile( const String& expressionString ) {
     return Expression(expression);
 }
 
+void      Compiler::ResetDispatchIndex() {
+    if( dispatchIndex != nullptr )
+        dispatchIndex->Reset();
+    if( callbackRegistry != nullptr )
+        callbackRegistry->Reset();
+}
+
 void      Compiler::getOptimizedExpressionString( ExpressionVal& expression ) {
     detail::AST* ast= nullptr;
     auto startOfDecompilation= allocator.TakeSnapshot();
@@ -342,6 +363,7 @@ void      Compiler::getOptimizedExpressionString( ExpressionVal& expression ) {
 //##################################################################################################
 
 bool           Compiler::AddNamed( const String& name, const String& expressionString ) {
+    ALIB_LOCK_RECURSIVE_WITH(namedExpressionsLock)
     String128 key;
     key.DbgDisableBufferReplacementWarning();
     key << name;
@@ -373,6 +395,7 @@ bool           Compiler::AddNamed( const String& name, const String& expressionS
 }
 
 Expression   Compiler::GetNamed( const String& name ) {
+    ALIB_LOCK_RECURSIVE_WITH(namedExpressionsLock)
     // search
     String128 key;
     key.DbgDisableBufferReplacementWarning();
@@ -402,14 +425,166 @@ Expression   Compiler::GetNamed( const String& name ) {
     return sharedExpression;
 }
 
+//##################################################################################################
+// Serialization
+//##################################################################################################
+#if !DOXYGEN
+namespace {
+
+// The magic number starting serialized programs. The last byte denotes the version of the format.
+constexpr uint32_t   blobMagic= 0x41455801;
+
+// Mixes the given value into a 64-bit FNV-1a hash.
+uint64_t fnvMix( uint64_t hash, uint64_t value ) {
+    for( int i= 0 ; i < 8 ; ++i ) {
+        hash^= ( value >> (i * 8) ) & 0xFF;
+        hash*= 1099511628211ull;
+    }
+    return hash;
+}
+
+} // anonymous namespace
+#endif
+
+uint64_t Compiler::Fingerprint() {
+    if( callbackRegistry == nullptr )
+        callbackRegistry= new CallbackRegistry();
+    callbackRegistry->Update( plugins );
+
+    uint64_t result= callbackRegistry->Fingerprint();
+    result= fnvMix( result, uint64_t( CfgCompilation   ) );
+    result= fnvMix( result, uint64_t( CfgNormalization ) );
+    return result;
+}
+
+bool Compiler::Serialize( Expression& expression, std::vector<uint8_t>& target ) {
+    ALIB_ASSERT_ERROR( expression != nullptr, "EXPR", "Serializing a nulled expression." )
+    uint64_t fingerprint= Fingerprint();
+
+    std::vector<uint8_t> blob;
+    ProgramBlobWriter    writer( blob );
+    writer.Write( blobMagic                     );
+    writer.Write( fingerprint                   );
+    writer.Write( expression->name              );
+    writer.Write( expression->originalString    );
+    writer.Write( String(expression->normalizedString) );
+    writer.Write( expression->GetOptimizedString()     );
+    if( !static_cast<Program*>(expression->program)->Serialize( writer, *callbackRegistry ) )
+        return false;
+
+    target.insert( target.end(), blob.begin(), blob.end() );
+    return true;
+}
+
+Expression Compiler::Deserialize( const std::vector<uint8_t>& blob, bool* restored ) {
+    if( restored )
+        *restored= false;
+
+    // read header
+    ProgramBlobReader reader( blob );
+    if( reader.Read<uint32_t>() != blobMagic )
+        return Expression();
+    uint64_t fingerprint= reader.Read<uint64_t>();
+    AString  name;
+    AString  originalString;
+    reader.Read( name           );
+    reader.Read( originalString );
+    if( !reader.OK || originalString.IsEmpty() )
+        return Expression();
+
+    // fingerprint matches? Then restore the program
+    if( fingerprint == Fingerprint() ) {
+        Expression expression( 1, 100 );
+        expression.ConstructT( expression.GetAllocator(),
+                               originalString,
+                               createCompileTimeScope(expression.GetAllocator()) );
+        if( name.IsNotNull() )
+            expression->name.Allocate( expression->allocator, name );
+        reader.Read( expression->normalizedString );
+        reader.Read( expression->optimizedString  );
+
+        auto* program= new Program( *this, *expression, nullptr );
+        expression->program= program;
+        if( reader.OK && program->Deserialize( reader, *callbackRegistry ) ) {
+            expression->ctScope->Allocator.DbgLock(true);
+            if( restored )
+                *restored= true;
+            return expression;
+    }   }
+
+    // fallback to compilation
+    Expression expression= Compile( originalString );
+    if( name.IsNotNull() ) {
+        expression->allocator.DbgLock(false);
+        expression->name.Allocate( expression->allocator, name );
+        expression->allocator.DbgLock(true);
+    }
+    return expression;
+}
+
+//##################################################################################################
+// CallbackRegistry
+//##################################################################################################
+CallbackRegistry::CallbackRegistry()
+: allocator( ALIB_DBG("ExprCallbacks",) 4 )                                                       {}
+
+void CallbackRegistry::Update( const Compiler::PluginList& plugins ) {
+    // unchanged?
+    if( registeredPlugins.size() == plugins.size() && fingerprint != 0 ) {
+        size_t i= 0;
+        while( i < plugins.size() && registeredPlugins[i] == plugins[i].plugin )
+            ++i;
+        if( i == plugins.size() )
+            return;
+    }
+
+    // rebuild
+    Reset();
+    fingerprint= 14695981039346656037ull;
+    fingerprint= fnvMix( fingerprint, uint64_t( ALIB_VERSION * 100 + ALIB_REVISION ) );
+    fingerprint= fnvMix( fingerprint, uint64_t( blobMagic                          ) );
+    fingerprint= fnvMix( fingerprint, uint64_t( sizeof(character)                  ) );
+    fingerprint= fnvMix( fingerprint, uint64_t( sizeof(integer)                    ) );
+    for( auto& slot : plugins ) {
+        actPlugin= slot.plugin;
+        actHash  = 0;
+        registeredPlugins.emplace_back( actPlugin );
+        actPlugin->CollectCallbacks( *this );
+        fingerprint= fnvMix( fingerprint, uint64_t( actPlugin->Name.Hashcode() ) );
+        fingerprint= fnvMix( fingerprint, actHash );
+    }
+    actPlugin= nullptr;
+}
+
+void CallbackRegistry::Reset() {
+    registeredPlugins.clear();
+    byCallback.Reset();
+    byName    .Reset();
+    allocator .Reset();
+    fingerprint= 0;
+}
+
+void CallbackRegistry::Add( CallbackDecl callback, const NString& name ) {
+    ALIB_ASSERT_ERROR( actPlugin != nullptr, "EXPR",
+                       "Callback \"{}\" added outside of CompilerPlugin::CollectCallbacks.", name )
+    NString key( allocator, NString256() << actPlugin->Name << '/' << name );
+    actHash+= uint64_t( key.Hashcode() ); // order-independent
+
+    auto result= byName.EmplaceIfNotExistent( key, Entry{ callback, actPlugin, key } );
+    ALIB_ASSERT_ERROR( result.second, "EXPR",
+                       "Callback name \"{}\" announced twice.", key )
+    byCallback.EmplaceIfNotExistent( callback, &result.first.Mapped() );
+}
+
 //##################################################################################################
 // Helpers
 //##################################################################################################
 void    Compiler::AddType( Type sample, const NString& name ) {
-    ALIB_DBG( auto it= )
-    typeMap.EmplaceIfNotExistent( &sample.TypeID(), name );
+    auto it= typeMap.EmplaceIfNotExistent( &sample.TypeID(), name );
     ALIB_ASSERT_ERROR( it.second == true, // is insert
                        "EXPR",  "Type already registered with compiler."  )
+    if( it.second )
+        typeSamples.EmplaceIfNotExistent( it.first.Mapped(), sample );
 }
 
 NString Compiler::TypeName(Type box) {
@@ -457,6 +632,52 @@ void Compiler::WriteFunctionSignature( ArgIterator  begin,
     WriteFunctionSignature( buf.data(), buf.size(), target );
 }
 
+//##################################################################################################
+// PluginDispatchIndex
+//##################################################################################################
+void PluginDispatchIndex::Update( const Compiler::PluginList& plugins ) {
+    // unchanged?
+    if( indexedPlugins.size() == plugins.size() ) {
+        size_t i= 0;
+        while( i < plugins.size() && indexedPlugins[i] == plugins[i].plugin )
+            ++i;
+        if( i == plugins.size() )
+            return;
+    }
+
+    // rebuild
+    Reset();
+    fallback[0]= fallback[1]= fallback[2]= 0;
+    for( size_t pluginNo= 0 ; pluginNo < plugins.size() ; ++pluginNo ) {
+        CompilerPlugin* plugin= plugins[pluginNo].plugin;
+        indexedPlugins.emplace_back( plugin );
+        if( pluginNo >= 64 )
+            continue;
+
+        actBit= uint64_t(1) << pluginNo;
+        auto keys= plugin->CollectDispatchKeys( *this );
+        if( !HasBits( keys, CompilerPlugin::DispatchKeys::Functions       ) )  fallback[0]|= actBit;
+        if( !HasBits( keys, CompilerPlugin::DispatchKeys::UnaryOperators  ) )  fallback[1]|= actBit;
+        if( !HasBits( keys, CompilerPlugin::DispatchKeys::BinaryOperators ) )  fallback[2]|= actBit;
+    }
+    actBit= 0;
+}
+
+void PluginDispatchIndex::AddFunction( character firstCharacter ) {
+    auto result= functions.InsertIfNotExistent( characters::ToUpper( firstCharacter ), uint64_t(0) );
+    result.first.Mapped()|= actBit;
+}
+
+void PluginDispatchIndex::AddUnaryOp( const String& op, const std::type_info& argType ) {
+    auto result= operators.InsertIfNotExistent( hash( op, argType, typeid(void) ), uint64_t(0) );
+    result.first.Mapped()|= actBit;
+}
 
+void PluginDispatchIndex::AddBinaryOp( const String&         op,
+                                       const std::type_info& lhsType,
+                                       const std::type_info& rhsType ) {
+    auto result= operators.InsertIfNotExistent( hash( op, lhsType, rhsType ), uint64_t(0) );
+    result.first.Mapped()|= actBit;
+}
 
 }} // namespace [alib::expressions]
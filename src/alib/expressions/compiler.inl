@@ -9,7 +9,7 @@
 ALIB_EXPORT namespace alib {  namespace expressions {
 
 // forwards
-namespace detail { struct Parser; }
+namespace detail { struct Parser; class PluginDispatchIndex; class CallbackRegistry; }
 struct  CompilerPlugin;
 
 //==================================================================================================
@@ -74,18 +74,37 @@ class Compiler  : public lang::PluginContainer<CompilerPlugin, CompilePriorities
     /// The expression parser.
     detail::Parser*                     parser                                             =nullptr;
 
+    /// The plug-in dispatch index. Created with the first compilation, unless flag
+    /// \alib{expressions;Compilation::NoPluginDispatchIndex} is set.
+    detail::PluginDispatchIndex*        dispatchIndex                                      =nullptr;
+
+    /// The registry of callback functions used to serialize programs. Created on demand by
+    /// methods #Serialize, #Deserialize and #Fingerprint.
+    detail::CallbackRegistry*           callbackRegistry                                   =nullptr;
+
     /// The map of Type names and bit flag values.
     HashMap< MonoAllocator,
              lang::TypeFunctors::Key, NAString,
              lang::TypeFunctors::Hash,
              lang::TypeFunctors::EqualTo  >   typeMap;
 
+    /// The sample boxes of the types registered with #AddType, hashed by their name.
+    /// Used to restore result types of deserialized programs.
+    HashMap< MonoAllocator, NString, Box >  typeSamples;
+
     /// The map of 'named' expressions.
     HashMap< MonoAllocator,
              AString, Expression,
              std::hash    <String>,
              std::equal_to<String>  >   namedExpressions;
 
+    #if !ALIB_SINGLE_THREADED
+    /// Protects the map of #namedExpressions. This allows retrieving evaluation-time nested
+    /// expressions while one compiled expression is evaluated by multiple threads in parallel.
+    /// (See class \alib{expressions;ScopePool}.)
+    threads::RecursiveLock      namedExpressionsLock;
+    #endif
+
 
   //################################################################################################
   // Public fields
@@ -330,8 +349,9 @@ IF_ALIB_CAMP(
     ///
     /// \note
     ///   There is no general need to register types for using them
-    ///   with \alib_expressions_nl. Parameter  \p{name} of this method is exclusively
-    ///   used to generate textual, human-readable output!
+    ///   with \alib_expressions_nl. Parameter  \p{name} of this method is used to generate
+    ///   textual, human-readable output and to identify types in programs serialized with
+    ///   method #Serialize.
     ///
     /// @param sample    A \ref alib_expressions_prereq_sb "sample value"
     ///                  of the type, which is implicitly boxed when passed.
@@ -463,6 +483,71 @@ IF_ALIB_CAMP(
     virtual ALIB_DLL
     Expression      GetNamed( const String& name );
 
+    /// Resets the plug-in dispatch index and the registry of callback functions used with
+    /// #Serialize. This method has to be invoked if, after a first compilation, the set of
+    /// functions or operators of an attached plug-in was changed.
+    /// (A change of the list of attached plug-ins itself is detected automatically.)
+    ///
+    /// \see Methods \alib{expressions;CompilerPlugin::CollectDispatchKeys} and
+    ///      \alib{expressions;CompilerPlugin::CollectCallbacks}.
+    ALIB_DLL
+    void            ResetDispatchIndex();
+
+    /// Serializes the compiled program of the given \p{expression} into a binary blob, which
+    /// can be restored with method #Deserialize. This allows avoiding the costs of parsing,
+    /// optimization and assembly, for example, with expressions that are stored and loaded with
+    /// the start of a software.
+    ///
+    /// The blob contains
+    /// - the #Fingerprint of this compiler,
+    /// - the original, the normalized and the optimized expression string,
+    /// - the names of compile-time nested expressions, and
+    /// - the program's commands, with constants of built-in types and references to
+    ///   callback functions by the names registered with
+    ///   \alib{expressions;CompilerPlugin::CollectCallbacks}.
+    ///
+    /// A program cannot be serialized if it contains constants of custom types, result types
+    /// which were not registered with #AddType, or callback functions which are not announced
+    /// by the compiler plug-ins.
+    ///
+    /// \note
+    ///   The blob is stored in the byte-order and character width of the platform.
+    ///   Both are covered by the fingerprint.
+    ///
+    /// @param expression The expression to serialize.
+    /// @param target     The vector to append the blob to.
+    /// @return \c true on success, \c false if the program cannot be serialized. In the latter
+    ///         case, \p{target} is not modified.
+    ALIB_DLL
+    bool            Serialize( Expression& expression, std::vector<uint8_t>& target );
+
+    /// Restores an expression from a blob created with #Serialize.
+    ///
+    /// If the fingerprint stored in the blob does not match the #Fingerprint of this compiler,
+    /// or if a callback function, a type or a compile-time nested expression cannot be resolved,
+    /// the expression is recompiled from its original string, which is stored in the blob.
+    /// In this case, exceptions of method #Compile may be thrown.
+    ///
+    /// Resources which plug-ins create in the compile-time scope (for example, precompiled
+    /// regular expressions of plug-in \alib{expressions::plugins;Strings}) are not restored.
+    /// Plug-ins have to create those at evaluation-time, if they are missing.
+    ///
+    /// @param blob      The data received with #Serialize.
+    /// @param restored  Optional output parameter. Set to \c true if the program was restored
+    ///                  from \p{blob}, and to \c false if the expression was recompiled.
+    /// @return The expression. Contains \c nullptr if \p{blob} is not a valid blob.
+    ALIB_DLL
+    Expression      Deserialize( const std::vector<uint8_t>& blob, bool* restored= nullptr );
+
+    /// Returns a fingerprint of this compiler's configuration, which is relevant for compiled
+    /// programs. It covers the version of the library, the character width, the byte-order,
+    /// the list of plug-ins, the callback functions they announce with
+    /// \alib{expressions::CompilerPlugin;CollectCallbacks}, and the fields #CfgCompilation and
+    /// #CfgNormalization.
+    /// @return The fingerprint.
+    ALIB_DLL
+    uint64_t        Fingerprint();
+
     /// Provides access to the internal \alib{MonoAllocator}.
     /// \note This method is deemed non-standard use of this class, and the using code needs to
     ///       knowing what to do.
@@ -519,6 +604,34 @@ class  ProgramBase {
     /// @param cmp The compiler to receive protected data from.
     /// @return The compiler's plugins.
     Compiler::PluginList&   getCompilerPlugins    (Compiler& cmp)            { return cmp.plugins; }
+
+    /// Friendship-access method used by derived implementation.
+    /// @param cmp The compiler to receive protected data from.
+    /// @return The compiler's plug-in dispatch index, or \c nullptr if flag
+    ///         \alib{expressions;Compilation::NoPluginDispatchIndex} is set.
+    PluginDispatchIndex*    getDispatchIndex      (Compiler& cmp) {
+        return HasBits( cmp.CfgCompilation, Compilation::NoPluginDispatchIndex ) ? nullptr
+                                                                                 : cmp.dispatchIndex;
+    }
+
+    /// Friendship-access method used by derived implementation.
+    /// @param cmp  The compiler to receive protected data from.
+    /// @param type A sample box of the type to search.
+    /// @return The name registered with \alib{expressions;Compiler::AddType}, or a \e nulled
+    ///         string if the type was not registered.
+    NString                 getTypeName           (Compiler& cmp, const Box& type) {
+        auto it= cmp.typeMap.Find( &type.TypeID() );
+        return it != cmp.typeMap.end() ? it.Mapped() : NULL_NSTRING;
+    }
+
+    /// Friendship-access method used by derived implementation.
+    /// @param cmp  The compiler to receive protected data from.
+    /// @param name The name of the type, as registered with \alib{expressions;Compiler::AddType}.
+    /// @return The sample box of the type, or \c nullptr if no type of that name is registered.
+    const Box*              getTypeSample         (Compiler& cmp, const NString& name) {
+        auto it= cmp.typeSamples.Find( name );
+        return it != cmp.typeSamples.end() ? &it.Mapped() : nullptr;
+    }
 };
 
 /// Base class exported by the main module \implude{Expressions} for technical reasons.
@@ -431,6 +431,58 @@ struct CompilerPlugin : public lang::Plugin<Compiler, CompilePriorities>
         , TypeOrValueRhs    ( nullptr     )                                                       {}
     };
 
+    /// Bitwise enumeration returned by method #CollectDispatchKeys. Each flag denotes that a
+    /// plug-in provided the complete set of keys for a category of syntax elements.
+    enum class DispatchKeys
+    {
+        NONE             = 0,      ///< No keys provided. The plug-in is offered all elements.
+        Functions        = 1 << 0, ///< All keys of identifiers and functions were provided.
+        UnaryOperators   = 1 << 1, ///< All keys of unary operators were provided.
+        BinaryOperators  = 1 << 2, ///< All keys of binary operators were provided.
+    };
+
+    /// Interface passed to method #CollectDispatchKeys. The compiler implements this interface
+    /// to build its internal plug-in dispatch index.
+    struct DispatchKeyCollector
+    {
+        /// Virtual destructor.
+        virtual ~DispatchKeyCollector()                                                           {}
+
+        /// Announces that the plug-in may compile identifiers or functions whose name starts
+        /// with the given character. The character is compared without letter case.
+        /// @param firstCharacter  The first character of the function name.
+        virtual void AddFunction( character firstCharacter )                                     =0;
+
+        /// Announces that the plug-in may compile the given unary operator for the given
+        /// argument type.
+        /// @param op       The operator.
+        /// @param argType  The type of the argument.
+        virtual void AddUnaryOp ( const String& op, const std::type_info& argType )              =0;
+
+        /// Announces that the plug-in may compile the given binary operator for the given
+        /// argument types.
+        /// @param op       The operator.
+        /// @param lhsType  The type of the left-hand side argument.
+        /// @param rhsType  The type of the right-hand side argument.
+        virtual void AddBinaryOp( const String&         op,
+                                  const std::type_info& lhsType,
+                                  const std::type_info& rhsType )                                =0;
+    };
+
+    /// Interface passed to method #CollectCallbacks. The compiler implements this interface
+    /// to build its registry of callback functions, which is used to serialize compiled programs.
+    struct CallbackCollector
+    {
+        /// Virtual destructor.
+        virtual ~CallbackCollector()                                                              {}
+
+        /// Registers a callback function under a name. The name has to be unique within the
+        /// plug-in and must not change between different runs of the software.
+        /// @param callback The callback function.
+        /// @param name     The name of the callback function.
+        virtual void Add( CallbackDecl callback, const NString& name )                           =0;
+    };
+
     /// Constructor.
     /// @param name       Assigned to field #Name.
     /// @param compiler   The compiler we will get attached to. Gets stored in field #Cmplr.
@@ -542,11 +594,255 @@ struct CompilerPlugin : public lang::Plugin<Compiler, CompilePriorities>
     ///         was done.
     virtual bool TryCompilation( CIAutoCast& ciAutoCast )       { (void) ciAutoCast; return false; }
 
+    /// This method is invoked by the \b %Compiler when it (re-)builds its plug-in dispatch index.
+    /// The index allows the compiler to skip plug-ins which are not able to compile a certain
+    /// function name or operator/argument type combination, without invoking the corresponding
+    /// method #TryCompilation.
+    ///
+    /// Implementations announce the keys that they are responsible for through the given
+    /// \p{collector} and return the categories for which the set of announced keys is complete.
+    /// For categories not returned, the plug-in continues to be offered every syntax element.
+    /// Announcing more keys than necessary is allowed, while announcing fewer leads to
+    /// compilation failures.
+    ///
+    /// Implementations which change the operator given with field \b Operator of
+    /// \alib{expressions::CompilerPlugin;CIUnaryOp} or \alib{expressions::CompilerPlugin;CIBinaryOp}
+    /// (for example, with alias operators) have to announce the keys of the alias operators as
+    /// well.
+    ///
+    /// \note
+    ///   The index is built with the first compilation. If a plug-in changes its set of keys after
+    ///   that, method \alib{expressions;Compiler::ResetDispatchIndex} has to be invoked.
+    ///
+    /// @param collector  The interface to announce the keys to.
+    /// @return The categories for which all keys were announced.
+    ///         This default implementation returns \b %DispatchKeys::NONE.
+    virtual DispatchKeys CollectDispatchKeys( DispatchKeyCollector& collector )
+    { (void) collector; return DispatchKeys::NONE; }
+
+    /// This method is invoked by the \b %Compiler when it (re-)builds its registry of callback
+    /// functions. The registry maps each callback function to a name, which is stable between
+    /// different runs of the software. It is used by methods
+    /// \alib{expressions;Compiler::Serialize} and \alib{expressions;Compiler::Deserialize} to
+    /// store references to callback functions within serialized programs.
+    ///
+    /// Implementations have to announce each callback function that they may provide with
+    /// methods #TryCompilation through the given \p{collector}.
+    /// Programs that contain callback functions which are not announced, cannot be serialized.
+    ///
+    /// @param collector  The interface to announce the callback functions to.
+    virtual void         CollectCallbacks( CallbackCollector& collector )        { (void) collector; }
+};
+
+namespace detail {
+
+//==================================================================================================
+/// The plug-in dispatch index of class \alib{expressions;Compiler}.
+/// It maps function names (by their first character) and operator/argument type combinations
+/// to a bit mask, which selects the plug-ins in the compiler's plug-in list that are to be offered
+/// the corresponding syntax element.
+/// The first 64 plug-ins are indexed. Plug-ins attached beyond that are always selected.
+///
+/// Keys are stored as hash values only. Collisions of hash values lead to a union of
+/// bit masks, and thus just select more plug-ins than necessary.
+//==================================================================================================
+class PluginDispatchIndex : public CompilerPlugin::DispatchKeyCollector
+{
+  public:
+    /// A mask which selects all plug-ins.
+    static constexpr uint64_t All                                                   = ~uint64_t(0);
+
+  protected:
+    /// The plug-ins that this index was built for.
+    std::vector<CompilerPlugin*>        indexedPlugins;
+
+    /// For each category of syntax elements, the mask of plug-ins that do not provide keys.
+    uint64_t                            fallback[3]                                     = {All,All,All};
+
+    /// The masks per upper-case first character of function names.
+    HashMap<HeapAllocator, character, uint64_t>             functions;
+
+    /// The masks per hash value of operators and argument types.
+    HashMap<HeapAllocator, std::size_t, uint64_t>           operators;
+
+    /// The bit of the plug-in whose keys are currently collected.
+    uint64_t                            actBit                                                  =0;
+
+    /// Calculates the hash value of an operator key.
+    /// @param op   The operator.
+    /// @param lhs  The type of the (left-hand side) argument.
+    /// @param rhs  The type of the right-hand side argument or <c>typeid(void)</c>.
+    /// @return The hash value.
+    static std::size_t hash( const String& op, const std::type_info& lhs,
+                                               const std::type_info& rhs ) {
+        return      op.Hashcode()
+                 +  4026031ul * lhs.hash_code()
+                 +  8175383ul * rhs.hash_code();
+    }
+
+  public:
+    /// Default constructor.
+    PluginDispatchIndex()                                                                  =default;
+
+    /// Rebuilds the index, if the given list of plug-ins differs from the one that the index
+    /// was built for.
+    /// @param plugins  The plug-ins of the compiler.
+    ALIB_DLL void   Update( const Compiler::PluginList& plugins );
+
+    /// Clears the index. The next invocation of #Update rebuilds it.
+    void            Reset()                                                                      {
+        indexedPlugins.clear();
+        fallback[0]= fallback[1]= fallback[2]= All;
+        functions.Reset();
+        operators.Reset();
+    }
+
+    /// Returns the plug-ins selected to compile a function with the given name.
+    /// @param name  The name of the function.
+    /// @return The mask of selected plug-ins.
+    uint64_t        Function( const String& name )                                             const {
+        if( name.IsEmpty() )
+            return All;
+        auto it= functions.Find( characters::ToUpper( name.CharAtStart() ) );
+        return fallback[0] | ( it != functions.end() ? it.Mapped() : 0 );
+    }
+
+    /// Returns the plug-ins selected to compile a unary operator.
+    /// @param op       The operator.
+    /// @param argType  The type of the argument.
+    /// @return The mask of selected plug-ins.
+    uint64_t        UnaryOp( const String& op, const std::type_info& argType )                 const {
+        auto it= operators.Find( hash( op, argType, typeid(void) ) );
+        return fallback[1] | ( it != operators.end() ? it.Mapped() : 0 );
+    }
+
+    /// Returns the plug-ins selected to compile a binary operator.
+    /// @param op       The operator.
+    /// @param lhsType  The type of the left-hand side argument.
+    /// @param rhsType  The type of the right-hand side argument.
+    /// @return The mask of selected plug-ins.
+    uint64_t        BinaryOp( const String&         op,
+                              const std::type_info& lhsType,
+                              const std::type_info& rhsType )                                  const {
+        auto it= operators.Find( hash( op, lhsType, rhsType ) );
+        return fallback[2] | ( it != operators.end() ? it.Mapped() : 0 );
+    }
+
+    /// Tests if the plug-in at the given position in the compiler's plug-in list is selected
+    /// by the given mask.
+    /// @param mask     The mask received with #Function, #UnaryOp or #BinaryOp.
+    /// @param pluginNo The position of the plug-in.
+    /// @return \c true if the plug-in is to be offered the syntax element, \c false otherwise.
+    static bool     Selects( uint64_t mask, size_t pluginNo ) {
+        return pluginNo >= 64 || ( mask & ( uint64_t(1) << pluginNo ) ) != 0;
+    }
+
+    #if !DOXYGEN
+    ALIB_DLL virtual void AddFunction( character firstCharacter )                         override;
+    ALIB_DLL virtual void AddUnaryOp ( const String& op, const std::type_info& argType )  override;
+    ALIB_DLL virtual void AddBinaryOp( const String&         op,
+                                       const std::type_info& lhsType,
+                                       const std::type_info& rhsType )                    override;
+    #endif
+};
+
+//==================================================================================================
+/// The registry of callback functions of class \alib{expressions;Compiler}.
+/// It maps the callback functions announced by the plug-ins with method
+/// \alib{expressions;CompilerPlugin::CollectCallbacks} to names and vice versa.
+/// The names are prefixed with the name of the plug-in.
+///
+/// In addition, a fingerprint of the set of plug-ins and their callback functions is calculated.
+//==================================================================================================
+class CallbackRegistry : public CompilerPlugin::CallbackCollector
+{
+  public:
+    /// The value type of the registry.
+    struct Entry
+    {
+        CallbackDecl        Callback;   ///< The callback function.
+        CompilerPlugin*     Plugin;     ///< The plug-in that announced the callback.
+        NString             Name;       ///< The name of the callback.
+    };
+
+  protected:
+    /// Hash functor for callback functions.
+    struct CallbackHash
+    {
+        /// Calculates the hash value of a callback function.
+        /// @param callback The callback function.
+        /// @return The hash value.
+        std::size_t operator()( CallbackDecl callback )                                        const
+        { return std::hash<std::uintptr_t>()( reinterpret_cast<std::uintptr_t>( callback ) ); }
+    };
+
+    /// The allocator used for the names of the callback functions.
+    MonoAllocator                                           allocator;
+
+    /// The plug-ins that this registry was built for.
+    std::vector<CompilerPlugin*>                            registeredPlugins;
+
+    /// The registry entries, hashed by name.
+    HashMap<HeapAllocator, NString, Entry>                  byName;
+
+    /// The registry entries, hashed by callback function.
+    HashMap<HeapAllocator, CallbackDecl, Entry*, CallbackHash>  byCallback;
+
+    /// The plug-in whose callbacks are currently collected.
+    CompilerPlugin*                                         actPlugin                     =nullptr;
+
+    /// The (order-independent) hash value of the names announced by #actPlugin.
+    uint64_t                                                actHash                             =0;
+
+    /// The fingerprint of the registry.
+    uint64_t                                                fingerprint                         =0;
+
+  public:
+    /// Constructor.
+    ALIB_DLL        CallbackRegistry();
+
+    /// Rebuilds the registry, if the given list of plug-ins differs from the one that the registry
+    /// was built for.
+    /// @param plugins  The plug-ins of the compiler.
+    ALIB_DLL void   Update( const Compiler::PluginList& plugins );
+
+    /// Clears the registry. The next invocation of #Update rebuilds it.
+    ALIB_DLL void   Reset();
+
+    /// Returns the fingerprint of the registered plug-ins and callback functions.
+    /// The value changes if plug-ins are added, removed or reordered, if plug-ins announce
+    /// different callback names, and with different versions of this library.
+    /// @return The fingerprint.
+    uint64_t        Fingerprint()                                       const { return fingerprint; }
+
+    /// Searches a callback function.
+    /// @param callback The callback function to search.
+    /// @return The entry of the callback, \c nullptr if not registered.
+    const Entry*    Find( CallbackDecl callback )                                              const {
+        auto it= byCallback.Find( callback );
+        return it != byCallback.end() ? it.Mapped() : nullptr;
+    }
+
+    /// Searches a callback function by its name.
+    /// @param name The name of the callback function.
+    /// @return The entry of the callback, \c nullptr if not registered.
+    const Entry*    Find( const NString& name )                                                const {
+        auto it= byName.Find( name );
+        return it != byName.end() ? &it.Mapped() : nullptr;
+    }
+
+    #if !DOXYGEN
+    ALIB_DLL virtual void Add( CallbackDecl callback, const NString& name )                override;
+    #endif
 };
 
+} // namespace alib::expressions[::detail]
+
 } // namespace alib[::expressions]
 
 /// Type alias in namespace \b alib.
 using     CompilerPlugin=    expressions::CompilerPlugin;
 
 } // namespace [alib]
+
+ALIB_ENUMS_MAKE_BITWISE(alib::expressions::CompilerPlugin::DispatchKeys)
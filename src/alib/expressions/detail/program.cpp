@@ -294,8 +294,14 @@ void Program::AssembleFunction( AString& functionName , bool isIdentifier, int q
 
     try
     {
-        for( auto& ppp : getCompilerPlugins(compiler) ) {
-            if( !ppp.plugin->TryCompilation( cInfo ) )
+        auto&                plugins = getCompilerPlugins(compiler);
+        PluginDispatchIndex* dispatch= getDispatchIndex(compiler);
+        uint64_t             selected= dispatch ? dispatch->Function( functionName )
+                                                : PluginDispatchIndex::All;
+        for( size_t pluginNo= 0 ; pluginNo < plugins.size() ; ++pluginNo ) {
+            auto& ppp= plugins[pluginNo];
+            if(    !PluginDispatchIndex::Selects( selected, pluginNo )
+                || !ppp.plugin->TryCompilation( cInfo ) )
                 continue;
 
             // constant?
@@ -448,9 +454,20 @@ void Program::AssembleUnaryOp( String& op, integer idxInOriginal, integer idxInN
                                              compileStorage->ConditionalStack.get_allocator().GetAllocator(),
                                              opReference, isConstant );
 
-            // search plug-ins
-            for( auto& ppp : getCompilerPlugins(compiler) ) {
-                if( !ppp.plugin->TryCompilation( cInfo ) )
+            // search plug-ins (re-select with the dispatch index when a plug-in resolved an alias)
+            auto&                plugins  = getCompilerPlugins(compiler);
+            PluginDispatchIndex* dispatch = getDispatchIndex(compiler);
+            String               indexedOp= cInfo.Operator;
+            uint64_t             selected = dispatch ? dispatch->UnaryOp( indexedOp, cInfo.ArgsBegin->TypeID() )
+                                                     : PluginDispatchIndex::All;
+            for( size_t pluginNo= 0 ; pluginNo < plugins.size() ; ++pluginNo ) {
+                auto& ppp= plugins[pluginNo];
+                if( dispatch && !cInfo.Operator.Equals<NC>( indexedOp ) ) {
+                    indexedOp= cInfo.Operator;
+                    selected = dispatch->UnaryOp( indexedOp, cInfo.ArgsBegin->TypeID() );
+                }
+                if(    !PluginDispatchIndex::Selects( selected, pluginNo )
+                    || !ppp.plugin->TryCompilation( cInfo ) )
                     continue;
 
                 if( !aliased || HasBits(compiler.CfgNormalization, Normalization::ReplaceVerbalOperatorsToSymbolic ) )
@@ -583,8 +600,28 @@ void Program::AssembleBinaryOp( String& op, integer idxInOriginal, integer idxIn
 
         try
         {
-            for( auto& ppp : getCompilerPlugins(compiler) ) {
-                if( !ppp.plugin->TryCompilation( cInfo ) )
+            // search plug-ins (re-select with the dispatch index when a plug-in resolved an alias)
+            auto&                plugins  = getCompilerPlugins(compiler);
+            PluginDispatchIndex* dispatch = getDispatchIndex(compiler);
+            String               indexedOp= cInfo.Operator;
+            auto selectPlugins= [&]() -> uint64_t {
+                // the assign operator might be aliased by any plug-in, regardless of its keys
+                if(     dispatch == nullptr
+                    || (    indexedOp == A_CHAR("=")
+                         && HasBits( compiler.CfgCompilation, Compilation::AliasEqualsOperatorWithAssignOperator ) ) )
+                    return PluginDispatchIndex::All;
+                return dispatch->BinaryOp( indexedOp, cInfo.ArgsBegin->TypeID(),
+                                                      (cInfo.ArgsBegin + 1)->TypeID() );
+            };
+            uint64_t selected= selectPlugins();
+            for( size_t pluginNo= 0 ; pluginNo < plugins.size() ; ++pluginNo ) {
+                auto& ppp= plugins[pluginNo];
+                if( dispatch && !cInfo.Operator.Equals<NC>( indexedOp ) ) {
+                    indexedOp= cInfo.Operator;
+                    selected = selectPlugins();
+                }
+                if(    !PluginDispatchIndex::Selects( selected, pluginNo )
+                    || !ppp.plugin->TryCompilation( cInfo ) )
                     continue;
 
                 if( !aliased || HasBits(compiler.CfgNormalization, Normalization::ReplaceVerbalOperatorsToSymbolic ) )
@@ -952,9 +989,242 @@ void Program::AssembleFinalize() {
     for( auto* it : compileStorage->Assembly )
         new ( cmd++ ) VM::Command(*it);
 
+    // lower built-in operators to native operations
+    if( !HasBits( compiler.CfgCompilation, Compilation::NoNativeOperations ) )
+        VM::LowerNativeOperations( *this );
+
     compileStorage= nullptr;
 }
 
+//##################################################################################################
+// Serialization
+//##################################################################################################
+#if !DOXYGEN
+namespace {
+
+// Tags denoting the type of boxes stored with serialized commands.
+enum class BoxTag : uint8_t
+{
+    TypeName,    // a sample box of a type registered with Compiler::AddType
+    Void,
+    Boolean,
+    Integer,
+    Float,
+    String,
+    DateTime,
+    Duration,
+};
+
+// Tags denoting the parameter of serialized subroutine commands.
+enum class NestedTag : uint8_t
+{
+    EvaluationTime,         // nested expression identified at evaluation-time
+    EvaluationTimeThrow,    // same, but throws if not found
+    CompileTime,            // index into the list of compile-time nested expressions
+};
+
+} // anonymous namespace
+#endif
+
+bool Program::Serialize( ProgramBlobWriter& writer, CallbackRegistry& registry ) {
+    // compile-time nested expressions
+    writer.Write( qtyOptimizations );
+    writer.Write( integer( ctNestedExpressions.size() ) );
+    for( auto& nested : ctNestedExpressions )
+        writer.Write( nested->Name() );
+
+    // commands
+    writer.Write( commandsCount );
+    for( integer pc= 0 ; pc < commandsCount ; ++pc ) {
+        Command& cmd= commands[pc];
+        writer.Write( cmd.Bits()              );
+        writer.Write( cmd.QtyArgs()           );
+        writer.Write( cmd.ExpressionPositions );
+
+        // result type, respectively constant value
+        const Box& box= cmd.ResultType;
+             if( box.IsType<void     >() )   writer.Write( BoxTag::Void );
+        else if( box.IsType<bool     >() ) { writer.Write( BoxTag::Boolean ); writer.Write( box.Unbox<bool   >() ); }
+        else if( box.IsType<integer  >() ) { writer.Write( BoxTag::Integer ); writer.Write( box.Unbox<integer>() ); }
+        else if( box.IsType<double   >() ) { writer.Write( BoxTag::Float   ); writer.Write( box.Unbox<double >() ); }
+        else if( box.IsType<String   >() ) { writer.Write( BoxTag::String  ); writer.Write( box.Unbox<String >() ); }
+    #if ALIB_CAMP
+        else if( box.IsType<DateTime >() ) { writer.Write( BoxTag::DateTime);
+                                             writer.Write( box.Unbox<DateTime>().ToRaw() );         }
+        else if( box.IsType<DateTime::Duration>() ) {
+                                             writer.Write( BoxTag::Duration);
+                                             writer.Write( box.Unbox<DateTime::Duration>().InNanoseconds() ); }
+    #endif
+        else {
+            // constants of custom types are not serializable. Other commands just need the type.
+            NString typeName= getTypeName( compiler, box );
+            if( cmd.IsConstant() || typeName.IsNull() )
+                return false;
+            writer.Write( BoxTag::TypeName );
+            writer.Write( typeName );
+        }
+
+        // parameter
+        switch( cmd.OpCode() ) {
+            case Command::OpCodes::Constant:
+                break;
+
+            case Command::OpCodes::Function: {
+                auto* entry= registry.Find( cmd.Parameter.Callback );
+                if( entry == nullptr )
+                    return false;
+                writer.Write( entry->Name );
+                writer.Write( cmd.DecompileSymbol );
+            } break;
+
+            case Command::OpCodes::Subroutine:
+                writer.Write( cmd.DecompileSymbol );
+                if( cmd.Parameter.NestedProgram == nullptr )
+                    writer.Write( NestedTag::EvaluationTime );
+                else if( cmd.Parameter.NestedProgram == this )
+                    writer.Write( NestedTag::EvaluationTimeThrow );
+                else {
+                    integer idx= 0;
+                    while(    idx < integer(ctNestedExpressions.size())
+                           && ctNestedExpressions[size_t(idx)]->GetProgram() != cmd.Parameter.NestedProgram )
+                        ++idx;
+                    if( idx == integer(ctNestedExpressions.size()) )
+                        return false;
+                    writer.Write( NestedTag::CompileTime );
+                    writer.Write( idx );
+                }
+            break;
+
+            case Command::OpCodes::JumpIfFalse:
+            case Command::OpCodes::Jump:
+                writer.Write( cmd.Parameter.Distance );
+            break;
+        }
+    }
+    return true;
+}
+
+bool Program::Deserialize( ProgramBlobReader& reader, CallbackRegistry& registry ) {
+    ALIB_ASSERT_ERROR( compileStorage == nullptr, "EXPR",
+                       "Deserializing into a program that is being compiled." )
+    MonoAllocator& ma= getExpressionAllocator(expression);
+
+    // compile-time nested expressions
+    qtyOptimizations= reader.Read<int>();
+    integer qtyNested= reader.Read<integer>();
+    if( !reader.OK || qtyNested < 0 )
+        return false;
+    String256 nestedName;
+    for( integer i= 0 ; i < qtyNested ; ++i ) {
+        reader.Read( nestedName );
+        if( !reader.OK )
+            return false;
+        try
+        {
+            ctNestedExpressions.emplace_back( compiler.GetNamed( nestedName ) );
+        }
+        catch( Exception& )
+        {
+            return false;
+        }
+    }
+
+    // commands
+    commandsCount= reader.Read<integer>();
+    if( !reader.OK || commandsCount <= 0 || ( reader.End - reader.Act ) < commandsCount )
+        return false;
+    commands= ma().AllocArray<VM::Command>( size_t(commandsCount) );
+    for( integer pc= 0 ; pc < commandsCount ; ++pc ) {
+        auto     bits     = reader.Read<int16_t >();
+        auto     qtyArgs  = reader.Read<int     >();
+        auto     positions= reader.Read<uinteger>();
+        String   symbol   = NULL_STRING; // only set with functions and subroutines
+
+        // result type, respectively constant value
+        Box      resultType;
+        switch( reader.Read<BoxTag>() ) {
+            case BoxTag::Void:    resultType= nullptr;                               break;
+            case BoxTag::Boolean: resultType= reader.Read<bool   >();                break;
+            case BoxTag::Integer: resultType= reader.Read<integer>();                break;
+            case BoxTag::Float:   resultType= reader.Read<double >();                break;
+            case BoxTag::String:  resultType= reader.Read( ma );                     break;
+        #if ALIB_CAMP
+            case BoxTag::DateTime:resultType= DateTime::FromRaw( reader.Read<DateTime::TRaw>() );   break;
+            case BoxTag::Duration:resultType= DateTime::Duration::FromNanoseconds(
+                                                                   reader.Read<int64_t>() ); break;
+        #endif
+            case BoxTag::TypeName: {
+                NString64 typeName;
+                reader.Read( typeName );
+                const Box* sample= getTypeSample( compiler, typeName );
+                if( sample == nullptr )
+                    return false;
+                resultType= *sample;
+            } break;
+            default: return false;
+        }
+
+        // parameter
+        VM::Command::OperationParam parameter;
+        ALIB_DBG( CompilerPlugin* plugin= nullptr; )
+        switch( Command::OpCodes( bits & Command::Bits::CMD_MASK ) ) {
+            case Command::OpCodes::Constant:
+                parameter.Distance= 0;
+                break;
+
+            case Command::OpCodes::Function: {
+                NString256 name;
+                reader.Read( name );
+                auto* entry= registry.Find( NString(name) );
+                if( entry == nullptr )
+                    return false;
+                parameter.Callback= entry->Callback;
+                symbol            = reader.Read( ma );
+                ALIB_DBG( plugin= entry->Plugin; )
+            } break;
+
+            case Command::OpCodes::Subroutine:
+                symbol= reader.Read( ma );
+                switch( reader.Read<NestedTag>() ) {
+                    case NestedTag::EvaluationTime:      parameter.NestedProgram= nullptr; break;
+                    case NestedTag::EvaluationTimeThrow: parameter.NestedProgram= this;    break;
+                    case NestedTag::CompileTime: {
+                        integer idx= reader.Read<integer>();
+                        if( idx < 0 || idx >= qtyNested )
+                            return false;
+                        parameter.NestedProgram= static_cast<Program*>(
+                                           ctNestedExpressions[size_t(idx)]->GetProgram() );
+                    } break;
+                    default: return false;
+                }
+            break;
+
+            case Command::OpCodes::JumpIfFalse:
+            case Command::OpCodes::Jump:
+                parameter.Distance= reader.Read<VM::PC>();
+                if( pc + parameter.Distance < 0 || pc + parameter.Distance > commandsCount )
+                    return false;
+            break;
+
+            default: return false;
+        }
+        if( !reader.OK )
+            return false;
+
+        auto& cmd= *new ( commands + pc ) VM::Command( bits, qtyArgs, parameter, resultType,
+                                                       symbol, positions );
+        ALIB_DBG( cmd.DbgInfo.Plugin  = plugin;
+                  cmd.DbgInfo.Callback= "<deserialized>";   )
+        (void) cmd;
+    }
+
+    // lower built-in operators to native operations
+    if( !HasBits( compiler.CfgCompilation, Compilation::NoNativeOperations ) )
+        VM::LowerNativeOperations( *this );
+
+    return true;
+}
+
 #undef ASSERT_ASSEMBLE
 #undef DBG_SET_CALLBACK_INFO
 
@@ -12,6 +12,122 @@ ALIB_EXPORT namespace alib {  namespace expressions {
 /// with expression evaluation.
 namespace detail {
 
+class CallbackRegistry;
+
+//==================================================================================================
+/// Writes the data of serialized programs. Values are stored in the byte-order of the platform.
+/// \see Method \alib{expressions;Compiler::Serialize}.
+//==================================================================================================
+struct ProgramBlobWriter
+{
+    /// The blob to append data to.
+    std::vector<uint8_t>&   Blob;
+
+    /// Constructor.
+    /// @param blob The blob to append data to.
+    ProgramBlobWriter( std::vector<uint8_t>& blob ) : Blob( blob )                                {}
+
+    /// Appends a trivially copyable value.
+    /// @tparam T     The type of the value.
+    /// @param  value The value to write.
+    template<typename T>
+    void Write( const T& value ) {
+        static_assert( std::is_trivially_copyable<T>::value, "Type not trivially copyable" );
+        auto* src= reinterpret_cast<const uint8_t*>( &value );
+        Blob.insert( Blob.end(), src, src + sizeof(T) );
+    }
+
+    /// Appends a string. The length is written first, with \c -1 denoting a \e nulled string.
+    /// @tparam TChar The character type of the string.
+    /// @param  value The string to write.
+    template<typename TChar>
+    void Write( const strings::TString<TChar>& value ) {
+        Write( value.IsNull() ? integer(-1) : value.Length() );
+        auto* src= reinterpret_cast<const uint8_t*>( value.Buffer() );
+        if( value.IsNotEmpty() )
+            Blob.insert( Blob.end(), src, src + value.Length() * integer(sizeof(TChar)) );
+    }
+};
+
+//==================================================================================================
+/// Reads data written with \alib{expressions::detail;ProgramBlobWriter}.
+/// Reading beyond the end of the blob does not throw. Instead, field #OK is cleared and
+/// default values are returned.
+//==================================================================================================
+struct ProgramBlobReader
+{
+    const uint8_t*  Act;        ///< The current read position.
+    const uint8_t*  End;        ///< The end of the blob.
+    bool            OK= true;   ///< Cleared when the blob was found to be corrupt.
+
+    /// Constructor.
+    /// @param blob The blob to read.
+    ProgramBlobReader( const std::vector<uint8_t>& blob )
+    : Act( blob.data() )
+    , End( blob.data() + blob.size() )                                                            {}
+
+    /// Reads a trivially copyable value.
+    /// @tparam T     The type of the value.
+    /// @return The value read, or a value-initialized \p{T}, if the blob was exhausted.
+    template<typename T>
+    T    Read() {
+        static_assert( std::is_trivially_copyable<T>::value, "Type not trivially copyable" );
+        T result{};
+        if( !OK || End - Act < integer(sizeof(T)) ) {
+            OK= false;
+            return result;
+        }
+        std::memcpy( &result, Act, sizeof(T) );
+        Act+= sizeof(T);
+        return result;
+    }
+
+    /// Reads a string into an \b %AString.
+    /// @tparam TChar  The character type of the string.
+    /// @param  target The string to write to.
+    template<typename TChar>
+    void Read( strings::TAString<TChar, lang::HeapAllocator>& target ) {
+        integer length= checkLength<TChar>();
+        if( length < 0 ) {
+            target.SetNull();
+            return;
+        }
+        target.Reset();
+        target.EnsureRemainingCapacity( length );
+        std::memcpy( target.VBuffer(), Act, size_t(length) * sizeof(TChar) );
+        target.SetLength( length );
+        Act+= length * integer(sizeof(TChar));
+    }
+
+    /// Reads a string and copies it into the given allocator.
+    /// @param  ma     The allocator to copy the string to.
+    /// @return The string read.
+    String Read( MonoAllocator& ma ) {
+        integer length= checkLength<character>();
+        if( length < 0 )
+            return NULL_STRING;
+        if( length == 0 )
+            return EMPTY_STRING;
+        auto* buffer= ma().AllocArray<character>( length );
+        std::memcpy( buffer, Act, size_t(length) * sizeof(character) );
+        Act+= length * integer(sizeof(character));
+        return String( buffer, length );
+    }
+
+  protected:
+    /// Reads the length of a string and checks it against the remaining size of the blob.
+    /// @tparam TChar  The character type of the string.
+    /// @return The length of the string, \c -1 for \e nulled strings and in case of corrupt
+    ///         data.
+    template<typename TChar>
+    integer checkLength() {
+        integer length= Read<integer>();
+        if( length < -1 || ( End - Act ) / integer(sizeof(TChar)) < length )
+            OK= false;
+        return OK ? length : -1;
+    }
+};
+
 
 //==================================================================================================
 /// This class represents a program that is "run on" the \alib{expressions;detail::VirtualMachine}
@@ -171,6 +287,25 @@ class Program : public ProgramBase
     /// @return The result value.
     Box             Run(Scope& scope)                  { return VirtualMachine::Run(*this, scope); }
 
+    /// Writes the commands of this program to a blob.
+    /// Invoked by \alib{expressions;Compiler::Serialize}.
+    /// @param writer    The writer to use.
+    /// @param registry  The registry used to name the callback functions.
+    /// @return \c true on success, \c false if the program contains callback functions, constant
+    ///         values or result types that cannot be serialized.
+    ALIB_DLL
+    bool            Serialize( ProgramBlobWriter& writer, CallbackRegistry& registry );
+
+    /// Restores the commands of a program written with #Serialize. Must only be invoked on
+    /// programs that were constructed without a compile-time allocator.
+    /// Invoked by \alib{expressions;Compiler::Deserialize}.
+    /// @param reader    The reader to use.
+    /// @param registry  The registry used to resolve the names of the callback functions.
+    /// @return \c true on success, \c false if the blob is corrupt or if a callback function,
+    ///         a type or a nested expression could not be resolved.
+    ALIB_DLL
+    bool            Deserialize( ProgramBlobReader& reader, CallbackRegistry& registry );
+
 
   //################################################################################################
   // Assemble methods
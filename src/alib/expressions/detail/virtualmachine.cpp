@@ -15,6 +15,8 @@
 #include "alib/expressions/expressions.prepro.hpp"
 #include <vector>
 #include <stack>
+#include <cmath>
+#include <limits>
 #include "ALib.Boxing.H"
 
 //============================================== Module ============================================
@@ -52,6 +54,131 @@ VirtualMachine::Command::Command( Program* program, const Box& resultType,
 #   define NORMPOS_IN_EXPR_STR  (cmd.ExpressionPositions >> (bitsof(integer)/2 )    )
 #endif
 #   include "ALib.Lang.CIFunctions.H"
+//##################################################################################################
+// Native operations
+//##################################################################################################
+#if !DOXYGEN
+namespace {
+
+using NativeOps= VirtualMachine::Command::NativeOps;
+using Fusions  = VirtualMachine::Command::Fusions;
+
+bool isUnary( NativeOps op )                                        { return op >= NativeOps::NegI; }
+
+bool isComparison( NativeOps op ) {
+    return    ( op >= NativeOps::SmII && op <= NativeOps::NeqII )
+           || ( op >= NativeOps::SmFF && op <= NativeOps::NeqFF )
+           ||   op == NativeOps::EqBB || op == NativeOps::NeqBB;
+}
+
+// Performs a native unary operation on the given stack value.
+void nativeUnary( NativeOps op, Box& arg ) {
+    ALIB_WARNINGS_ALLOW_SPARSE_ENUM_SWITCH
+    switch( op ) {
+        case NativeOps::NegI  : arg= -arg.Unbox<integer>();                                 return;
+        case NativeOps::NegF  : arg= -arg.Unbox<double >();                                 return;
+        case NativeOps::BitNot: arg= ~arg.Unbox<integer>();                                 return;
+        case NativeOps::NotB  : arg= !arg.Unbox<bool   >();                                 return;
+        default: ALIB_ERROR("EXPRVM", "Illegal native unary operation {}.", int(op) )       return;
+    }
+    ALIB_WARNINGS_RESTORE
+}
+
+// Performs a native binary operation. The result is stored in the left-hand side stack value.
+void nativeBinary( NativeOps op, Box& lhs, const Box& rhs ) {
+    ALIB_WARNINGS_ALLOW_SPARSE_ENUM_SWITCH
+    switch( op ) {
+        #define II(expr) { integer l= lhs.Unbox<integer>(); integer r= rhs.Unbox<integer>(); lhs= expr; return; }
+        #define FF(expr) { double  l= lhs.Unbox<double >(); double  r= rhs.Unbox<double >(); lhs= expr; return; }
+        #define BB(expr) { bool    l= lhs.Unbox<bool   >(); bool    r= rhs.Unbox<bool   >(); lhs= expr; return; }
+        case NativeOps::AddII : II( l +  r )
+        case NativeOps::SubII : II( l -  r )
+        case NativeOps::MulII : II( l *  r )
+        case NativeOps::DivII : II( l /  r )
+        case NativeOps::ModII : II( l %  r )
+        case NativeOps::BitAnd: II( l &  r )
+        case NativeOps::BitOr : II( l |  r )
+        case NativeOps::BitXOr: II( l ^  r )
+        case NativeOps::ShlII : II( l << r )
+        case NativeOps::ShrII : II( l >> r )
+        case NativeOps::SmII  : II( l <  r )
+        case NativeOps::SmEqII: II( l <= r )
+        case NativeOps::GtII  : II( l >  r )
+        case NativeOps::GtEqII: II( l >= r )
+        case NativeOps::EqII  : II( l == r )
+        case NativeOps::NeqII : II( l != r )
+
+        case NativeOps::AddFF : FF( l + r )
+        case NativeOps::SubFF : FF( l - r )
+        case NativeOps::MulFF : FF( l * r )
+        case NativeOps::DivFF : FF( l / r )
+        case NativeOps::SmFF  : FF( std::isless        ( l, r ) )
+        case NativeOps::SmEqFF: FF( std::islessequal   ( l, r ) )
+        case NativeOps::GtFF  : FF( std::isgreater     ( l, r ) )
+        case NativeOps::GtEqFF: FF( std::isgreaterequal( l, r ) )
+        case NativeOps::EqFF  : FF( std::fabs( l - r ) <= std::numeric_limits<double>::epsilon() )
+        case NativeOps::NeqFF : FF( std::fabs( l - r ) >  std::numeric_limits<double>::epsilon() )
+
+        case NativeOps::AndBB : BB( l && r )
+        case NativeOps::OrBB  : BB( l || r )
+        case NativeOps::EqBB  : BB( l == r )
+        case NativeOps::NeqBB : BB( l != r )
+        #undef II
+        #undef FF
+        #undef BB
+        default: ALIB_ERROR("EXPRVM", "Illegal native binary operation {}.", int(op) )      return;
+    }
+    ALIB_WARNINGS_RESTORE
+}
+
+} // anonymous namespace
+#endif // !DOXYGEN
+
+void VirtualMachine::LowerNativeOperations( Program& program ) {
+    integer length= program.Length();
+
+    // collect jump targets. Commands that are targets of jumps must not be fused into
+    // their predecessors.
+    std::vector<bool> isJumpTarget( size_t(length + 1), false );
+    for( integer pc= 0 ; pc < length ; ++pc ) {
+        Command& cmd= program.At(pc);
+        if( cmd.IsJump() )
+            isJumpTarget[size_t(pc + cmd.Parameter.Distance)]= true;
+    }
+
+    for( integer pc= 0 ; pc < length ; ++pc ) {
+        Command& cmd= program.At(pc);
+        if( cmd.OpCode() != Command::OpCodes::Function || cmd.HasArgs() )
+            continue;
+
+        NativeOps op= NativeOpOf( cmd.Parameter.Callback );
+        if(     op == NativeOps::NONE
+            ||  cmd.QtyArgs() != ( isUnary(op) ? 1 : 2 ) )
+            continue;
+
+        // comparison followed by a conditional jump?
+        bool fuseJump=     isComparison(op)
+                       &&  pc + 1 < length
+                       &&  program.At(pc + 1).OpCode() == Command::OpCodes::JumpIfFalse
+                       && !isJumpTarget[size_t(pc + 1)];
+
+        // binary operator with a constant right-hand side argument?
+        if(    !isUnary(op)
+            &&  pc > 0
+            &&  program.At(pc - 1).IsConstant()
+            &&  program.At(pc - 1).Fusion() == Fusions::NONE
+            && !isJumpTarget[size_t(pc)]                                 )
+        {
+            program.At(pc - 1).SetNativeOp( op, fuseJump ? Fusions::ConstRhsJump
+                                                         : Fusions::ConstRhs );
+            cmd.SetNativeOp( op, Fusions::Native );
+            continue;
+        }
+
+        cmd.SetNativeOp( op, fuseJump ? Fusions::Jump : Fusions::Native );
+    }
+}
+
 //##################################################################################################
 // Run()
 //##################################################################################################
@@ -101,6 +228,46 @@ void  VirtualMachine::run( Program& program, Scope& scope )                {ALIB
 
     for( integer programCounter= 0; programCounter < program.Length() ; ++ programCounter ) {
         const Command& cmd= program.At(programCounter);
+
+        // native operations
+        if( cmd.Fusion() != Command::Fusions::NONE ) {
+            switch( cmd.Fusion() ) {
+                case Command::Fusions::Native:
+                    if( isUnary( cmd.NativeOp() ) )
+                        nativeUnary( cmd.NativeOp(), stack.back() );
+                    else {
+                        nativeBinary( cmd.NativeOp(), *(stack.end() - 2), stack.back() );
+                        stack.pop_back();
+                    }
+                    continue;
+
+                case Command::Fusions::ConstRhs:
+                    nativeBinary( cmd.NativeOp(), stack.back(), cmd.ResultType );
+                    ++programCounter;   // skip the operator
+                    continue;
+
+                case Command::Fusions::Jump:
+                    nativeBinary( cmd.NativeOp(), *(stack.end() - 2), stack.back() );
+                    stack.pop_back();
+                    // jump distance is relative to the skipped jump command
+                    programCounter+= stack.back().Unbox<bool>()
+                                     ? 1
+                                     : program.At(programCounter + 1).Parameter.Distance;
+                    stack.pop_back();
+                    continue;
+
+                case Command::Fusions::ConstRhsJump:
+                    nativeBinary( cmd.NativeOp(), stack.back(), cmd.ResultType );
+                    // skip the operator and the jump command
+                    programCounter+= stack.back().Unbox<bool>()
+                                     ? 2
+                                     : 1 + program.At(programCounter + 2).Parameter.Distance;
+                    stack.pop_back();
+                    continue;
+
+                case Command::Fusions::NONE: break;
+        }   }
+
         ALIB_WARNINGS_ALLOW_BITWISE_SWITCH
         ALIB_WARNINGS_ALLOW_SPARSE_ENUM_SWITCH
         switch( cmd.OpCode() ) {
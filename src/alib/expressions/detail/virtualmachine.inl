@@ -81,6 +81,69 @@ struct VirtualMachine : VirtualMachineBase
         };
         #endif
 
+        /// Native operations which are executed by the virtual machine without invoking the
+        /// callback function of a command. The operations correspond to built-in operators of
+        /// plug-in \alib{expressions::plugins;Arithmetics}, with argument types
+        /// \alib{integer}, <c>double</c> and <c>bool</c>.
+        /// The values are set by method \alib{expressions::detail;VirtualMachine::LowerNativeOperations}.
+        enum class NativeOps : uint8_t
+        {
+            NONE,          ///< No native operation. The callback function is invoked.
+
+            AddII,         ///< Integer addition.
+            SubII,         ///< Integer subtraction.
+            MulII,         ///< Integer multiplication.
+            DivII,         ///< Integer division.
+            ModII,         ///< Integer modulo.
+            BitAnd,        ///< Bitwise and.
+            BitOr,         ///< Bitwise or.
+            BitXOr,        ///< Bitwise exclusive or.
+            ShlII,         ///< Shift left.
+            ShrII,         ///< Shift right.
+            SmII,          ///< Integer comparison <c>'<'</c>.
+            SmEqII,        ///< Integer comparison <c>'<='</c>.
+            GtII,          ///< Integer comparison <c>'>'</c>.
+            GtEqII,        ///< Integer comparison <c>'>='</c>.
+            EqII,          ///< Integer comparison <c>'=='</c>.
+            NeqII,         ///< Integer comparison <c>'!='</c>.
+
+            AddFF,         ///< Floating point addition.
+            SubFF,         ///< Floating point subtraction.
+            MulFF,         ///< Floating point multiplication.
+            DivFF,         ///< Floating point division.
+            SmFF,          ///< Floating point comparison <c>'<'</c>.
+            SmEqFF,        ///< Floating point comparison <c>'<='</c>.
+            GtFF,          ///< Floating point comparison <c>'>'</c>.
+            GtEqFF,        ///< Floating point comparison <c>'>='</c>.
+            EqFF,          ///< Floating point comparison <c>'=='</c> (with epsilon).
+            NeqFF,         ///< Floating point comparison <c>'!='</c> (with epsilon).
+
+            AndBB,         ///< Boolean and.
+            OrBB,          ///< Boolean or.
+            EqBB,          ///< Boolean comparison <c>'=='</c>.
+            NeqBB,         ///< Boolean comparison <c>'!='</c>.
+
+            NegI,          ///< Unary integer negation.
+            NegF,          ///< Unary floating point negation.
+            BitNot,        ///< Unary bitwise not.
+            NotB,          ///< Unary boolean not.
+        };
+
+        /// Denotes how a native operation is fused with the subsequent commands.
+        enum class Fusions : uint8_t
+        {
+            NONE,          ///< The command is not executed natively.
+            Native,        ///< A function command which is executed natively.
+            ConstRhs,      ///< A constant command that applies the native operation of the
+                           ///< subsequent binary operator command, using the constant as the
+                           ///< right-hand side argument. The operator command is skipped.
+            Jump,          ///< A native comparison, which in addition performs the subsequent
+                           ///< \b JumpIfFalse command. The jump command is skipped.
+            ConstRhsJump,  ///< Combination of \b ConstRhs and \b Jump. The subsequent operator and
+                           ///< jump commands are skipped.
+        };
+
+
         /// A union of different parameter types for the commands.
         union OperationParam
         {
@@ -116,6 +179,12 @@ struct VirtualMachine : VirtualMachineBase
         /// string. Hence, this piece of it logically belongs to #ListingTypes.
         uint16_t            qtyArgs;
 
+        /// The native operation executed instead of invoking the callback.
+        NativeOps           nativeOp                                            =NativeOps::NONE;
+
+        /// Denotes how the native operation is fused with subsequent commands.
+        Fusions             fusion                                                =Fusions::NONE;
+
       public:
         /// The parameter of the operation.
         OperationParam      Parameter;
@@ -208,6 +277,22 @@ struct VirtualMachine : VirtualMachineBase
                               | uinteger(idxOriginal  )  )                                        {}
 
 
+        /// Constructor used to restore a serialized command.
+        /// @param opcodeBits      The value returned by #Bits with the serialized command.
+        /// @param qtyFunctionArgs The value returned by #QtyArgs with the serialized command.
+        /// @param parameter       The parameter of the operation.
+        /// @param resultType      The result type, respectively the value of a constant.
+        /// @param symbol          The operator symbol or function name.
+        /// @param positions       The encoded expression string positions.
+        Command( int16_t opcodeBits, int qtyFunctionArgs, const OperationParam& parameter,
+                 const Box& resultType, const String& symbol, uinteger positions )
+        : bits               ( opcodeBits               )
+        , qtyArgs            ( uint16_t(qtyFunctionArgs))
+        , Parameter          ( parameter                )
+        , ResultType         ( resultType               )
+        , ExpressionPositions( positions                )
+        , DecompileSymbol    ( symbol                   )                                         {}
+
         /// Returns the opcode of this command.
         /// @return The masked command part of the opcode.
         constexpr OpCodes OpCode()                  const { return OpCodes(bits & Bits::CMD_MASK); }
@@ -226,6 +311,11 @@ struct VirtualMachine : VirtualMachineBase
         /// @return \c true if the command represents a jump, \c false otherwise.
         bool IsJump()                                              const { return (bits & 4) == 4; }
 
+        /// Returns the raw bits of the opcode, including the listing type and flags.
+        /// Used with serialization.
+        /// @return The raw bits of the opcode.
+        int16_t Bits()                                                        const { return bits; }
+
         /// Marks the command as the end of a conditional term.
         void SetEndOfConditionalFlag()                                                 { bits|= 8; }
 
@@ -237,6 +327,18 @@ struct VirtualMachine : VirtualMachineBase
 
         /// @return The number of arguments of a function call.
         int QtyArgs()                                                 const { return int(qtyArgs); }
+
+        /// @return The native operation of this command.
+        NativeOps NativeOp()                                          const { return nativeOp; }
+
+        /// @return The fusion of the native operation of this command.
+        Fusions   Fusion()                                              const { return fusion; }
+
+        /// Sets a native operation.
+        /// @param op          The native operation.
+        /// @param fusionType  Denotes how the operation is fused with subsequent commands.
+        void      SetNativeOp( NativeOps op, Fusions fusionType )
+        { nativeOp= op; fusion= fusionType; }
     }; // inner struct Command
 
     /// Static method that runs an expression program.
@@ -266,6 +368,30 @@ struct VirtualMachine : VirtualMachineBase
 
     #endif
 
+    /// Lowers commands that invoke callback functions of built-in operators of
+    /// plug-in \alib{expressions::plugins;Arithmetics} to
+    /// \alib{expressions::detail::VirtualMachine::Command;NativeOps;native operations}.
+    /// These are executed directly on the values of the stack, without invoking a callback
+    /// function, which would unbox the arguments and box the result.
+    /// In addition, the following patterns are fused into one command:
+    /// - A constant right-hand side argument followed by a binary operator.
+    /// - A comparison followed by a conditional jump.
+    ///
+    /// This method is invoked by \alib{expressions::detail;Program::AssembleFinalize}, unless flag
+    /// \alib{expressions;Compilation::NoNativeOperations} is set.
+    /// @param program  The program to lower.
+    ALIB_DLL static
+    void        LowerNativeOperations( Program& program );
+
+    /// Returns the native operation that corresponds to the given callback function.
+    /// This method is implemented with the callback functions of plug-in
+    /// \alib{expressions::plugins;Arithmetics}.
+    /// @param callback The callback function of a command.
+    /// @return The native operation, or \b %NativeOps::NONE if the callback is not a known
+    ///         built-in.
+    ALIB_DLL static
+    Command::NativeOps  NativeOpOf( CallbackDecl callback );
+
     /// The implementation of #Run, which itself is just initialization code.
     /// @param program      The program to run.
     /// @param scope        The scope to use.
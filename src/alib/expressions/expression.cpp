@@ -67,7 +67,7 @@ alib::Box  ExpressionVal::Evaluate( Scope& scope ) {
         Box result= static_cast<detail::Program*>(program)->Run( scope );
 
 
-    ALIB_DBG( DbgLastEvaluationTime= startTime.Age(); )
+    ALIB_DBG( DbgLastEvaluationTime.store( startTime.Age(), std::memory_order_relaxed ); )
 
     return result;
 }
@@ -85,9 +85,11 @@ class ExpressionVal
     Ticks::Duration     DbgAssemblyTime;
 
     /// Provides the time needed for the last evaluation of the expression.
+    /// With concurrent evaluations, this is the time of any of the recent evaluations.
+    /// The field is atomic, because concurrent evaluations write it in parallel.
     ///
     /// Note: This field is available only with debug-builds of the library.
-    Ticks::Duration     DbgLastEvaluationTime;
+    std::atomic<Ticks::Duration>    DbgLastEvaluationTime;
     #endif
 
   public:
@@ -138,6 +140,9 @@ class ExpressionVal
     ///
     /// The assertion will most probably give detailed information.
     ///
+    /// This method may be invoked by multiple threads in parallel, as long as each thread
+    /// passes a different \p{scope}. See class \alib{expressions;ScopePool} for details.
+    ///
     /// @param scope  The evaluation scope.
     /// @return The result of this evaluation of this expression node.
     ALIB_DLL Box        Evaluate(Scope& scope);
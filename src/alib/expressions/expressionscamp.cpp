@@ -29,6 +29,7 @@
     import   ALib.Camp;
     import   ALib.Camp.Base;
 #else
+#   include "ALib.Camp.Base.H"
 #   include "ALib.Expressions.Impl.H"
 #endif
 //========================================== Implementation ========================================
@@ -98,6 +99,7 @@ ExpressionsCamp::ExpressionsCamp()
       ALIB_ASSERT_ERROR( this == &EXPRESSIONS, "EXPR",
          "Instances of class Expressions must not be created. Use singleton alib::EXPRESSIONS" )
     #endif
+    BootstrapAddDependency( BASECAMP );
 }
 
 
@@ -609,6 +609,25 @@ enum class Compilation
     /// letter case.
     CallbackExceptionFallThrough                        = (1 << 14),
 
+    /// If this flag is set, the compiler does not use its plug-in dispatch index.
+    /// Instead, each syntax element is offered to all attached plug-ins, in the order of their
+    /// priority.
+    ///
+    /// \note
+    ///   The dispatch index only skips plug-ins which, by
+    ///   \alib{expressions;CompilerPlugin::CollectDispatchKeys;their own declaration}, are not
+    ///   able to compile a syntax element. Hence, the compilation results are the same with
+    ///   and without this flag. Other than for testing and measuring the index, there is no
+    ///   reason to set this flag.
+    NoPluginDispatchIndex                               = (1 << 15),
+
+    /// If this flag is set, the built-in arithmetic, comparison and boolean operators
+    /// are not lowered to native operations of the virtual machine. Instead, their
+    /// callback functions are invoked with each evaluation.
+    ///
+    /// \see Method \alib{expressions::detail;VirtualMachine::LowerNativeOperations}.
+    NoNativeOperations                                  = (1 << 16),
+
     /// If this flag is set, no optimizations are performed when assembling the program.
     ///
     /// \note
@@ -0,0 +1,107 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of module \alib_expressions of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib {  namespace expressions {
+
+//==================================================================================================
+/// Evaluates one compiled expression for each element of a range of input values, using the
+/// worker threads of a \alib{threadmodel;ThreadPool}.
+///
+/// The range is split into chunks of \p{chunkSize} elements, which are processed with function
+/// \alib{threadmodel;ParallelFor}. Hence, the calling thread participates in the evaluation.
+/// Each invocation of the loop function acquires one scope from the given \p{scopes} and
+/// evaluates the expression for each element of the chunks passed. Before each evaluation,
+/// callable \p{prepare} is invoked, which has to set the custom data of the scope according to
+/// the current element. After each evaluation, callable \p{consume} receives the result.
+///
+/// This function returns after all chunks were processed. In case the evaluation of an element
+/// throws, the remaining elements of its chunk are skipped, while other chunks are still
+/// processed. After all chunks are done, the first exception caught is rethrown.
+///
+/// \attention
+///   - Both callables are invoked concurrently from different threads. While \p{prepare}
+///     usually only writes to the (thread-exclusive) scope, \p{consume} usually stores the
+///     result with the element's index. Writing to distinct elements of a pre-sized container
+///     is fine, while, for example, appending to a shared container requires locking.
+///   - The box passed to \p{consume} may refer to data allocated in the scope, for example,
+///     in the case of string results. Such data has to be copied, because the scope is reused
+///     with the next evaluation.
+///   - Helper jobs scheduled by \alib{threadmodel;ParallelFor} might still be executed by the
+///     \p{pool} after this function returned. Before shutting the pool down,
+///     \alib{threadmodel;ThreadPool::WaitForAllIdle} has to be invoked.
+///   - The compiler of the expression must not be used to compile further expressions while
+///     this function runs. See class \alib{expressions;ScopePool} for details.
+///
+/// @tparam TIterator  The type of the iterators \p{begin} and \p{end}. Needs to be copyable,
+///                    incrementable and comparable.
+/// @tparam TPrepare   The type of \p{prepare}. Has to be invocable with
+///                    <c>(Scope&, TIterator)</c>.
+/// @tparam TConsume   The type of \p{consume}. Has to be invocable with
+///                    <c>(TIterator, Box&)</c>.
+/// @param pool        The thread pool to use.
+/// @param scopes      The pool of evaluation scopes.
+/// @param expression  The expression to evaluate.
+/// @param begin       The start of the range of input values.
+/// @param end         The end of the range of input values.
+/// @param prepare     The callable that prepares the scope for the evaluation of an element.
+/// @param consume     The callable that receives the result of an element.
+/// @param chunkSize   The number of elements which are skipped in case of an exception.
+///                    If \c 0 is given, which is the default, a chunk size is chosen that
+///                    creates four chunks per worker thread.
+//==================================================================================================
+template<typename TIterator, typename TPrepare, typename TConsume>
+void EvaluateAll( threadmodel::ThreadPool&  pool,
+                  ScopePool&                scopes,
+                  Expression&               expression,
+                  TIterator                 begin,
+                  TIterator                 end,
+                  TPrepare&&                prepare,
+                  TConsume&&                consume,
+                  integer                   chunkSize= 0 )
+{
+    integer qty= integer( std::distance( begin, end ) );
+    if( qty <= 0 )
+        return;
+    if( chunkSize <= 0 )
+        chunkSize= (std::max)( integer(1),
+                               qty / ( 4 * (std::max)( integer(1),
+                                                       integer(pool.Strategy.WorkersMax) ) ) );
+
+    // collect the start of each chunk, followed by the end of the range
+    std::vector<TIterator> chunks;
+    chunks.reserve( size_t( (qty + chunkSize - 1) / chunkSize + 1 ) );
+    for( integer remaining= qty ; remaining > 0 ; remaining-= chunkSize ) {
+        chunks.push_back( begin );
+        std::advance( begin, (std::min)( chunkSize, remaining ) );
+    }
+    chunks.push_back( end );
+
+    // evaluate the chunks and store the first exception caught
+    std::exception_ptr exception;
+    std::mutex         exceptionLock;
+    threadmodel::ParallelFor( pool, 0, integer(chunks.size()) - 1, 1, [&]( integer b, integer e ) {
+        ScopePool::Lease scope( scopes );
+        for( ; b < e ; ++b ) {
+            try
+            {
+                for( TIterator it= chunks[size_t(b)] ; it != chunks[size_t(b + 1)] ; ++it ) {
+                    prepare( scope.Get(), it );
+                    Box result= expression->Evaluate( scope.Get() );
+                    consume( it, result );
+            }   }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> guard( exceptionLock );
+                if( !exception )
+                    exception= std::current_exception();
+    }   }   } );
+
+    if( exception )
+        std::rethrow_exception( exception );
+}
+
+}} // namespace [alib::expressions]
@@ -518,6 +518,63 @@ ALIB_DBG(   ciFunction.DbgCallbackName  = "arrLen";  )
     return false;
 }
 
+CompilerPlugin::DispatchKeys Arithmetics::CollectDispatchKeys( DispatchKeyCollector& collector ) {
+    auto result= collectTableDispatchKeys( collector );
+
+    Token functionNames[1];
+    strings::util::LoadResourcedTokens( EXPRESSIONS, "CPALen", functionNames ALIB_DBG(,1) );
+    if(     functionNames[0].GetMinLength(0) == 0
+        ||  functionNames[0].GetDefinitionName().IsEmpty() )
+        return result & ~DispatchKeys::Functions;
+
+    collector.AddFunction( functionNames[0].GetDefinitionName().CharAtStart() );
+    return result;
+}
+
+void Arithmetics::CollectCallbacks( CallbackCollector& collector ) {
+    Calculus::CollectCallbacks( collector );
+    collector.Add( arrLen, "arrLen" );
+}
+
+}}} // namespace [alib::expressions::detail]
+
+//##################################################################################################
+// ### VirtualMachine::NativeOpOf
+//##################################################################################################
+// This method of the virtual machine is implemented here, because it needs access to the
+// callback functions of this compilation unit.
+namespace alib {  namespace expressions { namespace detail {
+
+VirtualMachine::Command::NativeOps VirtualMachine::NativeOpOf( CallbackDecl callback ) {
+    using N= Command::NativeOps;
+    using namespace plugins;
+    static const std::pair<CallbackDecl, N> table[]=
+    {
+        { add_II    , N::AddII  }, { sub_II    , N::SubII  }, { mul_II    , N::MulII  },
+        { div_II    , N::DivII  }, { mod_II    , N::ModII  },
+        { bitAnd    , N::BitAnd }, { bitOr     , N::BitOr  }, { bitXOr    , N::BitXOr },
+        { shfL_II   , N::ShlII  }, { shfR_II   , N::ShrII  },
+        { sm_II     , N::SmII   }, { smeq_II   , N::SmEqII }, { gt_II     , N::GtII   },
+        { gteq_II   , N::GtEqII }, { eq_II     , N::EqII   }, { neq_II    , N::NeqII  },
+
+        { add_FF    , N::AddFF  }, { sub_FF    , N::SubFF  }, { mul_FF    , N::MulFF  },
+        { div_FF    , N::DivFF  },
+        { sm_FF     , N::SmFF   }, { smeq_FF   , N::SmEqFF }, { gt_FF     , N::GtFF   },
+        { gteq_FF   , N::GtEqFF }, { eq_FF     , N::EqFF   }, { neq_FF    , N::NeqFF  },
+
+        { boolAnd_BB, N::AndBB  }, { boolOr_BB , N::OrBB   },
+        { eq_BB     , N::EqBB   }, { neq_BB    , N::NeqBB  },
+
+        { neg_I     , N::NegI   }, { neg_F     , N::NegF   },
+        { bitNot    , N::BitNot }, { boolNot_B , N::NotB   },
+    };
+
+    for( auto& entry : table )
+        if( entry.first == callback )
+            return entry.second;
+    return N::NONE;
+}
+
 }}} // namespace [alib::expressions::detail]
 
 #undef BOL
@@ -238,6 +238,20 @@ struct Arithmetics   : public plugins::Calculus
     ALIB_DLL
     virtual bool    TryCompilation( CIFunction& ciFunction )                               override;
 
+    /// Announces the keys of the tables of parent class \b %Calculus and additionally the name of
+    /// function <b>%Length(array)</b>.
+    ///
+    /// @param  collector  The collector to announce the keys to.
+    /// @return The categories for which all keys were announced.
+    ALIB_DLL
+    virtual DispatchKeys CollectDispatchKeys( DispatchKeyCollector& collector )            override;
+
+    /// Invokes the parent's method and additionally announces the callback function of
+    /// function <b>%Length(array)</b>.
+    ///
+    /// @param  collector  The collector to announce the callback functions to.
+    ALIB_DLL
+    virtual void         CollectCallbacks( CallbackCollector& collector )                  override;
 };
 
 //==================================================================================================
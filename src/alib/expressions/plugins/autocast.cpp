@@ -161,6 +161,14 @@ ALIB_DBG(ciAutoCast.DbgCallbackNameRhs         = upgradeCastDBG; )
     return true;
 }
 
+void AutoCast::CollectCallbacks( CallbackCollector& collector ) {
+    collector.Add( castI2F   , "castI2F"    );
+    collector.Add( castB2F   , "castB2F"    );
+    collector.Add( castB2I   , "castB2I"    );
+    collector.Add( CBToString, "CBToString" );
+    collector.Add( ToBoolean , "ToBoolean"  );
+}
+
 
 
 }}} // namespace [alib::expressions::detail]
@@ -46,6 +46,12 @@ struct AutoCast  : public CompilerPlugin
     /// @return \c true if an entry was found. \c false otherwise.
     ALIB_DLL
     virtual bool    TryCompilation( CIAutoCast& ciAutoCast )                               override;
+
+    /// Announces the callback functions of the auto-casts offered.
+    ///
+    /// @param  collector  The collector to announce the callback functions to.
+    ALIB_DLL
+    virtual void    CollectCallbacks( CallbackCollector& collector )                       override;
 };
 
 }}} // namespace [alib::expressions::detail]
@@ -497,6 +497,58 @@ Box any2Int ( expressions::Scope&, ArgIterator argsBegin, ArgIterator )
 //! @endcond
 
 
+//##################################################################################################
+// Dispatch keys and callbacks
+//##################################################################################################
+CompilerPlugin::DispatchKeys Calculus::collectTableDispatchKeys( DispatchKeyCollector& collector ) {
+    // operators and aliases
+    auto addOperator= [&collector]( const OperatorKey& key ) {
+        if( key.rhs == typeid(void) )
+            collector.AddUnaryOp ( key.op, key.lhs );
+        else
+            collector.AddBinaryOp( key.op, key.lhs, key.rhs );
+    };
+    for( auto& entry : Operators       )   addOperator( entry.first );
+    for( auto& entry : OperatorAliases )   addOperator( entry.first );
+
+    // constant identifiers and functions
+    auto result= DispatchKeys::UnaryOperators | DispatchKeys::BinaryOperators;
+    auto addFunction= [&collector]( const Token& descriptor ) {
+        if(    descriptor.GetMinLength(0) == 0
+            || descriptor.GetDefinitionName().IsEmpty() )
+            return false;
+        collector.AddFunction( descriptor.GetDefinitionName().CharAtStart() );
+        return true;
+    };
+    bool allFunctions= true;
+    for( auto& entry : ConstantIdentifiers )   allFunctions&= addFunction( entry.Descriptor );
+    for( auto& entry : Functions           )   allFunctions&= addFunction( entry.Descriptor );
+    if( allFunctions )
+        result|= DispatchKeys::Functions;
+
+    return result;
+}
+
+void Calculus::CollectCallbacks( CallbackCollector& collector ) {
+    NString256 name;
+    for( size_t i= 0 ; i < Functions.size() ; ++i )
+        if( Functions[i].Callback != nullptr )
+            collector.Add( Functions[i].Callback,
+                           name.Reset("F:") << Functions[i].Descriptor.GetDefinitionName()
+                                            << ':' << i );
+
+    for( auto& entry : Operators )
+        if( std::get<0>(entry.second) != nullptr )
+            collector.Add( std::get<0>(entry.second),
+                           name.Reset("O:") << entry.first.op << ':' << entry.first.lhs.name()
+                                                              << ':' << entry.first.rhs.name() );
+
+    for( size_t i= 0 ; i < AutoCasts.size() ; ++i )
+        if( AutoCasts[i].Callback != nullptr )
+            collector.Add( AutoCasts[i].Callback, name.Reset("C:") << i );
+    collector.Add( any2Int, "any2Int" );
+}
+
 bool Calculus::TryCompilation( CIAutoCast& ciAutoCast ) {
     bool result= false;
 
@@ -791,6 +791,47 @@ struct Calculus   : public CompilerPlugin
     ///         was added to \p{autoCast}. \c false otherwise.
     ALIB_DLL
     virtual bool    TryCompilation(CIAutoCast& autoCast)                                   override;
+
+  //################################################################################################
+  // Dispatch keys
+  //################################################################################################
+  protected:
+    /// Announces the keys of all entries of the fields #Operators and #OperatorAliases, as well
+    /// as the first characters of the descriptors found in fields #ConstantIdentifiers and
+    /// #Functions.
+    ///
+    /// Keys of functions are not announced, if a descriptor allows omitting its first character,
+    /// which is the case if its minimum length of the first segment is \c 0.
+    ///
+    /// This class does not override method
+    /// \alib{expressions;CompilerPlugin::CollectDispatchKeys}, hence derived types are offered
+    /// every syntax element by default. Derived types whose methods \b TryCompilation match
+    /// only the entries of the tables of this class may opt in to the dispatch index by
+    /// overriding \b CollectDispatchKeys and returning the result of this method.
+    /// Derived types that match further syntax elements have to announce those in addition,
+    /// or remove the corresponding category from the result.
+    ///
+    /// @param  collector  The collector to announce the keys to.
+    /// @return The categories for which all keys were announced.
+    ALIB_DLL
+    DispatchKeys    collectTableDispatchKeys( DispatchKeyCollector& collector );
+
+  public:
+
+    /// Announces the callback functions of the entries of fields #Functions, #Operators and
+    /// #AutoCasts, as well as the internal callback used with auto-casts that do not specify a
+    /// callback function.
+    ///
+    /// The names are built from the kind of the entry and its key. For example, functions
+    /// are named by their definition name and their index within table #Functions.
+    ///
+    /// \attention
+    ///   Derived types that provide callback functions which are not listed in the tables of this
+    ///   class, have to override this method and announce them in addition.
+    ///
+    /// @param  collector  The collector to announce the callback functions to.
+    ALIB_DLL
+    virtual void         CollectCallbacks( CallbackCollector& collector )                  override;
 };
 
 }} // namespace alib[::expressions::plugin]
@@ -143,6 +143,14 @@ struct DateAndTime   : public plugins::Calculus
     /// Virtual destructor
     virtual    ~DateAndTime()                                                            override {}
 
+    /// Announces the keys of the tables of parent class \b %Calculus, which are complete for
+    /// this plug-in.
+    ///
+    /// @param  collector  The collector to announce the keys to.
+    /// @return The categories for which all keys were announced.
+    virtual DispatchKeys CollectDispatchKeys( DispatchKeyCollector& collector )            override
+    { return collectTableDispatchKeys( collector ); }
+
     /// Static initialization function.
     /// Called once during \ref alib_mod_bs "library initialization".
     static ALIB_DLL
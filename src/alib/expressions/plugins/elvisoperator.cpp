@@ -69,5 +69,8 @@ bool ElvisOperator::TryCompilation( CIBinaryOp&   ciBinaryOp    ) {
     return true;
 }
 
+void ElvisOperator::CollectCallbacks( CallbackCollector& collector )
+{ collector.Add( elvis, "elvis" ); }
+
 }}} // namespace [alib::expressions::detail]
 //! @endcond
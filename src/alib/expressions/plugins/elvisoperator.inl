@@ -50,6 +50,11 @@ struct ElvisOperator   :  public CompilerPlugin
     ALIB_DLL
     virtual bool    TryCompilation( CIBinaryOp& ciBinaryOp )                               override;
 
+    /// Announces the callback function of the elvis operator.
+    ///
+    /// @param  collector  The collector to announce the callback functions to.
+    ALIB_DLL
+    virtual void    CollectCallbacks( CallbackCollector& collector )                       override;
 };
 
 }}} // namespace [alib::expressions::detail]
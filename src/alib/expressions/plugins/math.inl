@@ -71,6 +71,14 @@ struct Math   : public plugins::Calculus
 
     /// Virtual destructor
     virtual    ~Math()                                                                   override {}
+
+    /// Announces the keys of the tables of parent class \b %Calculus, which are complete for
+    /// this plug-in.
+    ///
+    /// @param  collector  The collector to announce the keys to.
+    /// @return The categories for which all keys were announced.
+    virtual DispatchKeys CollectDispatchKeys( DispatchKeyCollector& collector )            override
+    { return collectTableDispatchKeys( collector ); }
 };
 
 
@@ -548,6 +548,12 @@ bool Strings::TryCompilation( CIBinaryOp& ciBinaryOp ) {
     return true;
 }
 
+void Strings::CollectCallbacks( CallbackCollector& collector ) {
+    Calculus::CollectCallbacks( collector );
+    collector.Add( add_SX, "add_SX" );
+    collector.Add( add_XS, "add_XS" );
+}
+
 }}} // namespace [alib::expressions::detail]
 
 
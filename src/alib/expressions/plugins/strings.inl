@@ -315,6 +315,21 @@ struct Strings   : public plugins::Calculus
     ALIB_DLL
     virtual bool    TryCompilation( CIBinaryOp&   ciBinaryOp )                             override;
 
+    /// Announces the keys of the tables of parent class \b %Calculus. Because the concatenation
+    /// operator <c>'+'</c> accepts arbitrary types, category \b %DispatchKeys::BinaryOperators
+    /// is removed from the result.
+    ///
+    /// @param  collector  The collector to announce the keys to.
+    /// @return The categories for which all keys were announced.
+    virtual DispatchKeys CollectDispatchKeys( DispatchKeyCollector& collector )            override
+    { return collectTableDispatchKeys( collector ) & ~DispatchKeys::BinaryOperators; }
+
+    /// Invokes the parent's method and additionally announces the callback functions of the
+    /// concatenation operator <c>'+'</c> with arbitrary types.
+    ///
+    /// @param  collector  The collector to announce the callback functions to.
+    ALIB_DLL
+    virtual void         CollectCallbacks( CallbackCollector& collector )                  override;
 };
 
 //==================================================================================================
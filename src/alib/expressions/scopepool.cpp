@@ -0,0 +1,85 @@
+//##################################################################################################
+//  ALib C++ Library
+//
+//  Copyright 2013-2025 A-Worx GmbH, Germany
+//  Published under 'Boost Software License' (a free software license, see LICENSE.txt)
+//##################################################################################################
+#include "alib_precompile.hpp"
+#if !defined(ALIB_C20_MODULES) || ((ALIB_C20_MODULES != 0) && (ALIB_C20_MODULES != 1))
+#   error "Symbol ALIB_C20_MODULES has to be given to the compiler as either 0 or 1"
+#endif
+#if ALIB_C20_MODULES
+    module;
+#endif
+//========================================= Global Fragment ========================================
+#include "alib/expressions/expressions.prepro.hpp"
+
+//============================================== Module ============================================
+#if ALIB_C20_MODULES
+    module ALib.Expressions;
+    import   ALib.Lang;
+#   if !ALIB_SINGLE_THREADED
+    import   ALib.Threads;
+#   endif
+#else
+#   include "ALib.Lang.H"
+#   if !ALIB_SINGLE_THREADED
+#      include "ALib.Threads.H"
+#   endif
+#   include "ALib.Expressions.H"
+#endif
+//========================================== Implementation ========================================
+namespace alib {  namespace expressions {
+
+ScopePool::ScopePool( SPFormatter& pFormatter )
+: formatter( pFormatter ) {
+    ALIB_DBG( IF_ALIB_THREADS( lock.Dbg.Name= "ExpressionScopePool"; ) )
+}
+
+ScopePool::~ScopePool() {
+    ALIB_ASSERT_WARNING( integer(unused.size()) == created, "EXPR",
+        "ScopePool destructed while {} scope(s) are still acquired.",
+        created - integer(unused.size()) )
+    Clear();
+}
+
+SPFormatter ScopePool::cloneFormatter() {
+    ALIB_LOCK_WITH(lock)
+    return formatter->Clone();
+}
+
+Scope*  ScopePool::createScope() {
+    SPFormatter scopeFormatter= cloneFormatter();
+    return new Scope( scopeFormatter );
+}
+
+Scope&  ScopePool::Acquire() {
+    {ALIB_LOCK_WITH(lock)
+        if( !unused.empty() ) {
+            Scope* scope= unused.back();
+            unused.pop_back();
+            return *scope;
+        }
+        ++created;
+    }
+
+    // create outside the lock
+    return *createScope();
+}
+
+void    ScopePool::Release( Scope& scope ) {
+    ALIB_LOCK_WITH(lock)
+    ALIB_ASSERT_ERROR( integer(unused.size()) < created, "EXPR",
+                       "Scope released to ScopePool that was not acquired from it." )
+    unused.push_back( &scope );
+}
+
+void    ScopePool::Clear() {
+    ALIB_LOCK_WITH(lock)
+    for( Scope* scope : unused )
+        delete scope;
+    created-= integer(unused.size());
+    unused.clear();
+}
+
+}} // namespace [alib::expressions]
@@ -0,0 +1,139 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of module \alib_expressions of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib {  namespace expressions {
+
+//==================================================================================================
+/// A pool of evaluation scopes, which allows evaluating one compiled
+/// \alib{expressions;Expression} concurrently from multiple threads.
+///
+/// After compilation, expressions and their programs are not modified anymore. Therefore, one
+/// expression instance may be shared between threads, as long as each thread uses its own
+/// \alib{expressions;Scope}. This class manages such scopes: Method #Acquire hands out a scope
+/// that is currently not used by any other thread, and method #Release returns it to the pool.
+/// Scopes are created on demand with the virtual method #createScope and are reused afterward.
+/// Thus, the number of scopes created equals the maximum number of evaluations that ever ran in
+/// parallel.
+///
+/// The allocator of a scope is reset by the virtual machine with each evaluation (see
+/// \alib{expressions;Scope::Reset}). Because \alib{MonoAllocator} resets keep the buffers
+/// allocated, a pooled scope does not perform heap allocations anymore once it was used for
+/// a few evaluations. Results of an evaluation which are allocated in the scope
+/// (for example, strings) remain valid until the scope is released.
+///
+/// Evaluation-time nested expressions (see \ref alib_expressions_nested) are supported:
+/// The compiler's list of named expressions is protected by an internal lock, which is acquired
+/// when nested expressions are retrieved or compiled at evaluation-time.
+/// Nevertheless, the compiler must not be used for compiling other expressions, while evaluations
+/// are running.
+///
+/// Derived types may override method #createScope to create custom scopes, which provide
+/// access to application data to custom compiler plug-ins.
+///
+/// \see Helper function \alib{expressions;EvaluateAll}, which uses this type to evaluate
+///      an expression for a range of input values on a \alib{threadmodel;ThreadPool}.
+//==================================================================================================
+class ScopePool
+{
+  protected:
+    #if !ALIB_SINGLE_THREADED
+    /// The lock protecting the list of unused scopes.
+    threads::Lock           lock;
+    #endif
+
+    /// The formatter that the formatters of the scopes created are cloned from.
+    SPFormatter             formatter;
+
+    /// The scopes currently not in use.
+    std::vector<Scope*>     unused;
+
+    /// The number of scopes created.
+    integer                 created                                                              =0;
+
+    /// Creates a new evaluation scope.
+    /// The default implementation creates an instance of class \b Scope, which receives its
+    /// own clone of #formatter. A formatter must not be shared between scopes, because
+    /// built-in and custom plug-ins use the formatter of a scope while evaluating, which
+    /// changes its internal state (for example, with expression function \b Format).
+    /// Derived types have to likewise pass a result of #cloneFormatter to the scopes created.
+    ///
+    /// This method is invoked without holding the lock of this pool.
+    /// @return A new evaluation scope, allocated with the heap.
+    ALIB_DLL virtual Scope* createScope();
+
+    /// Clones #formatter, while the lock of this pool is acquired.
+    /// @return A clone of #formatter.
+    ALIB_DLL SPFormatter    cloneFormatter();
+
+  public:
+    /// RAII-style type that acquires a scope from a pool with construction and releases it with
+    /// destruction.
+    class Lease
+    {
+      protected:
+        ScopePool&  pool;   ///< The pool that the scope was acquired from.
+        Scope&      scope;  ///< The acquired scope.
+
+      public:
+        /// Constructor. Acquires a scope.
+        /// @param scopePool The pool to acquire a scope from.
+        Lease( ScopePool& scopePool )
+        : pool ( scopePool )
+        , scope( scopePool.Acquire() )                                                            {}
+
+        /// Destructor. Releases the scope.
+        ~Lease()                                                       { pool.Release( scope ); }
+
+        /// Deleted copy constructor.
+        Lease( const Lease& )                                                               =delete;
+
+        /// Deleted copy assignment.
+        void operator=( const Lease& )                                                      =delete;
+
+        /// @return The scope acquired.
+        Scope&  Get()                                                             { return scope; }
+
+        /// @return The scope acquired.
+        Scope*  operator->()                                                     { return &scope; }
+    };
+
+    /// Constructor.
+    /// @param pFormatter The formatter that the formatters of the scopes are cloned from.
+    ///                   Usually field \alib{expressions;Compiler::CfgFormatter} is given.
+    ALIB_DLL                ScopePool( SPFormatter& pFormatter );
+
+    /// Destructor. Deletes all scopes. All scopes have to be released before destruction.
+    ALIB_DLL virtual       ~ScopePool();
+
+    /// Deleted copy constructor.
+    ScopePool( const ScopePool& )                                                           =delete;
+
+    /// Deleted copy assignment.
+    void operator=( const ScopePool& )                                                      =delete;
+
+    /// Returns a scope that is not used by any other thread. If no unused scope is available,
+    /// a new one is created with #createScope.
+    /// @return The scope to use for evaluation.
+    ALIB_DLL Scope&         Acquire();
+
+    /// Returns a scope received with #Acquire to the pool.
+    /// @param scope The scope to release.
+    ALIB_DLL void           Release( Scope& scope );
+
+    /// Deletes all currently unused scopes.
+    ALIB_DLL void           Clear();
+
+    /// @return The number of scopes created (and not cleared) by this pool.
+    integer                 Size()                                          const { return created; }
+}; // class ScopePool
+
+} // namespace alib[::expressions]
+
+/// Type alias in namespace \b alib.
+using     ExpressionScopePool=    expressions::ScopePool;
+
+} // namespace [alib]
@@ -113,6 +113,14 @@ class FileExpressions
         /// Constructor
         /// @param compiler The compiler that this plugin will be attached to.
         Plugin( Compiler& compiler );
+
+        /// Announces the keys of the tables of parent class \b %Calculus, which are complete for
+        /// this plug-in.
+        ///
+        /// @param  collector  The collector to announce the keys to.
+        /// @return The categories for which all keys were announced.
+        virtual DispatchKeys CollectDispatchKeys( DispatchKeyCollector& collector )        override
+        { return collectTableDispatchKeys( collector ); }
     };
 
   public:
@@ -459,6 +459,69 @@ IF_ALIB_THREADS( , SharedLock*                      lock) ,
     int MonitorStop( FTreeListener*  listener );
 }; // FTree
 
+/// A sorter for iterating instances of class \alib{files;FTree} with type
+/// \alib{containers;StringTreeIterator}, which orders the nodes by their name, size, or
+/// modification date. Nodes with equal size or date are ordered by their name.
+///
+/// Sort keys are provided with method #GetSortKey. With a field different to
+/// \alib{files::FTreeSorter;Fields;Name}, the primary key is the size, respectively the date,
+/// while the secondary key holds the leading characters of the name.
+/// Thus, the file information only needs to be read once per node.
+struct FTreeSorter : StringTreeIterator<FTree>::NameSorter {
+    /// The fields that nodes are sorted by.
+    enum class Fields {
+        Name,   ///< Sorts by name.
+        Size,   ///< Sorts by size and then by name.
+        MDate,  ///< Sorts by modification date and then by name.
+    };
+
+    /// The field to sort by.
+    Fields          Field                                                            = Fields::Name;
+
+    /// Returns the value of the selected field, transformed into an unsigned integral
+    /// that keeps the order of the field values.
+    /// @param finfo The file information to read the field from.
+    /// @return The value to sort.
+    uint64_t FieldValue( const FInfo& finfo )                                                const {
+        return Field == Fields::Size ? uint64_t( finfo.Size() )
+                                     : uint64_t( finfo.MDate().ToRaw() ) ^ (uint64_t(1) << 63);
+    }
+
+    /// Compares the selected field and, if equal, the names of the nodes.
+    /// @param lhs  The left-hand side cursor to the node to compare.
+    /// @param rhs  The right-hand side cursor to the node to compare.
+    /// @return Returns \c true if \p{lhs} is 'smaller' than \p{rhs}, and \c false otherwise.
+    bool Compare( const FTree::ConstCursor& lhs, const FTree::ConstCursor& rhs )        override {
+        if( Field != Fields::Name ) {
+            uint64_t l= FieldValue( *lhs );
+            uint64_t r= FieldValue( *rhs );
+            if( l != r )
+                return Descending ? l > r : l < r;
+        }
+        return NameSorter::Compare( lhs, rhs );
+    }
+
+    /// Provides the sort key of the given node.
+    /// As with the parent's method, the name is not included in the key in the case of
+    /// case-insensitive sorting of 2- or 4-byte characters. The secondary key is left zero then,
+    /// and nodes of equal size or date are ordered by method #Compare.
+    /// @param node  The node to create a key for.
+    /// @param key   The key to set.
+    /// @return \c true, unless the parent's method is used and returns \c false.
+    bool GetSortKey( const FTree::ConstCursor&                   node,
+                     StringTreeIterator<FTree>::SortKey&         key  )                   override {
+        if( Field == Fields::Name )
+            return NameSorter::GetSortKey( node, key );
+        key.Primary  = FieldValue( *node );
+        key.Secondary= sizeof(FTree::CharacterType) == 1 || CaseSensitive
+                       ? NameKey( node.Name(), CaseSensitive ).Primary
+                       : 0;
+        if( Descending )
+            key.Invert();
+        return true;
+    }
+};
+
 
 /// Utility type which implements \alib{monomem;TSharedMonoVal} with class \alib{files;FTree}.
 /// The result of combining both is an automatic pointer to a \b %FTree that is "self-contained"
@@ -986,6 +1049,9 @@ void FFormat_File( const Box& box, const String& formatSpec, NumberFormat& nf, A
 /// Type alias in namespace \b alib.
 using     FTree      =   files::FTree;
 
+/// Type alias in namespace \b alib.
+using     FTreeSorter=   files::FTreeSorter;
+
 #if !ALIB_SINGLE_THREADED || DOXYGEN
 DOX_MARKER([DOX_MANUAL_ALIASES_FTREE])
 /// Type alias in namespace \b alib.
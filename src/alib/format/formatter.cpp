@@ -43,10 +43,16 @@ SPFormatter                 Formatter::Default;
 
 
 
-#if !DOXYGEN
+integer Formatter::EstimateLength( const boxing::BoxesSpan& args ) {
+    integer result= 0;
+    for( size_t i= 0 ; i < size_t(args.Size()) ; ++i ) {
+        const Box& arg= args[i];
+        result+= arg.IsArrayOf<character>() ? arg.UnboxLength() : 8;
+    }
+    return result;
+}
 
-template<>
-Formatter& Formatter::formatLoop( AString& target, const BoxesMA&  args )                  {ALIB_DCS
+Formatter& Formatter::formatLoop( AString& target, const boxing::BoxesSpan&  args )       {ALIB_DCS
     ALIB_DBG_PREVENT_RECURSIVE_METHOD_CALLS
 
     // initialize formatters
@@ -55,6 +61,11 @@ Formatter& Formatter::formatLoop( AString& target, const BoxesMA&  args )
         formatter->initializeFormat();
     while( (formatter= formatter->Next.Get()) != nullptr );
 
+    // grow the target once. (Strings using an external buffer are not grown, to avoid
+    // replacing a local buffer with a heap allocation that the result might not need.)
+    if( target.HasInternalBuffer() || target.IsNull() )
+        target.EnsureRemainingCapacity( EstimateLength( args ) );
+
     // loop over boxes
     integer argIdx= 0;
     while ( argIdx < args.Size() - 1 ) {
@@ -95,7 +106,6 @@ Formatter& Formatter::formatLoop( AString& target, const BoxesMA&  args )
         target.template _<NC>( args.back() );
     return *this;
 }
-#endif // !DOXYGEN
 
 
 
@@ -108,22 +118,5 @@ void Formatter::CloneSettings( Formatter& reference ) {
         Next->CloneSettings( *reference.Next );
 }
 
-#if !DOXYGEN
-template<>
-Formatter& Formatter::formatLoop(AString& target, const boxing::TBoxes<lang::HeapAllocator>& args) {
-    boxes.clear();
-    boxes.Add( args );
-    formatLoop( target, boxes );
-    return *this;
-}
-
-template<>
-Formatter& Formatter::formatLoop(AString& target, const boxing::TBoxes<PoolAllocator>&       args) {
-    boxes.clear();
-    boxes.Add( args );
-    formatLoop( target, boxes );
-    return *this;
-}
-#endif // !DOXYGEN
 
 } // namespace [alib::format]
@@ -158,10 +158,9 @@ class Formatter
     /// This is a convenience method to allow single-line format invocations.
     ///
     /// \note
-    ///   This method uses <c>static_assert</c> to disallow the invocation with one
-    ///   variadic argument of type \alib{boxing;TBoxes} or a derived type.
-    ///   This is to ensure that for these box containers, the more efficient method #FormatArgs
-    ///   is used.
+    ///   If only one argument is given, which is a container of boxes like
+    ///   \alib{boxing;TBoxes} or \alib{boxing;TLocalBoxes}, method #FormatArgs is invoked with it
+    ///   and the boxes are not copied.
     ///
     /// @tparam TArgs   Variadic template type list.
     /// @param target   An AString that takes the result.
@@ -169,24 +168,20 @@ class Formatter
     /// @return A reference to this formatter to allow concatenated operations.
     template <typename... TArgs>
     Formatter&          Format( AString& target, TArgs&&... args ) {
-        // assert that this method is not used with Boxes containers.
-        // Those are to be processed with FormatArgs
-        constexpr  bool Argument_has_type_Boxes=
-              (sizeof...(TArgs) == 1)
-           && (   std::is_base_of_v< Boxes  , std::decay< std::tuple_element<0, std::tuple<TArgs...>>>>
-               || std::is_base_of_v< BoxesMA, std::decay< std::tuple_element<0, std::tuple<TArgs...>>>>
-               || std::is_base_of_v< BoxesPA, std::decay< std::tuple_element<0, std::tuple<TArgs...>>>> );
-        static_assert( !Argument_has_type_Boxes,
-                       "To pass a container of type Boxes to a formatter, use method FormatArgs." );
-
-        // create argument objects using implicit constructor invocation
-        boxes.clear();
-        boxes.Add( std::forward<TArgs>( args )... );
-
-        // invoke format
-        formatLoop( target, boxes );
-        return *this;
-    }
+        // containers of boxes are processed without copying
+        if constexpr (    sizeof...(TArgs) == 1
+                       && ( std::is_convertible_v<const std::remove_cvref_t<TArgs>&,
+                                                  boxing::BoxesSpan> && ... ) )
+            return FormatArgs( target, boxing::BoxesSpan( args... ) );
+        else {
+            // create argument objects using implicit constructor invocation
+            boxes.clear();
+            boxes.Add( std::forward<TArgs>( args )... );
+
+            // invoke format
+            formatLoop( target, boxes );
+            return *this;
+    }   }
 
     /// Formats the internal list of arguments that is returned by methods #GetArgContainer
     /// and #Reset.
@@ -207,17 +202,31 @@ class Formatter
     /// the internally allocated object, which is returned by methods #GetArgContainer
     /// and #Reset.
     ///
+    /// The arguments are accepted as \alib{boxing;BoxesSpan}, which is implicitly constructed
+    /// from containers like \alib{boxing;TBoxes} (with any allocator) or
+    /// \alib{boxing;TLocalBoxes}. The boxes are not copied.
+    ///
     /// @param args       The arguments to be used with formatters.
     /// @param target     An AString that takes the result.
     /// @return A reference to this formatter to allow concatenated operations.
-    template<typename TAllocator>
-    Formatter&          FormatArgs( AString& target, const boxing::TBoxes<TAllocator>& args )
+    Formatter&          FormatArgs( AString& target, const boxing::BoxesSpan& args )
     {
         ALIB_DCS
         return formatLoop( target, args );
     }
 
 
+    /// Estimates the length of the result of formatting the given arguments. The estimate is
+    /// the sum of the lengths of all character arrays found in \p{args} plus eight characters
+    /// for any other argument.
+    ///
+    /// The estimate is used to grow the target string once, before formatting starts, instead
+    /// of growing it repeatedly while the arguments are appended.
+    /// @param args The arguments to format.
+    /// @return The estimated length of the formatted result.
+    ALIB_DLL
+    static integer      EstimateLength( const boxing::BoxesSpan& args );
+
     /// Clones and returns a copy of this formatter.
     ///
     /// If a formatter is attached to field \alib{format;Formatter::Next}, it is
@@ -295,10 +304,10 @@ class Formatter
     /// @param startArgument The first object in \p{args} to convert.
     ///
     /// @return The number of args consumed.
-    virtual int         format( AString&         target,
-                                const String&    formatString,
-                                const BoxesMA&   args,
-                                int              startArgument )                                 =0;
+    virtual int         format( AString&                  target,
+                                const String&             formatString,
+                                const boxing::BoxesSpan&  args,
+                                int                       startArgument )                        =0;
 
     /// The format loop implementation. Searches format strings in \p{args} and tests
     /// if \c this or #Next is capable of processing it.
@@ -306,16 +315,10 @@ class Formatter
     /// @param target     An AString that takes the result.
     /// @param args       The objects to be used with formatters.
     /// @return A reference to this formatter to allow concatenated operations.
-    template<typename TAllocator>
-    Formatter&      formatLoop( AString& target, const boxing::TBoxes<TAllocator>& args );
+    ALIB_DLL
+    Formatter&      formatLoop( AString& target, const boxing::BoxesSpan& args );
 };
 
-#if !DOXYGEN
-template<> ALIB_DLL Formatter& Formatter::formatLoop( AString& target, const boxing::TBoxes<lang::HeapAllocator>& args );
-template<> ALIB_DLL Formatter& Formatter::formatLoop( AString& target, const boxing::TBoxes<MonoAllocator>& args );
-template<> ALIB_DLL Formatter& Formatter::formatLoop( AString& target, const boxing::TBoxes<PoolAllocator>& args );
-#endif // !DOXYGEN
-
 
 inline
 Formatter&      Formatter::FormatArgs( AString& target )
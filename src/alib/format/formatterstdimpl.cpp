@@ -60,10 +60,10 @@ FormatterStdImpl::FormatterStdImpl( const String& formatterClassName )
     argumentCountStartsWith1= false;
 }
 
-int  FormatterStdImpl::format( AString&        pTargetString,
-                               const String&   pFormatString,
-                               const BoxesMA&  pArguments,
-                               int             pArgOffset        ) {
+int  FormatterStdImpl::format( AString&                  pTargetString,
+                               const String&             pFormatString,
+                               const boxing::BoxesSpan&  pArguments,
+                               int                       pArgOffset        ) {
     // save parameters/init state
     targetString=             &pTargetString;
     targetStringStartLength=  pTargetString.Length();
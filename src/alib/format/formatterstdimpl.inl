@@ -270,7 +270,7 @@ class FormatterStdImpl : public Formatter
     AString*                targetString;
 
     /// The list of arguments provided with method #Format.
-    const BoxesMA*          arguments;
+    const boxing::BoxesSpan* arguments;
 
     /// The length of the target string before adding the formatted contents.
     integer                 targetStringStartLength;
@@ -318,10 +318,10 @@ class FormatterStdImpl : public Formatter
     ///
     /// @return The number of args consumed.
     ALIB_DLL
-    virtual int             format( AString&        targetString,
-                                    const String&   formatString,
-                                    const BoxesMA&  arguments,
-                                    int             argOffset )                            override;
+    virtual int             format( AString&                  targetString,
+                                    const String&             formatString,
+                                    const boxing::BoxesSpan&  arguments,
+                                    int                       argOffset )                  override;
 
 
   //################################################################################################
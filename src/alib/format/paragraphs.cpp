@@ -121,8 +121,7 @@ Paragraphs&     Paragraphs::Clear() {
 
 //! @cond NO_DOX
 
-template<>
-void   Paragraphs::Add( boxing::TBoxes<MonoAllocator>&  args ) {
+void   Paragraphs::Add( const boxing::BoxesSpan&  args ) {
     integer startIdx= Buffer.Length();
     Formatter->FormatArgs( Buffer, args ); // may throw!
 
@@ -167,7 +166,7 @@ void throwMarkerException( FMTExceptions eType, String& markedBuffer, integer er
 }
 #   include "ALib.Lang.CIMethods.H"
     
-template<> void   Paragraphs::AddMarked( boxing::TBoxes<MonoAllocator>&  args ) {
+void   Paragraphs::AddMarked( const boxing::BoxesSpan&  args ) {
     character searchCharBuf[2];
               searchCharBuf[0]= MarkerChar;
               searchCharBuf[1]= '\n';
@@ -436,30 +435,6 @@ void  Paragraphs::Format( AString&      text,
 }   }
 
 
-#if !DOXYGEN
-template<> void   Paragraphs::Add( boxing::TBoxes<lang::HeapAllocator>&  args ) {
-    boxes.clear();
-    boxes.Add(args);
-    Add(boxes);
-}
-
-template<> void   Paragraphs::Add( boxing::TBoxes<PoolAllocator>&  args ) {
-    boxes.clear();
-    boxes.Add(args);
-    Add(boxes);
-}
-template<> void   Paragraphs::AddMarked( boxing::TBoxes<lang::HeapAllocator>&  args ) {
-    boxes.clear();
-    boxes.Add(args);
-    AddMarked(boxes);
-}
-
-template<> void   Paragraphs::AddMarked( boxing::TBoxes<PoolAllocator>&  args ) {
-    boxes.clear();
-    boxes.Add(args);
-    AddMarked(boxes);
-}
-#endif // !DOXYGEN
 
 
 } // namespace [alib::format]
@@ -166,15 +166,21 @@ class Paragraphs
     /// @throws <b>alib::format::FMTExceptions</b><br>
     ///         Rethrows exceptions from the formatter caused by errors in provided \p{args}.
     ///
+    /// The arguments are accepted as \alib{boxing;BoxesSpan}, which is implicitly constructed
+    /// from containers like \alib{boxing;TBoxes} (with any allocator) or
+    /// \alib{boxing;TLocalBoxes}. The boxes are not copied.
+    ///
     /// @param args   The list of arguments to add.
-    template<typename TAllocatorArgs>
-    void    Add( boxing::TBoxes<TAllocatorArgs>&  args );
+    ALIB_DLL
+    void    Add( const boxing::BoxesSpan&  args );
 
     /// Variadic template argument version of #Add.
     ///
     /// @param args   The variadic list of arguments to add.
     /// @return A reference to ourselves to allow concatenated calls.
     template <typename... BoxedObjects>
+    requires ( !(    sizeof...(BoxedObjects) == 1
+                  && ( std::is_convertible_v<const BoxedObjects&, boxing::BoxesSpan> && ... ) ) )
     Paragraphs&  Add( const BoxedObjects&... args ) {
         boxes.clear();
         boxes.Add( args... );
@@ -210,8 +216,8 @@ class Paragraphs
     ///   - Rethrows formatter exceptions occurring due to errors in provided \p{args}.
     ///
     /// @param args       The list of arguments to add.
-    template<typename TAllocatorArgs>
-    void            AddMarked( boxing::TBoxes<TAllocatorArgs>&  args );
+    ALIB_DLL
+    void            AddMarked( const boxing::BoxesSpan&  args );
 
     /// Variadic template argument version of #AddMarked.
     ///
@@ -222,6 +228,8 @@ class Paragraphs
     /// @param args   The variadic list of arguments to add.
     /// @return A reference to ourselves to allow concatenated calls.
     template <typename... BoxedObjects>
+    requires ( !(    sizeof...(BoxedObjects) == 1
+                  && ( std::is_convertible_v<const BoxedObjects&, boxing::BoxesSpan> && ... ) ) )
     Paragraphs&     AddMarked( const BoxedObjects&... args ) {
         boxes.clear();
         boxes.Add( args... );
@@ -275,15 +283,6 @@ class Paragraphs
     Paragraphs&     PopIndent();
 }; // class Paragraphs
 
-#if !DOXYGEN
-template<> ALIB_DLL  void    Paragraphs::Add      ( boxing::TBoxes<HeapAllocator>&  args );
-template<> ALIB_DLL  void    Paragraphs::Add      ( boxing::TBoxes<MonoAllocator>&  args );
-template<> ALIB_DLL  void    Paragraphs::Add      ( boxing::TBoxes<PoolAllocator>&  args );
-template<> ALIB_DLL  void    Paragraphs::AddMarked( boxing::TBoxes<HeapAllocator>&  args );
-template<> ALIB_DLL  void    Paragraphs::AddMarked( boxing::TBoxes<MonoAllocator>&  args );
-template<> ALIB_DLL  void    Paragraphs::AddMarked( boxing::TBoxes<PoolAllocator>&  args );
-#endif // !DOXYGEN
-
 } // namespace alib[::format]
 
 /// Type alias in namespace \b alib.
@@ -612,6 +612,47 @@ struct HeapAllocator
 
 };  // struct HeapAllocator
 
+//==================================================================================================
+/// Traits type which defines how types that manage a growing buffer, like
+/// \alib{strings;TAString;AString}, grow a buffer allocated with allocator type \p{TAllocator}.
+///
+/// The default implementation grows a buffer by 50% and does not round allocation sizes.
+/// Specializations are given with module \alib_monomem for types
+/// \alib{monomem;TMonoAllocator} and \alib{monomem;TPoolAllocator}:
+/// - A \b MonoAllocator does not free memory. Therefore, a buffer that is not the most recent
+///   allocation and hence cannot be extended in place, is abandoned with each growth.
+///   Doubling the size limits the sum of abandoned buffers to the size of the final buffer,
+///   while with 50% growth, this sum is twice the final size.
+/// - A \b PoolAllocator rounds each request up to the next power of 2. Doubling the size hits
+///   these block sizes exactly.
+///
+/// A custom allocator that reserves larger blocks than requested, may specialize this type to
+/// round requests up to the sizes of its blocks. Note that the truly allocated size is
+/// used by the caller only if it is reported back by the methods \alib{lang;Allocator::allocate}
+/// and \alib{lang;Allocator::reallocate}. Otherwise, the size returned by #RoundUp is
+/// requested.
+///
+/// @tparam TAllocator The allocator type, as prototyped with \alib{lang;Allocator}.
+//==================================================================================================
+template<typename TAllocator>
+struct GrowthTraits
+{
+    /// Rounds an allocation size up to the size of the memory block that the allocator
+    /// reserves for it.
+    /// @param size The requested size in bytes.
+    /// @return The given \p{size}.
+    static constexpr size_t RoundUp( size_t size )                          noexcept { return size; }
+
+    /// Calculates the new size of a buffer that needs to grow.
+    /// @param actSize      The current size of the buffer in bytes.
+    /// @param requiredSize The minimum size needed in bytes.
+    /// @return The size to request from the allocator.
+    static constexpr size_t Grow( size_t actSize, size_t requiredSize )                   noexcept {
+        size_t newSize= actSize + actSize / 2;
+        return RoundUp( newSize < requiredSize ? requiredSize : newSize );
+    }
+};
+
 
 //==================================================================================================
 /// This templated class is used to inherit an allocation member. The rationale for choosing
@@ -980,6 +980,30 @@ using     MonoAllocator =   monomem::TMonoAllocator<lang::HeapAllocator>;
 template<typename T>
 using StdMA= lang::StdAllocator<T, MonoAllocator>;
 
+namespace lang {
+
+/// Specialization of traits type \alib{lang;GrowthTraits} for type \alib{monomem;TMonoAllocator}.
+/// Buffers are doubled in size, which limits the memory that is abandoned when a buffer is not
+/// the most recent allocation and thus cannot be extended in place.
+/// @tparam TAllocator The chained allocator of the \b MonoAllocator.
+template<typename TAllocator>
+struct GrowthTraits<monomem::TMonoAllocator<TAllocator>>
+{
+    /// Returns the given size, because a \b MonoAllocator does not reserve larger blocks.
+    /// @param size The requested size in bytes.
+    /// @return The given \p{size}.
+    static constexpr size_t RoundUp( size_t size )                          noexcept { return size; }
+
+    /// Doubles the size of a buffer.
+    /// @param actSize      The current size of the buffer in bytes.
+    /// @param requiredSize The minimum size needed in bytes.
+    /// @return The size to request from the allocator.
+    static constexpr size_t Grow( size_t actSize, size_t requiredSize )                   noexcept
+    { return 2 * actSize < requiredSize ? requiredSize : 2 * actSize; }
+};
+
+} // namespace [alib::lang]
+
 
 
 } // namespace [alib]
@@ -553,4 +553,32 @@ using  PoolAllocatorHA     = monomem::TPoolAllocator<lang::HeapAllocator>;
 template<typename T>
 using StdPA= lang::StdAllocator<T, PoolAllocator>;
 
+namespace lang {
+
+/// Specialization of traits type \alib{lang;GrowthTraits} for type \alib{monomem;TPoolAllocator}.
+/// Allocation sizes are rounded up to the next power of 2, which is the size of the block that
+/// the pool allocator returns, and buffers are doubled in size.
+/// @tparam TAllocator The chained allocator of the \b PoolAllocator.
+/// @tparam TAlignment The alignment of the \b PoolAllocator.
+template<typename TAllocator, size_t TAlignment>
+struct GrowthTraits<monomem::TPoolAllocator<TAllocator, TAlignment>>
+{
+    /// Rounds the given size up to the block size of the pool allocator.
+    /// @param size The requested size in bytes.
+    /// @return The next higher power of 2.
+    static constexpr size_t RoundUp( size_t size )                                        noexcept {
+        using TPA= monomem::TPoolAllocator<TAllocator, TAlignment>;
+        return TPA::GetAllocationSize( TPA::GetAllocInformation( size ) );
+    }
+
+    /// Doubles the size of a buffer.
+    /// @param actSize      The current size of the buffer in bytes.
+    /// @param requiredSize The minimum size needed in bytes.
+    /// @return The size to request from the allocator.
+    static constexpr size_t Grow( size_t actSize, size_t requiredSize )                   noexcept
+    { return RoundUp( 2 * actSize < requiredSize ? requiredSize : 2 * actSize ); }
+};
+
+} // namespace [alib::lang]
+
 } // namespace [alib]
@@ -22,8 +22,7 @@ struct Key
         /// @param key The object to hash.
         /// @return The hash code.
         std::size_t operator()(const Key& key)                                               const {
-            return   key.Name    .Hashcode()
-                   ^ key.Category.Hashcode();
+            return key.Name.Hashcode( key.Category.Hashcode() );
         }
     };
 
@@ -20,7 +20,7 @@ struct  AppendableTraits<TEnum, TChar, TAllocator>
 
 // CHANGE 1 (compared to original implementation, without module Resources in the ALib Build)
         target << ResourcedType<TEnum>::TypeNamePrefix();
-        auto* record= enumrecords::TryRecord( element );
+        auto* record= enumrecords::detail::EnumRecordTable<TEnum>::Get().Find( element );
         if( record != nullptr )
             target << record->EnumElementName;
         else
@@ -43,41 +43,15 @@ struct  AppendableTraits<TBitwiseEnum, TChar,TAllocator> {
 // CHANGE 1 (compared to original implementation, without module Resources in the ALib Build)
         target << ResourcedType<TBitwiseEnum>::TypeNamePrefix();
 
-        // check what has been covered and omit double entries
-        TBitwiseEnum covered= TBitwiseEnum(0);
-
-        // loop over entry 2 to end, check bit
-        integer len= target.Length();
-
-        for( auto recordIt=   EnumRecords<TBitwiseEnum>().begin() ;
-                  recordIt != EnumRecords<TBitwiseEnum>().end()   ; ++recordIt  )
-        {
-            // no bits are set and this entry does not contain bits, then stop here
-            if( recordIt.Integral() == 0 ) {
-                if( elements == TBitwiseEnum(0) ) {
-                    target << recordIt->EnumElementName;
-// CHANGE 2 (compared to original implementation, without module Resources in the ALib Build)
-                    target << ResourcedType<TBitwiseEnum>::TypeNamePostfix();
-                    return;
-            }   }
-            else if(     HasBits( elements, recordIt.Enum() )
-                     && !HasBits( covered , recordIt.Enum() )  )
-            {
-                covered|= recordIt.Enum();
-                target << recordIt->EnumElementName << ',';
-        }   }
-        len= target.Length() - len;
-
-        // remove the last comma
-        if( len != 0 )
-            target.DeleteEnd( 1 );
+        TBitwiseEnum covered= enumrecords::detail::EnumRecordTable<TBitwiseEnum>::Get()
+                                                                  .AppendBitwise( target, elements );
 
         ALIB_ASSERT_ERROR( covered == elements, "ENUMS",
            "Not all bits have been covered while writing bitset '{}' of enumeration type <{}>. "
            "Remaining bits are '{}'.", NString(NString128(NBin( elements ))),
                 &typeid(TBitwiseEnum), NString(NString128(NBin( covered & elements ))) )
 
-// CHANGE 3 (compared to original implementation, without module Resources in the ALib Build)
+// CHANGE 2 (compared to original implementation, without module Resources in the ALib Build)
         target << ResourcedType<TBitwiseEnum>::TypeNamePostfix();
     }
 };
@@ -63,7 +63,16 @@ bool LocalResourcePool::BootstrapAddOrReplace( const NString& category,
     }
 #endif
 
-    return !it.second;
+    return !it.second || findInTables( category, name ) != nullptr;
+}
+
+void LocalResourcePool::BootstrapTable( const NString&                 category,
+                                        const StaticResourceTableView& table     ) {
+#if !ALIB_DEBUG_RESOURCES
+    tables.emplace_back( category, table );
+#else
+    ResourcePool::BootstrapTable( category, table );
+#endif
 }
 
 void LocalResourcePool::BootstrapBulk( const nchar* category, ... ) {
@@ -114,6 +123,11 @@ const String& LocalResourcePool::Get( const NString& category, const NString& na
         return dataIt.Mapped().first;
 #endif
     }
+
+    // search static tables
+    if( auto* entry= findInTables( category, name ) )
+        return entry->Value;
+
     ALIB_ASSERT_ERROR( !dbgAssert, "RESOURCES",
        "Unknown resource! Category: \"{}\", Name: \"{}\".", category, name )
     return NULL_STRING;
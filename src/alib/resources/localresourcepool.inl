@@ -37,6 +37,22 @@ class LocalResourcePool  : public ResourcePool
     /// A hash map used to store static resources.
     detail::StaticResourceMap       data;
 
+    /// The tables added with #BootstrapTable, together with their category.
+    /// Resources found in #data are preferred over those found in the tables.
+    std::vector<std::pair<NString, StaticResourceTableView>>    tables;
+
+    /// Searches the given resource in the #tables.
+    /// @param category   Category string of the resource.
+    /// @param name       Name string of the resource.
+    /// @return A pointer to the table entry, \c nullptr if not found.
+    const StaticResource*   findInTables( const NString& category, const NString& name )     const {
+        for( auto& table : tables )
+            if( table.first.Equals<NC>( category ) )
+                if( auto* entry= table.second.Find( name ) )
+                    return entry;
+        return nullptr;
+    }
+
     #if ALIB_DEBUG_RESOURCES
     /// If set before bootstrapping (e.g., to <c>&std::cout</c>), then each found resource string
     /// is written here. This is very useful to find errors in bulk resource strings, for example
@@ -110,6 +126,22 @@ class LocalResourcePool  : public ResourcePool
     virtual
     void BootstrapBulk( const nchar* category, ... )                                       override;
 
+    /// Overrides method \alib{resources;ResourcePool::BootstrapTable}.
+    /// The given table is not copied into the internal hash map, but searched with method #Get
+    /// in the case that a resource is not found in the hash map. With that, resources added
+    /// with #BootstrapAddOrReplace replace the resources of a table.
+    ///
+    /// \note
+    ///   If the compiler-symbol \ref ALIB_DEBUG_RESOURCES is set, the default implementation
+    ///   of the parent class is invoked, which copies the entries into the hash map.
+    ///   This way, the debug-features of this class apply to the resources of tables, too.
+    ///
+    /// @param category  The category of the resources given.
+    /// @param table     The view of the table.
+    ALIB_DLL
+    virtual
+    void BootstrapTable( const NString& category, const StaticResourceTableView& table )   override;
+
 
 #if DOXYGEN
     //==============================================================================================
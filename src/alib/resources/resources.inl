@@ -103,6 +103,27 @@ class ResourcePool
     virtual
     void BootstrapBulk( const nchar* category, ... )                                             =0;
 
+    /// Adds the resources of a \alib{resources;StaticResourceTable} to the given \p{category}.
+    /// Such tables are created at compile-time and allow implementations to avoid copying the
+    /// resources into a run-time data structure.
+    ///
+    /// This default implementation invokes #BootstrapAddOrReplace for each entry of the table.
+    /// Class \alib{resources;LocalResourcePool} overrides this method and searches the given
+    /// table directly.
+    ///
+    /// The same rules as documented with #BootstrapBulk apply: This method must be invoked only
+    /// during the process of \ref alib_mod_bs "bootstrapping", and the given table has to
+    /// survive this resource instance. Usually, the table is a \c constexpr object of
+    /// namespace scope.
+    ///
+    /// @param category  The category of the resources given.
+    /// @param table     The view of the table. See \alib{resources;StaticResourceTable::View}.
+    virtual
+    void BootstrapTable( const NString& category, const StaticResourceTableView& table ) {
+        for( auto& entry : table )
+            BootstrapAddOrReplace( category, entry.Name, entry.Value );
+    }
+
 #if DOXYGEN
     //==============================================================================================
     /// Returns a resource.
@@ -590,7 +611,8 @@ void Bootstrap( resources::ResourcePool& pool,
         EnumRecordParser::Get( element->integral );
         element->record.Parse();
 
-        detail::setEnumRecord( typeid(TEnum), integer(element->integral), &element->record );
+        if( !records.isLazy )
+            detail::setEnumRecord( typeid(TEnum), integer(element->integral), &element->record );
 
         EnumRecordParser::assertEndOfInput();
         // next
@@ -598,6 +620,7 @@ void Bootstrap( resources::ResourcePool& pool,
         ++nr;
     }
     (*lastP)= nullptr;
+    records.generation.fetch_add( 1, std::memory_order_release );
 
     // check if there are more coming (a gap in numbered definition)
     #if ALIB_DEBUG
@@ -612,6 +635,123 @@ void Bootstrap( resources::ResourcePool& pool,
     #endif
 }
 
+#include "ALib.Lang.CIMethods.H"
+} // namespace [alib::enumrecords::bootstrap]
+
+ALIB_EXPORT  namespace alib::enumrecords::detail {
+#include "ALib.Lang.CIFunctions.H"
+/// The parameters of a call to \alib{enumrecords::bootstrap;BootstrapLazy}, stored until the
+/// records of \p{TEnum} are loaded.
+/// @tparam TEnum The enumeration type.
+template<typename TEnum>
+struct LazyRecordSource
+{
+    static inline resources::ResourcePool*  Pool;       ///< The resource pool.
+    static inline NString                   Category;   ///< The resource category.
+    static inline NString                   Name;       ///< The resource name.
+    static inline character                 InnerDelim; ///< The delimiter of record fields.
+    static inline character                 OuterDelim; ///< The delimiter of records.
+    static inline bool                      IsLoading;  ///< Detects recursive invocations.
+};
+
+/// Loads the records of \p{TEnum} which were registered with
+/// \alib{enumrecords::bootstrap;BootstrapLazy}. Invoked by
+/// \alib{enumrecords::detail;EnumRecordHook::First} with the first access to the records.
+///
+/// The records are loaded while \alib{monomem;GLOBAL_ALLOCATOR_LOCK} is acquired. Other threads
+/// that access the records meanwhile are blocked in
+/// \alib{enumrecords::detail;EnumRecordHook::First}, until field \b lazyLoader of the hook is
+/// cleared, which is the last action performed.
+/// Because the records might be loaded while records of a different type are parsed, the
+/// static fields of class \alib{enumrecords::bootstrap;EnumRecordParser} are restored after
+/// loading.
+/// @tparam TEnum The enumeration type.
+template<typename TEnum>
+void loadLazyRecords() {
+    using Source= LazyRecordSource<TEnum>;
+    ALIB_LOCK_RECURSIVE_WITH(monomem::GLOBAL_ALLOCATOR_LOCK)
+    auto& hook= EnumRecordHook<TEnum>::GetSingleton();
+    if( hook.lazyLoader.load( std::memory_order_relaxed ) == nullptr || Source::IsLoading )
+        return;
+    Source::IsLoading= true;
+
+    Substring savedInput           = bootstrap::EnumRecordParser::Input;
+    character savedInnerDelim      = bootstrap::EnumRecordParser::InnerDelimChar;
+    character savedOuterDelim      = bootstrap::EnumRecordParser::OuterDelimChar;
+    String    savedOriginalInput   = bootstrap::EnumRecordParser::OriginalInput;
+    NString   savedResourceCategory= bootstrap::EnumRecordParser::ResourceCategory;
+    NString   savedResourceName    = bootstrap::EnumRecordParser::ResourceName;
+    bootstrap::EnumRecordParser::Input= nullptr;
+
+    bootstrap::Bootstrap<TEnum>( *Source::Pool, Source::Category, Source::Name,
+                                 Source::InnerDelim, Source::OuterDelim );
+
+    bootstrap::EnumRecordParser::Input           = savedInput;
+    bootstrap::EnumRecordParser::InnerDelimChar  = savedInnerDelim;
+    bootstrap::EnumRecordParser::OuterDelimChar  = savedOuterDelim;
+    bootstrap::EnumRecordParser::OriginalInput   = savedOriginalInput;
+    bootstrap::EnumRecordParser::ResourceCategory= savedResourceCategory;
+    bootstrap::EnumRecordParser::ResourceName    = savedResourceName;
+
+    hook.lazyLoader.store( nullptr, std::memory_order_release );
+    Source::IsLoading= false;
+}
+#include "ALib.Lang.CIMethods.H"
+} // namespace [alib::enumrecords::detail]
+
+ALIB_EXPORT  namespace alib::enumrecords::bootstrap {
+#include "ALib.Lang.CIFunctions.H"
+
+/// Same as #Bootstrap(ResourcePool&, const NString&, const NString&, character, character),
+/// but defers loading and parsing the records until they are accessed the first time.
+/// This reduces the time needed for bootstrapping in the case that the records of an enumeration
+/// type are not used by a process.
+///
+/// The records are loaded with the first invocation of one of the functions that access the
+/// records, for example, \alib{enumrecords;EnumRecords::begin}, \alib{enumrecords;TryRecord},
+/// \alib{enumrecords;Parse}, or when an element is appended to an \b AString.
+/// This may happen after bootstrapping, in parallel from different threads, which is
+/// supported: The records are loaded while \alib{monomem;GLOBAL_ALLOCATOR_LOCK} is acquired,
+/// and they are not inserted into the central hash map of records. Instead, function
+/// \alib{enumrecords;TryRecord} finds the records using type
+/// \alib{enumrecords::detail;EnumRecordTable}. This table, as well as the index used by
+/// \alib{enumrecords;Parse}, is built after the records are loaded, while a mutex of the
+/// table is acquired.
+///
+/// \note
+///   Because errors in the resource strings are detected only when the records are loaded,
+///   this function should be used only with resources that are known to be valid, such as the
+///   built-in resources of \alib.
+///
+/// @tparam TEnum      The enumeration type to load resourced records for.
+/// @param  pool       The resource pool to receive the string to parse the records from.
+///                    Must survive the application.
+/// @param  category   The resource category of the externalized string.
+/// @param  name       The resource name of the externalized name.
+/// @param  innerDelim The delimiter used for separating the fields of a record.
+///                    Defaults to <c>','</c>.
+/// @param  outerDelim The character delimiting enum records.
+///                    Defaults to <c>','</c>.
+template<typename TEnum>
+requires alib::enumrecords::HasRecords<TEnum>
+void BootstrapLazy( resources::ResourcePool& pool,
+                    const NString&           category,
+                    const NString&           name,
+                    character                innerDelim= ',',
+                    character                outerDelim= ','     ) {
+    using Source= detail::LazyRecordSource<TEnum>;
+    Source::Pool      = &pool;
+    Source::Category  = category;
+    Source::Name      = name;
+    Source::InnerDelim= innerDelim;
+    Source::OuterDelim= outerDelim;
+
+    auto& hook= detail::EnumRecordHook<TEnum>::GetSingleton();
+    hook.isLazy= true;
+    hook.lazyLoader.store( &detail::loadLazyRecords<TEnum>, std::memory_order_release );
+    detail::setLazyEnumRecords( typeid(TEnum), &detail::findLazyRecord<TEnum> );
+}
+
 /// This namespace function is available if the type trait \alib{resources;ResourcedTraits}
 /// is specialized for the enum type \p{TEnum}.<br>
 /// Invokes #Bootstrap(ResourcePool&, const NString&, const NString&, character, character)
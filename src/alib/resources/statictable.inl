@@ -0,0 +1,219 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of module \alib_resources of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib::resources {
+
+/// An entry of a \alib{resources;StaticResourceTable}.
+struct StaticResource
+{
+    NString     Name;   ///< The resource name.
+    String      Value;  ///< The resource string.
+};
+
+namespace detail {
+
+/// Hashes the name of a static resource. The function is usable at compile-time and is used
+/// by class \alib{resources;StaticResourceTable} to calculate its perfect hash function, as well
+/// as with searching resources at run-time.
+/// @param name The resource name.
+/// @return The hash value.
+constexpr uint64_t  staticResourceHash( const NString& name ) {
+    uint64_t h= 0xcbf29ce484222325ull;
+    for( integer i= 0 ; i < name.Length() ; ++i ) {
+        h^= uint64_t( uint8_t( name.Buffer()[i] ) );
+        h*= 0x100000001b3ull;
+    }
+    h^= h >> 33;   h*= 0xff51afd7ed558ccdull;
+    h^= h >> 33;   h*= 0xc4ceb9fe1a85ec53ull;
+    h^= h >> 33;
+    return h;
+}
+
+/// Calculates the slot of a static resource from its hash value and the displacement value of
+/// its bucket.
+/// @param hash          The hash value of the resource name.
+/// @param displacement  The displacement value of the bucket of the resource.
+/// @param qtySlots      The number of slots of the table.
+/// @return The slot index.
+constexpr uint32_t  staticResourceSlot( uint64_t hash, uint32_t displacement, uint32_t qtySlots ) {
+    hash^= uint64_t( displacement ) * 0x9e3779b97f4a7c15ull;
+    hash^= hash >> 31;   hash*= 0xbf58476d1ce4e5b9ull;
+    hash^= hash >> 29;
+    return uint32_t( hash % qtySlots );
+}
+
+/// Compares two resource names. In contrast to \alib{strings;TString::Equals}, this function
+/// is usable at compile-time.
+/// @param lhs The first name.
+/// @param rhs The second name.
+/// @return \c true if the names are equal, \c false otherwise.
+constexpr bool      staticResourceNamesEqual( const NString& lhs, const NString& rhs ) {
+    if( lhs.Length() != rhs.Length() )
+        return false;
+    for( integer i= 0 ; i < lhs.Length() ; ++i )
+        if( lhs.Buffer()[i] != rhs.Buffer()[i] )
+            return false;
+    return true;
+}
+
+} // namespace alib::resources[::detail]
+
+//==================================================================================================
+/// A non-templated reference to a \alib{resources;StaticResourceTable}, which is passed to
+/// method \alib{resources;ResourcePool::BootstrapTable}.
+/// Instances are created with method \alib{resources;StaticResourceTable::View}.
+//==================================================================================================
+struct StaticResourceTableView
+{
+    const StaticResource*   Entries;        ///< The entries of the table.
+    const uint32_t*         Displacements;  ///< The displacement values of the buckets.
+    const int32_t*          Slots;          ///< The indices of the entries stored in the slots.
+    uint32_t                QtyEntries;     ///< The number of entries.
+    uint32_t                QtyBuckets;     ///< The number of buckets.
+    uint32_t                QtySlots;       ///< The number of slots.
+
+    /// Searches a resource. The search performs one hash calculation and one string comparison.
+    /// @param name The name of the resource.
+    /// @return A pointer to the entry found, \c nullptr if no resource with the given name is
+    ///         contained.
+    const StaticResource*   Find( const NString& name )                                      const {
+        uint64_t hash= detail::staticResourceHash( name );
+        int32_t  idx = Slots[detail::staticResourceSlot( hash, Displacements[hash % QtyBuckets],
+                                                         QtySlots )];
+        return idx >= 0 && Entries[idx].Name.Equals<NC>( name ) ? Entries + idx : nullptr;
+    }
+
+    /// @return An iterator to the first entry.
+    const StaticResource*   begin()                                 const { return Entries; }
+
+    /// @return An iterator pointing behind the last entry.
+    const StaticResource*   end()                      const { return Entries + QtyEntries; }
+};
+
+//==================================================================================================
+/// A table of static resources, which is created at compile-time. The table embeds a
+/// <em>perfect hash function</em> which is calculated by its \c consteval constructor:
+/// The names of the resources are distributed into buckets of about four entries each.
+/// Starting with the largest bucket, for each bucket a displacement value is searched, which maps
+/// all names of the bucket to distinct slots that are not occupied by a previous bucket.
+/// (This approach is known as <em>"hash, displace and compress"</em>.) As a result, a resource is
+/// found at run-time with the calculation of one hash value and one string comparison.
+///
+/// The table is used to provide the default resources of a camp without creating a hash map
+/// at run-time, which reduces the time needed for bootstrapping. A table is declared as follows:
+///
+///         constexpr resources::StaticResourceTable myResources( {
+///             { "Name1",  A_CHAR("Value1")  },
+///             { "Name2",  A_CHAR("Value2")  },
+///             ...
+///         } );
+///
+/// and passed to the resource pool with
+/// \alib{resources;ResourcePool::BootstrapTable}, for example, in phase
+/// \alib{BootstrapPhases;PrepareResources} of method \alib{camp;Camp::Bootstrap}.
+///
+/// Duplicate names are detected at compile-time and lead to a compilation error.
+///
+/// @tparam N  The number of resources. Deduced by the compiler.
+//==================================================================================================
+template<size_t N>
+class StaticResourceTable
+{
+  public:
+    /// The number of buckets used with the hash function.
+    static constexpr uint32_t   QtyBuckets  = uint32_t( N / 4 + 1 );
+
+    /// The number of slots that the entries are distributed to.
+    static constexpr uint32_t   QtySlots    = uint32_t( N + N / 4 + 1 );
+
+  protected:
+    /// The resources.
+    StaticResource              entries[N];
+
+    /// The displacement value of each bucket.
+    uint32_t                    displacements[QtyBuckets];
+
+    /// The index of the entry stored in a slot. \c -1 for free slots.
+    int32_t                     slots[QtySlots];
+
+  public:
+    /// Constructor. Copies the given entries and calculates the perfect hash function.
+    /// @param pEntries The resources of the table.
+    consteval StaticResourceTable( const StaticResource (&pEntries)[N] )
+    : entries{}
+    , displacements{}
+    , slots{} {
+        uint64_t hashes     [N]          {};
+        uint32_t bucketOf   [N]          {};
+        uint32_t bucketSizes[QtyBuckets] {};
+        bool     bucketDone [QtyBuckets] {};
+        for( size_t i= 0 ; i < N ; ++i ) {
+            entries[i]= pEntries[i];
+            hashes [i]= detail::staticResourceHash( entries[i].Name );
+            bucketOf[i]= uint32_t( hashes[i] % QtyBuckets );
+            ++bucketSizes[bucketOf[i]];
+        }
+        for( auto& slot : slots )
+            slot= -1;
+
+        // place buckets, largest first
+        for( uint32_t round= 0 ; round < QtyBuckets ; ++round ) {
+            uint32_t bucket= QtyBuckets;
+            for( uint32_t b= 0 ; b < QtyBuckets ; ++b )
+                if( !bucketDone[b] && ( bucket == QtyBuckets || bucketSizes[b] > bucketSizes[bucket] ) )
+                    bucket= b;
+            bucketDone[bucket]= true;
+            if( bucketSizes[bucket] == 0 )
+                break;
+
+            uint32_t members[N] {};
+            uint32_t qtyMembers= 0;
+            for( uint32_t i= 0 ; i < N ; ++i )
+                if( bucketOf[i] == bucket ) {
+                    for( uint32_t m= 0 ; m < qtyMembers ; ++m )
+                        if( detail::staticResourceNamesEqual( entries[members[m]].Name,
+                                                              entries[i].Name ) )
+                            throw "Duplicate resource name in StaticResourceTable.";
+                    members[qtyMembers++]= i;
+                }
+
+            // search a displacement value that maps all members to free slots
+            for( uint32_t displacement= 0 ;; ++displacement ) {
+                if( displacement == 1u << 20 )
+                    throw "No perfect hash function found for StaticResourceTable.";
+                uint32_t trial[N] {};
+                bool     ok= true;
+                for( uint32_t m= 0 ; ok && m < qtyMembers ; ++m ) {
+                    trial[m]= detail::staticResourceSlot( hashes[members[m]], displacement, QtySlots );
+                    ok= slots[trial[m]] < 0;
+                    for( uint32_t o= 0 ; ok && o < m ; ++o )
+                        ok= trial[o] != trial[m];
+                }
+                if( !ok )
+                    continue;
+                displacements[bucket]= displacement;
+                for( uint32_t m= 0 ; m < qtyMembers ; ++m )
+                    slots[trial[m]]= int32_t( members[m] );
+                break;
+    }   }   }
+
+    /// Returns a non-templated reference to this table.
+    /// @return The view of this table.
+    constexpr StaticResourceTableView View()                                                 const {
+        return { entries, displacements, slots, uint32_t( N ), QtyBuckets, QtySlots };
+    }
+
+    /// Searches a resource. See \alib{resources;StaticResourceTableView::Find}.
+    /// @param name The name of the resource.
+    /// @return A pointer to the entry found, \c nullptr if not contained.
+    const StaticResource*   Find( const NString& name )          const { return View().Find( name ); }
+
+    /// @return The number of resources in this table.
+    static constexpr integer    Size()                                         { return integer(N); }
+};
+
+} // namespace [alib::resources]
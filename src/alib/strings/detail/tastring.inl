@@ -613,8 +613,13 @@ class TAString : public TString<TChar>
         #endif
     }
 
-    /// Increases the allocation size by either 50% of the current capacity or by the value
-    /// provided, whichever is higher.
+    /// Increases the allocation size to at least the current length plus the given value.
+    /// How much more is allocated is defined by the specialization of traits type
+    /// \alib{lang;GrowthTraits} for template type \p{TAllocator}: With the
+    /// \alib{lang;HeapAllocator}, the capacity grows by 50%, while with a
+    /// \alib{MonoAllocator} and a \alib{PoolAllocator} it is doubled.
+    /// If the allocator returns a larger memory block than requested, as the \b PoolAllocator
+    /// does, the additional space is added to the #Capacity.
     ///
     /// @param minimumGrowth    The desired minimum growth of length.
     ALIB_DLL
@@ -812,6 +817,9 @@ class TAString : public TString<TChar>
   //################################################################################################
 
     /// Appends an array of an incompatible character type.
+    /// The characters are converted with function \alib{characters;Transcode}. This conversion
+    /// does not depend on the locale settings of the C library. Invalid input sequences are
+    /// replaced by \alib{characters;UTFReplacementCharacter}.
     ///
     /// @tparam TCharSrc    The character type of the given array.
     /// @tparam TCheck      Defaults to \alib{CHK}, which is the normal invocation mode.
@@ -835,293 +843,9 @@ class TAString : public TString<TChar>
                 return *this;
         }   }
 
-        // We have to know what the "real" types are.
-        #if !DOXYGEN
-        #if ALIB_CHARACTERS_NATIVE_WCHAR
-        #   define REAL_WCHAR wchar
-        #   define REAL_XCHAR xchar
-        #else
-        #   define REAL_WCHAR xchar
-        #   define REAL_XCHAR wchar
-        #endif
-        #endif
-
-        // TAString<nchar>
-        if constexpr ( std::same_as<TChar, nchar> ) {
-
-            // wchar -> nchar
-            if constexpr ( std::same_as<TCharSrc, REAL_WCHAR> ) {
-              //---------------------------------- Windows Version ---------------------------------
-                #if defined( _WIN32 )
-
-                    // loop until reserved size is big enough
-                    for(integer bufSizeFactor= 2; bufSizeFactor < 8; ++bufSizeFactor) {
-                        EnsureRemainingCapacity( srcLength * bufSizeFactor );
-                        int conversionSize= WideCharToMultiByte( CP_UTF8, 0,
-                                                                 src, int( srcLength),
-                                                                 base::vbuffer + base::length, int( Capacity() - base::length ),
-                                                                 NULL, NULL );
-                        if ( conversionSize > 0 ) {
-                            base::length+= conversionSize;
-                            return *this;
-                        }
-
-                        // not enough space?
-                        int error= GetLastError();
-                        if (error == ERROR_INSUFFICIENT_BUFFER ) {
-                            EnsureRemainingCapacity( srcLength );
-                            continue;
-                        }
-
-                        // quit on other errors
-                        ALIB_WARNING( "STRINGS",
-                         "AString: Cannot convert wide character string to UTF-8. Error: {} ({})",
-                          (   error == ERROR_INVALID_FLAGS          ? "ERROR_INVALID_FLAGS."
-                            : error == ERROR_INVALID_PARAMETER      ? "ERROR_INVALID_PARAMETER"
-                            : error == ERROR_NO_UNICODE_TRANSLATION ? "ERROR_NO_UNICODE_TRANSLATION"
-                                                                    : "<unknown>" ),
-                          error  )
-                        return *this;
-                    }
-                    // Error: not enough space
-                    ALIB_ERROR(  "STRINGS", "AString: Cannot convert wide character string to "
-                                            "UTF-8. Error: ERROR_INSUFFICIENT_BUFFER" )
-                    return *this;
-
-              //-------------------------------- __GLIBCXX__ Version -------------------------------
-                #elif defined (__GLIBCXX__)  || defined(_LIBCPP_VERSION) || defined(__APPLE__) || defined(__ANDROID_NDK__)
-
-                    integer maxConversionSize= integer(MB_CUR_MAX) * srcLength;
-
-                    mbstate_t ps;
-                    EnsureRemainingCapacity( maxConversionSize );
-                    memset( &ps, 0, sizeof(mbstate_t) );
-                    const REAL_WCHAR* srcp= src;
-                    size_t conversionSize= wcsnrtombs( base::vbuffer + base::length, &srcp, size_t(srcLength), size_t(maxConversionSize),  &ps);
-                    if ( conversionSize == size_t( -1 ) ) {
-                        ALIB_WARNING( "STRINGS", "Cannot convert WCS to MBCS. "
-                                                 "Check locale settings (should be UTF-8)" )
-                        return *this;
-                    }
-
-                    if ( conversionSize < 1 ) {
-                        ALIB_ERROR( "STRINGS", "Error converting WCS to MBCS." )
-                        return *this;
-                    }
-
-                    TString<TChar>::length+= conversionSize;
-                    return *this;
-
-                #else
-                    #pragma message ("Unknown Platform in file: " __FILE__ )
-                    return *this;
-                #endif
-            } // wchar -> nchar
-
-            // xchar -> nchar
-            if constexpr ( std::same_as<TCharSrc, REAL_XCHAR> ) {
-                // convert to REAL_WCHAR and invoke REAL_WCHAR version
-                TAString<REAL_WCHAR, lang::HeapAllocator>   converter;
-                REAL_WCHAR externalBuffer[2048];
-                converter.SetBuffer( externalBuffer, 2048 );
-                converter.DbgDisableBufferReplacementWarning();
-                converter.Append<NC>( src, srcLength );
-                Append<NC>( converter.Buffer(), converter.Length() );
-            }
-
-        } // TAString<nchar>
-
-        // TAString<wchar_t>
-        if constexpr ( std::same_as<TChar, wchar_t> ) {
-            // nchar -> wchar_t
-            if constexpr ( std::same_as<TCharSrc, nchar> ) {
-                EnsureRemainingCapacity( srcLength );
-              //---------------------------------- Windows Version ---------------------------------
-                #if defined( _WIN32 )
-                    if( srcLength == 0)
-                        return *this;
-                    integer conversionSize= MultiByteToWideChar( CP_UTF8, 9,
-                                                                 src, int( srcLength ),
-                                                                 base::vbuffer + base::length,
-                                                                 int( Capacity() - base::length ) );
-                    // check for errors
-                    #if ALIB_DEBUG
-                        if ( conversionSize == 0 ) {
-                            // not enough space?
-                            int error= GetLastError();
-
-                            ALIB_WARNING( "STRINGS",
-                                "MBCS to WCS conversion failed. Error: {} ({})",
-                                (  error == ERROR_INSUFFICIENT_BUFFER      ?  "ERROR_INSUFFICIENT_BUFFER."
-                                 : error == ERROR_INVALID_FLAGS            ?  "ERROR_INVALID_FLAGS."
-                                 : error == ERROR_INVALID_PARAMETER        ?  "ERROR_INVALID_PARAMETER"
-                                 : error == ERROR_NO_UNICODE_TRANSLATION   ?  "ERROR_NO_UNICODE_TRANSLATION"
-                                                                           :  "<unknown>" ),
-                                error )
-
-                        }
-
-                        ALIB_ASSERT_ERROR( conversionSize <= srcLength, "STRINGS",
-                           "MBCS to WCS conversion failed. Requested length={}, conversion length=",
-                           srcLength, conversionSize )
-                    #endif
-
-                    base::length+= conversionSize;
-                    return *this;
-
-
-              //-------------------------------- __GLIBCXX__ Version -------------------------------
-                #elif defined (__GLIBCXX__) || defined(_LIBCPP_VERSION) || defined(__APPLE__) || defined(__ANDROID_NDK__)
-
-                    // copy loop
-                    while(srcLength > 0 ) {
-                        integer actConversionLenght= srcLength;
-                        for( int pass= 0 ; pass < 2 ; ++pass ) {
-
-                            mbstate_t    ps;    memset( &ps, 0, sizeof(mbstate_t) );
-                            const nchar* srcp= src;
-                            size_t       wcWritten= mbsnrtowcs( base::vbuffer + base::length,  &srcp,
-                                                                size_t(actConversionLenght),
-                                                                size_t(Capacity() - base::length), &ps );
-
-                            // single character failed?
-                            if( wcWritten == static_cast<size_t >(-1) ) {
-                                // already repeated?
-                                // This can't (must not) happen! If it did, release code does infinite loop!
-                                ALIB_ASSERT( pass == 0, "STRINGS" )
-
-                                // first character that failed?
-                                if( srcp == src ) {
-                                    ++src;
-                                    --srcLength;
-                                    *(base::vbuffer + base::length++)= '?';
-                                    break; // break try loop, continue with next character
-                                }
-
-                                // retry those characters that succeeded
-                                actConversionLenght= srcp - src;
-                                continue;
-                            }
-
-                            base::length+=    wcWritten;
-                            src+=       wcWritten;
-                            srcLength-= actConversionLenght;
-                            break;
-                    }   }
-                    return *this;
-
-                #else
-                    #pragma message ("Unknown Platform in file: " __FILE__ )
-                    return *this;
-                #endif
-
-            } // nchar -> wchar_t
-
-            // xchar -> wchar_t
-            if constexpr ( std::same_as<TCharSrc, REAL_XCHAR> ) {
-              #if ALIB_SIZEOF_WCHAR_T == 4
-                EnsureRemainingCapacity( srcLength );
-
-                // convert UTF16 to UTF32
-                const char16_t* srcEnd=    src + srcLength;
-                while (src < srcEnd) {
-                    const char32_t uc = char32_t(*src++);
-                    if ((uc - 0xd800) >= 2048)  { // not surrogate
-                        base::vbuffer[base::length++] = static_cast<wchar_t>(uc);
-                    } else {
-                        ALIB_ASSERT_ERROR(    src < srcEnd                        // has one more?
-                                           && ((uc    & 0xfffffc00) == 0xd800)    // is low
-                                           && ((*src  & 0xfffffc00) == 0xdc00),   // is high
-                                           "STRINGS", "Error decoding UTF16" )
-                        base::vbuffer[base::length++]=  static_cast<wchar_t>(     (uc << 10)
-                                                                       +  ((*src++) - 0x35fdc00 ) );
-                }   }
-
-              #else
-                // convert UTF32 to UTF16
-                EnsureRemainingCapacity( srcLength * 2 );
-
-                const char32_t* srcEnd=    src + srcLength;
-                while (src < srcEnd) {
-                    uinteger uc= *src++;
-                    ALIB_ASSERT_ERROR(       uc <  0xd800
-                                        || ( uc >= 0xe000 && uc <= 0x10ffff ),
-                                        "STRINGS", "Illegal unicode 32 bit codepoint"       )
-
-                    if( uc < 0x10000 ) {
-                          base::vbuffer[base::length++]=  static_cast<wchar_t>( uc );
-                    } else {
-                        uc-= 0x10000;
-                        base::vbuffer[base::length++]= static_cast<wchar_t>(  ( uc >> 10    ) + 0xd800  );
-                        base::vbuffer[base::length++]= static_cast<wchar_t>(  ( uc &  0x3ff ) + 0xdc00  );
-                }   }
-
-                return *this;
-              #endif
-            } // nchar -> wchar_t
-        } //wchar_t
-
-        // TAString<REAL_XCHAR>
-        if constexpr ( std::same_as<TChar, REAL_XCHAR> ) {
-            // wchar_t -> REAL_XCHAR
-            if constexpr ( std::same_as<TCharSrc, wchar_t> ) {
-              #if ALIB_SIZEOF_WCHAR_T == 2
-                EnsureRemainingCapacity( srcLength );
-
-                // convert UTF16 to UTF32
-                const wchar_t* srcEnd=    src + srcLength;
-                while (src < srcEnd) {
-                    const char32_t uc = *src++;
-                    if ((uc - 0xd800) >= 2048)  { // not surrogate
-                        base::vbuffer[base::length++] = static_cast<REAL_XCHAR>(uc);
-                    } else {
-                        ALIB_ASSERT_ERROR(    src < srcEnd                        // has one more?
-                                           && ((uc    & 0xfffffc00) == 0xd800)    // is low
-                                           && ((*src  & 0xfffffc00) == 0xdc00),   // is high
-                                           "STRINGS", "Error decoding UTF16" )
-
-                        base::vbuffer[base::length++]= static_cast<REAL_XCHAR>(     (uc << 10)
-                                                                                 +  ((*src++) - 0x35fdc00 ) );
-                }   }
-
-              #else
-                // convert UTF32 to UTF16
-                EnsureRemainingCapacity( srcLength * 2 ); // can potentially double!
-
-                const wchar_t* srcEnd=    src + srcLength;
-                while (src < srcEnd) {
-                    uinteger uc= uinteger( *src++ );
-                    ALIB_ASSERT_ERROR(       uc <  0xd800
-                                        || ( uc >= 0xe000 && uc <= 0x10ffff ),
-                                        "STRINGS", "Illegal unicode 32 bit codepoint"   )
-
-                    if( uc < 0x10000 ) {
-                          base::vbuffer[base::length++]=  static_cast<REAL_XCHAR>( uc );
-                    } else {
-                        uc-= 0x10000;
-                        base::vbuffer[base::length++]= static_cast<REAL_XCHAR>(  ( uc >> 10    ) + 0xd800  );
-                        base::vbuffer[base::length++]= static_cast<REAL_XCHAR>(  ( uc &  0x3ff ) + 0xdc00  );
-                }   }
-              #endif
-            } // wchar_t -> REAL_XCHAR
-
-            // nchar -> REAL_XCHAR
-            if constexpr ( std::same_as<TCharSrc, nchar> ) {
-                ALIB_STRING_DBG_CHK( this )
-
-                // We are using a WAString to do the job. Not efficient, but for today, this should be all we do!
-                TAString<REAL_WCHAR,lang::HeapAllocator>   converter;
-                REAL_WCHAR externalBuffer[8192];
-                externalBuffer[0]= 0;
-                converter.SetBuffer( externalBuffer, 8192 );
-                converter.Append<NC>( src, srcLength );
-                converter.DbgDisableBufferReplacementWarning();
-                return Append<NC>( converter.Buffer(), converter.Length() );
-            } // nchar -> REAL_XCHAR
-
-
-        } //wchar_t
-
+        // convert between UTF-8, UTF-16 and UTF-32
+        EnsureRemainingCapacity( characters::TranscodedLengthMax<TChar, TCharSrc>( srcLength ) );
+        base::length+= characters::Transcode( src, srcLength, base::vbuffer + base::length );
         return *this;
     }
 
@@ -1314,41 +1038,16 @@ class TAString : public TString<TChar>
         }
 
 
-        // this is an AString<nchar>?
-        if constexpr ( std::same_as< TChar, nchar > ) {
-            wchar wc=  static_cast<wchar>( src );
-            int mbLength;
-            #if defined(_WIN32)
-                EnsureRemainingCapacity( MB_LEN_MAX * 2);
-                mbLength= WideCharToMultiByte( CP_UTF8, 0, &wc, 1,
-                                               ((nchar*) base::vbuffer) + base::length,
-                                               MB_LEN_MAX * 2, NULL, NULL );
-                if ( mbLength <= 0 ) {
-                    ALIB_DBG( DWORD error= GetLastError(); )
-                    ALIB_WARNING( "STRINGS", "Cannot convert wide character string to UTF-8. Error: {} ({})",
-                     (   error == ERROR_INSUFFICIENT_BUFFER    ? "ERROR_INSUFFICIENT_BUFFER"
-                      :  error == ERROR_INVALID_FLAGS          ? "ERROR_INVALID_FLAGS."
-                      :  error == ERROR_INVALID_PARAMETER      ? "ERROR_INVALID_PARAMETER"
-                      :  error == ERROR_NO_UNICODE_TRANSLATION ? "ERROR_NO_UNICODE_TRANSLATION"
-                                                               : "<unknown>" ),
-                      error )
-                }
-            #else
-                EnsureRemainingCapacity( integer(MB_CUR_MAX) + 1);
-                mbLength= wctomb( reinterpret_cast<nchar*>(base::vbuffer)
-                                                         + base::length, wc );
-            #endif
-
-            if ( mbLength <= 0 ) {
-                ALIB_WARNING( "STRINGS", "Cannot convert WC to MBC." )
-                return *this;
-            }
-
-            base::length+= mbLength;
+        // this is an AString<nchar> and a wide character is given?
+        if constexpr (    std::same_as< TChar, nchar >
+                      && !std::same_as< decltype(src), nchar > ) {
+            char32_t cp= static_cast<char32_t>( src );
+            EnsureRemainingCapacity( 4 );
+            base::length+= characters::Transcode( &cp, 1, base::vbuffer + base::length );
             return *this;
         }
 
-        // AString<wchar>/<xchar>? (we are just casting)
+        // same type or AString<wchar>/<xchar>? (we are just casting)
         EnsureRemainingCapacity( 1 );
         base::vbuffer[ base::length++ ]= static_cast<TChar>( src );
         return *this;
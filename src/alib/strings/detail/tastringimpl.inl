@@ -83,9 +83,13 @@ void TAString<TChar, TAllocator>::GrowBufferAtLeastBy( integer minimumGrowth ) {
     ALIB_ASSERT_WARNING (  base::length + minimumGrowth > actCapacity, "STRINGS",
       "Unnecessary invocation of Grow(): {} <= {}", base::length + minimumGrowth, actCapacity )
 
-    // first allocation? Go with given growth as size
+    using growthTraits= lang::GrowthTraits<TAllocator>;
+
+    // first allocation? Go with given growth as size (rounded up to the allocator's block size)
     if (actCapacity == 0 ) {
-        SetBuffer( minimumGrowth > 15 ? minimumGrowth : 15 );
+        SetBuffer( integer( growthTraits::RoundUp( size_t( (std::max)( minimumGrowth, integer(15) )
+                                                           + 1 ) * sizeof(TChar) )
+                            / sizeof(TChar) ) - 1 );
         #if ALIB_DEBUG_STRINGS
         debugLastAllocRequest= minimumGrowth;
         #endif
@@ -93,11 +97,11 @@ void TAString<TChar, TAllocator>::GrowBufferAtLeastBy( integer minimumGrowth ) {
         return;
     }
 
-    // calc new size: in general grow by 50%
-    integer newCapacity= actCapacity + (actCapacity / 2);
-    if ( newCapacity < base::length + minimumGrowth )
-        newCapacity+= minimumGrowth;
-
+    // calc new size as defined by the allocator's growth traits
+    integer newCapacity= integer( growthTraits::Grow(
+                                    size_t( actCapacity                   + 1 ) * sizeof(TChar),
+                                    size_t( base::length + minimumGrowth  + 1 ) * sizeof(TChar) )
+                                  / sizeof(TChar) ) - 1;
     if ( newCapacity < 15 )
         newCapacity= 15;
 
@@ -34,11 +34,18 @@
 //##################################### std::ostream& operator<< ###################################
 std::ostream& operator<<( std::ostream& stream, const alib::WString& string ) {
     alib::NString4K conv;
-    alib::integer   maxConv= 4 * 1024 / static_cast<alib::integer>(MB_CUR_MAX);
+    alib::integer   maxConv= 4 * 1024 / alib::characters::TranscodedLengthMax<alib::nchar,
+                                                                                alib::wchar>( 1 );
 
     alib::integer startIdx= 0;
     while( startIdx < string.Length() ) {
         alib::integer length= (std::min)( alib::integer(maxConv), string.Length() - startIdx);
+
+        // do not split UTF-16 surrogate pairs
+        if constexpr ( sizeof(alib::wchar) == 2 )
+            if(    startIdx + length < string.Length()
+                && ( string.CharAt<alib::NC>( startIdx + length - 1 ) & 0xFC00 ) == 0xD800 )
+                --length;
         conv.Reset( string.Substring<alib::NC>(startIdx, length) );
         stream.write( conv.Buffer(), conv.Length() );
         startIdx+= length;
@@ -256,61 +256,7 @@ integer  TString<nchar>::WStringLength()
     if ( length == 0 )
         return 0;
 
-    const nchar* cs= buffer;
-
-  //---------------------------------------- Windows Version ---------------------------------------
-    #if defined( _WIN32 )
-
-        int conversionSize= MultiByteToWideChar( CP_UTF8, 0, cs, int( length ), nullptr, 0 );
-
-        // check for errors
-        #if ALIB_DEBUG
-            if ( conversionSize == 0 ) {
-                // not enough space?
-                int error= GetLastError();
-
-                NString128 msg( "AString: Conversion to wide character string failed (Error: " );
-                     if ( error == ERROR_INSUFFICIENT_BUFFER      ) msg._( "ERROR_INSUFFICIENT_BUFFER."   );
-                else if ( error == ERROR_INVALID_FLAGS            ) msg._( "ERROR_INVALID_FLAGS."         );
-                else if ( error == ERROR_INVALID_PARAMETER        ) msg._( "ERROR_INVALID_PARAMETER"      );
-                else if ( error == ERROR_NO_UNICODE_TRANSLATION   ) msg._( "ERROR_NO_UNICODE_TRANSLATION" );
-                else                                                msg._( error );
-                msg._(')');
-
-                ALIB_WARNING( "STRINGS", msg )
-                return length;
-            }
-
-            if( conversionSize > length ) {
-                ALIB_ERROR( "STRINGS", "MBCS to WCS conversion failed. Conversion length=",
-                                       conversionSize );
-                return length;
-            }
-        #endif
-
-        return conversionSize;
-
-  //-------------------------------------- __GLIBCXX__ Version -------------------------------------
-    #elif defined (__GLIBCXX__) || defined(_LIBCPP_VERSION) || defined(__APPLE__) || defined(__ANDROID_NDK__)
-
-        size_t conversionSize=  mbsnrtowcs( nullptr, &cs, size_t(length), 0, nullptr );
-        if ( conversionSize ==  size_t(-1) ) {
-            ALIB_WARNING( "STRINGS", "MBCS to WCS conversion failed. Illegal MBC sequence. "
-                                     "Probably UTF-8 is not set in locale" )
-            return length;
-        }
-
-        ALIB_ASSERT_ERROR( conversionSize <= size_t( length ), "STRINGS",
-                           "MBCS to WCS conversion failed. Conversion length=", conversionSize )
-
-        return integer(conversionSize);
-
-    #else
-
-        #pragma message ("Unknown Platform in file: " __FILE__ )
-        return length;
-
-    #endif
+    return characters::TranscodedLength<wchar>( buffer, length );
 }
 
 template integer  TString<nchar>::indexOfString<lang::Case::Sensitive>(const TString<nchar>&,integer,integer) const;
@@ -347,45 +293,7 @@ integer  TString<xchar>::WStringLength()
     if ( length == 0 )
         return 0;
 
-    const xchar* src=       buffer;
-    const xchar* srcEnd=    buffer + length;
-    integer result= 0;
-#if ALIB_SIZEOF_WCHAR_T == 4
-
-    // convert UTF16 to UTF32
-    while (src < srcEnd) {
-        const char32_t uc = static_cast<char32_t>( *src++ );
-        if ((uc - 0xd800) >= 2048) // not surrogate
-            ++result;
-        else {
-            ALIB_ASSERT_ERROR(    src < srcEnd                                    // has one more?
-                               && ((uc                & 0xfffffc00) == 0xd800)    // is low?
-                               && ((char32_t(*src++)  & 0xfffffc00) == 0xdc00),   // is high?
-                               "STRINGS", "Error decoding UTF16" )
-
-            ++result;
-            ++src;
-    }   }
-
-#else
-
-    // convert UTF32 to UTF16
-    while (src < srcEnd) {
-        uinteger uc= *src++;
-        ALIB_ASSERT_ERROR(       uc <  0xd800
-                            || ( uc >= 0xe000 && uc <= 0x10ffff ), "STRINGS",
-                            "Illegal unicode 32 bit codepoint"       )
-
-        if( uc < 0x10000 )
-            ++result;
-        else {
-            uc-= 0x10000;
-            result+= 2;
-    }   }
-
-#endif
-
-    return result;
+    return characters::TranscodedLength<wchar>( buffer, length );
 }
 
 template integer  TString<xchar>::indexOfString<lang::Case::Sensitive>(const TString<xchar>&,integer,integer) const;
@@ -399,38 +307,6 @@ template uint64_t TString<xchar>::ParseHex      ( integer, TNumberFormat<xchar>*
 template uint64_t TString<xchar>::ParseOct      ( integer, TNumberFormat<xchar>*            , integer*      ) const;
 template double   TString<xchar>::ParseFloat    ( integer, TNumberFormat<xchar>*            , integer*      ) const;
 
-//##################################################################################################
-// Hashcode
-//##################################################################################################
-template<typename TChar>
-requires alib::characters::IsCharacter<TChar>
-std::size_t TString<TChar>::Hashcode()                                                         const
-{
-    return std::hash<std::basic_string_view<TChar>>()(
-           std::basic_string_view<TChar>( Buffer(), size_t( Length() ) ) );
-}
-
-
-template std::size_t TString<nchar>::Hashcode          () const;
-template std::size_t TString<wchar>::Hashcode          () const;
-template std::size_t TString<xchar>::Hashcode          () const;
-
-template<typename TChar>
-requires alib::characters::IsCharacter<TChar>
-std::size_t TString<TChar>::HashcodeIgnoreCase()                                             const {
-    std::size_t result= 68460391ul * ( size_t(length) + 1 );
-
-    auto* begin= buffer;
-    auto* end  = buffer + length;
-    while( begin != end )
-        result = 199ul * result + std::size_t( ToUpper<TChar>( *begin++ ) );
-
-    return result;
-}
-template std::size_t TString<nchar>::HashcodeIgnoreCase() const;
-template std::size_t TString<wchar>::HashcodeIgnoreCase() const;
-template std::size_t TString<xchar>::HashcodeIgnoreCase() const;
-
 //##################################################################################################
 // debug methods
 //##################################################################################################
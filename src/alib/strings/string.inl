@@ -317,24 +317,12 @@ class TString
 
     /// Returns the length of the string if represented as a wide character string.
     /// If template parameter \p{TChar} equals \c wchar, then this is identical with #Length.
-    /// Otherwise the calculation is done using
-    /// - <em>mbsnrtowcs()</em>
-    ///   (without providing a conversion buffer) on glibc platforms (e.g., Linux)
-    /// - <em>MultiByteToWideChar()</em>
-    ///   (without providing a conversion buffer) on the Windows platform.
-    ///
-    /// If the conversion fails, \c -1 is returned.
-    ///
-    /// \note
-    ///   On GNU/Linux and Mac OS, it might be necessary to invoke standard C method
-    ///   <em>setlocale()</em> once, before using this method, to successfully calculate
-    ///   the length.
-    ///   This by default is done during \ref alib_mod_bs "library initialization",
-    ///   if performed on class \alib{camp;Basecamp}.
+    /// Otherwise, the length is calculated with function \alib{characters;TranscodedLength},
+    /// which does not depend on the locale settings of the C library. Invalid input sequences
+    /// are counted like function \alib{characters;Transcode} replaces them, hence the result
+    /// always equals the length of a conversion.
     ///
     /// @return The length of string when it was converted to wide characters.
-    ///         If counting failed (what means that a corresponding conversion would also fail)
-    ///         the #Length is returned.
     integer                 WStringLength()                                                   const;
 
 
@@ -492,22 +480,31 @@ class TString
     //##############################################################################################
     /// Computes a hash number for the contained string.
     ///
-    /// \note
-    ///   If this library is compiled using C++17, internally this method is using
-    ///   <c>std::hash<std::string_view<TChar>></c>. Otherwise a compatible hash function
-    ///   is used.
-    /// \see Alternative method #HashcodeIgnoreCase.
+    /// The hash number is calculated with function \alib{characters;Hash}, which processes
+    /// the string in words of 64 bits. The hash number is not guaranteed to be the same with
+    /// different platforms or versions of this library and hence must not be stored persistently.
+    ///
+    /// \see
+    ///   - Alternative method #HashcodeIgnoreCase.
+    ///   - Class \alib{strings;THashedString;HashedString}, which stores a string together with
+    ///     its hash number, to avoid repeated calculations.
     ///
+    /// @param seed An optional seed value. Hash numbers of multiple strings may be combined by
+    ///             passing the hash number of one string as the seed of the next.
     /// @return A hash number which is equal for two instances with the same content.
-    std::size_t Hashcode()                                                                    const;
+    std::size_t Hashcode( uint64_t seed= 0 )                                                  const
+    { return std::size_t( characters::Hash( buffer, length, seed ) ); }
 
     /// Computes a hash number for the contained string converted to upper case letters.
+    /// The hash number is calculated with function \alib{characters;HashIgnoreCase}.
     ///
     /// \see Alternative method #Hashcode.
     ///
+    /// @param seed An optional seed value. See method #Hashcode for details.
     /// @return A hash number which is equal for two instances with have the same content
     ///         if converted to upper case letters.
-    std::size_t HashcodeIgnoreCase()                                                          const;
+    std::size_t HashcodeIgnoreCase( uint64_t seed= 0 )                                        const
+    { return std::size_t( characters::HashIgnoreCase( buffer, length, seed ) ); }
 
     //##############################################################################################
     /// @name Comparison Methods
@@ -2139,8 +2136,6 @@ extern template ALIB_DLL uint64_t TString<nchar>::ParseBin
 extern template ALIB_DLL uint64_t TString<nchar>::ParseHex                            ( integer, TNumberFormat<nchar>*, integer* ) const;
 extern template ALIB_DLL uint64_t TString<nchar>::ParseOct                            ( integer, TNumberFormat<nchar>*, integer* ) const;
 extern template ALIB_DLL double   TString<nchar>::ParseFloat                          ( integer, TNumberFormat<nchar>*, integer* ) const;
-extern template ALIB_DLL size_t   TString<nchar>::Hashcode                            ()                                           const;
-extern template ALIB_DLL size_t   TString<nchar>::HashcodeIgnoreCase                  ()                                           const;
 
 template<> inline        integer  TString<wchar>::WStringLength                       () const { return length; }
 extern template ALIB_DLL integer  TString<wchar>::indexOfString<lang::Case::Sensitive>(const TString<wchar>&, integer, integer   ) const;
@@ -2153,8 +2148,6 @@ extern template ALIB_DLL uint64_t TString<wchar>::ParseBin
 extern template ALIB_DLL uint64_t TString<wchar>::ParseHex                            ( integer, TNumberFormat<wchar>*, integer* ) const;
 extern template ALIB_DLL uint64_t TString<wchar>::ParseOct                            ( integer, TNumberFormat<wchar>*, integer* ) const;
 extern template ALIB_DLL double   TString<wchar>::ParseFloat                          ( integer, TNumberFormat<wchar>*, integer* ) const;
-extern template ALIB_DLL size_t   TString<wchar>::Hashcode                            ()                                           const;
-extern template ALIB_DLL size_t   TString<wchar>::HashcodeIgnoreCase                  ()                                           const;
 
 template<>      ALIB_DLL integer  TString<xchar>::WStringLength                       ()      const;
 extern template ALIB_DLL integer  TString<xchar>::indexOfString<lang::Case::Sensitive>( const TString<xchar >&, integer, integer ) const;
@@ -2167,8 +2160,6 @@ extern template ALIB_DLL uint64_t TString<xchar>::ParseBin
 extern template ALIB_DLL uint64_t TString<xchar>::ParseHex                            ( integer, TNumberFormat<xchar>*, integer* ) const;
 extern template ALIB_DLL uint64_t TString<xchar>::ParseOct                            ( integer, TNumberFormat<xchar>*, integer* ) const;
 extern template ALIB_DLL double   TString<xchar>::ParseFloat                          ( integer, TNumberFormat<xchar>*, integer* ) const;
-extern template ALIB_DLL size_t   TString<xchar>::Hashcode                            ()                                           const;
-extern template ALIB_DLL size_t   TString<xchar>::HashcodeIgnoreCase                  ()                                           const;
 
 //##################################################################################################
 // debug members
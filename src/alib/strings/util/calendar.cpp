@@ -13,6 +13,11 @@
 #endif
 //========================================= Global Fragment ========================================
 #include "alib/strings/strings.prepro.hpp"
+#if !defined( _WIN32 )
+#   include <algorithm>
+#   include <atomic>
+#   include <ctime>
+#endif
 //============================================== Module ============================================
 #if ALIB_C20_MODULES
     module ALib.Strings.Calendar;
@@ -57,9 +62,189 @@ DOX_MARKER( [CDT_DAY_NAMES])
 #endif // !DOXYGEN
 
 
+//##################################################################################################
+// Civil date arithmetic and time zone offset cache
+//##################################################################################################
+#if !DOXYGEN && !defined( _WIN32 )
+namespace {
+
+constexpr int64_t secondsPerDay= 86400;
+
+// Division and modulo rounding towards negative infinity.
+constexpr int64_t floorDiv( int64_t a, int64_t b )    { return a / b - ( (a % b != 0) && ((a < 0) != (b < 0)) ); }
+constexpr int64_t floorMod( int64_t a, int64_t b )    { return a - floorDiv( a, b ) * b; }
+
+// Returns the number of days since 1970-01-01 of a date of the proleptic Gregorian calendar.
+// Months outside of 1..12 and days outside of the month are normalized, like mktime does.
+// (Algorithm of Howard Hinnant, "chrono-compatible low-level date algorithms".)
+constexpr int64_t daysFromCivil( int64_t year, int64_t month, int64_t day ) {
+    year += floorDiv( month - 1, 12 );
+    month = floorMod( month - 1, 12 ) + 1;
+    year -= month <= 2;
+    int64_t era= floorDiv( year, 400 );
+    int64_t yoe= year - era * 400;
+    int64_t doy= ( 153 * ( month > 2 ? month - 3 : month + 9 ) + 2 ) / 5 + day - 1;
+    int64_t doe= yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+// Sets the fields of the given calendar object from the seconds since 1970-01-01 00:00:00 of
+// the civil time to represent.
+void setFromCivilSeconds( CalendarDateTime& cdt, int64_t seconds ) {
+    int64_t days= floorDiv( seconds, secondsPerDay );
+    int64_t secs= seconds - days * secondsPerDay;
+    cdt.Hour     = int( secs / 3600 );
+    cdt.Minute   = int( secs / 60 % 60 );
+    cdt.Second   = int( secs % 60 );
+    cdt.DayOfWeek= int( floorMod( days + 4, 7 ) );  // 1970-01-01 was a Thursday
+
+    days+= 719468;
+    int64_t era= floorDiv( days, 146097 );
+    int64_t doe= days - era * 146097;
+    int64_t yoe= ( doe - doe / 1460 + doe / 36524 - doe / 146096 ) / 365;
+    int64_t doy= doe - ( 365 * yoe + yoe / 4 - yoe / 100 );
+    int64_t mp = ( 5 * doy + 2 ) / 153;
+    cdt.Day      = int( doy - ( 153 * mp + 2 ) / 5 + 1 );
+    cdt.Month    = int( mp < 10 ? mp + 3 : mp - 9 );
+    cdt.Year     = int( yoe + era * 400 + ( cdt.Month <= 2 ) );
+}
+
+// Returns the seconds since 1970-01-01 00:00:00 of the civil time given by a calendar object.
+int64_t civilSeconds( const CalendarDateTime& cdt ) {
+    return   daysFromCivil( cdt.Year, cdt.Month, cdt.Day ) * secondsPerDay
+           + int64_t( cdt.Hour ) * 3600 + int64_t( cdt.Minute ) * 60 + cdt.Second;
+}
+
+// Returns the UTC offset of the local time zone at the given point in time, received from libc.
+int64_t libcOffset( int64_t epochSeconds ) {
+    struct tm tm;
+    time_t    tt= time_t( epochSeconds );
+    localtime_r( &tt, &tm );
+    return int64_t( tm.tm_gmtoff );
+}
+
+// The window of time in which the UTC offset of the local time zone is cached. The window
+// contains at most one transition of the offset, e.g., from standard to daylight saving time.
+// The fields are read without locking: Field 'seq' is odd while the window is rebuilt and
+// incremented with each change. Readers that observe a change fall back to libc.
+struct OffsetWindow {
+    std::atomic<uint32_t>   seq         {0};
+    std::atomic<int64_t>    start       {0};  // first epoch second of the window
+    std::atomic<int64_t>    end         {0};  // epoch second behind the window
+    std::atomic<int64_t>    transition  {0};  // first epoch second with 'offsetAfter'
+    std::atomic<int64_t>    offsetBefore{0};
+    std::atomic<int64_t>    offsetAfter {0};
+};
+OffsetWindow            offsetWindow;
+
+// A consistent copy of the fields of 'offsetWindow'.
+struct OffsetWindowSnapshot {
+    int64_t start, end, transition, offsetBefore, offsetAfter;
+};
+
+// The length of the window. Between two rebuilds, libc is invoked about 1000 times.
+constexpr int64_t       windowLength  = 14 * secondsPerDay;
+
+// The distance of the offset samples used to find the transitions within a window.
+constexpr int64_t       sampleDistance= 3 * 3600;
+
+// Reads the window. Returns false if the window is rebuilt concurrently.
+bool readWindow( OffsetWindowSnapshot& snapshot ) {
+    uint32_t seq= offsetWindow.seq.load( std::memory_order_acquire );
+    if( seq & 1 )
+        return false;
+    snapshot.start       = offsetWindow.start       .load( std::memory_order_relaxed );
+    snapshot.end         = offsetWindow.end         .load( std::memory_order_relaxed );
+    snapshot.transition  = offsetWindow.transition  .load( std::memory_order_relaxed );
+    snapshot.offsetBefore= offsetWindow.offsetBefore.load( std::memory_order_relaxed );
+    snapshot.offsetAfter = offsetWindow.offsetAfter .load( std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_acquire );
+    return offsetWindow.seq.load( std::memory_order_relaxed ) == seq;
+}
+
+// Rebuilds the window to start at the given epoch second. Nothing is done if another thread
+// rebuilds the window concurrently.
+void rebuildWindow( int64_t start ) {
+    uint32_t seq= offsetWindow.seq.load( std::memory_order_relaxed );
+    if( (seq & 1) || !offsetWindow.seq.compare_exchange_strong( seq, seq + 1,
+                                                                std::memory_order_acquire ) )
+        return;
+
+    // sample the offset to find the first transition. The window ends before a second one.
+    int64_t end         = start + windowLength;
+    int64_t offsetBefore= libcOffset( start );
+    int64_t offsetAfter = offsetBefore;
+    int64_t transition  = end;
+    int64_t last        = start;
+    for( int64_t t= start + sampleDistance ; t < end + sampleDistance ; t+= sampleDistance ) {
+        int64_t sample= t < end ? t : end - 1;
+        int64_t offset= libcOffset( sample );
+        if( offset == offsetAfter ) {
+            last= sample;
+            continue;
+        }
+        if( transition != end ) {
+            end= last + 1;
+            break;
+        }
+
+        // binary search of the transition between 'last' and 'sample'
+        int64_t lo= last, hi= sample;
+        while( hi - lo > 1 ) {
+            int64_t mid= lo + ( hi - lo ) / 2;
+            ( libcOffset( mid ) == offsetBefore ? lo : hi )= mid;
+        }
+        transition = hi;
+        offsetAfter= offset;
+        last       = sample;
+    }
+
+    offsetWindow.start       .store( start       , std::memory_order_relaxed );
+    offsetWindow.end         .store( end         , std::memory_order_relaxed );
+    offsetWindow.transition  .store( transition  , std::memory_order_relaxed );
+    offsetWindow.offsetBefore.store( offsetBefore, std::memory_order_relaxed );
+    offsetWindow.offsetAfter .store( offsetAfter , std::memory_order_relaxed );
+    offsetWindow.seq.store( seq + 2, std::memory_order_release );
+}
+
+// Reads the window. If it was not built yet, or if the given point in time lies shortly
+// behind it, the window is rebuilt. Returns false if the given point in time is not covered.
+bool getWindow( int64_t epochSeconds, OffsetWindowSnapshot& snapshot ) {
+    if( !readWindow( snapshot ) )
+        return false;
+    if( epochSeconds >= snapshot.start && epochSeconds < snapshot.end )
+        return true;
+
+    if( snapshot.start == snapshot.end )
+        rebuildWindow( int64_t( std::time( nullptr ) ) - windowLength / 4 );
+    else if( epochSeconds >= snapshot.end && epochSeconds < snapshot.end + windowLength )
+        rebuildWindow( (std::max)( epochSeconds - windowLength / 4, snapshot.end ) );
+    else
+        return false;
+
+    return     readWindow( snapshot )
+            && epochSeconds >= snapshot.start && epochSeconds < snapshot.end;
+}
+
+} // anonymous namespace
+#endif // !DOXYGEN && !defined( _WIN32 )
+
 //##################################################################################################
 // CalendarDateTime
 //##################################################################################################
+void CalendarDateTime::ResetTimezoneCache() {
+    #if !defined( _WIN32 )
+        tzset();
+        uint32_t seq= offsetWindow.seq.load( std::memory_order_relaxed );
+        while(    (seq & 1)
+               || !offsetWindow.seq.compare_exchange_weak( seq, seq + 1, std::memory_order_acquire ) )
+            seq= offsetWindow.seq.load( std::memory_order_relaxed ) & ~1u;
+        offsetWindow.start.store( 0, std::memory_order_relaxed );
+        offsetWindow.end  .store( 0, std::memory_order_relaxed );
+        offsetWindow.seq  .store( seq + 2, std::memory_order_release );
+    #endif
+}
+
 void CalendarDateTime::Clear() {
     Year=
     Month=
@@ -86,16 +271,25 @@ void CalendarDateTime::Set( const DateTime& timeStamp, lang::Timezone timezone )
         Second=     st.wSecond;
 
     #elif defined (__GLIBCXX__) || defined(_LIBCPP_VERSION) || defined(__APPLE__) || defined(__ANDROID_NDK__)
-        struct tm  tm;
         time_t tt= timeStamp.InEpochSeconds();
         if ( timezone == lang::Timezone::UTC ) {
-            tm.tm_isdst=      0; // daylight saving off
-            gmtime_r( &tt, &tm );
-        } else {
-            tm.tm_isdst=     -1; // daylight saving auto
-            localtime_r( &tt, &tm );
+            setFromCivilSeconds( *this, int64_t( tt ) );
+            return;
         }
 
+        OffsetWindowSnapshot window;
+        if( getWindow( int64_t( tt ), window ) ) {
+            setFromCivilSeconds( *this, int64_t( tt ) + ( int64_t( tt ) < window.transition
+                                                          ? window.offsetBefore
+                                                          : window.offsetAfter ) );
+            return;
+        }
+
+        // not cached: use libc
+        struct tm  tm;
+        tm.tm_isdst=     -1; // daylight saving auto
+        localtime_r( &tt, &tm );
+
         Year=       tm.tm_year + 1900;
         Day=        tm.tm_mday;
         DayOfWeek=  tm.tm_wday;
@@ -127,6 +321,24 @@ DateTime  CalendarDateTime::Get( lang::Timezone timezone )
         result= DateTime::FromSystemTime( st, timezone );
 
     #elif defined (__GLIBCXX__) || defined(_LIBCPP_VERSION) || defined(__APPLE__) || defined(__ANDROID_NDK__)
+        int64_t civil= civilSeconds( *this );
+        if ( timezone == lang::Timezone::UTC )
+            return DateTime::FromEpochSeconds( time_t( civil ) );
+
+        // The civil time is unambiguous if exactly one of the two offsets of the window leads to
+        // a point in time that uses this offset. Otherwise, the time is either skipped or
+        // repeated with a transition, or not covered by the window, and libc is used.
+        OffsetWindowSnapshot window;
+        if( getWindow( civil, window ) ) {
+            int64_t before= civil - window.offsetBefore;
+            int64_t after = civil - window.offsetAfter;
+            bool    validBefore= before >= window.start      && before < window.transition;
+            bool    validAfter =  after >= window.transition &&  after < window.end;
+            if( validBefore != validAfter )
+                return DateTime::FromEpochSeconds( time_t( validBefore ? before : after ) );
+        }
+
+        // not cached: use libc
         struct tm  tm;
         tm.tm_year=       Year - 1900;
         tm.tm_mday=       Day;
@@ -135,16 +347,8 @@ DateTime  CalendarDateTime::Get( lang::Timezone timezone )
         tm.tm_min=        Minute;
         tm.tm_sec=        Second;
 
-        time_t tt;
-        if ( timezone == lang::Timezone::UTC ) {
-            tm.tm_isdst=      0; // daylight saving off
-            tt= timegm( &tm );
-        } else {
-            tm.tm_isdst=     -1; // daylight saving auto
-            tt= mktime( &tm );
-        }
-
-        result= DateTime::FromEpochSeconds( tt );
+        tm.tm_isdst=     -1; // daylight saving auto
+        result= DateTime::FromEpochSeconds( mktime( &tm ) );
 
 
     #else
@@ -25,6 +25,15 @@ ALIB_EXPORT namespace alib { namespace  strings::util {
 /// \note
 ///   This class is using system-specific calendar methods and relies on the locale and time zone
 ///   settings of the machine.
+///   On non-Windows platforms, conversions in respect to UTC are performed arithmetically.
+///   For conversions in respect to local time, the offsets of the local time zone are cached
+///   for a window of two weeks around the current time, which includes the transition points
+///   of daylight saving time. Within this window, no libc functions are invoked.
+///   This avoids the global lock that function \c localtime_r acquires and makes the conversion
+///   performed with each log line of \alox considerably faster. Points in time outside the
+///   window, or local times that are skipped or repeated with a transition, are converted
+///   using libc. If the time zone of the process is changed, method #ResetTimezoneCache has to
+///   be invoked.
 //==================================================================================================
 class CalendarDateTime
 {
@@ -130,6 +139,13 @@ class CalendarDateTime
     ALIB_DLL
     void        Clear();
 
+    /// Clears the cache of time zone offsets used with conversions in respect to local time
+    /// and invokes \c tzset.
+    /// This method has to be invoked if environment variable \c TZ is changed while the process
+    /// is running. On Windows platforms, this method is empty.
+    ALIB_DLL
+    static void ResetTimezoneCache();
+
     /// Formats the date using a given pattern string. Within the pattern string, different symbols
     /// are interpreted as tokens. The format is compatible with C# time format strings, as well as
     /// with class SimpleDateFormat of the Java APIs.<br>
@@ -0,0 +1,105 @@
+//##################################################################################################
+//  ALib C++ Library
+//
+//  Copyright 2013-2025 A-Worx GmbH, Germany
+//  Published under 'Boost Software License' (a free software license, see LICENSE.txt)
+//##################################################################################################
+#include "alib_precompile.hpp"
+#if !defined(ALIB_C20_MODULES) || ((ALIB_C20_MODULES != 0) && (ALIB_C20_MODULES != 1))
+#   error "Symbol ALIB_C20_MODULES has to be given to the compiler as either 0 or 1"
+#endif
+#if ALIB_C20_MODULES
+    module;
+#endif
+//========================================= Global Fragment ========================================
+#include "alib/alib.inl"
+#include <thread>
+//============================================== Module ============================================
+#if ALIB_C20_MODULES
+    module ALib.ThreadModel;
+#else
+#   include "ALib.ThreadModel.H"
+#endif
+//========================================== Implementation ========================================
+namespace alib::threadmodel {
+
+#   include "ALib.Lang.CIFunctions.H"
+void* Task::promise_type::operator new( size_t size ) {
+    auto& manager= DWManager::GetSingleton();
+    manager.Acquire(ALIB_CALLER_PRUNED);
+        void* mem= manager.GetPoolAllocator().allocate( size,
+                                                    ALIB_MONOMEM_POOLALLOCATOR_DEFAULT_ALIGNMENT );
+    manager.Release(ALIB_CALLER_PRUNED);
+    return mem;
+}
+
+void Task::promise_type::operator delete( void* mem, size_t size ) {
+    auto& manager= DWManager::GetSingleton();
+    manager.Acquire(ALIB_CALLER_PRUNED);
+        manager.GetPoolAllocator().free( mem, size );
+    manager.Release(ALIB_CALLER_PRUNED);
+}
+#   include "ALib.Lang.CIMethods.H"
+
+std::coroutine_handle<> Task::promise_type::FinalAwaiter::await_suspend(
+                                         std::coroutine_handle<promise_type> handle )  noexcept {
+    auto& promise= handle.promise();
+
+    // set flag 'Busy' together with 'Done'. Neither waiting threads nor the destructor of the
+    // task delete the frame, while 'Busy' is set.
+    int prevState= promise.state.fetch_or( Done | Busy, std::memory_order_acq_rel );
+
+    // continue an awaiting coroutine (symmetric transfer)
+    std::coroutine_handle<> next= ( prevState & Awaited ) ? promise.continuation
+                                                          : std::noop_coroutine();
+
+    // release waiting threads
+    if( prevState & Waiting )
+        promise.state.notify_all();
+
+    // clear 'Busy'. This is the last access to the frame, unless nobody is interested
+    // in this coroutine anymore.
+    prevState= promise.state.fetch_and( ~Busy, std::memory_order_acq_rel );
+    if( prevState & Detached )
+        handle.destroy();
+    return next;
+}
+
+Task::~Task() {
+    if( !handle )
+        return;
+    int prevState= handle.promise().state.fetch_or( promise_type::Detached,
+                                                    std::memory_order_acq_rel );
+    ALIB_ASSERT_ERROR(    ( prevState & promise_type::Done )
+                       || ( prevState & promise_type::Awaited ) == 0, "TMOD",
+                       "Task destructed while being awaited." )
+
+    // if the final awaiter is still busy, it deletes the frame
+    if( ( prevState & ( promise_type::Done | promise_type::Busy ) ) == promise_type::Done )
+        handle.destroy();
+}
+
+void Task::Wait() {
+    auto& state= handle.promise().state;
+    int   actState= state.load( std::memory_order_acquire );
+    while( ( actState & promise_type::Done ) == 0 ) {
+        if(    ( actState & promise_type::Waiting ) == 0
+            && !state.compare_exchange_weak( actState, actState | promise_type::Waiting,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire ) )
+            continue;
+        state.wait( actState | promise_type::Waiting, std::memory_order_acquire );
+        actState= state.load( std::memory_order_acquire );
+    }
+
+    // the final awaiter might still notify. Wait until it does not access the frame anymore.
+    while( actState & promise_type::Busy ) {
+        std::this_thread::yield();
+        actState= state.load( std::memory_order_acquire );
+    }
+
+    if( handle.promise().exception )
+        std::rethrow_exception( handle.promise().exception );
+}
+
+} // namespace [alib::threadmodel]
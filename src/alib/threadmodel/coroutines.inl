@@ -0,0 +1,361 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of module \alib_threadmodel of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib { namespace threadmodel {
+
+//==================================================================================================
+/// A job that resumes a suspended C++20 coroutine. Scheduled by the awaiters returned with
+/// methods \alib{threadmodel;ThreadPool::Resume}, \alib{threadmodel;DedicatedWorker::Resume} and
+/// \alib{threadmodel;Trigger::Sleep}.
+//==================================================================================================
+struct JResume : Job
+{
+    std::coroutine_handle<>     Handle;   ///< The coroutine to resume.
+
+    /// Constructor.
+    /// @param handle Assigned to #Handle.
+    JResume( std::coroutine_handle<> handle ) : Job(typeid(JResume)), Handle(handle)              {}
+
+    /// Overrides the parent function as necessary.
+    /// @return The sizeof this derived type.
+    virtual size_t  SizeOf()                                override { return sizeof(JResume); }
+
+    /// Resumes the coroutine.
+    /// @return \c true.
+    virtual bool    Do()                                    override { Handle.resume(); return true; }
+};
+
+namespace detail {
+
+/// The awaiter returned by \alib{threadmodel;ThreadPool::Resume}.
+struct PoolResumeAwaiter
+{
+    ThreadPool&     pool;   ///< The pool to continue the coroutine with.
+
+    /// @return \c false.
+    bool    await_ready()                                          const noexcept { return false; }
+
+    /// Schedules a \alib{threadmodel;JResume} job with the pool.
+    /// @param handle The suspended coroutine.
+    void    await_suspend( std::coroutine_handle<> handle )
+    { pool.ScheduleVoid<JResume>( handle ); }
+
+    /// Nothing to do.
+    void    await_resume()                                                   const noexcept {}
+};
+
+/// The awaiter returned by \alib{threadmodel;DedicatedWorker::Resume}.
+struct WorkerResumeAwaiter
+{
+    DedicatedWorker&    worker;     ///< The worker to continue the coroutine with.
+    Priority            priority;   ///< The priority of the job that resumes the coroutine.
+
+    /// @return \c false.
+    bool    await_ready()                                          const noexcept { return false; }
+
+    /// Schedules a \alib{threadmodel;JResume} job with the worker.
+    /// @param handle The suspended coroutine.
+    void    await_suspend( std::coroutine_handle<> handle )
+    { worker.ScheduleVoid<JResume>( priority, handle ); }
+
+    /// Nothing to do.
+    void    await_resume()                                                   const noexcept {}
+};
+
+/// The awaiter returned by \alib{threadmodel;Trigger::Sleep}. This is a
+/// \alib{threadmodel;Triggered} object, which is added to the trigger for a single time when the
+/// coroutine is suspended. When triggered, a \alib{threadmodel;JResume} job is scheduled with the
+/// thread pool. The coroutine is not resumed by the trigger-thread, because triggered objects
+/// are invoked while the trigger is locked.
+struct TriggerSleepAwaiter : Triggered
+{
+    Trigger&                sleepTrigger;   ///< The trigger to use.
+    Ticks::Duration         duration;       ///< The sleep duration.
+    ThreadPool&             pool;           ///< The pool to continue the coroutine with.
+    std::coroutine_handle<> handle;         ///< The suspended coroutine.
+
+    /// Constructor.
+    /// @param pTrigger  Assigned to #sleepTrigger.
+    /// @param pDuration Assigned to #duration.
+    /// @param pPool     Assigned to #pool.
+    TriggerSleepAwaiter( Trigger& pTrigger, const Ticks::Duration& pDuration, ThreadPool& pPool )
+    :
+    #if ALIB_STRINGS
+      Triggered   ( A_CHAR("CoroutineSleep") ),
+    #endif
+      sleepTrigger( pTrigger  )
+    , duration    ( pDuration )
+    , pool        ( pPool     )                                            { triggerOnce= true; }
+
+    /// @return The sleep duration.
+    Ticks::Duration triggerPeriod()                                  override { return duration; }
+
+    /// Schedules a \alib{threadmodel;JResume} job with the pool.
+    void            trigger()                    override { pool.ScheduleVoid<JResume>( handle ); }
+
+    /// @return \c false.
+    bool            await_ready()                                  const noexcept { return false; }
+
+    /// Adds this object to the trigger.
+    /// @param pHandle The suspended coroutine.
+    void            await_suspend( std::coroutine_handle<> pHandle )
+    { handle= pHandle; sleepTrigger.Add( *this ); }
+
+    /// Nothing to do.
+    void            await_resume()                                           const noexcept {}
+};
+
+/// The awaiter returned by <c>operator co_await</c> applied to a \alib{threadmodel;JFuture}.
+/// The awaiter is attached to the future as a continuation. The coroutine is resumed by the
+/// thread that fulfills the future.
+struct FutureAwaiter : JFuture::Continuation
+{
+    JFuture&                future;     ///< The future to await.
+    std::coroutine_handle<> handle;     ///< The suspended coroutine.
+    JFuture::State          state;      ///< The state that the future was fulfilled with.
+
+    /// Constructor.
+    /// @param pFuture Assigned to #future.
+    FutureAwaiter( JFuture& pFuture ) : future(pFuture), state(JFuture::State(0))                 {}
+
+    /// @return \c true if the future is fulfilled already.
+    bool            await_ready() {
+        state= future.GetState();
+        return state != JFuture::State(0);
+    }
+
+    /// Attaches this awaiter as a continuation to the future.
+    /// @param pHandle The suspended coroutine.
+    void            await_suspend( std::coroutine_handle<> pHandle )
+    { handle= pHandle; future.addContinuation( this ); }
+
+    /// Resumes the coroutine. Invoked by \alib{threadmodel;JFuture::Fulfill}.
+    /// @param pState The state that the future was fulfilled with.
+    void            Run( JFuture::State pState )        override { state= pState; handle.resume(); }
+
+    /// @return The state that the future was fulfilled with.
+    JFuture::State  await_resume()                                    const noexcept { return state; }
+};
+
+/// The awaiter returned by <c>operator co_await</c> applied to a \alib{threadmodel;Task}.
+struct TaskAwaiter;
+
+} // namespace alib::threadmodel[::detail]
+
+//==================================================================================================
+/// \attention This class belongs to module \alib_threadmodel, which is not in a stable and
+///            consistent state, yet.
+///            Also, this type is considered experimental.
+///
+/// A C++20 coroutine type to be used with \alib{threadmodel;ThreadPool},
+/// \alib{threadmodel;DedicatedWorker} and \alib{threadmodel;Trigger}.
+/// A function that returns this type may use the following expressions:
+/// - <c>co_await pool.Resume()</c>: Continues the coroutine with a worker of a thread pool.
+/// - <c>co_await worker.Resume( priority )</c>: Continues the coroutine with a dedicated worker.
+/// - <c>co_await trigger.Sleep( duration, pool )</c>: Suspends the coroutine for the given
+///   duration, without blocking a thread, and then continues it with a thread pool.
+/// - <c>co_await future</c>: Suspends the coroutine until a \alib{threadmodel;JFuture} is
+///   fulfilled and continues it with the thread that fulfilled it. Returns the state of the future.
+/// - <c>co_await task</c>: Suspends the coroutine until another task is done and continues it with
+///   the thread that finished the other task.
+///
+/// While a coroutine is suspended, no thread is occupied. This allows a large number of
+/// concurrent requests, which would otherwise block the workers of a pool with waiting for
+/// timers or results.
+///
+/// Coroutines start executing immediately with the thread that invokes the coroutine function.
+/// The frames of the coroutines are allocated with the
+/// \alib{threadmodel;DWManager::GetPoolAllocator;pool allocator} of the singleton
+/// \alib{threadmodel;DWManager}. Consequently, the frames are aligned only as specified with
+/// compiler symbol \ref ALIB_MONOMEM_POOLALLOCATOR_DEFAULT_ALIGNMENT, which must not be exceeded
+/// by the local variables of coroutine functions.
+///
+/// The object returned by the coroutine function is the owner of the coroutine frame.
+/// Its method #Wait blocks the calling thread until the coroutine is done. This may be done by
+/// several threads, also while another coroutine awaits the task. If the object is
+/// destructed before the coroutine is done, the coroutine is detached and its frame is deleted
+/// when it is done.
+///
+/// Exceptions that are not caught by a coroutine are stored with its frame, and the coroutine
+/// counts as done. The exception is rethrown by method #Wait and by <c>co_await task</c>.
+/// Exceptions of detached coroutines are discarded.
+//==================================================================================================
+class Task
+{
+  public:
+    /// The promise type of the coroutine. Not to be used directly.
+    struct promise_type
+    {
+        /// The flags of the state of a task. Different to exclusive states, flags allow a
+        /// coroutine to await a task, while threads are blocked in \alib{threadmodel;Task::Wait}.
+        enum Flags : int {
+            Awaited     = 1 << 0,   ///< Another coroutine awaits this one.
+            Waiting     = 1 << 1,   ///< A thread is blocked in \alib{threadmodel;Task::Wait}.
+            Detached    = 1 << 2,   ///< The \b Task object was destructed before the coroutine
+                                    ///< was done.
+            Done        = 1 << 3,   ///< The coroutine is done.
+            Busy        = 1 << 4,   ///< Set together with \b Done, while the final awaiter still
+                                    ///< accesses the coroutine frame.
+        };
+
+        /// The state of the task. A combination of \b Flags.
+        std::atomic<int>            state                                                   = 0;
+
+        /// The coroutine to resume when done, set before flag \b Awaited.
+        std::coroutine_handle<>     continuation;
+
+        /// An exception that was not caught by the coroutine.
+        std::exception_ptr          exception;
+
+        /// The final awaiter, which resumes the awaiting coroutine, notifies a waiting thread
+        /// or deletes the frame of a detached coroutine.
+        struct FinalAwaiter
+        {
+            /// @return \c false.
+            bool    await_ready()                                  const noexcept { return false; }
+
+            /// Performs the actions depending on the state.
+            /// @param handle The coroutine that is done.
+            /// @return The coroutine to continue with.
+            ALIB_DLL
+            std::coroutine_handle<> await_suspend( std::coroutine_handle<promise_type> handle )
+                                                                                          noexcept;
+
+            /// Nothing to do.
+            void    await_resume()                                           const noexcept {}
+        };
+
+        /// @return The task object.
+        Task                get_return_object()
+        { return Task( std::coroutine_handle<promise_type>::from_promise( *this ) ); }
+
+        /// @return An awaiter that does not suspend.
+        std::suspend_never  initial_suspend()                          const noexcept { return {}; }
+
+        /// @return The final awaiter.
+        FinalAwaiter        final_suspend()                            const noexcept { return {}; }
+
+        /// Nothing to do.
+        void                return_void()                                          const noexcept {}
+
+        /// Stores the current exception in field #exception.
+        void                unhandled_exception()                                        noexcept
+        { exception= std::current_exception(); }
+
+        /// Allocates a coroutine frame with the pool allocator of the \alib{threadmodel;DWManager}.
+        /// @param size The size of the frame.
+        /// @return The frame memory.
+        ALIB_DLL static void*   operator new( size_t size );
+
+        /// Frees a coroutine frame.
+        /// @param mem  The frame memory.
+        /// @param size The size of the frame.
+        ALIB_DLL static void    operator delete( void* mem, size_t size );
+    };
+
+  protected:
+    friend struct detail::TaskAwaiter;
+
+    /// The coroutine.
+    std::coroutine_handle<promise_type>    handle;
+
+    /// Constructor used by \b promise_type.
+    /// @param pHandle The coroutine.
+    explicit Task( std::coroutine_handle<promise_type> pHandle ) : handle(pHandle)                {}
+
+  public:
+    /// Deleted copy constructor.
+    Task( const Task& )                                                                  = delete;
+
+    /// Move constructor.
+    /// @param move The object to move.
+    Task( Task&& move ) noexcept : handle( move.handle )                  { move.handle= nullptr; }
+
+    /// Deleted copy assignment.
+    Task& operator=( const Task& )                                                       = delete;
+
+    /// Destructor. Deletes the coroutine frame if the coroutine is done, otherwise detaches the
+    /// coroutine.
+    ALIB_DLL ~Task();
+
+    /// @return \c true if the coroutine is done, \c false otherwise.
+    bool            IsDone()                                                                 const
+    {
+        return   ( handle.promise().state.load( std::memory_order_acquire )
+                   & ( promise_type::Done | promise_type::Busy ) )
+              == promise_type::Done;
+    }
+
+    /// Blocks the calling thread until the coroutine is done.
+    /// If the coroutine was ended by an exception, this exception is rethrown.
+    ALIB_DLL void   Wait();
+
+    /// Makes a task awaitable by another coroutine.
+    /// @return The awaiter.
+    inline detail::TaskAwaiter  operator co_await();
+};
+
+namespace detail {
+
+#if !DOXYGEN
+struct TaskAwaiter
+{
+    Task&   task;
+
+    bool    await_ready()                                                        const noexcept
+    { return task.IsDone(); }
+
+    bool    await_suspend( std::coroutine_handle<> handle ) {
+        auto& promise= task.handle.promise();
+        promise.continuation= handle;
+        int prevState= promise.state.fetch_or( Task::promise_type::Awaited,
+                                               std::memory_order_acq_rel );
+        ALIB_ASSERT_ERROR( ( prevState & Task::promise_type::Awaited ) == 0, "TMOD",
+                           "Task awaited by two coroutines." )
+
+        // if done already, the final awaiter did not see the flag: continue right away
+        return ( prevState & Task::promise_type::Done ) == 0;
+    }
+
+    void    await_resume()                                                                 const {
+        if( task.handle.promise().exception )
+            std::rethrow_exception( task.handle.promise().exception );
+    }
+};
+#endif
+
+} // namespace alib::threadmodel[::detail]
+
+#if !DOXYGEN
+inline detail::TaskAwaiter      Task::operator co_await()                    { return { *this }; }
+
+inline detail::PoolResumeAwaiter    ThreadPool::Resume()                     { return { *this }; }
+
+inline detail::WorkerResumeAwaiter  DedicatedWorker::Resume( Priority priority )
+{ return { *this, priority }; }
+
+inline detail::TriggerSleepAwaiter  Trigger::Sleep( const Ticks::Duration& duration,
+                                                    ThreadPool& pool )
+{ return detail::TriggerSleepAwaiter( *this, duration, pool ); }
+
+inline detail::TriggerSleepAwaiter  Trigger::Sleep( const Ticks::Duration::TDuration& duration,
+                                                    ThreadPool& pool )
+{ return detail::TriggerSleepAwaiter( *this, Ticks::Duration( duration ), pool ); }
+#endif
+
+/// Makes a \alib{threadmodel;JFuture} awaitable by a coroutine.
+/// The coroutine is continued with the thread that fulfills the future.
+/// @param future The future to await.
+/// @return The awaiter.
+inline detail::FutureAwaiter    operator co_await( JFuture& future )               { return future; }
+
+} // namespace alib[::threadmodel]
+
+/// Type alias in namespace \b alib.
+using      Task     = threadmodel::Task;
+
+}  // namespace [alib]
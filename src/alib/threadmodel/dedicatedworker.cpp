@@ -186,19 +186,77 @@ void DWManager::RemoveAll( Priority stopPriority ) {
 //##################################################################################################
 // DedicatedWorker
 //##################################################################################################
+int DedicatedWorker::getBucket( Priority priority ) {
+    int idx= 0;
+    while( idx < qtyBuckets && buckets[idx].priority < priority )
+        ++idx;
+    if( idx < qtyBuckets && buckets[idx].priority == priority )
+        return idx;
+
+    // a level that covers a range of priorities keeps doing so until it is empty
+    if( idx > 0 && buckets[idx - 1].coversRange )
+        return idx - 1;
+
+    // all levels used: drop an empty level, or else let a neighbor level cover the new priority
+    if( qtyBuckets == MaxPriorityLevels ) {
+        uint32_t emptyBuckets= ~nonEmptyBuckets;
+        if( emptyBuckets == 0 ) {
+            ALIB_MESSAGE( "TMOD", "DedicatedWorker: More than {} different priority values "
+                          "queued. Jobs are inserted with a linear search.", MaxPriorityLevels )
+            if( idx == 0 )
+                buckets[0].priority= priority;
+            else
+                --idx;
+            buckets[idx].coversRange= true;
+            return idx;
+        }
+
+        int empty= lang::CTZ( emptyBuckets );
+        for( int i= empty ; i < qtyBuckets - 1 ; ++i )
+            buckets[i]= buckets[i + 1];
+        --qtyBuckets;
+        uint32_t lowerBits= ( uint32_t(1) << empty ) - 1;
+        nonEmptyBuckets= ( nonEmptyBuckets & lowerBits ) | ( ( nonEmptyBuckets >> 1 ) & ~lowerBits );
+        if( empty < idx )
+            --idx;
+    }
+
+    // insert a new priority level
+    for( int i= qtyBuckets ; i > idx ; --i )
+        buckets[i]= buckets[i - 1];
+    buckets[idx]= { priority, 0, queue.end(), false };
+    ++qtyBuckets;
+    uint32_t lowerBits= ( uint32_t(1) << idx ) - 1;
+    nonEmptyBuckets= ( nonEmptyBuckets & lowerBits ) | ( ( nonEmptyBuckets & ~lowerBits ) << 1 );
+    return idx;
+}
+
 void DedicatedWorker::pushAndRelease(QueueElement&& jobInfo) {
     Acquire(ALIB_CALLER_PRUNED);
 
-    // search the first element with equal or higher priority
-    auto  it=   queue.begin();
-    while(it != queue.end()) {
-        if(jobInfo.priority <= it->priority )
-            break;
-        it++;
+    // insert before the youngest job of equal priority, respectively before the youngest job of
+    // the next higher priority level, or at the end if no such job is queued.
+    // Within a level that covers a range of priorities, the position is searched linearly.
+    int          bucketIdx= getBucket( jobInfo.priority );
+    QueueBucket& bucket   = buckets[bucketIdx];
+    if( bucket.count > 0 && bucket.first->priority < jobInfo.priority ) {
+        auto it= bucket.first;
+        for( int i= 0 ; i < bucket.count && it->priority < jobInfo.priority ; ++i )
+            ++it;
+        queue.Insert(it, jobInfo );
+    } else {
+        auto it= queue.end();
+        if( bucket.count > 0 )
+            it= bucket.first;
+        else {
+            uint32_t higher= nonEmptyBuckets & ~( ( uint32_t(2) << bucketIdx ) - 1 );
+            if( higher != 0 )
+                it= buckets[lang::CTZ( higher )].first;
+        }
+        bucket.first= queue.Insert(it, jobInfo );
     }
-
-    // insert before found
-    queue.Insert(it, jobInfo );
+    ++bucket.count;
+    nonEmptyBuckets|= uint32_t(1) << bucketIdx;
 
     #if ALIB_DEBUG
         std::vector<std::any> args; args.reserve(32);
@@ -224,6 +282,13 @@ std::pair<Job*, bool>  DedicatedWorker::pop()
     std::pair<Job*, bool> result= { queue.back().job, queue.back().keepJob };
     ALIB_DBG( auto dbgPriority= queue.back().priority; )
 
+    // the last job belongs to the highest non-empty priority level
+    int bucketIdx= lang::MSB( nonEmptyBuckets ) - 1;
+    ALIB_ASSERT( buckets[bucketIdx].priority <= queue.back().priority, "TMOD" )
+    if( --buckets[bucketIdx].count == 0 ) {
+        nonEmptyBuckets&= ~( uint32_t(1) << bucketIdx );
+        buckets[bucketIdx].coversRange= false;
+    }
     queue.pop_back();
     --length;
 
@@ -187,6 +187,8 @@ class DedicatedWorker : protected alib::Thread
                       , protected TCondition<DedicatedWorker>
 {
     friend class DWManager;
+    friend struct JFuture;
+    friend struct detail::WorkerResumeAwaiter;
     friend struct threads::TCondition<DedicatedWorker>;
 
   protected:
@@ -228,14 +230,51 @@ class DedicatedWorker : protected alib::Thread
                              ///< execution.
     };
 
-    /// The queue of jobs.
-    /// This is a simple list, instead of a 'real' priority queue.
-    /// This design decision was taken because there should never be too many jobs queued
-    /// and the naive iteration is more efficient than using a 'real' priority queue type.
-    List<QueueElement>  queue;
+    /// Information about the jobs of one priority level in the #queue.
+    struct QueueBucket
+    {
+        Priority                        priority; ///< The priority of the jobs.
+        int                             count;    ///< The number of jobs of this priority.
+        List<QueueElement>::iterator    first;    ///< The first (youngest) job of this priority
+                                                  ///< in the #queue.
+        bool                            coversRange; ///< Set if more than #MaxPriorityLevels
+                                                     ///< priorities are queued. In this case, the
+                                                     ///< level takes jobs of higher priorities
+                                                     ///< up to the next level.
+    };
+
+    /// The maximum number of different priority values that are queued in constant time.
+    /// If more priorities are queued at the same time, some levels take a range of priorities,
+    /// which are sorted with a linear search.
+    static constexpr int                MaxPriorityLevels                                      = 32;
+
+    /// The queue of jobs, sorted by ascending priority. Jobs of equal priority are sorted from the
+    /// youngest to the oldest. The job to execute next is the last one.
+    /// To avoid a search for the insertion position, field #buckets stores the first job of
+    /// each priority level, while field #nonEmptyBuckets indicates the levels that jobs are
+    /// queued for. With that, jobs are pushed and popped in constant time.
+    List<QueueElement>                  queue;
+
+    /// The priority levels that were used with this worker, sorted by ascending priority.
+    QueueBucket                         buckets[MaxPriorityLevels];
+
+    /// The number of entries used in #buckets.
+    int                                 qtyBuckets                                             = 0;
+
+    /// A bit set for each entry in #buckets that jobs are queued for.
+    uint32_t                            nonEmptyBuckets                                        = 0;
 
     /// The current number of jobs in the queue.
-    int                                length;
+    int                                 length;
+
+    /// Returns the index of the entry in #buckets for the given \p{priority}.
+    /// If not found, a new entry is inserted. If all #MaxPriorityLevels entries are used, an
+    /// empty entry is removed, or, if none is empty, the neighboring entry is returned, which
+    /// then covers a range of priorities.
+    /// @param priority The priority to search.
+    /// @return The index of the bucket.
+    ALIB_DLL
+    int         getBucket( Priority priority );
 
     /// Mandatory method needed and invoked by templated base type \alib{threads;TCondition}.
     /// @return \c true if field #queue is not empty, \c false otherwise.
@@ -451,6 +490,14 @@ class DedicatedWorker : protected alib::Thread
   //================================================================================================
   // Job Interface
   //================================================================================================
+    /// Returns an awaitable object that continues a \alib{threadmodel;Task} coroutine with
+    /// this worker.
+    ///
+    /// Usage: <c>co_await worker.Resume( Priority::Standard );</c>
+    /// @param priority The priority of the job that resumes the coroutine.
+    /// @return The awaiter.
+    inline detail::WorkerResumeAwaiter  Resume( Priority priority );
+
     /// Schedules a stop job into this thread's job queue.
     /// When this job is processed from the queue, this thread will exit.
     /// @param priority The priority of the job. Use \b Lowest if it is assured that no
@@ -0,0 +1,237 @@
+//##################################################################################################
+//  ALib C++ Library
+//
+//  Copyright 2013-2025 A-Worx GmbH, Germany
+//  Published under 'Boost Software License' (a free software license, see LICENSE.txt)
+//##################################################################################################
+#include "alib_precompile.hpp"
+#if !defined(ALIB_C20_MODULES) || ((ALIB_C20_MODULES != 0) && (ALIB_C20_MODULES != 1))
+#   error "Symbol ALIB_C20_MODULES has to be given to the compiler as either 0 or 1"
+#endif
+#if ALIB_C20_MODULES
+    module;
+#endif
+//========================================= Global Fragment ========================================
+#include "alib/alib.inl"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+//============================================== Module ============================================
+#if ALIB_C20_MODULES
+    module ALib.ThreadModel;
+#else
+#   include "ALib.ThreadModel.H"
+#endif
+//========================================== Implementation ========================================
+namespace alib::threadmodel {
+
+#if !DOXYGEN
+namespace {
+
+// The condition variables that method JFuture::WaitFor blocks on.
+struct TimedWaiters {
+    std::mutex              mutex;
+    std::condition_variable condition;
+};
+
+TimedWaiters    timedWaiters[16];
+
+TimedWaiters&   timedWaitersOf( const JFuture* future )
+{ return timedWaiters[ ( reinterpret_cast<uintptr_t>( future ) >> 6 ) % 16 ]; }
+
+} // anonymous namespace
+
+struct JFuture::JCombined : JFuture
+{
+    std::atomic<int>        pending;
+    std::atomic<uint32_t>   combinedState;
+    std::atomic<bool>       anyDone;
+    bool                    isAny;
+
+    JCombined( int qty, bool pIsAny )
+    : JFuture(typeid(JCombined)), pending(qty), combinedState(uint32_t(State::OK))
+    , anyDone(false), isAny(pIsAny)                                                               {}
+
+    size_t  SizeOf()                                          override { return sizeof(JCombined); }
+};
+
+struct JFuture::CombineContinuation : Continuation
+{
+    JCombined&  combined;
+    ThreadPool& pool;
+
+    CombineContinuation( JCombined& pCombined, ThreadPool& pPool )
+    : combined(pCombined), pool(pPool)                                                            {}
+
+    void Run( State state )                                                             override {
+        JCombined&  c = combined;
+        ThreadPool& tp= pool;
+        { ALIB_LOCK_WITH(tp)
+            tp.GetPoolAllocator()().Delete( this );
+        }
+
+        if( c.isAny ) {
+            if( !c.anyDone.exchange( true, std::memory_order_acq_rel ) )
+                c.Fulfill( state );
+            return;
+        }
+
+        if( state != State::OK ) {
+            uint32_t expected= uint32_t(State::OK);
+            c.combinedState.compare_exchange_strong( expected, uint32_t(state) );
+        }
+        if( c.pending.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+            c.Fulfill( State( c.combinedState.load( std::memory_order_acquire ) ) );
+    }
+};
+
+#endif // !DOXYGEN
+
+#   include "ALib.Lang.CIFunctions.H"
+JFuture& JFuture::combine( ThreadPool& pool, std::initializer_list<JFuture*> futures, bool isAny ) {
+    pool.Acquire(ALIB_CALLER_PRUNED);
+        auto* combined= pool.GetPoolAllocator()().New<JCombined>( int(futures.size()), isAny );
+    pool.Release(ALIB_CALLER_PRUNED);
+
+    if( futures.size() == 0 ) {
+        combined->Fulfill();
+        return *combined;
+    }
+
+    for( JFuture* future : futures ) {
+        pool.Acquire(ALIB_CALLER_PRUNED);
+            auto* continuation= pool.GetPoolAllocator()().New<CombineContinuation>( *combined,
+                                                                                    pool );
+        pool.Release(ALIB_CALLER_PRUNED);
+        future->addContinuation( continuation );
+    }
+    return *combined;
+}
+#   include "ALib.Lang.CIMethods.H"
+
+JFuture::~JFuture() {
+    ALIB_ASSERT_WARNING(    continuations.load( std::memory_order_relaxed ) == nullptr
+                         || continuations.load( std::memory_order_relaxed ) == closed(), "TMOD",
+        "Future with pending continuations destructed without being fulfilled." )
+}
+
+void JFuture::addContinuation( Continuation* continuation ) {
+    Continuation* head= continuations.load( std::memory_order_acquire );
+    do {
+        if( head == closed() ) {
+            continuation->Run( State( result.load( std::memory_order_acquire ) ) );
+            return;
+        }
+        continuation->next= head;
+    }
+    while( !continuations.compare_exchange_weak( head, continuation,
+                                                 std::memory_order_acq_rel,
+                                                 std::memory_order_acquire ) );
+}
+
+void JFuture::Fulfill( State newState ) {
+    ALIB_ASSERT_ERROR( newState != State::Unfulfilled, "TMOD",
+                       "Future must not be fulfilled with state 'Unfulfilled'." )
+    ALIB_ASSERT_ERROR( result.load( std::memory_order_relaxed ) == 0, "TMOD",
+                       "Future was already fulfilled. Repeated calls not allowed." )
+
+    // detach the continuations before the state is set, because the latter releases waiting
+    // threads, which may delete this object.
+    result.store( uint32_t(newState), std::memory_order_release );
+    Continuation* list= continuations.exchange( closed(), std::memory_order_acq_rel );
+
+    // set the state together with the busy flag. Waiting threads are woken up, but do not
+    // return (and hence do not delete this object) before the busy flag is cleared.
+    uint32_t prevState= state.exchange( uint32_t(newState) | BusyFlag, std::memory_order_acq_rel );
+    if( prevState & WaiterFlag )
+        state.notify_all();
+    if( prevState & TimedWaiterFlag ) {
+        TimedWaiters& waiters= timedWaitersOf( this );
+        std::lock_guard<std::mutex> lock( waiters.mutex );
+        waiters.condition.notify_all();
+    }
+
+    // clear the busy flag. This is the last access to this object.
+    state.fetch_and( ~BusyFlag, std::memory_order_release );
+
+    // run the continuations, in the order they were added
+    Continuation* reversed= nullptr;
+    while( list ) {
+        Continuation* next= list->next;
+        list->next= reversed;
+        reversed  = list;
+        list      = next;
+    }
+    while( reversed ) {
+        Continuation* next= reversed->next;
+        reversed->Run( newState );
+        reversed= next;
+}   }
+
+JFuture::State JFuture::Wait() {
+    uint32_t actState= state.load( std::memory_order_acquire );
+    for( int i= 0 ; ( actState & StateMask ) == 0 && i < SpinIterations ; ++i ) {
+        if( i % 64 == 63 )
+            std::this_thread::yield();
+        actState= state.load( std::memory_order_acquire );
+    }
+
+    while( ( actState & StateMask ) == 0 ) {
+        if( ( actState & WaiterFlag ) == 0
+            && !state.compare_exchange_weak( actState, actState | WaiterFlag,
+                                             std::memory_order_acq_rel ) )
+            continue;
+        state.wait( actState | WaiterFlag, std::memory_order_acquire );
+        actState= state.load( std::memory_order_acquire );
+    }
+
+    // the fulfilling thread might still notify. Wait until it does not access this object anymore.
+    while( actState & BusyFlag ) {
+        std::this_thread::yield();
+        actState= state.load( std::memory_order_acquire );
+    }
+    return State( actState & StateMask );
+}
+
+JFuture::State JFuture::WaitFor( const Ticks::Duration& maxWaitTimeSpan ) {
+    Ticks    wakeUpTime= Ticks::Now() + maxWaitTimeSpan;
+    uint32_t actState  = state.load( std::memory_order_acquire );
+    for( int i= 0 ; ( actState & StateMask ) == 0 && i < SpinIterations ; ++i ) {
+        if( i % 64 == 63 ) {
+            if( Ticks::Now() >= wakeUpTime )
+                return State::Unfulfilled;
+            std::this_thread::yield();
+        }
+        actState= state.load( std::memory_order_acquire );
+    }
+
+    // announce the waiter and block on the associated condition variable. The flag is set
+    // before the state is checked under the lock, hence a notification cannot be missed.
+    // (The flag is not removed with a timeout. This only causes a superfluous notification.)
+    if( ( actState & StateMask ) == 0 ) {
+        state.fetch_or( TimedWaiterFlag, std::memory_order_acq_rel );
+        TimedWaiters& waiters= timedWaitersOf( this );
+        std::unique_lock<std::mutex> lock( waiters.mutex );
+        waiters.condition.wait_until( lock, wakeUpTime.Export(), [this, &actState] {
+            actState= state.load( std::memory_order_acquire );
+            return ( actState & StateMask ) != 0;
+        } );
+        if( ( actState & StateMask ) == 0 )
+            return State::Unfulfilled;
+    }
+
+    // the fulfilling thread might still notify. Wait until it does not access this object anymore.
+    while( actState & BusyFlag ) {
+        std::this_thread::yield();
+        actState= state.load( std::memory_order_acquire );
+    }
+    return State( actState & StateMask );
+}
+
+JFuture& JFuture::WhenAll( ThreadPool& pool, std::initializer_list<JFuture*> futures )
+{ return combine( pool, futures, false ); }
+
+JFuture& JFuture::WhenAny( ThreadPool& pool, std::initializer_list<JFuture*> futures )
+{ return combine( pool, futures, true  ); }
+
+} // namespace [alib::threadmodel]
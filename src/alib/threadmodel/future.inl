@@ -0,0 +1,278 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of module \alib_threadmodel of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib { namespace threadmodel {
+
+//==================================================================================================
+/// \attention This class belongs to module \alib_threadmodel, which is not in a stable and
+///            consistent state, yet.
+///            Also, this type is considered experimental.
+///
+/// A job type that allows awaiting its processing, similar to \alib{threadmodel;JPromise}.
+/// While the latter aggregates a \alib{threads;Promise}, which is implemented with
+/// <c>std::promise</c> and <c>std::future</c> and hence allocates a shared state on the heap,
+/// this type stores its state in a single atomic word inside the job object, which is
+/// pool-allocated by the \alib{threadmodel;ThreadPool} or \alib{threadmodel;DedicatedWorker} that
+/// it is scheduled with.
+///
+/// Besides waiting, which spins for a short while before the thread is blocked using
+/// <c>std::atomic::wait</c> (a futex on most platforms), this type allows attaching
+/// continuations with the methods #Then: These schedule a new job with a
+/// \alib{threadmodel;ThreadPool} or a \alib{threadmodel;DedicatedWorker} once this job is
+/// fulfilled, without blocking any thread. The static methods #WhenAll and #WhenAny create
+/// futures that are fulfilled when all, respectively any, of a set of futures are fulfilled.
+/// Together, this allows building graphs of dependent jobs.
+///
+/// Derived types implement method \alib{threadmodel;Job::Do} and invoke #Fulfill when done.
+/// After that, the object must not be accessed anymore, because waiting threads or continuations
+/// may delete it.
+/// They have to override method #SizeOf, as documented with class \alib{threadmodel;Job}.
+/// As with other jobs, a future received with \b Schedule has to be deleted by the caller
+/// after it was fulfilled.
+//==================================================================================================
+struct JFuture : Job
+{
+    friend struct detail::FutureAwaiter;
+
+    /// The state type. The same as used with class \alib{threads;Promise}.
+    using State= Promise::State;
+
+    /// The number of iterations that the waiting methods poll the state, before the thread is
+    /// blocked.
+    static constexpr int        SpinIterations                                            = 2000;
+
+  protected:
+    /// Base type of continuations attached to a future. Implementations are either pool-allocated
+    /// and delete themselves when run, or are embedded in a coroutine frame that they resume.
+    struct Continuation
+    {
+        Continuation*   next                                                            = nullptr;
+
+        /// Virtual destructor.
+        virtual        ~Continuation()                                                 = default;
+
+        /// Invoked once when the future is fulfilled.
+        /// @param state The state that the future was fulfilled with.
+        virtual void    Run( State state )                                                    = 0;
+    };
+
+    /// A continuation that schedules a job with a thread pool.
+    /// @tparam TJob   The job type to schedule.
+    /// @tparam TArgs  The types of the arguments to construct the job with.
+    template<typename TJob, typename... TArgs>
+    struct PoolContinuation : Continuation
+    {
+        ThreadPool&             pool;   ///< The pool to schedule the job with.
+        std::tuple<TArgs...>    args;   ///< The arguments to construct the job with.
+
+        /// Constructor.
+        /// @param pPool  Assigned to #pool.
+        /// @param pArgs  Assigned to #args.
+        template<typename... TCArgs>
+        PoolContinuation( ThreadPool& pPool, TCArgs&&... pArgs )
+        : pool(pPool), args( std::forward<TCArgs>(pArgs)... )                                     {}
+
+        /// Schedules the job and deletes this object.
+        void Run( State )                                                               override {
+            std::apply( [this]( auto&... a )
+                        { pool.template ScheduleVoid<TJob>( std::move(a)... ); }, args );
+            ThreadPool& tp= pool;
+            { ALIB_LOCK_WITH(tp)
+                tp.GetPoolAllocator()().Delete( this );
+            }
+        }
+    };
+
+    /// A continuation that schedules a job with a dedicated worker.
+    /// @tparam TJob   The job type to schedule.
+    /// @tparam TArgs  The types of the arguments to construct the job with.
+    template<typename TJob, typename... TArgs>
+    struct WorkerContinuation : Continuation
+    {
+        DedicatedWorker&        worker;     ///< The worker to schedule the job with.
+        Priority                priority;   ///< The priority of the job.
+        std::tuple<TArgs...>    args;       ///< The arguments to construct the job with.
+
+        /// Constructor.
+        /// @param pWorker    Assigned to #worker.
+        /// @param pPriority  Assigned to #priority.
+        /// @param pArgs      Assigned to #args.
+        template<typename... TCArgs>
+        WorkerContinuation( DedicatedWorker& pWorker, Priority pPriority, TCArgs&&... pArgs )
+        : worker(pWorker), priority(pPriority), args( std::forward<TCArgs>(pArgs)... )            {}
+
+        /// Schedules the job and deletes this object.
+        void Run( State )                                                               override {
+            std::apply( [this]( auto&... a )
+                        { worker.template ScheduleVoid<TJob>( priority, std::move(a)... ); }, args );
+            auto& manager= DWManager::GetSingleton();
+            { ALIB_LOCK_WITH(manager)
+                manager.GetPoolAllocator()().Delete( this );
+            }
+        }
+    };
+
+    /// The continuation used with #WhenAll and #WhenAny.
+    struct CombineContinuation;
+
+    /// The future type returned by #WhenAll and #WhenAny.
+    struct JCombined;
+
+    /// Set in #state when a thread is blocked in #Wait.
+    static constexpr uint32_t   WaiterFlag                                           = 1u << 31;
+
+    /// Set in #state by #Fulfill while it still accesses this object after setting the state.
+    /// As long as this flag is set, the future is not considered fulfilled.
+    static constexpr uint32_t   BusyFlag                                             = 1u << 30;
+
+    /// Set in #state when a thread is blocked in #WaitFor. Because <c>std::atomic</c> does not
+    /// offer timed waits, such threads block on a condition variable which is selected from a
+    /// small static table by the address of the future.
+    static constexpr uint32_t   TimedWaiterFlag                                      = 1u << 29;
+
+    /// The mask to extract the \b State from #state.
+    static constexpr uint32_t   StateMask             = ~( WaiterFlag | BusyFlag | TimedWaiterFlag );
+
+    /// The state word. Holds the \b State and flags #WaiterFlag, #BusyFlag and #TimedWaiterFlag.
+    std::atomic<uint32_t>       state;
+
+    /// The result passed to continuations. Set by #Fulfill before #state, because the latter
+    /// releases waiting threads, which may delete this object.
+    std::atomic<uint32_t>       result;
+
+    /// A lock-free stack of continuations. Set to #closed when fulfilled.
+    std::atomic<Continuation*>  continuations;
+
+    /// @return The value of #continuations which denotes that this future is fulfilled.
+    static Continuation*        closed()  { return reinterpret_cast<Continuation*>( uintptr_t(1) ); }
+
+    /// Adds a continuation. If this future is fulfilled already, it is run right away.
+    /// @param continuation The continuation to add.
+    ALIB_DLL void               addContinuation( Continuation* continuation );
+
+    /// Implementation of #WhenAll and #WhenAny.
+    /// @param pool    The pool used to allocate the returned future.
+    /// @param futures The futures to combine.
+    /// @param isAny   \c true to implement #WhenAny, \c false for #WhenAll.
+    /// @return The combined future.
+    ALIB_DLL static JFuture&    combine( ThreadPool& pool, std::initializer_list<JFuture*> futures,
+                                         bool isAny );
+
+  public:
+    /// Constructor.
+    /// @param id     The type-info of the derived type. Passed to parent class \b %Job.
+    JFuture( const std::type_info& id )
+    : Job(id), state(0), result(0), continuations(nullptr)                                        {}
+
+    /// Destructor. With debug-compilations, asserts that no continuations are pending.
+    ALIB_DLL virtual   ~JFuture()                                                         override;
+
+    /// Overrides the parent function as necessary.
+    /// @return The sizeof this derived type.
+    virtual size_t      SizeOf()                                override { return sizeof(JFuture); }
+
+    /// Sets the state, wakes up waiting threads and runs the continuations.
+    /// Must be called only once.
+    /// @param newState The state to set. Must not be \b State::Unfulfilled.
+    ///                 Defaults to \alib{threads;Promise::State;OK}.
+    ALIB_DLL void       Fulfill( State newState= State::OK );
+
+    /// Returns the current state without blocking.
+    /// @return The state given with #Fulfill, or \b State::Unfulfilled.
+    State               GetState()                                                           const
+    {
+        uint32_t actState= state.load( std::memory_order_acquire );
+        return ( actState & BusyFlag ) ? State(0) : State( actState & StateMask );
+    }
+
+    /// @return \c true if #Fulfill was invoked, \c false otherwise.
+    bool                IsFulfilled()                      const { return GetState() != State(0); }
+
+    /// Waits an unlimited time for this future to become fulfilled.
+    /// @return The state given with #Fulfill.
+    ALIB_DLL State      Wait();
+
+    /// Waits for this future to become fulfilled, but only for a given duration.
+    /// @param maxWaitTimeSpan The maximum time to wait.
+    /// @return Either <b>State::Unfulfilled</b>, or the state given with #Fulfill.
+    ALIB_DLL State      WaitFor( const Ticks::Duration& maxWaitTimeSpan );
+
+    #if !DOXYGEN
+    State               WaitFor( const Ticks::Duration::TDuration& maxWaitTimeSpan )
+    { return WaitFor( Ticks::Duration( maxWaitTimeSpan ) ); }
+    #endif
+
+    /// Schedules a job of type \p{TJob} with the given \p{pool}, once this future is fulfilled.
+    /// If fulfilled already, the job is scheduled right away.
+    /// The job is scheduled with \alib{threadmodel;ThreadPool::ScheduleVoid} and hence deleted
+    /// automatically.
+    /// @tparam TJob    The job type to create and schedule.
+    /// @tparam TArgs   Types of the variadic arguments \p{args} that construct \p{TJob}.
+    /// @param  pool    The pool to schedule the job with.
+    /// @param  args    Variadic arguments forwarded to the constructor of \p{TJob}.
+    ///                 The arguments are stored by value until the job is scheduled.
+    template<typename TJob, typename... TArgs>
+    void                Then( ThreadPool& pool, TArgs&&... args ) {
+        using TCont= PoolContinuation<TJob, std::decay_t<TArgs>...>;
+        pool.Acquire(ALIB_CALLER_PRUNED);
+            TCont* continuation= pool.GetPoolAllocator()().New<TCont>( pool,
+                                                                   std::forward<TArgs>(args)... );
+        pool.Release(ALIB_CALLER_PRUNED);
+        addContinuation( continuation );
+    }
+
+    /// Schedules a job of type \p{TJob} with the given dedicated \p{worker}, once this future is
+    /// fulfilled. If fulfilled already, the job is scheduled right away.
+    /// The job is scheduled with \alib{threadmodel;DedicatedWorker::ScheduleVoid} and hence
+    /// deleted automatically.
+    /// @tparam TJob     The job type to create and schedule.
+    /// @tparam TArgs    Types of the variadic arguments \p{args} that construct \p{TJob}.
+    /// @param  worker   The worker to schedule the job with.
+    /// @param  priority The priority of the job.
+    /// @param  args     Variadic arguments forwarded to the constructor of \p{TJob}.
+    ///                  The arguments are stored by value until the job is scheduled.
+    template<typename TJob, typename... TArgs>
+    void                Then( DedicatedWorker& worker, Priority priority, TArgs&&... args ) {
+        using TCont= WorkerContinuation<TJob, std::decay_t<TArgs>...>;
+        auto& manager= DWManager::GetSingleton();
+        manager.Acquire(ALIB_CALLER_PRUNED);
+            TCont* continuation= manager.GetPoolAllocator()().New<TCont>( worker, priority,
+                                                                      std::forward<TArgs>(args)... );
+        manager.Release(ALIB_CALLER_PRUNED);
+        addContinuation( continuation );
+    }
+
+    /// Creates a future which is fulfilled when all given \p{futures} are fulfilled.
+    /// Its state is \alib{threads;Promise::State;OK}, if all futures were fulfilled with this
+    /// state, otherwise it is the first different state received.
+    ///
+    /// The returned object is allocated with the pool allocator of \p{pool} and has to be
+    /// deleted with \alib{threadmodel;ThreadPool::DeleteJob} after it was fulfilled.
+    /// @param pool    The pool used to allocate the returned future.
+    /// @param futures The futures to combine.
+    /// @return The combined future.
+    ALIB_DLL static JFuture&    WhenAll( ThreadPool& pool, std::initializer_list<JFuture*> futures );
+
+    /// Creates a future which is fulfilled when any of the given \p{futures} is fulfilled,
+    /// using the state of that future.
+    ///
+    /// The returned object is allocated with the pool allocator of \p{pool} and has to be
+    /// deleted with \alib{threadmodel;ThreadPool::DeleteJob}. Because the remaining futures
+    /// still refer to the returned object when they are fulfilled, this must not be done before
+    /// all given futures are fulfilled.
+    /// @param pool    The pool used to allocate the returned future.
+    /// @param futures The futures to combine.
+    /// @return The combined future.
+    ALIB_DLL static JFuture&    WhenAny( ThreadPool& pool, std::initializer_list<JFuture*> futures );
+};
+
+} // namespace alib[::threadmodel]
+
+/// Type alias in namespace \b alib.
+using      JFuture     = threadmodel::JFuture;
+
+}  // namespace [alib]
@@ -10,6 +10,9 @@ ALIB_EXPORT namespace alib { namespace threadmodel {
 class DedicatedWorker;
 class ThreadPool;
 class DWManager;
+namespace detail {   struct PoolResumeAwaiter;
+                     struct WorkerResumeAwaiter;
+                     struct FutureAwaiter;         }
 
 //==================================================================================================
 /// \attention This class belongs to the module \alib_threadmodel, which is not in a stable and
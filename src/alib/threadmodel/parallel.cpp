@@ -0,0 +1,85 @@
+//##################################################################################################
+//  ALib C++ Library
+//
+//  Copyright 2013-2025 A-Worx GmbH, Germany
+//  Published under 'Boost Software License' (a free software license, see LICENSE.txt)
+//##################################################################################################
+#include "alib_precompile.hpp"
+#if !defined(ALIB_C20_MODULES) || ((ALIB_C20_MODULES != 0) && (ALIB_C20_MODULES != 1))
+#   error "Symbol ALIB_C20_MODULES has to be given to the compiler as either 0 or 1"
+#endif
+#if ALIB_C20_MODULES
+    module;
+#endif
+//========================================= Global Fragment ========================================
+#include "alib/alib.inl"
+//============================================== Module ============================================
+#if ALIB_C20_MODULES
+    module ALib.ThreadModel;
+#else
+#   include "ALib.ThreadModel.H"
+#endif
+//========================================== Implementation ========================================
+namespace alib::threadmodel::detail {
+
+void ParallelLoop::Participate() {
+    integer act= next.load( std::memory_order_relaxed );
+    for(;;) {
+        integer remaining= end - act;
+        if( remaining <= 0 )
+            return;
+
+        // claim a chunk
+        integer size= (std::min)( remaining, (std::max)( grain, remaining / divisor ) );
+        if( !next.compare_exchange_weak( act, act + size, std::memory_order_relaxed ) )
+            continue;
+
+        invoker( function, act, act + size );
+        if( done.fetch_add( size, std::memory_order_release ) + size == total )
+            done.notify_one();
+        act= next.load( std::memory_order_relaxed );
+}   }
+
+void ParallelLoop::Release() {
+    if( refCount.fetch_sub( 1, std::memory_order_acq_rel ) != 1 )
+        return;
+
+    ThreadPool& tp= pool;
+    tp.Acquire(ALIB_CALLER_PRUNED);
+        tp.GetPoolAllocator()().Delete( this );
+    tp.Release(ALIB_CALLER_PRUNED);
+}
+
+#   include "ALib.Lang.CIFunctions.H"
+void ParallelLoop::Run( ThreadPool& pool, integer begin, integer end, integer grain,
+                        Invoker invoker, void* function ) {
+    // the caller is one participant. Helpers are only scheduled if there is enough work.
+    integer qtyChunks = ( end - begin + grain - 1 ) / grain;
+    int     qtyHelpers= int( (std::min)( integer(pool.Strategy.WorkersMax), qtyChunks - 1 ) );
+    if( qtyHelpers <= 0 ) {
+        invoker( function, begin, end );
+        return;
+    }
+
+    pool.Acquire(ALIB_CALLER_PRUNED);
+        ParallelLoop* loop= pool.GetPoolAllocator()().New<ParallelLoop>( pool, begin, end, grain,
+                                                                        invoker, function );
+    pool.Release(ALIB_CALLER_PRUNED);
+    loop->divisor= 2 * integer( qtyHelpers + 1 );
+    loop->refCount.store( qtyHelpers + 1, std::memory_order_relaxed );
+
+    for( int i= 0 ; i < qtyHelpers ; ++i )
+        pool.ScheduleVoid<JParallelLoop>( loop );
+
+    loop->Participate();
+
+    // wait until the chunks claimed by the helpers are processed
+    integer actDone;
+    while( (actDone= loop->done.load( std::memory_order_acquire )) < loop->total )
+        loop->done.wait( actDone, std::memory_order_acquire );
+
+    loop->Release();
+}
+#   include "ALib.Lang.CIMethods.H"
+
+} // namespace [alib::threadmodel::detail]
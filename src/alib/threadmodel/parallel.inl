@@ -0,0 +1,288 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of module \alib_threadmodel of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib { namespace threadmodel {
+
+namespace detail {
+
+//==================================================================================================
+/// The shared state of a parallel loop started with \alib{threadmodel;ParallelFor}.
+/// The range of the loop is distributed dynamically among the caller and the helper jobs that
+/// are scheduled with the \alib{threadmodel;ThreadPool}: Each participant claims a chunk of the
+/// range, processes it and claims the next one, until the range is exhausted.
+/// The size of a chunk is the larger of the grain size and the remaining range divided by twice
+/// the number of participants. Hence, chunks are large at the start of the loop and become smaller
+/// towards its end, which balances the load without imposing the overhead of small chunks on the
+/// whole range.
+///
+/// Instances are allocated with the \alib{threadmodel;ThreadPool::GetPoolAllocator;pool allocator}
+/// of the thread pool and are reference counted: Helper jobs may be executed by the pool only
+/// after the caller has returned already. Such late helpers do not find any work and just
+/// release their reference.
+//==================================================================================================
+struct ParallelLoop
+{
+    /// The signature of the function that invokes the type-erased user function.
+    using Invoker= void (*)( void* function, integer begin, integer end );
+
+    std::atomic<integer>    next;       ///< The start of the next chunk to claim.
+    std::atomic<integer>    done;       ///< The number of processed elements.
+    std::atomic<int>        refCount;   ///< The number of references (caller and helper jobs).
+    integer                 end;        ///< The end of the range.
+    integer                 total;      ///< The size of the range.
+    integer                 grain;      ///< The minimum size of a chunk.
+    integer                 divisor;    ///< Twice the number of participants.
+    Invoker                 invoker;    ///< Invokes #function.
+    void*                   function;   ///< The type-erased user function.
+    ThreadPool&             pool;       ///< The pool that this loop is executed with.
+
+    /// Constructor.
+    /// @param pPool      Assigned to #pool.
+    /// @param begin      The start of the range.
+    /// @param pEnd       Assigned to #end.
+    /// @param pGrain     Assigned to #grain.
+    /// @param pInvoker   Assigned to #invoker.
+    /// @param pFunction  Assigned to #function.
+    ParallelLoop( ThreadPool& pPool, integer begin, integer pEnd, integer pGrain,
+                  Invoker pInvoker, void* pFunction )
+    : next(begin), done(0), refCount(1), end(pEnd), total(pEnd - begin), grain(pGrain), divisor(2)
+    , invoker(pInvoker), function(pFunction), pool(pPool)                                         {}
+
+    /// Claims and processes chunks until the range is exhausted.
+    /// The participant that completes the last chunk notifies the caller waiting in #Run.
+    ALIB_DLL void       Participate();
+
+    /// Releases a reference. The last reference deletes this object.
+    ALIB_DLL void       Release();
+
+    /// Creates a loop object and schedules the helper jobs. Then, the caller participates in
+    /// processing the loop and finally blocks until all chunks claimed by helpers are processed.
+    /// @param pool      The thread pool to use.
+    /// @param begin     The start of the range.
+    /// @param end       The end of the range.
+    /// @param grain     The minimum size of a chunk.
+    /// @param invoker   Invokes \p{function}.
+    /// @param function  The type-erased user function.
+    ALIB_DLL static void Run( ThreadPool& pool, integer begin, integer end, integer grain,
+                              Invoker invoker, void* function );
+};
+
+/// The job type scheduled with the \alib{threadmodel;ThreadPool} to participate in a
+/// \alib{threadmodel::detail;ParallelLoop}.
+struct JParallelLoop : Job
+{
+    ParallelLoop*   loop;   ///< The loop to participate in.
+
+    /// Constructor.
+    /// @param pLoop Assigned to #loop.
+    JParallelLoop( ParallelLoop* pLoop ) : Job(typeid(JParallelLoop)), loop(pLoop)                {}
+
+    /// Overrides the parent function as necessary.
+    /// @return The sizeof this derived type.
+    virtual size_t  SizeOf()                          override { return sizeof(JParallelLoop); }
+
+    /// Participates in the loop and releases it.
+    /// @return \c true.
+    virtual bool    Do()             override { loop->Participate(); loop->Release(); return true; }
+};
+
+} // namespace alib::threadmodel[::detail]
+
+/// Processes the range <c>[begin, end)</c> in parallel, using the workers of the given
+/// \p{pool}. The range is split into chunks of at least \p{grain} elements, which are passed to
+/// \p{function} with two parameters of type \alib{integer} denoting the start and the end of the
+/// chunk. Chunks are claimed dynamically by the participating threads, starting with large
+/// chunks and decreasing their size towards the end of the range.
+/// (See \alib{threadmodel::detail;ParallelLoop} for details.)
+///
+/// The calling thread participates in processing chunks, instead of blocking, and this function
+/// returns when all chunks are processed. Therefore, it may also be called from within a job
+/// executed by the pool.
+///
+/// The jobs scheduled with the pool are pool-allocated and deleted automatically.
+/// \p{function} must not throw exceptions.
+///
+/// @tparam TFunction The type of the function. Deduced by the compiler.
+/// @param pool       The thread pool to use.
+/// @param begin      The start of the range.
+/// @param end        The end of the range.
+/// @param grain      The minimum number of elements passed to one invocation of \p{function}.
+/// @param function   The function that processes a chunk.
+template<typename TFunction>
+void    ParallelFor( ThreadPool& pool, integer begin, integer end, integer grain,
+                     TFunction&& function ) {
+    if( end - begin <= grain ) {
+        if( end > begin )
+            function( begin, end );
+        return;
+    }
+    using TFunc= std::remove_reference_t<TFunction>;
+    detail::ParallelLoop::Run( pool, begin, end, (std::max)( grain, integer(1) ),
+                               []( void* fn, integer b, integer e )
+                               { (*static_cast<TFunc*>( fn ))( b, e ); },
+                               const_cast<void*>( static_cast<const void*>( &function ) ) );
+}
+
+/// Reduces the range <c>[begin, end)</c> in parallel, using the workers of the given \p{pool}.
+/// The range is processed in chunks, as documented with function \alib{threadmodel;ParallelFor}.
+/// For each chunk, \p{map} is invoked with the start and the end of the chunk, and the result
+/// is combined with the results of the other chunks using \p{combine}.
+///
+/// Because the order in which chunks are processed is not defined, \p{combine} has to be
+/// associative and commutative.
+///
+/// @tparam T          The result type.
+/// @tparam TMap       The type of the mapping function. Deduced by the compiler.
+/// @tparam TCombine   The type of the combining function. Deduced by the compiler.
+/// @param pool        The thread pool to use.
+/// @param begin       The start of the range.
+/// @param end         The end of the range.
+/// @param grain       The minimum number of elements passed to one invocation of \p{map}.
+/// @param identity    The neutral element of \p{combine}. Returned if the range is empty.
+/// @param map         Returns the result of a chunk.
+/// @param combine     Combines two results.
+/// @return The combined result of all chunks.
+template<typename T, typename TMap, typename TCombine>
+T       ParallelReduce( ThreadPool& pool, integer begin, integer end, integer grain,
+                        T identity, TMap&& map, TCombine&& combine ) {
+    T          result= identity;
+    std::mutex resultLock;
+    ParallelFor( pool, begin, end, grain, [&]( integer b, integer e ) {
+        T partial= map( b, e );
+        std::lock_guard<std::mutex> guard( resultLock );
+        result= combine( result, partial );
+    } );
+    return result;
+}
+
+/// Sorts the given random-access range in parallel, using the workers of the given \p{pool}.
+/// The range is divided into blocks, which are sorted with <c>std::sort</c> in parallel.
+/// Then, neighboring blocks are merged pairwise with <c>std::inplace_merge</c>, again in
+/// parallel, until one block remains.
+/// If the range is smaller than \p{cutoff}, it is sorted sequentially.
+///
+/// Like <c>std::sort</c>, the sort is not stable.
+///
+/// @tparam TIterator  The random-access iterator type. Deduced by the compiler.
+/// @tparam TCompare   The type of the comparison function. Deduced by the compiler.
+/// @param pool        The thread pool to use.
+/// @param first       The start of the range to sort.
+/// @param last        The end of the range to sort.
+/// @param compare     The comparison function.
+/// @param cutoff      The minimum size of a block. Defaults to \c 4096.
+template<typename TIterator, typename TCompare>
+requires std::predicate<TCompare&, decltype(*std::declval<TIterator>()),
+                                   decltype(*std::declval<TIterator>())>
+void    ParallelSort( ThreadPool& pool, TIterator first, TIterator last, TCompare compare,
+                      integer cutoff= 4096 ) {
+    integer size= integer( last - first );
+    if( size <= cutoff ) {
+        std::sort( first, last, compare );
+        return;
+    }
+
+    // use a power of two number of blocks
+    integer qtyBlocks= 1;
+    while( qtyBlocks < 4 * integer(pool.Strategy.WorkersMax + 1) && size / (qtyBlocks * 2) >= cutoff )
+        qtyBlocks*= 2;
+    auto blockStart= [&]( integer block ) { return first + size * block / qtyBlocks; };
+
+    ParallelFor( pool, 0, qtyBlocks, 1, [&]( integer b, integer e ) {
+        for( ; b < e ; ++b )
+            std::sort( blockStart( b ), blockStart( b + 1 ), compare );
+    } );
+
+    for( integer width= 1 ; width < qtyBlocks ; width*= 2 )
+        ParallelFor( pool, 0, qtyBlocks / ( 2 * width ), 1, [&]( integer b, integer e ) {
+            for( ; b < e ; ++b )
+                std::inplace_merge( blockStart( 2 * width * b             ),
+                                    blockStart( 2 * width * b +     width ),
+                                    blockStart( 2 * width * b + 2 * width ), compare );
+        } );
+}
+
+/// Overload of \alib{threadmodel;ParallelSort} using <c>std::less</c>.
+/// @tparam TIterator  The random-access iterator type. Deduced by the compiler.
+/// @param pool        The thread pool to use.
+/// @param first       The start of the range to sort.
+/// @param last        The end of the range to sort.
+/// @param cutoff      The minimum size of a block. Defaults to \c 4096.
+template<typename TIterator>
+void    ParallelSort( ThreadPool& pool, TIterator first, TIterator last, integer cutoff= 4096 )
+{ ParallelSort( pool, first, last, std::less<>(), cutoff ); }
+
+/// Invokes \p{function} for each child of the node that \p{parent} represents, using the workers
+/// of the given \p{pool}. The cursor of the child is passed to \p{function}, which may traverse
+/// the subtree of the child.
+///
+/// This function may be used with cursors of types \alib{containers;StringTree} and
+/// \alib{files;FTree}, or any other type that offers the methods \b FirstChild,
+/// \b GoToNextSibling and \b IsValid.
+/// Because the children are processed concurrently, the tree must not be modified until this
+/// function returns, and \p{function} must restrict itself to read access to the tree, or to
+/// modifications of the values of the nodes of the given subtree.
+///
+/// @tparam TCursor    The cursor type. Deduced by the compiler.
+/// @tparam TFunction  The type of the function. Deduced by the compiler.
+/// @param pool        The thread pool to use.
+/// @param parent      The parent of the subtrees to process.
+/// @param function    The function invoked with each child.
+template<typename TCursor, typename TFunction>
+void    ParallelForEach( ThreadPool& pool, const TCursor& parent, TFunction&& function ) {
+    std::vector<TCursor> children;
+    for( TCursor child= parent.FirstChild() ; child.IsValid() ; child.GoToNextSibling() )
+        children.emplace_back( child );
+
+    ParallelFor( pool, 0, integer(children.size()), 1, [&]( integer b, integer e ) {
+        for( ; b < e ; ++b )
+            function( children[size_t(b)] );
+    } );
+}
+
+/// A \alib{containers;StringTreeIterator::SortCache} which sorts the children of nodes with
+/// function \alib{threadmodel;ParallelSort}. Sets of siblings smaller than the given cutoff value
+/// are sorted sequentially.
+///
+/// Because the comparisons are performed concurrently, the sorter used with the iterator has to
+/// allow concurrent invocations of its methods. This is true for type
+/// \alib{containers;StringTreeIterator::NameSorter}.
+///
+/// @tparam TStringTreeIterator  The type of the \alib{containers;StringTreeIterator} that this
+///                              cache is used with.
+template<typename TStringTreeIterator>
+class ParallelSortCache : public TStringTreeIterator::SortCache {
+  protected:
+    /// The element type that is sorted.
+    using SortEntry   = typename TStringTreeIterator::SortEntry;
+
+    /// The comparison function object used.
+    using EntryCompare= typename TStringTreeIterator::EntryCompare;
+
+    /// The thread pool to use.
+    ThreadPool&     pool;
+
+    /// The minimum size of a block passed to \alib{threadmodel;ParallelSort}.
+    integer         cutoff;
+
+    /// Overrides the parent's method to invoke \alib{threadmodel;ParallelSort}.
+    /// @param first   The start of the range to sort.
+    /// @param last    The end of the range to sort.
+    /// @param compare The comparison function object.
+    void sort( SortEntry* first, SortEntry* last, const EntryCompare& compare )          override
+    { ParallelSort( pool, first, last, compare, cutoff ); }
+
+  public:
+    /// Constructor.
+    /// @param pPool    The thread pool to use.
+    /// @param pCutoff  The minimum size of a block passed to \alib{threadmodel;ParallelSort}.
+    ///                 Defaults to \c 4096.
+    ParallelSortCache( ThreadPool& pPool, integer pCutoff= 4096 )
+    : pool  ( pPool   )
+    , cutoff( pCutoff )                                                                           {}
+};
+
+}} // namespace [alib::threadmodel]
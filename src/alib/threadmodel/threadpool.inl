@@ -464,6 +464,13 @@ class ThreadPool : protected TCondition<ThreadPool>
     void           ScheduleVoid( TArgs&&... args  )
     {  (void) schedule<TJob, TArgs...>( false, std::forward<TArgs>(args)... ); }
 
+    /// Returns an awaitable object that continues a \alib{threadmodel;Task} coroutine with a
+    /// worker of this pool.
+    ///
+    /// Usage: <c>co_await pool.Resume();</c>
+    /// @return The awaiter.
+    inline detail::PoolResumeAwaiter    Resume();
+
     /// Deletes a job object previously scheduled with #Schedule.
     ///
     /// \attention
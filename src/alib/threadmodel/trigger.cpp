@@ -30,8 +30,7 @@ namespace alib::threadmodel {
 
 Trigger::Trigger()
 : Thread         (A_CHAR("Trigger"))
-, TCondition     (ALIB_DBG(A_CHAR("Trigger")))
-, triggerList    (monomem::GLOBAL_ALLOCATOR)                                                      {}
+, TCondition     (ALIB_DBG(A_CHAR("Trigger")))                                                    {}
 
 Trigger::~Trigger() {
     if( state <= State::Started ) {
@@ -40,25 +39,63 @@ Trigger::~Trigger() {
     else if( state != State::Terminated ) {
         ALIB_ERROR("TMOD", "Trigger destroyed without being terminated" )
         Start();
+    }
+
+    // detach objects that were not removed
+    for( auto& entry : wakeupHeap ) {
+        entry.Target->registeredTrigger= nullptr;
+        entry.Target->triggerHeapIndex = -1;
 }   }
 
+void Trigger::heapUp( integer idx ) {
+    TriggerEntry entry= wakeupHeap[size_t(idx)];
+    while( idx > 0 ) {
+        integer parent= (idx - 1) / 2;
+        if( wakeupHeap[size_t(parent)].NextWakeup <= entry.NextWakeup )
+            break;
+        wakeupHeap[size_t(idx)]= wakeupHeap[size_t(parent)];
+        wakeupHeap[size_t(idx)].Target->triggerHeapIndex= idx;
+        idx= parent;
+    }
+    wakeupHeap[size_t(idx)]= entry;
+    entry.Target->triggerHeapIndex= idx;
+}
+
+void Trigger::heapDown( integer idx ) {
+    integer      size = integer(wakeupHeap.size());
+    TriggerEntry entry= wakeupHeap[size_t(idx)];
+    for(;;) {
+        integer child= 2 * idx + 1;
+        if( child >= size )
+            break;
+        if(    child + 1 < size
+            && wakeupHeap[size_t(child + 1)].NextWakeup < wakeupHeap[size_t(child)].NextWakeup )
+            ++child;
+        if( entry.NextWakeup <= wakeupHeap[size_t(child)].NextWakeup )
+            break;
+        wakeupHeap[size_t(idx)]= wakeupHeap[size_t(child)];
+        wakeupHeap[size_t(idx)].Target->triggerHeapIndex= idx;
+        idx= child;
+    }
+    wakeupHeap[size_t(idx)]= entry;
+    entry.Target->triggerHeapIndex= idx;
+}
+
 void Trigger::Add(Triggered& triggered, bool initialWakeup) {
     Acquire(ALIB_CALLER_PRUNED);
 
-        // find if not already registered
-        bool isExisting= false;
-        for ( auto& it : triggerList )
-            if ( it.Target == &triggered ) {
-                isExisting= true;
-                break;
-            }
-
-        Ticks now;
-        if(!isExisting )
-        { ALIB_LOCK_RECURSIVE_WITH(monomem::GLOBAL_ALLOCATOR_LOCK)
-            triggerList.emplace_back( &triggered,
-                                     now + ( initialWakeup ? Ticks::Duration()
-                                                           : triggered.triggerPeriod() )  );
+        ALIB_ASSERT_ERROR(    triggered.registeredTrigger == nullptr
+                           || triggered.registeredTrigger == this, "TMOD",
+                           "Triggered object is already added to a different trigger." )
+
+        if( triggered.registeredTrigger == nullptr ) {
+            Ticks now;
+            triggered.registeredTrigger= this;
+            triggered.triggerHeapIndex = integer(wakeupHeap.size());
+            wakeupHeap.push_back( { &triggered,
+                                    now + ( initialWakeup ? Ticks::Duration()
+                                                          : triggered.triggerPeriod() ) } );
+            heapUp( triggered.triggerHeapIndex );
         }
         else
 #if ALIB_STRINGS
@@ -76,12 +113,22 @@ void Trigger::Remove(Triggered &triggered) {
     bool found= false;
 
     { ALIB_LOCK
-        for(auto it= triggerList.begin() ; it != triggerList.end() ; it++) {
-            if(it->Target == &triggered) {
-                found= true;
-                triggerList.erase(it);
-                break;
-    }   }   }
+        if( triggered.registeredTrigger == this ) {
+            found= true;
+            integer idx = triggered.triggerHeapIndex;
+            integer last= integer(wakeupHeap.size()) - 1;
+            if( idx != last ) {
+                wakeupHeap[size_t(idx)]= wakeupHeap.back();
+                wakeupHeap[size_t(idx)].Target->triggerHeapIndex= idx;
+            }
+            wakeupHeap.pop_back();
+            if( idx != last ) {
+                heapUp  ( idx );
+                heapDown( idx );
+            }
+            triggered.registeredTrigger= nullptr;
+            triggered.triggerHeapIndex = -1;
+    }   }
 
     // check
     if(!found) {
@@ -93,6 +140,8 @@ void Trigger::Remove(Triggered &triggered) {
         #endif
 }   }
 
+void Trigger::SetSlack( Ticks::Duration duration )                     { ALIB_LOCK slack= duration; }
+
 void Trigger::Run() {
     ALIB_MESSAGE( "TMOD",  "Internal trigger-thread started" )
     internalThreadMode= true;
@@ -130,20 +179,41 @@ void Trigger::Do(Ticks until)
     while(     (!calledByInternalThread || internalThreadMode )
             &&  now.Reset() < until                                 )
     {
-        // trigger loop
-        Ticks  nextTriggerTime= until;
-        for( auto& it : triggerList ) {
-            // Trigger current?
-            if( it.NextWakeup <= now  ) {
-                it.Target->trigger();
-                now.Reset(); // first we increase now, then we calculate the next wakeup
-                it.NextWakeup= now + it.Target->triggerPeriod();
+        // trigger loop: trigger all objects due until now plus the slack. Each object is
+        // triggered at most once per pass, even if its period is shorter than the time needed.
+        Ticks deadline= now + slack;
+        for( size_t qty= wakeupHeap.size() ; qty > 0 ; --qty ) {
+            TriggerEntry& first= wakeupHeap.front();
+            if( deadline < first.NextWakeup )
+                break;
+
+            // objects triggered once are removed first, because they may be destructed
+            // by their trigger action
+            if( first.Target->triggerOnce ) {
+                Triggered* target= first.Target;
+                target->registeredTrigger= nullptr;
+                target->triggerHeapIndex = -1;
+                wakeupHeap.front()= wakeupHeap.back();
+                wakeupHeap.pop_back();
+                if( !wakeupHeap.empty() ) {
+                    wakeupHeap.front().Target->triggerHeapIndex= 0;
+                    heapDown( 0 );
+                }
+                target->trigger();
+                continue;
             }
 
-            // If earlier than others, use this as the new trigger time
-            nextTriggerTime= (std::min)(nextTriggerTime, it.NextWakeup);
+            first.Target->trigger();
+            now.Reset(); // first we increase now, then we calculate the next wakeup
+            first.NextWakeup= now + first.Target->triggerPeriod();
+            heapDown( 0 );
         }
 
+        // the earliest object defines the next wakeup
+        Ticks  nextTriggerTime= until;
+        if( !wakeupHeap.empty() )
+            nextTriggerTime= (std::min)(nextTriggerTime, wakeupHeap.front().NextWakeup);
+
         // sleep
         wakeUpCondition= false;
         WaitForNotification( nextTriggerTime  ALIB_COMMA_CALLER_PRUNED  );
@@ -7,8 +7,10 @@
 //==================================================================================================
 ALIB_EXPORT namespace alib { namespace threadmodel {
 
-// forward declaration
+// forward declarations
 class Trigger;
+class ThreadPool;
+namespace detail { struct TriggerSleepAwaiter; }
 
 //==================================================================================================
 /// This class declares a simple virtual interface for objects that allow to be triggered
@@ -50,6 +52,17 @@ class Triggered
 
     /// Virtual empty destructor. Needed with any virtual class.
     virtual ~Triggered()                                                                          {}
+
+    /// The trigger that this object is added to. Set and cleared by class \alib{threadmodel;Trigger}.
+    Trigger*        registeredTrigger                                                    = nullptr;
+
+    /// The index of this object in the wakeup heap of #registeredTrigger.
+    integer         triggerHeapIndex                                                          = -1;
+
+    /// If set, this object is removed from the trigger before it is triggered the first time.
+    /// In this case, the trigger does not access the object after invoking #trigger, which
+    /// hence is allowed to destruct it.
+    bool            triggerOnce                                                            = false;
         
     /// Implementations need to return the sleep time, between two trigger events.
     /// Precisely, this method is called after #trigger has been executed and defines the
@@ -99,24 +112,22 @@ class Trigger :   protected   Thread,
     friend class  lang::Owner<Trigger&>;
 
   protected:
-    /// The entry type used with field #triggerList.
+    /// The entry type used with field #wakeupHeap.
     struct TriggerEntry
     {
-        /// Constructor.
-        /// @param target      Assigned to #Target.
-        /// @param nextWakeup  Assigned to #NextWakeup.
-        TriggerEntry(Triggered* target, const Ticks& nextWakeup )
-        : Target(target), NextWakeup(nextWakeup)                                                  {}
-
-        /// Deleted copy constructor (to avoid working on copies accidentally).
-        TriggerEntry(TriggerEntry& )                                                        =delete;
-
         Triggered*  Target;     ///< The triggered object.
         Ticks       NextWakeup; ///< The next wakeup time.
     };
 
-    /// The list of registered triggered objects.
-    ListMA<TriggerEntry>   triggerList;
+    /// The registered triggered objects, organized as a binary min-heap sorted by the next wakeup
+    /// time. The index of each object in the heap is stored in the object itself with field
+    /// \alib{threadmodel;Triggered::triggerHeapIndex}. This way, adding, removing and triggering
+    /// an object is performed in logarithmic time.
+    std::vector<TriggerEntry>           wakeupHeap;
+
+    /// Objects which are due within this duration after the point in time of the next wakeup
+    /// are triggered with this wakeup. Set with #SetSlack.
+    Ticks::Duration                     slack;
 
     /// The condition requested by parent class \alib{threads;TCondition} via a call to
     /// #isConditionMet.
@@ -129,6 +140,16 @@ class Trigger :   protected   Thread,
     /// @return Member #wakeUpCondition
     bool isConditionMet()                                 const noexcept { return wakeUpCondition; }
 
+    /// Moves the heap entry at the given position towards the root, as long as it is due earlier
+    /// than its parent.
+    /// @param idx The index of the entry in #wakeupHeap.
+    ALIB_DLL void   heapUp( integer idx );
+
+    /// Moves the heap entry at the given position towards the leaves, as long as it is due later
+    /// than one of its children.
+    /// @param idx The index of the entry in #wakeupHeap.
+    ALIB_DLL void   heapDown( integer idx );
+
   public:
     /// Constructor.
     ALIB_DLL                Trigger();
@@ -163,15 +184,51 @@ class Trigger :   protected   Thread,
     ALIB_DLL  virtual void  Stop();
 
     /// Add an object to be triggered.
+    /// An object can be added to only one trigger at a time.
     /// @param triggered        The object to be triggered.
     /// @param initialWakeup    If \c true, the first wakeup is scheduled right away.
     ///                         Defaults to \c false.
     ALIB_DLL void           Add( Triggered& triggered, bool initialWakeup= false);
 
     /// Remove a previously added triggered object.
+    /// This method may be invoked from any thread. When it returns, the object is not triggered
+    /// anymore.
     /// @param triggered  The object to be removed from the list.
     ALIB_DLL void           Remove( Triggered& triggered);
 
+    /// Sets the slack used to coalesce wakeups: Objects which are due within the given
+    /// duration after the earliest due object are triggered together with it.
+    /// This reduces the number of wakeups, at the price of triggering objects up to this duration
+    /// too early.<br>
+    /// Defaults to zero, which triggers each object at its due time.
+    /// @param duration The slack to use.
+    ALIB_DLL void           SetSlack( Ticks::Duration duration );
+
+    #if !DOXYGEN
+    void                    SetSlack( Ticks::Duration::TDuration duration )
+    { SetSlack( Ticks::Duration( duration ) ); }
+    #endif
+
+    /// Returns an awaitable object that suspends a \alib{threadmodel;Task} coroutine for the given
+    /// duration, without blocking a thread. The coroutine is continued with a worker of the given
+    /// \p{pool}. This trigger has to be running, either with its internal thread or by invoking
+    /// #Do.
+    ///
+    /// Usage: <c>co_await trigger.Sleep( 10ms, pool );</c>
+    /// @param duration The duration to sleep.
+    /// @param pool     The pool to continue the coroutine with.
+    /// @return The awaiter.
+    inline detail::TriggerSleepAwaiter  Sleep( const Ticks::Duration& duration, ThreadPool& pool );
+
+    #if !DOXYGEN
+    inline detail::TriggerSleepAwaiter  Sleep( const Ticks::Duration::TDuration& duration,
+                                               ThreadPool& pool );
+    #endif
+
+    /// Returns the number of objects added.
+    /// @return The number of triggered objects.
+    integer                 Size()                        { ALIB_LOCK return integer(wakeupHeap.size()); }
+
 }; // Trigger
 
 
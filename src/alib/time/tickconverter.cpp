@@ -33,9 +33,10 @@ void TickConverter::SyncClocks( int qtyRepeats ) {
     Ticks::TTimePoint       steadyClock;
     DateTime::TTimePoint    systemClock;
     uint64_t lastDiff= 0;
+    TicksClock::Synchronize();
     for( int i= 0 ; i < qtyRepeats ; ++i ) {
         systemClock= system_clock::now();
-        steadyClock= steady_clock::now();
+        steadyClock= TicksClock::now();
 
         auto systemCount= systemClock.time_since_epoch().count();
         auto steadyCount= steadyClock.time_since_epoch().count();
@@ -57,6 +57,9 @@ class TickConverter
     /// In other words, the conversion methods always work just as if the system clock had not
     /// changed since the last invocation of this method.
     ///
+    /// If the time stamp counter is used with class \b Ticks, this method first invokes
+    /// \alib{time;TicksClock::Synchronize}.
+    ///
     /// \note
     ///   On a GNU/Linux workstation (without workload), the error observed when doing only one
     ///   measurement was in the magnitude of several microseconds.
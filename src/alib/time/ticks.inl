@@ -27,11 +27,15 @@ ALIB_EXPORT namespace alib {  namespace time {
 ///
 /// The class has no specific interface, but the methods and operators inherited from base
 /// \alib{time;TimePointBase}.
+///
+/// The time points are read with clock \alib{time;TicksClock}, which by default reads
+/// \c std::chrono::steady_clock and optionally may be switched to read the time stamp counter
+/// of the CPU.
 /// @see
 ///   For this class, a \ref alibtools_debug_helpers_gdb "pretty printer" for the
 ///   GNU debugger is provided.
 //==================================================================================================
-class Ticks : public TimePointBase<std::chrono::steady_clock, Ticks>
+class Ticks : public TimePointBase<TicksClock, Ticks>
 {
   public:
 //! @cond NO_DOX
@@ -0,0 +1,29 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+#ifndef HPP_ALIB_TIME_PP
+#define HPP_ALIB_TIME_PP
+#pragma once
+
+#ifndef INL_ALIB
+#   include "alib/alib.inl"
+#endif
+
+//##################################################################################################
+// Symbols introduced by module ALib.Time
+//##################################################################################################
+// The hardware counter read by class TicksClock:
+// 1: the time-stamp counter of x86 CPUs, 2: the virtual counter of aarch64 CPUs, 0: none.
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#   define ALIB_TIME_TSC   1
+#elif defined(__aarch64__) && !defined(_MSC_VER)
+#   define ALIB_TIME_TSC   2
+#else
+#   define ALIB_TIME_TSC   0
+#endif
+
+#endif // HPP_ALIB_TIME_PP
@@ -48,7 +48,7 @@ ALIB_EXPORT namespace alib::time {
 ///
 /// @tparam TClock    The type of clock to use. This will be
 ///                   - \c std::chrono::system_clock with descendant class \alib{time;DateTime} and
-///                   - \c std::chrono::steady_clock with descendant class \alib{time;Ticks}.
+///                   - \alib{time;TicksClock} with descendant class \alib{time;Ticks}.
 /// @tparam TDerived  The derived type itself, hence either \alib{time;DateTime} or
 ///                   \alib{time;Ticks}. This template parameter is needed to define the result
 ///                   type of various methods and operators.
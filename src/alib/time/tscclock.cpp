@@ -0,0 +1,155 @@
+//##################################################################################################
+//  ALib C++ Library
+//
+//  Copyright 2013-2025 A-Worx GmbH, Germany
+//  Published under 'Boost Software License' (a free software license, see LICENSE.txt)
+//##################################################################################################
+#include "alib_precompile.hpp"
+#if !defined(ALIB_C20_MODULES) || ((ALIB_C20_MODULES != 0) && (ALIB_C20_MODULES != 1))
+#   error "Symbol ALIB_C20_MODULES has to be given to the compiler as either 0 or 1"
+#endif
+#if ALIB_C20_MODULES
+    module;
+#endif
+//========================================= Global Fragment ========================================
+#include "alib/alib.inl"
+#include "alib/time/time.prepro.hpp"
+#include <limits>
+#include <thread>
+#if ALIB_TIME_TSC == 1
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+//============================================== Module ============================================
+#if ALIB_C20_MODULES
+    module ALib.Time;
+#else
+#   include "ALib.Time.H"
+#endif
+//========================================== Implementation ========================================
+using namespace std::chrono;
+namespace alib::time {
+
+std::atomic<bool>       TicksClock::useTSC      = false;
+std::atomic<uint32_t>   TicksClock::seq         = 0;
+std::atomic<uint64_t>   TicksClock::tscBase     = 0;
+std::atomic<int64_t>    TicksClock::nanosBase   = 0;
+std::atomic<double>     TicksClock::nanosPerTick= 0.0;
+
+#if !DOXYGEN
+namespace {
+
+// The counter value and steady clock nanoseconds of the calibration. Guarded by the
+// sequence counter being odd.
+uint64_t    tscOrigin;
+int64_t     nanosOrigin;
+
+// Probes both clocks. The steady clock is read between two counter reads and the pair with the
+// smallest distance of the counter reads is chosen.
+void probe( uint64_t& tsc, int64_t& nanos ) {
+    uint64_t best= (std::numeric_limits<uint64_t>::max)();
+    for( int i= 0 ; i < 7 ; ++i ) {
+        uint64_t t1= TicksClock::ReadTSC();
+        int64_t  ns= duration_cast<nanoseconds>( steady_clock::now().time_since_epoch() ).count();
+        uint64_t t2= TicksClock::ReadTSC();
+        if( t2 - t1 < best ) {
+            best = t2 - t1;
+            tsc  = t1 + ( t2 - t1 ) / 2;
+            nanos= ns;
+}   }   }
+
+// Acquires exclusive write access by making the sequence counter odd.
+uint32_t lockSeq( std::atomic<uint32_t>& seq ) {
+    for(;;) {
+        uint32_t s= seq.load( std::memory_order_relaxed );
+        if( (s & 1) == 0 && seq.compare_exchange_weak( s, s + 1, std::memory_order_acquire ) ) {
+            std::atomic_thread_fence( std::memory_order_release );
+            return s + 1;
+        }
+        std::this_thread::yield();
+}   }
+
+} // anonymous namespace
+#endif // !DOXYGEN
+
+bool TicksClock::IsTSCAvailable() {
+    #if ALIB_TIME_TSC == 1
+        // CPUID leaf 0x80000007, EDX bit 8: invariant TSC
+        #if defined(_MSC_VER)
+            int regs[4];
+            __cpuid( regs, int(0x80000000) );
+            if( unsigned(regs[0]) < 0x80000007u )
+                return false;
+            __cpuid( regs, int(0x80000007) );
+            return ( regs[3] & (1 << 8) ) != 0;
+        #else
+            unsigned eax, ebx, ecx, edx;
+            if(    __get_cpuid( 0x80000000u, &eax, &ebx, &ecx, &edx ) == 0
+                || eax < 0x80000007u )
+                return false;
+            __get_cpuid( 0x80000007u, &eax, &ebx, &ecx, &edx );
+            return ( edx & (1u << 8) ) != 0;
+        #endif
+    #elif ALIB_TIME_TSC == 2
+        // the generic timer of ARMv8 runs at a constant frequency
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+bool TicksClock::UseTSC( bool on, int calibrationMillis ) {
+    if( !on || !IsTSCAvailable() ) {
+        useTSC.store( false, std::memory_order_relaxed );
+        return false;
+    }
+
+    uint64_t tsc1, tsc2;
+    int64_t  nanos1, nanos2;
+    probe( tsc1, nanos1 );
+    do {
+        std::this_thread::sleep_for( milliseconds( (std::max)( calibrationMillis, 1 ) ) );
+        probe( tsc2, nanos2 );
+    } while( tsc2 <= tsc1 || nanos2 <= nanos1 );
+
+    uint32_t s= lockSeq( seq );
+    tscOrigin  = tsc1;
+    nanosOrigin= nanos1;
+    tscBase     .store( tsc2  , std::memory_order_relaxed );
+    nanosBase   .store( nanos2, std::memory_order_relaxed );
+    nanosPerTick.store( double( nanos2 - nanos1 ) / double( tsc2 - tsc1 ),
+                        std::memory_order_relaxed );
+    seq.store( s + 1, std::memory_order_release );
+    useTSC.store( true, std::memory_order_relaxed );
+    return true;
+}
+
+void TicksClock::Synchronize() {
+    if( !useTSC.load( std::memory_order_relaxed ) )
+        return;
+    uint64_t tsc;
+    int64_t  nanos;
+    probe( tsc, nanos );
+
+    uint32_t s= lockSeq( seq );
+    uint64_t base= tscBase.load( std::memory_order_relaxed );
+    if( tsc > base && tsc > tscOrigin && nanos > nanosOrigin ) {
+        // The rate measured over the whole time since calibration. The mapping continues
+        // at the current value and uses a corrected rate that reaches the steady clock after
+        // the same number of ticks that passed since the previous synchronization.
+        double  rate  = double( nanos - nanosOrigin ) / double( tsc - tscOrigin );
+        double  ticks = double( tsc - base );
+        int64_t mapped= nanosBase.load( std::memory_order_relaxed )
+                      + int64_t( ticks * nanosPerTick.load( std::memory_order_relaxed ) );
+        double  corrected= rate + double( nanos - mapped ) / ticks;
+        tscBase     .store( tsc   , std::memory_order_relaxed );
+        nanosBase   .store( mapped, std::memory_order_relaxed );
+        nanosPerTick.store( (std::max)( corrected, rate / 2 ), std::memory_order_relaxed );
+    }
+    seq.store( s + 1, std::memory_order_release );
+}
+
+} // namespace [alib::time]
@@ -0,0 +1,145 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of the \aliblong. It does not belong to an \alibmod and is
+/// included in any \alibbuild.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib {  namespace time {
+
+//==================================================================================================
+/// The clock used by class \alib{time;Ticks} (and with that by class \alib{time;StopWatch}).
+/// The type fulfills the requirements of the \c std::chrono clock concept and uses the types
+/// of \c std::chrono::steady_clock for durations and time points.
+///
+/// By default, \c std::chrono::steady_clock is read. With method #UseTSC, the clock is switched
+/// to reading the time stamp counter of the CPU, which is considerably faster: On x86 platforms,
+/// instruction \c rdtsc is used, on ARM64 platforms, register \c cntvct_el0 is read. Only an
+/// <em>invariant</em> time stamp counter, which runs at a constant rate independent of power
+/// management, is used. Method #IsTSCAvailable performs the corresponding run-time check.
+///
+/// The counter values are converted to the time points of \c std::chrono::steady_clock, hence
+/// values read before and after switching the clock source can be mixed.
+/// The conversion is calibrated when the TSC is activated. Method #Synchronize refines the
+/// calibration, taking the time passed since the previous synchronization into account.
+/// It is invoked by \alib{time;TickConverter::SyncClocks} and should be invoked periodically,
+/// e.g., every few minutes, to keep the deviation from \c std::chrono::steady_clock small.
+///
+/// \attention
+///   While the time stamp counter is used, the time points returned are monotonic only for
+///   the values read by one thread. Because the counter is read without serializing
+///   instructions, and because the counters of different CPU cores might differ slightly,
+///   a value read by one thread might be smaller than a value read by another thread shortly
+///   before.<br>
+///   Furthermore, switching the clock source with #UseTSC might step the time points
+///   backwards by the deviation of the two clocks, which is usually below a microsecond.
+///   Therefore, the clock source should be switched only once, at the start of a process,
+///   before time points are compared.
+//==================================================================================================
+class TicksClock
+{
+  public:
+    /// The arithmetic type of durations.
+    using rep        = std::chrono::steady_clock::rep;
+
+    /// The tick period of the clock.
+    using period     = std::chrono::steady_clock::period;
+
+    /// The duration type of the clock.
+    using duration   = std::chrono::steady_clock::duration;
+
+    /// The time point type of the clock. This equals the type of \c std::chrono::steady_clock.
+    using time_point = std::chrono::steady_clock::time_point;
+
+    /// The clock is steady.
+    static constexpr bool is_steady = true;
+
+  protected:
+    /// Denotes whether the time stamp counter is used.
+    static ALIB_DLL std::atomic<bool>       useTSC;
+
+    /// Sequence counter of the conversion parameters. Odd while they are modified.
+    static ALIB_DLL std::atomic<uint32_t>   seq;
+
+    /// The counter value of the last synchronization.
+    static ALIB_DLL std::atomic<uint64_t>   tscBase;
+
+    /// The nanoseconds of \c std::chrono::steady_clock of the last synchronization.
+    static ALIB_DLL std::atomic<int64_t>    nanosBase;
+
+    /// The nanoseconds per counter tick.
+    static ALIB_DLL std::atomic<double>     nanosPerTick;
+
+  public:
+    /// Reads the time stamp counter. Must be invoked only if #IsTSCAvailable returns \c true.
+    /// @return The current counter value.
+    static uint64_t     ReadTSC()                                                        noexcept {
+        #if ALIB_TIME_TSC == 1 && defined(_MSC_VER)
+            return uint64_t( __rdtsc() );
+        #elif ALIB_TIME_TSC == 1
+            return uint64_t( __builtin_ia32_rdtsc() );
+        #elif ALIB_TIME_TSC == 2
+            uint64_t value;
+            __asm__ __volatile__( "mrs %0, cntvct_el0" : "=r"( value ) );
+            return value;
+        #else
+            return 0;
+        #endif
+    }
+
+    /// Returns the current point in time.
+    /// @return The current time point, read from either the time stamp counter or
+    ///         \c std::chrono::steady_clock.
+    static time_point   now()                                                            noexcept {
+        if( !useTSC.load( std::memory_order_relaxed ) )
+            return std::chrono::steady_clock::now();
+        for(;;) {
+            uint32_t s    = seq.load( std::memory_order_acquire );
+            uint64_t tsc  = ReadTSC();
+            uint64_t base = tscBase     .load( std::memory_order_relaxed );
+            int64_t  nanos= nanosBase   .load( std::memory_order_relaxed );
+            double   rate = nanosPerTick.load( std::memory_order_relaxed );
+            std::atomic_thread_fence( std::memory_order_acquire );
+            if( (s & 1) == 0 && seq.load( std::memory_order_relaxed ) == s ) {
+                nanos+= int64_t( double( int64_t( tsc - base ) ) * rate );
+                return time_point( std::chrono::duration_cast<duration>(
+                                                           std::chrono::nanoseconds( nanos ) ) );
+    }   }   }
+
+    /// Tests if the CPU provides an invariant time stamp counter.
+    /// @return \c true if the time stamp counter can be used, \c false otherwise.
+    ALIB_DLL static bool    IsTSCAvailable();
+
+    /// Switches the clock source. When switched on, the conversion of counter values is
+    /// calibrated by probing both clocks before and after the given calibration time.
+    /// Note that switching the source might step the time points returned backwards
+    /// (see the class documentation).
+    /// @param on                The source to use: \c true for the time stamp counter,
+    ///                          \c false for \c std::chrono::steady_clock.
+    ///                          Defaults to \c true.
+    /// @param calibrationMillis The time to spend for calibration. Defaults to \c 5.
+    /// @return \c true if the time stamp counter is used after the call, \c false otherwise.
+    ALIB_DLL static bool    UseTSC( bool on= true, int calibrationMillis= 5 );
+
+    /// Returns whether the time stamp counter is used.
+    /// @return \c true if the time stamp counter is used, \c false otherwise.
+    static bool             IsTSCUsed()              { return useTSC.load( std::memory_order_relaxed ); }
+
+    /// Synchronizes the conversion of counter values with \c std::chrono::steady_clock.
+    /// The rate of the counter is recalculated from the counter and clock values of the
+    /// previous and the current synchronization. The mapping continues at the time point that
+    /// the previous mapping yields for the current counter value. Hence, the time points read
+    /// by one thread never fall below those read by this thread before the synchronization.
+    /// Across threads, this is not guaranteed (see the class documentation).
+    ///
+    /// Does nothing if the time stamp counter is not used.
+    ALIB_DLL static void    Synchronize();
+};
+
+} // namespace alib[::time]
+
+/// Type alias in namespace \b alib.
+using     TicksClock   =    time::TicksClock;
+
+}  // namespace [alib]
@@ -65,6 +65,8 @@ namespace detail
 void ConfigNodeHandler::FreeNode( typename TTree::Node& node, TTree& tree ) {
     // delete node name
     auto& cfg= static_cast<Configuration&>(tree);
+    cfg.deletionCount.fetch_add(1, std::memory_order_release);
+    cfg.bumpModificationCount();
     cfg.Pool.free( const_cast<TTree::CharacterType*>(node.name.storage.Buffer()),
                                                        size_t(node.name.storage.Length()) * sizeof(TTree::CharacterType) );
 
@@ -203,6 +205,7 @@ void Configuration::notifyListeners(  int               event,
                                           const Variable&   variable,
                                           const String&     variablePathGiven,
                                           Priority          previousPriority  ) {
+    bumpModificationCount();
     String256       variablePathBuffer;
     const String*   variablePath= &variablePathGiven;
     for (auto it= listeners.begin() ; it != listeners.end() ; ++it )
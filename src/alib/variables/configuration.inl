@@ -288,7 +288,19 @@ class Configuration : public StringTree<MonoAllocator,detail::Entry, detail::Con
     /// The list of registered listeners.
     ListMA<ListenerRecord>         listeners;
 
+    /// Counts modifications of variables. Increased with each declaration, definition, import
+    /// and deletion of variables.
+    /// @see Method #ModificationCount and class \alib{variables;TVariableHandle}.
+    std::atomic<uinteger>          modificationCount                                            {1};
+
+    /// Counts the removal of nodes from this configuration's \b StringTree.
+    /// @see Method #DeletionCount.
+    std::atomic<uinteger>          deletionCount                                                {1};
+
   //======================================= Protected Methods ======================================
+    /// Increases the modification counter. Invoked with each change of a variable.
+    void bumpModificationCount()   { modificationCount.fetch_add(1, std::memory_order_release); }
+
     /// Implementation of \alib{variables;Configuration::RegisterType}.
     /// @tparam TVMeta    The meta-information type of the type to register.
     template<typename TVMeta>
@@ -570,6 +582,29 @@ class Configuration : public StringTree<MonoAllocator,detail::Entry, detail::Con
     ALIB_DLL
     AString&                  WriteBooleanToken( bool value, int8_t index, AString& dest );
 
+    /// Returns the current value of the modification counter of this configuration.
+    /// The counter is increased with each declaration, definition, import and deletion of a
+    /// variable, as well as with value assignments performed through the assignment operators of
+    /// class \alib{variables;Variable}.
+    ///
+    /// The counter is read with acquire semantics, which pairs with the release increment
+    /// performed after each modification. It is used by class
+    /// \alib{variables;TVariableHandle} to detect whether a cached value is still current.
+    ///
+    /// \note
+    ///   Modifications performed on references received with \alib{variables;Variable::Get}
+    ///   are not detected, unless followed by an invocation of \alib{variables;Variable::Define}.
+    /// @return The current modification count.
+    uinteger                  ModificationCount()                                              const
+    { return modificationCount.load(std::memory_order_acquire); }
+
+    /// Returns the number of nodes that have been removed from this configuration since its
+    /// construction. This counter is used by class \alib{variables;TVariableHandle} to decide
+    /// whether a cursor needs to be re-resolved.
+    /// @return The current deletion count.
+    uinteger                  DeletionCount()                                                  const
+    { return deletionCount.load(std::memory_order_relaxed); }
+
 
   //===================================== Listener Registration ====================================
 
@@ -724,6 +759,7 @@ void detail::ConfigNodeHandler::InitializeNode( typename TTree::Node&  node, TTr
 class Variable : protected Configuration::Cursor
 {
     friend class alib::variables::Configuration;
+    template<typename T> friend class TVariableHandle;
 
     /// The base cursor type of the internal \b StringTree. This type is used to perform
     /// cursor operations on \b Configuration instances.
@@ -751,6 +787,10 @@ class Variable : protected Configuration::Cursor
     /// @return The virtual meta handler.
     inline VMeta* getMeta()                                   const { return Cursor::Value().meta; }
 
+    /// Increases the \alib{variables;Configuration::ModificationCount;modification counter} of
+    /// the configuration. Invoked by the assignment operators after the value was written.
+    void          touch()                       { Tree<Configuration>().bumpModificationCount(); }
+
 
   //################################################################################################
   // Constructors
@@ -1203,11 +1243,11 @@ class Variable : protected Configuration::Cursor
     String&         GetString(int idx) { return Get<StringVectorPA>().at(size_t(idx)); }    ///< @param idx The index of the requested string. @return Calls and returns \ref Get "Get\<StringVectorPA\>().Lines.at(idx)".
     int             Size()             { return int(Get<StringVectorPA>().size()); }        ///< @return Calls and returns \ref Get "Get\<StringVectorPA\>().Lines.size()".
 
-    bool          operator= (bool          val) { return Get<Bool      >()= val; }          ///< Calls \ref Get "Get\<Bool\>()" and assigns \p{val}.                    @param val The value to assign. @return The \p{val} given.
-    integer       operator= (integer       val) { return Get<integer   >()= val; }          ///< Calls \ref Get "Get\<integer\>()" and assigns \p{val}.                 @param val The value to assign. @return The \p{val} given.
-    float         operator= (float         val) { Get<double>()= double(val); return val; } ///< Calls \ref Get "Get\<double\>()" and assigns \p{val}.        @param val The value to assign. @return The \p{val} given.
-    double        operator= (double        val) { return Get<double    >()= val; }          ///< Calls \ref Get "Get\<double\>()" and assigns \p{val}.                  @param val The value to assign. @return The \p{val} given.
-    const String& operator= (const String& val) { return Get<AStringPA>().Reset(val); }     ///< Calls \ref Get "Get\<AStringPA\>()" and resets the string to \p{val}.  @param val The value to assign. @return The \p{val} given.
+    bool          operator= (bool          val) { Get<Bool      >()= val; touch(); return val; }                 ///< Calls \ref Get "Get\<Bool\>()" and assigns \p{val}.                    @param val The value to assign. @return The \p{val} given.
+    integer       operator= (integer       val) { Get<integer   >()= val; touch(); return val; }                 ///< Calls \ref Get "Get\<integer\>()" and assigns \p{val}.                 @param val The value to assign. @return The \p{val} given.
+    float         operator= (float         val) { Get<double>()= double(val); touch(); return val; }             ///< Calls \ref Get "Get\<double\>()" and assigns \p{val}.        @param val The value to assign. @return The \p{val} given.
+    double        operator= (double        val) { Get<double    >()= val; touch(); return val; }                 ///< Calls \ref Get "Get\<double\>()" and assigns \p{val}.                  @param val The value to assign. @return The \p{val} given.
+    const String& operator= (const String& val) { auto& str= Get<AStringPA>().Reset(val); touch(); return str; } ///< Calls \ref Get "Get\<AStringPA\>()" and resets the string to \p{val}.  @param val The value to assign. @return The \p{val} given.
 
 
 
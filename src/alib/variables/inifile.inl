@@ -179,8 +179,7 @@ class IniFile
             /// @param key The key to hash.
             /// @return The hash code.
             std::size_t operator()(const EntryKey& key)                                      const {
-                return    key.SectionName.HashcodeIgnoreCase()
-                        ^ key.EntryName  .HashcodeIgnoreCase();
+                return key.EntryName.HashcodeIgnoreCase( key.SectionName.HashcodeIgnoreCase() );
             }
         };
 
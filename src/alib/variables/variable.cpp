@@ -305,6 +305,7 @@ bool Variable::Try(const String& name, const String& typeName) {
                                           GetConfiguration(),
                                           *escaper,
                                           substitute(Variable(cursor), substBuf, escaper) );
+            touch();
         }
         return true;
     }
@@ -339,6 +340,7 @@ void Variable::Import( const String& src, Priority priority, const StringEscaper
         String512 substBuf;
         getMeta()->imPort( Cursor::Value().data, GetConfiguration(), *escaper,
                            substitute(src, substBuf, escaper) );
+        touch();
 }   }
 
 
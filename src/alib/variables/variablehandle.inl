@@ -0,0 +1,217 @@
+//==================================================================================================
+/// \file
+/// This header-file is part of module \alib_variables of the \aliblong.
+///
+/// \emoji :copyright: 2013-2025 A-Worx GmbH, Germany.
+/// Published under \ref mainpage_license "Boost Software License".
+//==================================================================================================
+ALIB_EXPORT namespace alib {  namespace variables {
+
+namespace detail {
+
+/// Type traits used by class \alib{variables;TVariableHandle}. For each supported value type
+/// \p{T}, the specialization provides the type which is stored in the variable and a method
+/// to decode the value.
+/// @tparam T The type of the cached value.
+template<typename T> struct VHandleTraits;
+
+#if !DOXYGEN
+template<> struct VHandleTraits<bool>
+{
+    using StoredType= Bool;
+    static bool    Decode( const Bool& stored )                           { return stored.Value; }
+};
+
+template<> struct VHandleTraits<integer>
+{
+    using StoredType= integer;
+    static integer Decode( const integer& stored )                              { return stored; }
+};
+
+template<> struct VHandleTraits<double>
+{
+    using StoredType= double;
+    static double  Decode( const double& stored )                               { return stored; }
+};
+
+template<> struct VHandleTraits<String>
+{
+    using StoredType= AStringPA;
+    static String  Decode( const AStringPA& stored )                            { return stored; }
+};
+
+template<> struct VHandleTraits<Box>
+{
+    using StoredType= Box;
+    static Box     Decode( const Box& stored )                                  { return stored; }
+};
+#endif
+} // namespace detail
+
+//==================================================================================================
+/// A lightweight, typed handle to a \alib{variables;Variable}, which caches the decoded value.
+///
+/// The handle is resolved to the node of the variable in the \alib{variables;Configuration}
+/// once, with construction. Each invocation of #Get compares the cached
+/// \alib{variables;Configuration::ModificationCount;modification count} of the configuration
+/// with the current one. Only if the configuration was changed since the last read, the value
+/// is re-fetched from the variable. In case a node of the configuration was deleted in the
+/// meantime, the variable is re-resolved by its name, which includes the search for
+/// \alib{variables;Configuration::PresetImportString;preset values}.
+/// In the usual case, a read hence is nothing more than a relaxed atomic load and a comparison.
+///
+/// Supported types are:
+///
+///  Template Type \p{T} | Variable Type     | Value Stored In Variable
+/// ---------------------|-------------------|-------------------------
+///  <c>bool</c>         | <c>"B"</c>        | \alib{variables;Bool}
+///  \alib{integer}      | <c>"I"</c>        | \alib{integer}
+///  <c>double</c>       | <c>"F"</c>        | <c>double</c>
+///  \alib{String}       | <c>"S"</c>        | \alib{AStringPA}
+///  \alib{boxing;Box}   | <c>"BOX"</c>      | \alib{boxing;Box}
+///
+/// With type \alib{String}, the cached string refers to the buffer of the variable's value.
+/// It remains valid until the next modification of the configuration, which in turn is detected
+/// by the next invocation of #Get.
+///
+/// \attention
+///   The modification counter is only increased by methods of class \b Variable which change
+///   a variable's definition or value, for example \alib{variables;Variable::Define},
+///   \alib{variables;Variable::Import} or the assignment operators. If the value of a
+///   variable is changed using a reference received with \alib{variables;Variable::Get},
+///   this has to be announced by an invocation of \alib{variables;Variable::Define}.
+///
+/// \attention
+///   Instances of this type are not meant to be shared between threads. Each thread should
+///   own its handle. In case the configuration is modified by other threads, the same rules
+///   apply as for using class \b Variable: In case #IsCurrent returns \c false, the configuration
+///   has to be locked while method #Get is invoked. Method #IsCurrent itself may be invoked
+///   without locking.
+///
+/// @tparam T The value type. See the table above for the supported types.
+//==================================================================================================
+template<typename T>
+class TVariableHandle
+{
+  protected:
+    /// The type stored in the variable.
+    using StoredType= typename detail::VHandleTraits<T>::StoredType;
+
+    /// The variable (cursor) this handle is resolved to.
+    Variable        variable;
+
+    /// The name of the variable. Used to re-resolve the variable after deletions.
+    AString         name;
+
+    /// The type name of the variable.
+    String          typeName;
+
+    /// The modification count of the configuration when the value was fetched.
+    uinteger        generation                                                                  =0;
+
+    /// The deletion count of the configuration when the variable was resolved.
+    uinteger        deletions                                                                   =0;
+
+    /// The cached value.
+    T               value                                                                       {};
+
+    /// Denotes if the variable was found with the last resolution.
+    bool            declared                                                                 =true;
+
+    /// Denotes if the variable was declared and defined with the last fetch.
+    bool            defined                                                                 =false;
+
+    /// Re-fetches the value and, if nodes of the configuration had been deleted or the
+    /// variable was not found with the last attempt, re-resolves the variable.
+    void refresh() {
+        Configuration& cfg       = variable.GetConfiguration();
+        uinteger       actualGen = cfg.ModificationCount();
+        uinteger       actualDel = cfg.DeletionCount();
+        if( actualDel != deletions || !declared ) {
+            variable = Variable(cfg);
+            declared = variable.Try( name, typeName );
+            deletions= actualDel;
+        }
+
+        defined= declared && variable.IsDefined();
+        value  = defined ? detail::VHandleTraits<T>::Decode( variable.template Get<StoredType>() )
+                         : T{};
+        generation= actualGen;
+    }
+
+  public:
+    /// Default constructor. A default-constructed handle must not be used before a valid handle
+    /// is assigned.
+    TVariableHandle()                                                                      =default;
+
+    /// Constructs a handle from a declared variable.
+    /// @param declaredVariable The variable to create a handle for.
+    TVariableHandle( const Variable& declaredVariable )
+    : variable ( declaredVariable ) {
+        ALIB_ASSERT_ERROR( variable.IsDeclared(), "VARIABLES",
+                           "Variable handle created from an undeclared variable." )
+        typeName= variable.getMeta()->typeName();
+        variable.Name( name );
+        deletions= variable.GetConfiguration().DeletionCount();
+        refresh();
+    }
+
+    /// Declares the variable and constructs a handle to it.
+    /// @param cfg          The configuration to use.
+    /// @param varName      The name of the variable.
+    /// @param varTypeName  The type of the variable.
+    /// @param defaultValue An optional default value. Defaults to \e nulled string.
+    TVariableHandle( Configuration& cfg,
+                     const String&  varName, const String& varTypeName,
+                     const String&  defaultValue= NULL_STRING )
+    : TVariableHandle( Variable( cfg, varName, varTypeName, defaultValue ) )                      {}
+
+    /// Declares the variable and constructs a handle to it.
+    /// @param cfg  The configuration to use.
+    /// @param decl The declaration to use.
+    TVariableHandle( Configuration& cfg, const Declaration* decl )
+    : TVariableHandle( Variable( cfg, decl ) )                                                    {}
+
+    /// Returns \c true if the cached value reflects the latest modification of the
+    /// configuration. This method performs a relaxed atomic load and does not access the
+    /// variable.
+    /// @return \c true if the cached value is current, \c false if the next invocation of #Get
+    ///         is going to re-fetch the value.
+    bool        IsCurrent()                                                                    const
+    { return generation == variable.GetConfiguration().ModificationCount(); }
+
+    /// Returns the value of the variable. If the configuration was not modified since the last
+    /// invocation, the cached value is returned.
+    /// @return The (cached) value of the variable.
+    const T&    Get() {
+        if( !IsCurrent() )
+            refresh();
+        ALIB_ASSERT_ERROR( defined, "VARIABLES",
+                           "Requesting value from undefined variable \"{}\".", name )
+        return value;
+    }
+
+    /// Implicit cast operator. Calls #Get.
+    /// @return The (cached) value of the variable.
+    operator const T&()                                                           { return Get(); }
+
+    /// Returns \c true if the variable is declared and defined.
+    /// @return \c true if a value is available, \c false otherwise.
+    bool        IsDefined() {
+        if( !IsCurrent() )
+            refresh();
+        return defined;
+    }
+
+    /// Returns the variable that this handle is resolved to.
+    /// @return The variable.
+    Variable&   GetVariable()                                                  { return variable; }
+}; // class TVariableHandle
+
+} // namespace alib[::variables]
+
+/// Type alias in namespace \b alib.
+template<typename T>
+using VariableHandle= variables::TVariableHandle<T>;
+
+}  // namespace [alib]
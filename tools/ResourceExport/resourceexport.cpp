@@ -46,6 +46,10 @@ int main( int argc, const char *argv[] )
     StringEscaperStandard externalizer;
     AString               externalizedValue;
 
+    // with argument "--cpp", C++ code of static resource tables is written instead of
+    // INI-file sections. See class resources::StaticResourceTable.
+    bool cppTables= argc > 1 && NString( argv[1] ).Equals( "--cpp" );
+
     // loop over "sections", which is the first level of nodes
     auto section= pool->Root();
     section.GoToFirstChild();
@@ -56,17 +60,38 @@ int main( int argc, const char *argv[] )
             continue;
 
         // write category
-        cout << endl << '[' << section.Name() << ']' << endl;
+        if( cppTables )
+            cout << endl << "constexpr resources::StaticResourceTable resources"
+                         << section.Name() << "( {" << endl;
+        else
+            cout << endl << '[' << section.Name() << ']' << endl;
 
         // loop over resources in actual category
         auto entry= section.FirstChild();
         while( entry.IsValid() )
         {
             // externalize and write
-            externalizer.Escape( Variable(entry).GetString(), externalizedValue.Reset(), A_CHAR("") );
-            cout << entry.Name() << '=' << externalizedValue  << endl;
+            if( cppTables ) {
+                externalizedValue.Reset();
+                for( character c : Variable(entry).GetString() )
+                    switch( c ) {
+                        case '"'    : externalizedValue << "\\\""; break;
+                        case '\\'   : externalizedValue << "\\\\"; break;
+                        case '\n'   : externalizedValue << "\\n" ; break;
+                        case '\r'   : externalizedValue << "\\r" ; break;
+                        case '\t'   : externalizedValue << "\\t" ; break;
+                        case '\033' : externalizedValue << "\\033"; break;
+                        default     : externalizedValue << c;      break;
+                    }
+                cout << "    { \"" << entry.Name() << "\", A_CHAR(\"" << externalizedValue << "\") }," << endl;
+            } else {
+                externalizer.Escape( Variable(entry).GetString(), externalizedValue.Reset(), A_CHAR("") );
+                cout << entry.Name() << '=' << externalizedValue  << endl;
+            }
             entry.GoToNextSibling();
         }
+        if( cppTables )
+            cout << "} );" << endl;
         section.GoToNextSibling();
     }
 